@@ -80,11 +80,11 @@
 #define SABER_ARCH(arch) (SABER_PRIVATE_ARCH_##arch(arch))
 
 // Type of cpu processor architecture
-// (cpu) := (ARM|X86)
+// (cpu) := (ARM|RISCV|X86)
 #define SABER_CPU(cpu) (SABER_PRIVATE_CPU_##cpu(cpu))
 
 // Tuple of Type/Sizeof cpu processor architecture
-// (cpu, arch) = (ARM|X86, 32|64)
+// (cpu, arch) = (ARM|RISCV|X86, 32|64)
 #define SABER_CPU_ARCH(cpu, arch) (SABER_CPU(cpu) && SABER_ARCH(arch))
 
 // Target OS type for compiled source
@@ -133,6 +133,7 @@
 #undef SABER_PRIVATE_ARCH_64	// 64bits
 
 #undef SABER_PRIVATE_CPU_ARM	// ARM
+#undef SABER_PRIVATE_CPU_RISCV	// RISC-V
 #undef SABER_PRIVATE_CPU_X86	// Intel/AMD
 
 // #undef SABER_PRIVATE_PLATFORM_ANDROID // not yet
@@ -176,6 +177,7 @@
 		#define SABER_PRIVATE_ARCH_32(unused)	1
 		#define SABER_PRIVATE_ARCH_64(unused)	0
 		#define SABER_PRIVATE_CPU_ARM(unused)	0
+		#define SABER_PRIVATE_CPU_RISCV(unused)	0
 		#define SABER_PRIVATE_CPU_X86(unused)	1
 		#define SABER_PRIVATE_ENDIANORDER_BIG(unused) 	 0
 		#define SABER_PRIVATE_ENDIANORDER_LITTLE(unused) 1
@@ -184,6 +186,7 @@
 		#define SABER_PRIVATE_ARCH_32(unused)	0
 		#define SABER_PRIVATE_ARCH_64(unused)	1
 		#define SABER_PRIVATE_CPU_ARM(unused)	0
+		#define SABER_PRIVATE_CPU_RISCV(unused)	0
 		#define SABER_PRIVATE_CPU_X86(unused)	1
 		#define SABER_PRIVATE_ENDIANORDER_BIG(unused) 	 0
 		#define SABER_PRIVATE_ENDIANORDER_LITTLE(unused) 1
@@ -192,6 +195,7 @@
 		#define SABER_PRIVATE_ARCH_32(unused)	1
 		#define SABER_PRIVATE_ARCH_64(unused)	0
 		#define SABER_PRIVATE_CPU_ARM(unused)	1
+		#define SABER_PRIVATE_CPU_RISCV(unused)	0
 		#define SABER_PRIVATE_CPU_X86(unused)	0
 		#define SABER_PRIVATE_ENDIANORDER_BIG(unused) 	 0
 		#define SABER_PRIVATE_ENDIANORDER_LITTLE(unused) 1
@@ -200,6 +204,7 @@
 		#define SABER_PRIVATE_ARCH_32(unused)	0
 		#define SABER_PRIVATE_ARCH_64(unused)	1
 		#define SABER_PRIVATE_CPU_ARM(unused)	1
+		#define SABER_PRIVATE_CPU_RISCV(unused)	0
 		#define SABER_PRIVATE_CPU_X86(unused)	0
 		#define SABER_PRIVATE_ENDIANORDER_BIG(unused) 	 0
 		#define SABER_PRIVATE_ENDIANORDER_LITTLE(unused) 1
@@ -238,6 +243,7 @@
 		#define SABER_PRIVATE_ARCH_32(unused)	0 // Never 32bit
 		#define SABER_PRIVATE_ARCH_64(unused)	1 // Always 64bit
 		#define SABER_PRIVATE_CPU_ARM(unused)	(defined(__aarch64__))
+		#define SABER_PRIVATE_CPU_RISCV(unused)	0
 		#define SABER_PRIVATE_CPU_X86(unused)	(defined(__x86_64__))
 		#define SABER_PRIVATE_ENDIANORDER_BIG(unused) 	 0
 		#define SABER_PRIVATE_ENDIANORDER_LITTLE(unused) 1
@@ -249,6 +255,7 @@
 		#define SABER_PRIVATE_ARCH_32(unused)	0 // Never 32bit
 		#define SABER_PRIVATE_ARCH_64(unused)	1 // Always 64bit
 		#define SABER_PRIVATE_CPU_ARM(unused)	1 // Always ARM
+		#define SABER_PRIVATE_CPU_RISCV(unused)	0
 		#define SABER_PRIVATE_CPU_X86(unused)	0
 		#define SABER_PRIVATE_ENDIANORDER_BIG(unused) 	 0
 		#define SABER_PRIVATE_ENDIANORDER_LITTLE(unused) 1
@@ -261,6 +268,7 @@
 		#define SABER_PRIVATE_ARCH_32(unused)	0 // Never 32bit
 		#define SABER_PRIVATE_ARCH_64(unused)	1 // Always 64bit
 		#define SABER_PRIVATE_CPU_ARM(unused)	(defined(__aarch64__))
+		#define SABER_PRIVATE_CPU_RISCV(unused)	0
 		#define SABER_PRIVATE_CPU_X86(unused)	(defined(__x86_64__))
 		#define SABER_PRIVATE_ENDIANORDER_BIG(unused) 	 0
 		#define SABER_PRIVATE_ENDIANORDER_LITTLE(unused) 1
@@ -302,6 +310,7 @@
 		#define SABER_PRIVATE_ARCH_32(unused)	0
 		#define SABER_PRIVATE_ARCH_64(unused)	1
 		#define SABER_PRIVATE_CPU_ARM(unused)	0
+		#define SABER_PRIVATE_CPU_RISCV(unused)	0
 		#define SABER_PRIVATE_CPU_X86(unused)	1
 		#define SABER_PRIVATE_ENDIANORDER_BIG(unused) 	 0
 		#define SABER_PRIVATE_ENDIANORDER_LITTLE(unused) 1
@@ -310,6 +319,7 @@
 		#define SABER_PRIVATE_ARCH_32(unused)	1
 		#define SABER_PRIVATE_ARCH_64(unused)	0
 		#define SABER_PRIVATE_CPU_ARM(unused)	0
+		#define SABER_PRIVATE_CPU_RISCV(unused)	0
 		#define SABER_PRIVATE_CPU_X86(unused)	1
 		#define SABER_PRIVATE_ENDIANORDER_BIG(unused) 	 0
 		#define SABER_PRIVATE_ENDIANORDER_LITTLE(unused) 1
@@ -318,6 +328,7 @@
 		#define SABER_PRIVATE_ARCH_32(unused)	1
 		#define SABER_PRIVATE_ARCH_64(unused)	0
 		#define SABER_PRIVATE_CPU_ARM(unused)	1
+		#define SABER_PRIVATE_CPU_RISCV(unused)	0
 		#define SABER_PRIVATE_CPU_X86(unused)	0
 		#define SABER_PRIVATE_ENDIANORDER_BIG(unused) 	 0
 		#define SABER_PRIVATE_ENDIANORDER_LITTLE(unused) 1
@@ -326,6 +337,16 @@
 		#define SABER_PRIVATE_ARCH_32(unused)	0
 		#define SABER_PRIVATE_ARCH_64(unused)	1
 		#define SABER_PRIVATE_CPU_ARM(unused)	1
+		#define SABER_PRIVATE_CPU_RISCV(unused)	0
+		#define SABER_PRIVATE_CPU_X86(unused)	0
+		#define SABER_PRIVATE_ENDIANORDER_BIG(unused) 	 0
+		#define SABER_PRIVATE_ENDIANORDER_LITTLE(unused) 1
+
+	#elif defined(__riscv)
+		#define SABER_PRIVATE_ARCH_32(unused)	(__riscv_xlen == 32)
+		#define SABER_PRIVATE_ARCH_64(unused)	(__riscv_xlen == 64)
+		#define SABER_PRIVATE_CPU_ARM(unused)	0
+		#define SABER_PRIVATE_CPU_RISCV(unused)	1
 		#define SABER_PRIVATE_CPU_X86(unused)	0
 		#define SABER_PRIVATE_ENDIANORDER_BIG(unused) 	 0
 		#define SABER_PRIVATE_ENDIANORDER_LITTLE(unused) 1
@@ -0,0 +1,125 @@
+#ifndef SABER_EVENTS_DETAIL_TOKENSLOTS_HPP
+#define SABER_EVENTS_DETAIL_TOKENSLOTS_HPP
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace saber::events::detail {
+
+// `TokenSlots` maps each token to the location of its callback (a generational slot map).
+// A token packs a slot index (low 32 bits) and the slot's generation (high 32 bits);
+// releasing a slot bumps its generation, so a stale token (e.g., double unregister)
+// no longer matches and is rejected in O(1).
+
+template<typename TokenType, typename LocationType, typename Allocator = std::allocator<LocationType>>
+class TokenSlots
+{
+public:
+	using Token = TokenType;
+
+	TokenSlots() = default;
+
+	// Slots are allocated with (a rebound copy of) `inAllocator`
+	explicit TokenSlots(const Allocator& inAllocator) :
+		mSlots(inAllocator),
+		mFreeSlots(inAllocator)
+	{
+	}
+
+	// Allocate a slot holding `inLocation`; reuses released slots first
+	Token Acquire(const LocationType& inLocation)
+	{
+		std::uint32_t slot{};
+		if (mFreeSlots.empty())
+		{
+			slot = static_cast<std::uint32_t>(mSlots.size());
+			mSlots.push_back(Slot{kFirstGeneration, inLocation});
+		}
+		else
+		{
+			slot = mFreeSlots.back();
+			mFreeSlots.pop_back();
+			mSlots[slot].mLocation = inLocation;
+		}
+		return MakeToken(slot, mSlots[slot].mGeneration);
+	}
+
+	// Location of a live token, or nullptr for a stale/unknown token
+	const LocationType* Find(Token inToken) const
+	{
+		const auto slot = SlotOf(inToken);
+		const bool isLive = (slot < mSlots.size()) && (mSlots[slot].mGeneration == GenerationOf(inToken));
+		return isLive ? &mSlots[slot].mLocation : nullptr;
+	}
+
+	// Repoint a live token after its callback moved
+	void Move(Token inToken, const LocationType& inLocation)
+	{
+		mSlots[SlotOf(inToken)].mLocation = inLocation;
+	}
+
+	// Invalidate a live token and recycle its slot
+	void Release(Token inToken)
+	{
+		const auto slot = SlotOf(inToken);
+		auto& generation = mSlots[slot].mGeneration;
+		generation = (generation == kMaxGeneration) ? kFirstGeneration : generation + 1;
+		mSlots[slot].mLocation = LocationType{};
+		mFreeSlots.push_back(slot);
+	}
+
+	// Invalidate every live token whose location matches `inPredicate`, in O(slot count)
+	// NOTE: A released slot holds a default constructed location, which `inPredicate` must not match
+	template<typename Predicate>
+	void ReleaseIf(Predicate&& inPredicate)
+	{
+		for (std::size_t slot = 0; slot < mSlots.size(); ++slot)
+		{
+			if (inPredicate(static_cast<const LocationType&>(mSlots[slot].mLocation)))
+			{
+				Release(MakeToken(static_cast<std::uint32_t>(slot), mSlots[slot].mGeneration));
+			}
+		}
+	}
+
+private:
+	struct Slot
+	{
+		std::uint32_t mGeneration{};
+		LocationType mLocation{};
+	};
+
+	// NOTE: Generations start at 1, so a default constructed `Token{}` never matches a slot
+	static constexpr std::uint32_t kFirstGeneration = 1;
+	static constexpr std::uint32_t kMaxGeneration = ~std::uint32_t{0};
+
+	static Token MakeToken(std::uint32_t inSlot, std::uint32_t inGeneration)
+	{
+		return Token{(static_cast<std::uint64_t>(inGeneration) << 32) | inSlot};
+	}
+
+	static std::uint32_t SlotOf(Token inToken)
+	{
+		return static_cast<std::uint32_t>(inToken.Value());
+	}
+
+	static std::uint32_t GenerationOf(Token inToken)
+	{
+		return static_cast<std::uint32_t>(inToken.Value() >> 32);
+	}
+
+	template<typename T>
+	using VectorType = std::vector<T, typename std::allocator_traits<Allocator>::template rebind_alloc<T>>;
+
+private:
+	VectorType<Slot> mSlots;
+	VectorType<std::uint32_t> mFreeSlots;
+
+}; // class TokenSlots
+
+} // namespace saber::events::detail
+
+#endif // SABER_EVENTS_DETAIL_TOKENSLOTS_HPP
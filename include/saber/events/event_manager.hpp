@@ -3,17 +3,74 @@
 
 // saber
 #include "saber/config.hpp"
+#include "saber/exception.hpp"
 #include "saber/utility.hpp"
+#include "saber/events/detail/token_slots.hpp"
 
 // std
 #include <algorithm>
 #include <any>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <tuple>
+#include <type_traits>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#ifndef SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+// Macro controlling whether `EventManager::Next()` (co_await the next event) is available.
+// Enabled by default when the compiler supports C++20 coroutines (e.g., -std=c++20);
+// to disable it, specify this compiler switch:
+//     -DSABER_EVENTS_CONFIG_ISENABLED_COROUTINE=0
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define SABER_EVENTS_CONFIG_ISENABLED_COROUTINE	1
+#else
+#define SABER_EVENTS_CONFIG_ISENABLED_COROUTINE	0
+#endif
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+#include <coroutine>
+#include <optional>
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+
+#ifndef SABER_EVENTS_CONFIG_ISENABLED_PMR
+// Macro controlling whether `EventManager::Make(std::pmr::memory_resource*)` is available.
+// Enabled by default when the standard library provides <memory_resource>; to disable it,
+// specify this compiler switch:
+//     -DSABER_EVENTS_CONFIG_ISENABLED_PMR=0
+#if defined(__cpp_lib_memory_resource)
+#define SABER_EVENTS_CONFIG_ISENABLED_PMR	1
+#else
+#define SABER_EVENTS_CONFIG_ISENABLED_PMR	0
+#endif
+#endif // SABER_EVENTS_CONFIG_ISENABLED_PMR
+
+#ifndef SABER_EVENTS_CONFIG_ISENABLED_STATS
+// Macro controlling the EventManager instrumentation (see `EventManager::GetStats()`): per event type
+// notify counts and fan-out, and per callback latency histograms. Disabled by default, so it costs nothing;
+// to enable it (consistently, for every translation unit of the program), specify this compiler switch:
+//     -DSABER_EVENTS_CONFIG_ISENABLED_STATS=1
+#define SABER_EVENTS_CONFIG_ISENABLED_STATS	0
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+#include "saber/events/event_stats.hpp"
+#include <chrono>
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
 namespace saber::events {
 
 template<typename SenderType, typename EventType>
@@ -21,6 +78,100 @@ using EventArgsType = std::tuple<const SenderType&, const EventType&>;
 
 class EventManager; // forward declaration
 
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+template<typename SenderType, typename EventType, typename Filter>
+class EventAwaiter; // forward declaration
+
+// Default `EventManager::Next()` filter: accepts every event of the awaited type
+struct AcceptAnyEvent
+{
+	template<typename SenderType, typename EventType>
+	bool operator()(const SenderType&, const EventType&) const
+	{
+		return true;
+	}
+};
+
+namespace detail {
+
+// A coroutine suspended in `co_await EventManager::Next()`: a node of an intrusive, circular,
+// doubly linked list. The node lives in the awaiting coroutine's frame, so waiting needs no
+// heap allocation, and a node unlinks itself when destroyed (e.g., its coroutine is destroyed).
+struct AwaiterNode
+{
+	// Tests the awaiter's filter against the notified event, keeping the event if accepted
+	using TryResumeType = bool(*)(AwaiterNode& ioNode, const std::any& inArgs);
+
+	AwaiterNode() = default;
+	AwaiterNode(std::type_index inArgsType, TryResumeType inTryResume) :
+		mArgsType{inArgsType},
+		mTryResume{inTryResume}
+	{
+	}
+
+	~AwaiterNode()
+	{
+		Unlink();
+	}
+
+	// Linked nodes are referenced by address: never copied or moved
+	AwaiterNode(const AwaiterNode&) = delete;
+	AwaiterNode& operator=(const AwaiterNode&) = delete;
+
+	bool IsLinked() const
+	{
+		return mNext != this;
+	}
+
+	void LinkBefore(AwaiterNode& ioNext)
+	{
+		mPrev = ioNext.mPrev;
+		mNext = &ioNext;
+		mPrev->mNext = this;
+		ioNext.mPrev = this;
+	}
+
+	void Unlink()
+	{
+		mPrev->mNext = mNext;
+		mNext->mPrev = mPrev;
+		mPrev = this;
+		mNext = this;
+	}
+
+	AwaiterNode* mPrev{this};
+	AwaiterNode* mNext{this};
+	std::type_index mArgsType{typeid(void)};
+	TryResumeType mTryResume{};
+	std::coroutine_handle<> mHandle{};
+};
+
+} // namespace detail
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+
+// Coalescing policy of an event type, used while a coalescing window is open
+// (see: `EventManager::BeginWindow()`). Repeated notifications of the same
+// (sender, event type) inside the window merge into one delivery when it ends.
+enum class CoalesceKind
+{
+	kNone,		// Every notification is delivered immediately (default)
+	kLastWins,	// Only the last notification in the window is delivered
+	kMerge		// Notifications are folded with `CoalesceTraits<EventType>::Merge()`
+};
+
+// Specialize to opt an event type into coalescing, e.g.:
+//     template<>
+//     struct saber::events::CoalesceTraits<ScrollEvent>
+//     {
+//         static constexpr CoalesceKind kKind = CoalesceKind::kMerge;
+//         static void Merge(ScrollEvent& ioPending, const ScrollEvent& inNext) { ioPending.mDelta += inNext.mDelta; }
+//     };
+template<typename EventType>
+struct CoalesceTraits
+{
+	static constexpr CoalesceKind kKind = CoalesceKind::kNone;
+};
+
 // The `EventCallback` class type-erases a user-provided callable (e.g., a
 // lambda) and provides a uniform `int operator()(std::any)` entry point that
 // can be invoked by the event system regardless of the concrete event type.
@@ -58,6 +209,11 @@ private:
 		return mTypeIndex;
 	}
 
+	std::type_index GetSenderTypeIndex() const
+	{
+		return mSenderTypeIndex;
+	}
+
 	// Constructor template: capture any callable `Lambda` that accepts
 	// `(const SenderType&, const EventType&)` and returns `int`. We store the
 	// callable in `mCallback` (as `std::any`) and create a small trampoline
@@ -71,6 +227,8 @@ private:
 
 		mTypeIndex{typeid(EventArgsType<SenderType, EventType>)}, // store the type_index of the event args
 
+		mSenderTypeIndex{typeid(SenderType)}, // store the type_index of the sender, for sender-scoped registration
+
 		// trampoline: casts the erased callable and erased event back to
 		// their concrete types and invokes the callable.
 		mInvoke{+[](const std::any& inCallback, const std::any& inArgs)
@@ -96,6 +254,8 @@ private:
 	std::any mCallback{};
 	// Stores the type_index of the EventArgsType<SenderType, EventType>
 	std::type_index mTypeIndex{typeid(void)}; 
+	// Stores the type_index of the SenderType
+	std::type_index mSenderTypeIndex{typeid(void)};
 	// Pointer to the trampoline function that knows how to cast and
 	// invoke `mCallback` for the correct `EventType`.
 	CallbackType mInvoke{};
@@ -111,6 +271,27 @@ public:
 public:
 	static std::unique_ptr<EventManager> Make();
 
+#if SABER_EVENTS_CONFIG_ISENABLED_PMR
+	// As Make(), allocating the manager's own storage (dispatch table, callback lists, pending changes,
+	// held events) from `ioResource`, rather than the global heap. E.g., a per-manager pool:
+	//     std::pmr::unsynchronized_pool_resource pool;
+	//     auto manager = EventManager::Make(&pool);
+	// `ioResource` must outlive the manager; it is used without locking, by the thread using the manager.
+	// NOTE: Three allocations bypass `ioResource`: callables (type-erased by EventCallback::Make()), the
+	// `std::any` payloads of held events, and events forwarded between shards (see MakeSharded()).
+	static std::unique_ptr<EventManager> Make(std::pmr::memory_resource* ioResource);
+#endif // SABER_EVENTS_CONFIG_ISENABLED_PMR
+
+	// Sharded for many notifying threads: each thread gets its own shard (callback lists, coalescing
+	// window, awaiters), so Notify() dispatches to the calling thread's callbacks without locking.
+	// Callbacks run on the thread that registered them (thread affinity): an event notified on one thread
+	// is forwarded to the other shards with callbacks for its type, and delivered there by the owning
+	// thread's DispatchForwarded(). Unregister() must be called on the registering thread.
+	// A thread's shard is destroyed when the thread exits: with its callbacks (whose tokens become stale),
+	// its undelivered events and its instrumentation counters.
+	// NOTE: Forwarded events are held by copy; their senders must outlive the delivery.
+	static std::unique_ptr<EventManager> MakeSharded();
+
 	virtual ~EventManager() = default;
 
 public:
@@ -118,20 +299,101 @@ public:
 
 	[[nodiscard]] Token Register(const EventCallback& inCallback); // Observe
 
+	// Sender-scoped: the callback only runs for events notified by `inSender` (compared by address)
+	template<typename SenderType>
+	[[nodiscard]] Token Register(EventCallback&& ioCallback, const SenderType* inSender); // Consume
+
+	template<typename SenderType>
+	[[nodiscard]] Token Register(const EventCallback& inCallback, const SenderType* inSender); // Observe
+
 	void Unregister(Token inToken);
 
 	template<typename SenderType, typename EventType>
 	void Notify(SenderType& inSender, const EventType& inEvent);
 
+	// Open a coalescing window (windows nest). Until the outermost window ends, events whose
+	// `CoalesceTraits<>` coalesce are held, one per (sender, event type), and delivered by EndWindow()
+	// in the order they were first notified. NOTE: their senders must outlive the window.
+	void BeginWindow();
+
+	void EndWindow();
+
+	// Deliver the events forwarded to the calling thread's callbacks by other threads' Notify(),
+	// returning how many were delivered. Always 0 for a manager that is not sharded.
+	std::size_t DispatchForwarded();
+
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+	// Snapshot of the instrumentation counters, e.g., to find slow callbacks: `GetStats().ToJson()`.
+	// Counters are recorded without locking, and may be snapshot from any thread.
+	EventStats GetStats();
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+	// co_await the next event of (SenderType, EventType) accepted by `inFilter(sender, event)`,
+	// instead of registering a one-shot callback. Use it like this:
+	//     const DamageEvent damage = co_await manager->Next<Player, DamageEvent>(
+	//         [&player](const Player& inSender, const DamageEvent&){return &inSender == &player;});
+	// The coroutine resumes inline, within the Notify() of that event (after its callbacks);
+	// coalesced events resume it when the coalescing window ends. The filter must not notify.
+	template<typename SenderType, typename EventType, typename Filter = AcceptAnyEvent>
+	[[nodiscard]] EventAwaiter<SenderType, EventType, Filter> Next(Filter inFilter = {});
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+
 protected:
 	EventManager() = default;
 
+	// Delivers a held event: recovers its concrete sender/event types
+	using DeliverType = void(*)(EventManager& ioManager, const void* inSender, const std::any& inEvent);
+
+	template<typename SenderType, typename EventType>
+	static void Deliver(EventManager& ioManager, const void* inSender, const std::any& inEvent);
+
+	// Copies the event out of notified args, to hold it (empty if the event is not copyable)
+	using CaptureType = std::any(*)(const std::any& inArgs);
+
+	template<typename SenderType, typename EventType>
+	static std::any Capture(const std::any& inArgs);
+
+	// Type-erased operations on the events of one (SenderType, EventType)
+	struct EventOps
+	{
+		CaptureType mCapture{};
+		DeliverType mDeliver{};
+	};
+
+	template<typename SenderType, typename EventType>
+	static const EventOps& GetEventOps();
+
 private:
-	virtual Token OnRegister(std::type_index inArgsType, EventCallback&& ioCallback) = 0;
+	// `inSender` is nullptr for callbacks of any sender
+	virtual Token OnRegister(std::type_index inArgsType, const void* inSender, EventCallback&& ioCallback) = 0;
 
 	virtual void OnUnregister(Token inToken) = 0;
 
-	virtual void OnNotify(std::any inArgs) = 0;
+	virtual void OnNotify(const void* inSender, std::any inArgs, const EventOps& inOps) = 0;
+
+	// Held event of (inSender, inArgsType) to merge into (empty when first notified in the window),
+	// or nullptr when no window is open
+	virtual std::any* OnCoalesce(const void* inSender, std::type_index inArgsType, DeliverType inDeliver) = 0;
+
+	virtual void OnBeginWindow() = 0;
+
+	virtual void OnEndWindow() = 0;
+
+	virtual std::size_t OnDispatchForwarded() = 0;
+
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+	// Append this manager's counters to `ioStats`
+	virtual void OnGetStats(EventStats& ioStats) = 0;
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+	template<typename SenderType, typename EventType, typename Filter>
+	friend class EventAwaiter; // allow awaiters to suspend on this EventManager
+
+	// Link a suspended awaiter; it is unlinked when its event is notified
+	virtual void OnAwait(detail::AwaiterNode& ioAwaiter) = 0;
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
 
 }; // class EventManager
 
@@ -141,7 +403,7 @@ inline EventManager::Token EventManager::Register(EventCallback&& ioCallback) //
 	// TRICKY: virtuals are unable to accept template types, so use typeid and std::type_index
 	// to allow us to find callbacks of a certain type from the callback list
 	std::type_index eventType = ioCallback.GetTypeIndex(); // use the template params
-	return OnRegister(eventType, std::move(ioCallback));
+	return OnRegister(eventType, nullptr, std::move(ioCallback));
 }
 
 inline EventManager::Token EventManager::Register(const EventCallback& inCallback) // Observe
@@ -150,7 +412,23 @@ inline EventManager::Token EventManager::Register(const EventCallback& inCallbac
 	// to allow us to find callbacks of a certain type from the callback list
 	EventCallback copy{inCallback}; // explicit copy
 	std::type_index eventType = inCallback.GetTypeIndex(); // use the template params
-    return OnRegister(eventType, std::move(copy));
+    return OnRegister(eventType, nullptr, std::move(copy));
+}
+
+template<typename SenderType>
+inline EventManager::Token EventManager::Register(EventCallback&& ioCallback, const SenderType* inSender) // Consume
+{
+	SABER_REQUIRE(inSender != nullptr);
+	SABER_REQUIRE(ioCallback.GetSenderTypeIndex() == std::type_index{typeid(SenderType)});
+	std::type_index eventType = ioCallback.GetTypeIndex(); // use the template params
+	return OnRegister(eventType, inSender, std::move(ioCallback));
+}
+
+template<typename SenderType>
+inline EventManager::Token EventManager::Register(const EventCallback& inCallback, const SenderType* inSender) // Observe
+{
+	EventCallback copy{inCallback}; // explicit copy
+	return Register(std::move(copy), inSender);
 }
 
 inline void EventManager::Unregister(Token inToken)
@@ -161,78 +439,415 @@ inline void EventManager::Unregister(Token inToken)
 template<typename SenderType, typename EventType>
 inline void EventManager::Notify(SenderType& inSender, const EventType& inEvent)
 {
+	const void* sender = std::addressof(inSender);
+	constexpr CoalesceKind kCoalesce = CoalesceTraits<EventType>::kKind;
+	if constexpr (kCoalesce != CoalesceKind::kNone)
+	{
+		static_assert(std::is_copy_constructible_v<EventType>, "Coalesced events are held by copy");
+		std::any* pending = OnCoalesce(sender, typeid(EventArgsType<SenderType, EventType>), &Deliver<SenderType, EventType>);
+		if (pending != nullptr)
+		{
+			if constexpr (kCoalesce == CoalesceKind::kMerge)
+			{
+				if (pending->has_value())
+				{
+					CoalesceTraits<EventType>::Merge(std::any_cast<EventType&>(*pending), inEvent);
+					return;
+				}
+			}
+			*pending = inEvent; // Explicit copy
+			return;
+		}
+	}
+
 	EventArgsType<SenderType, EventType> args{inSender, inEvent};
-	OnNotify(std::any{args}); // Explicit copy
+	OnNotify(sender, std::any{args}, GetEventOps<SenderType, EventType>()); // Explicit copy
+}
+
+inline void EventManager::BeginWindow()
+{
+	OnBeginWindow();
+}
+
+inline void EventManager::EndWindow()
+{
+	OnEndWindow();
+}
+
+inline std::size_t EventManager::DispatchForwarded()
+{
+	return OnDispatchForwarded();
+}
+
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+inline EventStats EventManager::GetStats()
+{
+	EventStats result{};
+	OnGetStats(result);
+	return result;
+}
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
+template<typename SenderType, typename EventType>
+inline /*static*/ void EventManager::Deliver(EventManager& ioManager, const void* inSender, const std::any& inEvent)
+{
+	const auto& sender = *static_cast<const SenderType*>(inSender);
+	EventArgsType<SenderType, EventType> args{sender, std::any_cast<const EventType&>(inEvent)};
+	ioManager.OnNotify(inSender, std::any{args}, GetEventOps<SenderType, EventType>()); // Explicit copy
+}
+
+template<typename SenderType, typename EventType>
+inline /*static*/ std::any EventManager::Capture(const std::any& inArgs)
+{
+	if constexpr (std::is_copy_constructible_v<EventType>)
+	{
+		const auto& args = std::any_cast<const EventArgsType<SenderType, EventType>&>(inArgs);
+		return std::any{std::get<1>(args)}; // Explicit copy
+	}
+	else
+	{
+		return std::any{};
+	}
+}
+
+template<typename SenderType, typename EventType>
+inline /*static*/ auto EventManager::GetEventOps() -> const EventOps&
+{
+	static constexpr EventOps kOps{&Capture<SenderType, EventType>, &Deliver<SenderType, EventType>};
+	return kOps;
+}
+
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+// Awaitable returned by `EventManager::Next()`
+template<typename SenderType, typename EventType, typename Filter>
+class EventAwaiter : private detail::AwaiterNode
+{
+public:
+	EventAwaiter(EventManager& ioManager, Filter inFilter) :
+		detail::AwaiterNode{typeid(EventArgsType<SenderType, EventType>), &TryResume},
+		mManager{ioManager},
+		mFilter{std::move(inFilter)}
+	{
+	}
+
+	bool await_ready() const noexcept
+	{
+		return false;
+	}
+
+	void await_suspend(std::coroutine_handle<> inHandle)
+	{
+		mHandle = inHandle;
+		mManager.OnAwait(*this);
+	}
+
+	EventType await_resume()
+	{
+		return std::move(*mEvent);
+	}
+
+private:
+	static bool TryResume(detail::AwaiterNode& ioNode, const std::any& inArgs)
+	{
+		auto& self = static_cast<EventAwaiter&>(ioNode);
+		const auto& [sender, event] = std::any_cast<const EventArgsType<SenderType, EventType>&>(inArgs);
+		if (!self.mFilter(sender, event))
+		{
+			return false;
+		}
+		self.mEvent.emplace(event); // Explicit copy: the event only lives for the Notify()
+		return true;
+	}
+
+private:
+	EventManager& mManager;
+	Filter mFilter;
+	std::optional<EventType> mEvent{};
+};
+
+template<typename SenderType, typename EventType, typename Filter>
+inline EventAwaiter<SenderType, EventType, Filter> EventManager::Next(Filter inFilter)
+{
+	static_assert(std::is_invocable_r_v<bool, Filter, const SenderType&, const EventType&>);
+	return EventAwaiter<SenderType, EventType, Filter>{*this, std::move(inFilter)};
 }
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
 
 namespace detail {
 
+// Callbacks are dispatched by (args type, sender address): Notify() only visits the
+// callbacks of its sender, and those registered for any sender (sender: nullptr)
+
+struct DispatchKey
+{
+	std::type_index mArgsType{typeid(void)};
+	const void* mSender{};
+
+	bool operator==(const DispatchKey& inOther) const
+	{
+		return (mArgsType == inOther.mArgsType) && (mSender == inOther.mSender);
+	}
+};
+
+struct DispatchKeyHash
+{
+	std::size_t operator()(const DispatchKey& inKey) const
+	{
+		const std::size_t typeHash = std::hash<std::type_index>{}(inKey.mArgsType);
+		const std::size_t senderHash = std::hash<const void*>{}(inKey.mSender);
+		return typeHash ^ (senderHash + 0x9e3779b9 + (typeHash << 6) + (typeHash >> 2)); // boost::hash_combine
+	}
+};
+
+// Allocator of an EventManagerImpl's storage
+#if SABER_EVENTS_CONFIG_ISENABLED_PMR
+using EventAllocator = std::pmr::polymorphic_allocator<std::byte>;
+#else
+using EventAllocator = std::allocator<std::byte>;
+#endif // SABER_EVENTS_CONFIG_ISENABLED_PMR
+
+template<typename T>
+using EventVector = std::vector<T, typename std::allocator_traits<EventAllocator>::template rebind_alloc<T>>;
+
+template<typename T>
+using DispatchKeyMap = std::unordered_map<DispatchKey, T, DispatchKeyHash, std::equal_to<DispatchKey>,
+	typename std::allocator_traits<EventAllocator>::template rebind_alloc<std::pair<const DispatchKey, T>>>;
+
 class EventManagerImpl final : public EventManager // EventManagerImpl is-a EventManager
 {
 public:
-	~EventManagerImpl() override = default;
+	~EventManagerImpl() override;
 
 private:
 	friend class EventManager; // allow Make() to construct it
-    EventManagerImpl() = default;
+	friend class ShardedEventManagerImpl; // shards are EventManagerImpls
+	explicit EventManagerImpl(const EventAllocator& inAllocator = EventAllocator{});
 
 private:
-	Token OnRegister(std::type_index inArgsType, EventCallback&& ioCallback) override;
+	Token OnRegister(std::type_index inArgsType, const void* inSender, EventCallback&& ioCallback) override;
 
 	void OnUnregister(Token inToken) override;
 
-	void OnNotify(std::any inArgs) override;
+	void OnNotify(const void* inSender, std::any inArgs, const EventOps& inOps) override;
+
+	std::any* OnCoalesce(const void* inSender, std::type_index inArgsType, DeliverType inDeliver) override;
+
+	void OnBeginWindow() override;
+
+	void OnEndWindow() override;
+
+	std::size_t OnDispatchForwarded() override;
+
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+	void OnGetStats(EventStats& ioStats) override;
+
+	// Record of `inArgsType`, made on its first notify
+	EventTypeRecord& GetTypeRecord(std::type_index inArgsType);
+
+	// Report `inToken`'s callback as `inReportedToken` (e.g., the sharded manager's token)
+	void SetReportedToken(Token inToken, Token inReportedToken);
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
+	// Close a coalescing window, delivering its held events through `ioManager`
+	void CloseWindow(EventManager& ioManager);
+
+	// Apply the Register/Unregister calls made during Notify()
+	void ApplyPending();
+
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+	void OnAwait(AwaiterNode& ioAwaiter) override;
+
+	// Resume the coroutines awaiting the event of `inArgs`
+	void ResumeAwaiters(const std::any& inArgs);
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
 
 private:
-	std::uint64_t mCounter{ 0 }; // Counter to generate unique tokens
+	struct CallbackEntry
+	{
+		Token mToken{};
+		EventCallback mCallback;
+		bool mIsLive{true}; // false: unregistered during Notify(); removed once the outermost Notify() returns
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+		std::shared_ptr<HandlerRecord> mRecord{};
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+	};
+
+	// Each dispatch bucket is a dense list of the callbacks for one (args type, sender)
+	struct CallbackList
+	{
+		// Allocator-aware: the dispatch map constructs its buckets with its own allocator
+		using allocator_type = EventAllocator;
+
+		CallbackList() = default;
+
+		explicit CallbackList(const allocator_type& inAllocator) :
+			mEntries(inAllocator),
+			mAdded(inAllocator)
+		{
+		}
+
+		EventVector<CallbackEntry> mEntries{};
+		EventVector<CallbackEntry> mAdded{}; // Registered during Notify(); appended once the outermost Notify() returns
+		bool mIsDirty{false}; // Has changes pending (listed in `mDirty`)
+	};
 
-	using CallbackList = std::vector<std::tuple<Token, std::type_index, EventCallback>>;
-	using CallbackElement = CallbackList::value_type;
-	std::shared_ptr<CallbackList> mCallbackList{ std::make_shared<CallbackList>() };
+	using DispatchMap = DispatchKeyMap<CallbackList>;
+	using Bucket = DispatchMap::value_type;
 
-	// GetCallbackListOrCopy() enforces Copy On Write safety for the callback list
-	CallbackList& GetCallbackListOrCopy()
+	// NOTE: Pointers to unordered_map elements stay valid across rehashing
+	struct Location
 	{
-		// NOTE: use_count() is not thread-safe; use_count() checks assume no concurrent access
+		Bucket* mBucket{};
+		std::size_t mIndex{};
+		bool mIsAdded{}; // index into `mAdded`, rather than `mEntries`
+	};
+
+	// Counts the Notify() depth; once the outermost Notify() returns (or throws), applies the pending changes
+	class NotifyScope
+	{
+	public:
+		explicit NotifyScope(EventManagerImpl& ioManager) :
+			mManager{ioManager}
+		{
+			++mManager.mNotifyDepth;
+		}
+
+		~NotifyScope()
 		{
-			const bool isNotifying = (mCallbackList.use_count() > 1);
-    		if (isNotifying)
+			if (--mManager.mNotifyDepth == 0 && !mManager.mDirty.empty())
 			{
-				// Copy-on-write: make copy of in-flight callbacklist...
-				// The use_count() of this new copy in mCallbackList becomes: "==1"
-				// The use_count() of the previous mCallback instance is now: "-=1"
-				mCallbackList = std::make_shared<CallbackList>(*mCallbackList);
+				mManager.ApplyPending();
 			}
 		}
 
-		return *mCallbackList;
+		NotifyScope(const NotifyScope&) = delete;
+		NotifyScope& operator=(const NotifyScope&) = delete;
+
+	private:
+		EventManagerImpl& mManager;
+	};
+
+	void MarkDirty(Bucket& ioBucket)
+	{
+		if (!ioBucket.second.mIsDirty)
+		{
+			ioBucket.second.mIsDirty = true;
+			mDirty.push_back(&ioBucket);
+		}
 	}
 
+	EventAllocator mAllocator;
+	DispatchMap mDispatch;
+	TokenSlots<Token, Location, EventAllocator> mTokenSlots; // Token -> (bucket, index into its callback list)
+
+	// Pending changes log: Register/Unregister calls during Notify() are O(1), and never copy a callback list
+	std::size_t mNotifyDepth{0};
+	EventVector<Bucket*> mDirty;
+
+	// Coalescing window: held events, in first notified order, and their index by (args type, sender)
+	struct PendingEvent
+	{
+		const void* mSender{};
+		std::any mEvent{};
+		DeliverType mDeliver{};
+	};
+
+	std::size_t mWindowDepth{0};
+	EventVector<PendingEvent> mPending;
+	DispatchKeyMap<std::size_t> mPendingIndex;
+
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+	AwaiterNode mAwaiters{}; // Sentinel of the suspended awaiters
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+	// Records are only added/removed by the thread using this manager, under `mStatsMutex`; so that thread
+	// reads them without locking, while OnGetStats() (from any thread) locks
+	std::mutex mStatsMutex{};
+	std::unordered_map<std::type_index, std::unique_ptr<EventTypeRecord>> mTypeRecords{};
+	std::unordered_map<std::uint64_t, std::shared_ptr<HandlerRecord>> mHandlerRecords{}; // By token
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
 }; // class EventManagerImpl
 
-inline EventManager::Token EventManagerImpl::OnRegister(std::type_index inArgsType, EventCallback&& ioCallback)
+inline EventManagerImpl::EventManagerImpl(const EventAllocator& inAllocator) :
+	mAllocator{inAllocator},
+	mDispatch(inAllocator),
+	mTokenSlots(inAllocator),
+	mDirty(inAllocator),
+	mPending(inAllocator),
+	mPendingIndex(inAllocator)
+{
+}
+
+inline EventManagerImpl::~EventManagerImpl()
+{
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+	// Awaiting coroutines are never resumed; detach them, so their frames don't reference this manager
+	while (mAwaiters.IsLinked())
+	{
+		mAwaiters.mNext->Unlink();
+	}
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+}
+
+inline EventManager::Token EventManagerImpl::OnRegister(std::type_index inArgsType, const void* inSender, EventCallback&& ioCallback)
 {
-	Token newToken{ mCounter++ }; // Create a unique token
-	auto& callbackList = GetCallbackListOrCopy();
-	callbackList.emplace_back(newToken, inArgsType, std::move(ioCallback));
+	auto& bucket = *mDispatch.try_emplace(DispatchKey{inArgsType, inSender}).first;
+
+	// TRICKY: Callbacks registered during Notify() are held aside, so the lists being notified never reallocate
+	const bool isNotifying = (mNotifyDepth > 0);
+	auto& entries = isNotifying ? bucket.second.mAdded : bucket.second.mEntries;
+	const Token newToken = mTokenSlots.Acquire(Location{&bucket, entries.size(), isNotifying}); // Create a unique token
+	entries.push_back(CallbackEntry{newToken, std::move(ioCallback)});
+	if (isNotifying)
+	{
+		MarkDirty(bucket);
+	}
+
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+	auto record = std::make_shared<HandlerRecord>();
+	record->mToken = newToken.Value();
+	record->mArgsType = inArgsType;
+	entries.back().mRecord = record;
+	{
+		std::lock_guard<std::mutex> lock{mStatsMutex};
+		mHandlerRecords.emplace(newToken.Value(), std::move(record));
+	}
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
 	return newToken;
 }
 
 inline void EventManagerImpl::OnUnregister(Token inToken)
 {
-	// Search for the token in list and remove it
-	auto& callbackList = GetCallbackListOrCopy();
-	auto isTargetToken = [inToken](const CallbackElement& element)
+	// O(1) lookup of the token's element; a stale token (e.g., already unregistered) is ignored
+	const auto* location = mTokenSlots.Find(inToken);
+	if (location == nullptr)
 	{
-		const bool isTarget = std::get<0>(element) == inToken;
-		return isTarget;
-	};
+		return;
+	}
 
-	// There will only ever be one matching token, therefore, we can use std::find_if to
-	// find the first matching token and erase it without needing to go through the entire list with std::remove_if
-	const auto didFind = std::find_if(callbackList.begin(), callbackList.end(), isTargetToken);
+	const auto [bucket, index, isAdded] = *location;
+	mTokenSlots.Release(inToken);
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+	{
+		std::lock_guard<std::mutex> lock{mStatsMutex};
+		mHandlerRecords.erase(inToken.Value());
+	}
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
+	if (mNotifyDepth > 0)
+	{
+		// TRICKY: The callback may be the one running (unregistering itself), so it is not destroyed
+		// here: Notify() skips it, and ApplyPending() removes it
+		auto& entries = isAdded ? bucket->second.mAdded : bucket->second.mEntries;
+		entries[index].mIsLive = false;
+		MarkDirty(*bucket);
+		return;
+	}
 
-	if (didFind != callbackList.end())
+	auto& callbackList = bucket->second.mEntries; // Nothing is pending outside of Notify()
+	if (index != callbackList.size() - 1)
 	{
 		// REVISIT: Move assign might throw an exception?
 		// If so, we might have to do something like this:
@@ -240,43 +855,729 @@ inline void EventManagerImpl::OnUnregister(Token inToken)
 		//		callbackList.pop_back();
 
 		// Use an optimal O(1) removal for performance; note that list order is not considered important
-		*didFind = std::move(callbackList.back());
-		callbackList.pop_back(); // Remove the last element
+		callbackList[index] = std::move(callbackList.back());
+		mTokenSlots.Move(callbackList[index].mToken, Location{bucket, index, false});
+	}
+	callbackList.pop_back(); // Remove the last element
+
+	if (callbackList.empty())
+	{
+		// Don't accumulate buckets of transient senders
+		const DispatchKey key = bucket->first; // copy: erase() destroys the element
+		mDispatch.erase(key);
 	}
 }
 
-inline void EventManagerImpl::OnNotify(std::any inArgs)
+inline void EventManagerImpl::OnNotify(const void* inSender, std::any inArgs, const EventOps& /*inOps*/)
 {
-    // "snapshot" the current state of the mCallbackList...
-    // This protects against modification of mCallbackList due to
-    // re-entrant Register/Unregister calls during OnNotify()
-
+	// The sender's callbacks, then those of any sender
 	const std::type_index targetType = inArgs.type();
-	auto snapshot = mCallbackList;
-	auto findAllCallbacks = [&inArgs, &targetType](const auto& element) -> void
+	CallbackList* callbackLists[2]{};
+	const DispatchKey keys[2]{DispatchKey{targetType, inSender}, DispatchKey{targetType, nullptr}};
+	for (std::size_t i = 0; i < 2; ++i)
 	{
-		const auto& [token, eventType, callback] = element;
-		if (eventType == targetType)
+		const auto found = mDispatch.find(keys[i]);
+		if (found != mDispatch.end())
 		{
-			callback(inArgs); // Reference operator(): invoke the callback
+			callbackLists[i] = &found->second;
 		}
+	}
+
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+	EventTypeRecord& typeRecord = GetTypeRecord(targetType);
+	typeRecord.mNotifyCount.Add(1);
+	auto invokeCallback = [&inArgs, &typeRecord](const CallbackEntry& inEntry) -> void
+	{
+		const auto start = std::chrono::steady_clock::now();
+		inEntry.mCallback(inArgs); // Reference operator(): invoke the callback
+		const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+		inEntry.mRecord->mLatency.Record(static_cast<std::uint64_t>(elapsed.count()));
+		typeRecord.mFanOut.Add(1);
 	};
+#else
+	auto invokeCallback = [&inArgs](const CallbackEntry& inEntry) -> void
+	{
+		inEntry.mCallback(inArgs); // Reference operator(): invoke the callback
+	};
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
+	{
+		// Re-entrant Register/Unregister calls during Notify() are logged, rather than modifying the
+		// lists being iterated: callbacks registered now are not called by this Notify(), and those
+		// unregistered now are skipped. The outermost Notify() applies them when it returns.
+		NotifyScope scope{*this};
+		for (CallbackList* callbackList : callbackLists)
+		{
+			if (callbackList == nullptr)
+			{
+				continue;
+			}
+
+			const auto& entries = callbackList->mEntries;
+			const std::size_t count = entries.size();
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (entries[i].mIsLive)
+				{
+					invokeCallback(entries[i]);
+				}
+			}
+		}
+	}
 
-	// Search for the token in the callback list and invoke all associated callbacks using std::for_each
-	// use std::for_each for C++11, preferred way
-	// snapshot's .use_count() is decremented here (RAII)...
-    // if mCallbackList was modified during OnNotify(), the snapshot's .use_count()
-    // will ==0, and the snapshot's old-copy-of the callback list is also deleted.
-    // however, if no change was made to mCallbackList, snapshot's .use_count()
-    // will >=1, and no list deletion occurs.
-	std::for_each(snapshot->begin(), snapshot->end(), findAllCallbacks);
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+	ResumeAwaiters(inArgs);
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
 }
 
-} // namespace detail
+inline std::any* EventManagerImpl::OnCoalesce(const void* inSender, std::type_index inArgsType, DeliverType inDeliver)
+{
+	if (mWindowDepth == 0)
+	{
+		return nullptr;
+	}
 
-inline /*static*/ std::unique_ptr<EventManager> EventManager::Make()
+	const auto [found, isNew] = mPendingIndex.try_emplace(DispatchKey{inArgsType, inSender}, mPending.size());
+	if (isNew)
+	{
+		mPending.push_back(PendingEvent{inSender, std::any{}, inDeliver});
+	}
+	return &mPending[found->second].mEvent;
+}
+
+inline void EventManagerImpl::OnBeginWindow()
 {
-	std::unique_ptr<EventManager> result{new detail::EventManagerImpl()};
+	++mWindowDepth;
+}
+
+inline void EventManagerImpl::OnEndWindow()
+{
+	CloseWindow(*this);
+}
+
+inline std::size_t EventManagerImpl::OnDispatchForwarded()
+{
+	return 0; // Not sharded: nothing is ever forwarded
+}
+
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+inline void EventManagerImpl::OnGetStats(EventStats& ioStats)
+{
+	std::lock_guard<std::mutex> lock{mStatsMutex};
+	for (const auto& [argsType, record] : mTypeRecords)
+	{
+		// Sum the counters of an args type already reported (e.g., by another shard)
+		std::string name = GetTypeName(argsType);
+		auto found = std::find_if(ioStats.mEventTypes.begin(), ioStats.mEventTypes.end(), [&name](const auto& inStats)
+		{
+			return inStats.mName == name;
+		});
+		if (found == ioStats.mEventTypes.end())
+		{
+			found = ioStats.mEventTypes.insert(found, EventTypeStats{std::move(name)});
+		}
+		found->mNotifyCount += record->mNotifyCount.Load();
+		found->mFanOut += record->mFanOut.Load();
+	}
+
+	for (const auto& [token, record] : mHandlerRecords)
+	{
+		ioStats.mHandlers.push_back(HandlerStats{record->mToken, GetTypeName(record->mArgsType), record->mLatency.Snapshot()});
+	}
+}
+
+inline EventTypeRecord& EventManagerImpl::GetTypeRecord(std::type_index inArgsType)
+{
+	// TRICKY: Only this thread adds records, so finding one without locking is safe
+	const auto found = mTypeRecords.find(inArgsType);
+	if (found != mTypeRecords.end())
+	{
+		return *found->second;
+	}
+
+	std::lock_guard<std::mutex> lock{mStatsMutex};
+	return *mTypeRecords.emplace(inArgsType, std::make_unique<EventTypeRecord>()).first->second;
+}
+
+inline void EventManagerImpl::SetReportedToken(Token inToken, Token inReportedToken)
+{
+	std::lock_guard<std::mutex> lock{mStatsMutex};
+	const auto found = mHandlerRecords.find(inToken.Value());
+	if (found != mHandlerRecords.end())
+	{
+		found->second->mToken = inReportedToken.Value();
+	}
+}
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
+inline void EventManagerImpl::ApplyPending()
+{
+	EventVector<Bucket*> dirty(mAllocator);
+	dirty.swap(mDirty);
+	for (Bucket* bucket : dirty)
+	{
+		auto& callbackList = bucket->second;
+		callbackList.mIsDirty = false;
+
+		// Remove the callbacks unregistered during Notify()
+		// NOTE: Their tokens are already released (and may be reused), so only live callbacks are repointed
+		auto& entries = callbackList.mEntries;
+		std::size_t liveCount = 0;
+		for (std::size_t i = 0; i < entries.size(); ++i)
+		{
+			if (!entries[i].mIsLive)
+			{
+				continue;
+			}
+			if (i != liveCount)
+			{
+				entries[liveCount] = std::move(entries[i]);
+				mTokenSlots.Move(entries[liveCount].mToken, Location{bucket, liveCount, false});
+			}
+			++liveCount;
+		}
+		entries.erase(entries.begin() + static_cast<std::ptrdiff_t>(liveCount), entries.end());
+
+		// Append the callbacks registered during Notify()
+		for (auto& added : callbackList.mAdded)
+		{
+			if (added.mIsLive)
+			{
+				mTokenSlots.Move(added.mToken, Location{bucket, entries.size(), false});
+				entries.push_back(std::move(added));
+			}
+		}
+		callbackList.mAdded.clear();
+
+		if (entries.empty())
+		{
+			const DispatchKey key = bucket->first; // copy: erase() destroys the element
+			mDispatch.erase(key);
+		}
+	}
+}
+
+inline void EventManagerImpl::CloseWindow(EventManager& ioManager)
+{
+	if (mWindowDepth == 0 || --mWindowDepth > 0)
+	{
+		return;
+	}
+
+	// The window is closed before delivering: callbacks notifying more events get them delivered immediately
+	EventVector<PendingEvent> pending(mAllocator);
+	pending.swap(mPending);
+	mPendingIndex.clear();
+	for (const auto& element : pending)
+	{
+		element.mDeliver(ioManager, element.mSender, element.mEvent);
+	}
+}
+
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+inline void EventManagerImpl::OnAwait(AwaiterNode& ioAwaiter)
+{
+	ioAwaiter.LinkBefore(mAwaiters); // Append: awaiters of one event resume in suspension order
+}
+
+inline void EventManagerImpl::ResumeAwaiters(const std::any& inArgs)
+{
+	if (!mAwaiters.IsLinked())
+	{
+		return; // Nobody awaiting
+	}
+
+	// Move the accepting awaiters to a local list first: resuming a coroutine may await again
+	const std::type_index targetType = inArgs.type();
+	AwaiterNode ready{};
+	for (AwaiterNode* node = mAwaiters.mNext; node != &mAwaiters;)
+	{
+		AwaiterNode* next = node->mNext;
+		if (node->mArgsType == targetType && node->mTryResume(*node, inArgs))
+		{
+			node->Unlink();
+			node->LinkBefore(ready);
+		}
+		node = next;
+	}
+
+	// NOTE: A ready coroutine destroyed by one resumed before it unlinks itself from `ready`
+	while (ready.IsLinked())
+	{
+		AwaiterNode* node = ready.mNext;
+		node->Unlink();
+		node->mHandle.resume();
+	}
+}
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+
+// Sharded EventManager (see `EventManager::MakeSharded()`): one EventManagerImpl shard per thread.
+// The notifying thread's shard is found through a thread_local cache, so the hot path of Notify()
+// takes no lock; forwarding to other threads' shards only happens for event types they registered.
+// A shard lives as long as its thread: it is detached (with its callbacks) when the thread exits.
+class ShardedEventManagerImpl final : public EventManager // ShardedEventManagerImpl is-a EventManager
+{
+public:
+	~ShardedEventManagerImpl() override;
+
+private:
+	friend class EventManager; // allow MakeSharded() to construct it
+	ShardedEventManagerImpl() = default;
+
+private:
+	Token OnRegister(std::type_index inArgsType, const void* inSender, EventCallback&& ioCallback) override;
+
+	void OnUnregister(Token inToken) override;
+
+	void OnNotify(const void* inSender, std::any inArgs, const EventOps& inOps) override;
+
+	std::any* OnCoalesce(const void* inSender, std::type_index inArgsType, DeliverType inDeliver) override;
+
+	void OnBeginWindow() override;
+
+	void OnEndWindow() override;
+
+	std::size_t OnDispatchForwarded() override;
+
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+	void OnGetStats(EventStats& ioStats) override;
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+	void OnAwait(AwaiterNode& ioAwaiter) override;
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+
+private:
+	struct Shard; // forward declaration
+
+	// Other shards with callbacks, by args type
+	// NOTE: Routes share their shards, so a stale copy never forwards to a destroyed shard
+	using RouteMap = std::unordered_map<std::type_index, std::vector<std::shared_ptr<Shard>>>;
+
+	// Event notified on another thread, held (shared by its target shards) until delivered
+	struct ForwardedEvent
+	{
+		const void* mSender{};
+		std::shared_ptr<const std::any> mEvent{};
+		const EventOps* mOps{};
+	};
+
+	struct Shard : std::enable_shared_from_this<Shard>
+	{
+		explicit Shard(std::thread::id inThread) : mThread{inThread} {}
+
+		const std::thread::id mThread;
+#if SABER_EVENTS_CONFIG_ISENABLED_PMR
+		std::pmr::unsynchronized_pool_resource mPool{}; // Per thread pool: no allocator lock on the event path
+		EventManagerImpl mLocal{EventAllocator{&mPool}}; // Only used by `mThread`
+#else
+		EventManagerImpl mLocal{}; // Only used by `mThread`
+#endif // SABER_EVENTS_CONFIG_ISENABLED_PMR
+
+		// Copy of the manager's routes, refreshed by `mThread` when they change
+		RouteMap mRoutes{};
+		std::uint64_t mRoutesVersion{0};
+
+		std::mutex mInboxMutex{};
+		std::vector<ForwardedEvent> mInbox{}; // Guarded by `mInboxMutex`
+	};
+
+	struct Registration
+	{
+		Shard* mShard{};
+		Token mLocalToken{};
+		std::type_index mArgsType{typeid(void)};
+	};
+
+	static std::uint64_t MakeManagerId()
+	{
+		static std::atomic<std::uint64_t> sNextId{1};
+		return sNextId.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Shared by a manager and the threads owning its shards, so an exiting thread only detaches
+	// its shard while the manager still exists
+	struct ManagerHandle
+	{
+		explicit ManagerHandle(ShardedEventManagerImpl* inManager) : mManager{inManager} {}
+
+		std::mutex mMutex{};
+		ShardedEventManagerImpl* mManager{}; // Guarded by `mMutex`; null once the manager is destroyed
+	};
+
+	// The calling thread's shards, by manager id: found without locking, however many managers it uses.
+	// Detaches them when the thread exits: thread ids are reused, so a later thread must not inherit
+	// a dead thread's shard (whose inbox would otherwise fill up forever)
+	class ShardOwner
+	{
+	public:
+		ShardOwner() = default;
+		~ShardOwner();
+
+		ShardOwner(const ShardOwner&) = delete;
+		ShardOwner& operator=(const ShardOwner&) = delete;
+
+		// Shard of manager `inManagerId`, or null before the thread's first use of it
+		// NOTE: Manager ids are never reused, so a destroyed manager's entry never matches
+		Shard* Find(std::uint64_t inManagerId) const;
+
+		void Add(std::uint64_t inManagerId, const std::shared_ptr<ManagerHandle>& inHandle, Shard& inShard);
+
+	private:
+		struct OwnedShard
+		{
+			std::uint64_t mManagerId{0};
+			std::shared_ptr<ManagerHandle> mHandle{};
+			Shard* mShard{};
+		};
+
+		std::vector<OwnedShard> mShards{};
+	};
+
+	static ShardOwner& GetShardOwner()
+	{
+		thread_local ShardOwner sOwner{};
+		return sOwner;
+	}
+
+	// The calling thread's shard, made on its first use
+	Shard& GetLocalShard()
+	{
+		Shard* shard = GetShardOwner().Find(mId);
+		return (shard != nullptr) ? *shard : AttachShard();
+	}
+
+	Shard& AttachShard();
+
+	// Remove the exiting thread's shard: its routes, its tokens and its pending forwarded events
+	void DetachShard(Shard& ioShard);
+
+	// Forward the event of `inArgs` to the other shards with callbacks for it
+	void Forward(Shard& ioShard, const void* inSender, const std::any& inArgs, const EventOps& inOps);
+
+private:
+	const std::uint64_t mId{MakeManagerId()};
+	const std::shared_ptr<ManagerHandle> mHandle{std::make_shared<ManagerHandle>(this)};
+
+	std::mutex mMutex{}; // Guards the members below
+	std::vector<std::shared_ptr<Shard>> mShards{};
+	std::unordered_map<const Shard*, std::unordered_map<std::type_index, std::size_t>> mHandlerCounts{};
+	RouteMap mRoutes{}; // Every shard with callbacks, by args type
+	std::atomic<std::uint64_t> mRoutesVersion{0}; // Bumped when `mRoutes` changes
+	TokenSlots<Token, Registration> mTokenSlots{};
+
+}; // class ShardedEventManagerImpl
+
+inline ShardedEventManagerImpl::~ShardedEventManagerImpl()
+{
+	{
+		// Threads exiting from now on leave their (destroyed) shard alone
+		std::lock_guard<std::mutex> lock{mHandle->mMutex};
+		mHandle->mManager = nullptr;
+	}
+
+	// Shards route to each other: break these cycles, so the shards are destroyed with the manager
+	for (const auto& shard : mShards)
+	{
+		shard->mRoutes.clear();
+	}
+}
+
+inline ShardedEventManagerImpl::ShardOwner::~ShardOwner()
+{
+	for (const auto& owned : mShards)
+	{
+		std::lock_guard<std::mutex> lock{owned.mHandle->mMutex};
+		if (owned.mHandle->mManager != nullptr)
+		{
+			owned.mHandle->mManager->DetachShard(*owned.mShard);
+		}
+	}
+	mShards.clear();
+}
+
+inline auto ShardedEventManagerImpl::ShardOwner::Find(std::uint64_t inManagerId) const -> Shard*
+{
+	for (const auto& owned : mShards)
+	{
+		if (owned.mManagerId == inManagerId)
+		{
+			return owned.mShard;
+		}
+	}
+	return nullptr;
+}
+
+inline void ShardedEventManagerImpl::ShardOwner::Add(std::uint64_t inManagerId, const std::shared_ptr<ManagerHandle>& inHandle, Shard& inShard)
+{
+	// Forget the shards of destroyed managers, so a long lived thread does not accumulate them
+	mShards.erase(std::remove_if(mShards.begin(), mShards.end(), [](const OwnedShard& inOwned)
+	{
+		std::lock_guard<std::mutex> lock{inOwned.mHandle->mMutex};
+		return inOwned.mHandle->mManager == nullptr;
+	}), mShards.end());
+	mShards.push_back(OwnedShard{inManagerId, inHandle, &inShard});
+}
+
+inline auto ShardedEventManagerImpl::AttachShard() -> Shard&
+{
+	const std::thread::id thread = std::this_thread::get_id();
+	Shard* shard{};
+	bool isNew = false;
+	{
+		std::lock_guard<std::mutex> lock{mMutex};
+		auto found = std::find_if(mShards.begin(), mShards.end(), [thread](const auto& inShard)
+		{
+			return inShard->mThread == thread;
+		});
+		if (found == mShards.end())
+		{
+			found = mShards.insert(mShards.end(), std::make_shared<Shard>(thread));
+			isNew = true;
+		}
+		shard = found->get();
+	}
+
+	// NOTE: Outside of `mMutex`, since the owner locks the handles of (other) managers
+	if (isNew)
+	{
+		GetShardOwner().Add(mId, mHandle, *shard);
+	}
+	return *shard;
+}
+
+inline void ShardedEventManagerImpl::DetachShard(Shard& ioShard)
+{
+	std::shared_ptr<Shard> detached{};
+	{
+		std::lock_guard<std::mutex> lock{mMutex};
+		const auto found = std::find_if(mShards.begin(), mShards.end(), [&ioShard](const auto& inShard)
+		{
+			return inShard.get() == &ioShard;
+		});
+		if (found == mShards.end())
+		{
+			return;
+		}
+		detached = std::move(*found);
+		mShards.erase(found);
+
+		// Stop routing events here; other shards refresh their copies on their next Notify()
+		const auto counts = mHandlerCounts.find(&ioShard);
+		if (counts != mHandlerCounts.end())
+		{
+			for (const auto& [argsType, count] : counts->second)
+			{
+				auto& route = mRoutes[argsType];
+				route.erase(std::find(route.begin(), route.end(), detached));
+				if (route.empty())
+				{
+					mRoutes.erase(argsType);
+				}
+			}
+			mHandlerCounts.erase(counts);
+		}
+		mRoutesVersion.fetch_add(1, std::memory_order_release);
+
+		// Its callbacks are gone with the thread: their tokens become stale
+		mTokenSlots.ReleaseIf([&ioShard](const Registration& inRegistration)
+		{
+			return inRegistration.mShard == &ioShard;
+		});
+	}
+
+	// NOTE: Only the rare Notify() racing with this may still forward here, into a shard nobody drains:
+	// it is destroyed with the last stale route to it
+	ioShard.mRoutes.clear();
+	std::vector<ForwardedEvent> inbox{};
+	{
+		std::lock_guard<std::mutex> lock{ioShard.mInboxMutex};
+		inbox.swap(ioShard.mInbox);
+	}
+}
+
+inline EventManager::Token ShardedEventManagerImpl::OnRegister(std::type_index inArgsType, const void* inSender, EventCallback&& ioCallback)
+{
+	Shard& shard = GetLocalShard();
+	const Token localToken = shard.mLocal.OnRegister(inArgsType, inSender, std::move(ioCallback));
+
+	std::lock_guard<std::mutex> lock{mMutex};
+	if (++mHandlerCounts[&shard][inArgsType] == 1)
+	{
+		// First callback of this type on this thread: route the type's events here
+		mRoutes[inArgsType].push_back(shard.shared_from_this());
+		mRoutesVersion.fetch_add(1, std::memory_order_release);
+	}
+	const Token newToken = mTokenSlots.Acquire(Registration{&shard, localToken, inArgsType});
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+	shard.mLocal.SetReportedToken(localToken, newToken);
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+	return newToken;
+}
+
+inline void ShardedEventManagerImpl::OnUnregister(Token inToken)
+{
+	Registration registration{};
+	{
+		std::lock_guard<std::mutex> lock{mMutex};
+		const Registration* found = mTokenSlots.Find(inToken);
+		if (found == nullptr)
+		{
+			return; // A stale token (e.g., already unregistered) is ignored
+		}
+
+		// The shard's callback lists are only ever touched by its own thread
+		SABER_REQUIRE(found->mShard->mThread == std::this_thread::get_id());
+		registration = *found;
+		mTokenSlots.Release(inToken);
+
+		auto& counts = mHandlerCounts[registration.mShard];
+		if (--counts[registration.mArgsType] == 0)
+		{
+			// Last callback of this type on this thread: stop routing the type's events here
+			counts.erase(registration.mArgsType);
+			auto& route = mRoutes[registration.mArgsType];
+			route.erase(std::find_if(route.begin(), route.end(), [&registration](const auto& inShard)
+			{
+				return inShard.get() == registration.mShard;
+			}));
+			if (route.empty())
+			{
+				mRoutes.erase(registration.mArgsType);
+			}
+			mRoutesVersion.fetch_add(1, std::memory_order_release);
+		}
+	}
+
+	registration.mShard->mLocal.OnUnregister(registration.mLocalToken);
+}
+
+inline void ShardedEventManagerImpl::OnNotify(const void* inSender, std::any inArgs, const EventOps& inOps)
+{
+	Shard& shard = GetLocalShard();
+
+	// Refresh this shard's copy of the routes, only when they changed
+	if (mRoutesVersion.load(std::memory_order_acquire) != shard.mRoutesVersion)
+	{
+		// NOTE: The old copy is dropped outside of `mMutex`, since it may hold the last reference to a detached shard
+		RouteMap routes{};
+		{
+			std::lock_guard<std::mutex> lock{mMutex};
+			shard.mRoutesVersion = mRoutesVersion.load(std::memory_order_relaxed);
+			for (const auto& [argsType, route] : mRoutes)
+			{
+				for (const auto& target : route)
+				{
+					if (target.get() != &shard)
+					{
+						routes[argsType].push_back(target);
+					}
+				}
+			}
+		}
+		shard.mRoutes.swap(routes);
+	}
+
+	if (!shard.mRoutes.empty())
+	{
+		Forward(shard, inSender, inArgs, inOps);
+	}
+	shard.mLocal.OnNotify(inSender, std::move(inArgs), inOps);
+}
+
+inline void ShardedEventManagerImpl::Forward(Shard& ioShard, const void* inSender, const std::any& inArgs, const EventOps& inOps)
+{
+	const auto found = ioShard.mRoutes.find(inArgs.type());
+	if (found == ioShard.mRoutes.end())
+	{
+		return; // No other thread has callbacks for it
+	}
+
+	std::any event = inOps.mCapture(inArgs);
+	if (!event.has_value())
+	{
+		return; // Not copyable: delivered to this thread only
+	}
+
+	auto shared = std::make_shared<const std::any>(std::move(event));
+	for (const auto& target : found->second)
+	{
+		std::lock_guard<std::mutex> lock{target->mInboxMutex};
+		target->mInbox.push_back(ForwardedEvent{inSender, shared, &inOps});
+	}
+}
+
+inline std::any* ShardedEventManagerImpl::OnCoalesce(const void* inSender, std::type_index inArgsType, DeliverType inDeliver)
+{
+	return GetLocalShard().mLocal.OnCoalesce(inSender, inArgsType, inDeliver);
+}
+
+inline void ShardedEventManagerImpl::OnBeginWindow()
+{
+	GetLocalShard().mLocal.OnBeginWindow();
+}
+
+inline void ShardedEventManagerImpl::OnEndWindow()
+{
+	// Held events are delivered through this manager, so they are forwarded like any other
+	GetLocalShard().mLocal.CloseWindow(*this);
+}
+
+inline std::size_t ShardedEventManagerImpl::OnDispatchForwarded()
+{
+	Shard& shard = GetLocalShard();
+	std::vector<ForwardedEvent> inbox{};
+	{
+		std::lock_guard<std::mutex> lock{shard.mInboxMutex};
+		inbox.swap(shard.mInbox);
+	}
+
+	// Delivered to this thread's shard only: never forwarded again
+	for (const auto& element : inbox)
+	{
+		element.mOps->mDeliver(shard.mLocal, element.mSender, *element.mEvent);
+	}
+	return inbox.size();
+}
+
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+inline void ShardedEventManagerImpl::OnGetStats(EventStats& ioStats)
+{
+	std::lock_guard<std::mutex> lock{mMutex};
+	for (const auto& shard : mShards)
+	{
+		shard->mLocal.OnGetStats(ioStats);
+	}
+}
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+inline void ShardedEventManagerImpl::OnAwait(AwaiterNode& ioAwaiter)
+{
+	GetLocalShard().mLocal.OnAwait(ioAwaiter);
+}
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+
+} // namespace detail
+
+inline /*static*/ std::unique_ptr<EventManager> EventManager::Make()
+{
+	std::unique_ptr<EventManager> result{new detail::EventManagerImpl()};
+	return result;
+}
+
+#if SABER_EVENTS_CONFIG_ISENABLED_PMR
+inline /*static*/ std::unique_ptr<EventManager> EventManager::Make(std::pmr::memory_resource* ioResource)
+{
+	SABER_REQUIRE(ioResource != nullptr);
+	std::unique_ptr<EventManager> result{new detail::EventManagerImpl(detail::EventAllocator{ioResource})};
+	return result;
+}
+#endif // SABER_EVENTS_CONFIG_ISENABLED_PMR
+
+inline /*static*/ std::unique_ptr<EventManager> EventManager::MakeSharded()
+{
+	std::unique_ptr<EventManager> result{new detail::ShardedEventManagerImpl()};
 	return result;
 }
 
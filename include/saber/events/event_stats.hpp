@@ -0,0 +1,344 @@
+#ifndef SABER_EVENTS_EVENTSTATS_HPP
+#define SABER_EVENTS_EVENTSTATS_HPP
+
+// saber
+#include "saber/config.hpp"
+
+// std
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#endif
+
+namespace saber::events {
+
+// Instrumentation snapshot of an `EventManager`, see `EventManager::GetStats()`
+// (available when built with -DSABER_EVENTS_CONFIG_ISENABLED_STATS=1)
+
+namespace detail {
+class LatencyRecorder; // forward declaration
+} // namespace detail
+
+#pragma region class LatencyHistogram
+
+// HDR-style histogram of latencies, in nanoseconds: every power of two range is split into
+// kSubBucketCount linear buckets, so any recorded value is within 1/kSubBucketCount (12.5%) of
+// its bucket's bounds, from 1ns up to the full 64 bit range, in a fixed kBucketCount counters.
+class LatencyHistogram
+{
+public:
+	static constexpr std::size_t kSubBucketBits = 3;
+	static constexpr std::size_t kSubBucketCount = std::size_t{1} << kSubBucketBits;
+	static constexpr std::size_t kBucketCount = (64 - kSubBucketBits + 1) * kSubBucketCount;
+
+public:
+	void Record(std::uint64_t inNanoseconds, std::uint64_t inCount = 1)
+	{
+		mCounts[GetBucketIndex(inNanoseconds)] += inCount;
+		mCount += inCount;
+		mSum += inNanoseconds * inCount;
+		mMax = std::max(mMax, inNanoseconds);
+	}
+
+	void Merge(const LatencyHistogram& inOther)
+	{
+		for (std::size_t i = 0; i < kBucketCount; ++i)
+		{
+			mCounts[i] += inOther.mCounts[i];
+		}
+		mCount += inOther.mCount;
+		mSum += inOther.mSum;
+		mMax = std::max(mMax, inOther.mMax);
+	}
+
+	std::uint64_t GetCount() const
+	{
+		return mCount;
+	}
+
+	std::uint64_t GetMax() const
+	{
+		return mMax;
+	}
+
+	std::uint64_t GetMean() const
+	{
+		return (mCount > 0) ? (mSum / mCount) : 0;
+	}
+
+	// Smallest bucket bound that at least `inPercentile` (0..100) of the recorded values are not above
+	std::uint64_t GetPercentile(double inPercentile) const;
+
+	std::uint64_t GetBucketCount(std::size_t inIndex) const
+	{
+		return mCounts[inIndex];
+	}
+
+	static constexpr std::size_t GetBucketIndex(std::uint64_t inValue)
+	{
+		if (inValue < kSubBucketCount)
+		{
+			return static_cast<std::size_t>(inValue);
+		}
+
+		// Power of two range of `inValue`, then its linear sub-bucket within that range
+		const std::size_t magnitude = FloorLog2(inValue);
+		const std::size_t subBucket = static_cast<std::size_t>(inValue >> (magnitude - kSubBucketBits)) - kSubBucketCount;
+		return (magnitude - kSubBucketBits + 1) * kSubBucketCount + subBucket;
+	}
+
+	// Smallest value counted by bucket `inIndex`
+	static constexpr std::uint64_t GetBucketLowerBound(std::size_t inIndex)
+	{
+		if (inIndex < kSubBucketCount)
+		{
+			return inIndex;
+		}
+
+		const std::size_t magnitude = inIndex / kSubBucketCount + kSubBucketBits - 1;
+		const std::uint64_t subBucket = inIndex % kSubBucketCount;
+		return (kSubBucketCount + subBucket) << (magnitude - kSubBucketBits);
+	}
+
+	// Largest value counted by bucket `inIndex`
+	static constexpr std::uint64_t GetBucketUpperBound(std::size_t inIndex)
+	{
+		return (inIndex + 1 < kBucketCount) ? GetBucketLowerBound(inIndex + 1) - 1 : UINT64_MAX;
+	}
+
+private:
+	static constexpr std::size_t FloorLog2(std::uint64_t inValue)
+	{
+		std::size_t result = 0;
+		for (std::size_t shift = 32; shift > 0; shift /= 2)
+		{
+			if ((inValue >> shift) != 0)
+			{
+				inValue >>= shift;
+				result += shift;
+			}
+		}
+		return result;
+	}
+
+private:
+	friend class detail::LatencyRecorder; // allow recorders to snapshot into it
+
+	std::array<std::uint64_t, kBucketCount> mCounts{};
+	std::uint64_t mCount{0};
+	std::uint64_t mSum{0};
+	std::uint64_t mMax{0};
+};
+
+inline std::uint64_t LatencyHistogram::GetPercentile(double inPercentile) const
+{
+	if (mCount == 0)
+	{
+		return 0;
+	}
+
+	const double clamped = std::clamp(inPercentile, 0.0, 100.0);
+	const auto target = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(clamped / 100.0 * static_cast<double>(mCount) + 0.5));
+	std::uint64_t cumulative = 0;
+	for (std::size_t i = 0; i < kBucketCount; ++i)
+	{
+		cumulative += mCounts[i];
+		if (cumulative >= target)
+		{
+			return std::min(GetBucketUpperBound(i), mMax);
+		}
+	}
+	return mMax;
+}
+
+#pragma endregion
+
+#pragma region struct EventStats
+
+struct EventTypeStats
+{
+	std::string mName{}; // Args type: (sender, event)
+	std::uint64_t mNotifyCount{0};
+	std::uint64_t mFanOut{0}; // Callbacks run, over all notifies
+};
+
+struct HandlerStats
+{
+	std::uint64_t mToken{0}; // `EventManager::Token::Value()` of the callback
+	std::string mName{}; // Args type: (sender, event)
+	LatencyHistogram mLatency{};
+};
+
+struct EventStats
+{
+	std::vector<EventTypeStats> mEventTypes{};
+	std::vector<HandlerStats> mHandlers{}; // Registered callbacks only
+
+	// Dump as a JSON object; per handler, its latency count, mean, p50, p99 and max (in ns)
+	std::string ToJson() const;
+};
+
+namespace detail {
+
+inline std::string GetTypeName(std::type_index inType)
+{
+	std::string result{inType.name()};
+#if __has_include(<cxxabi.h>)
+	int status = 0;
+	char* demangled = abi::__cxa_demangle(result.c_str(), nullptr, nullptr, &status);
+	if (status == 0 && demangled != nullptr)
+	{
+		result = demangled;
+	}
+	std::free(demangled);
+#endif
+	return result;
+}
+
+inline void AppendJsonString(std::string& ioJson, const std::string& inValue)
+{
+	ioJson += '"';
+	for (const char c : inValue)
+	{
+		switch (c)
+		{
+			case '"': ioJson += "\\\""; break;
+			case '\\': ioJson += "\\\\"; break;
+			case '\n': ioJson += "\\n"; break;
+			case '\t': ioJson += "\\t"; break;
+			default:
+			{
+				if (static_cast<unsigned char>(c) < 0x20)
+				{
+					char escaped[8]{};
+					std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+					ioJson += escaped;
+				}
+				else
+				{
+					ioJson += c;
+				}
+				break;
+			}
+		}
+	}
+	ioJson += '"';
+}
+
+// Counter with a single writer thread, readable from any thread without locking
+class StatsCounter
+{
+public:
+	void Add(std::uint64_t inValue)
+	{
+		// Single writer: a plain load/store, rather than a read-modify-write
+		mValue.store(mValue.load(std::memory_order_relaxed) + inValue, std::memory_order_relaxed);
+	}
+
+	void SetMax(std::uint64_t inValue)
+	{
+		if (inValue > mValue.load(std::memory_order_relaxed))
+		{
+			mValue.store(inValue, std::memory_order_relaxed);
+		}
+	}
+
+	std::uint64_t Load() const
+	{
+		return mValue.load(std::memory_order_relaxed);
+	}
+
+private:
+	std::atomic<std::uint64_t> mValue{0};
+};
+
+// Records a `LatencyHistogram` on its writer thread, while other threads snapshot it
+class LatencyRecorder
+{
+public:
+	void Record(std::uint64_t inNanoseconds)
+	{
+		mCounts[LatencyHistogram::GetBucketIndex(inNanoseconds)].Add(1);
+		mSum.Add(inNanoseconds);
+		mMax.SetMax(inNanoseconds);
+	}
+
+	LatencyHistogram Snapshot() const
+	{
+		// NOTE: Not atomic as a whole: a value recorded meanwhile may be in some counters only
+		LatencyHistogram result{};
+		for (std::size_t i = 0; i < LatencyHistogram::kBucketCount; ++i)
+		{
+			result.mCounts[i] = mCounts[i].Load();
+			result.mCount += result.mCounts[i];
+		}
+		result.mSum = mSum.Load();
+		result.mMax = mMax.Load();
+		return result;
+	}
+
+private:
+	std::array<StatsCounter, LatencyHistogram::kBucketCount> mCounts{};
+	StatsCounter mSum{};
+	StatsCounter mMax{};
+};
+
+struct EventTypeRecord
+{
+	StatsCounter mNotifyCount{};
+	StatsCounter mFanOut{};
+};
+
+struct HandlerRecord
+{
+	std::uint64_t mToken{0}; // Reported token
+	std::type_index mArgsType{typeid(void)};
+	LatencyRecorder mLatency{};
+};
+
+} // namespace detail
+
+inline std::string EventStats::ToJson() const
+{
+	std::string json{"{\"eventTypes\":["};
+	for (std::size_t i = 0; i < mEventTypes.size(); ++i)
+	{
+		const auto& eventType = mEventTypes[i];
+		json += (i > 0) ? ",{\"name\":" : "{\"name\":";
+		detail::AppendJsonString(json, eventType.mName);
+		json += ",\"notifyCount\":" + std::to_string(eventType.mNotifyCount);
+		json += ",\"fanOut\":" + std::to_string(eventType.mFanOut) + "}";
+	}
+
+	json += "],\"handlers\":[";
+	for (std::size_t i = 0; i < mHandlers.size(); ++i)
+	{
+		const auto& handler = mHandlers[i];
+		json += (i > 0) ? ",{\"token\":" : "{\"token\":";
+		json += std::to_string(handler.mToken) + ",\"name\":";
+		detail::AppendJsonString(json, handler.mName);
+		json += ",\"count\":" + std::to_string(handler.mLatency.GetCount());
+		json += ",\"meanNs\":" + std::to_string(handler.mLatency.GetMean());
+		json += ",\"p50Ns\":" + std::to_string(handler.mLatency.GetPercentile(50.0));
+		json += ",\"p99Ns\":" + std::to_string(handler.mLatency.GetPercentile(99.0));
+		json += ",\"maxNs\":" + std::to_string(handler.mLatency.GetMax()) + "}";
+	}
+	json += "]}";
+	return json;
+}
+
+#pragma endregion
+
+} // namespace saber::events
+
+#endif // SABER_EVENTS_EVENTSTATS_HPP
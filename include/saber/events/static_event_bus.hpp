@@ -0,0 +1,419 @@
+#ifndef SABER_EVENTS_STATICEVENTBUS_HPP
+#define SABER_EVENTS_STATICEVENTBUS_HPP
+
+// saber
+#include "saber/config.hpp"
+#include "saber/utility.hpp"
+#include "saber/events/detail/token_slots.hpp"
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace saber::events {
+
+// `StaticEventBus` is the compile-time counterpart of `EventManager`, for subsystems whose
+// set of events is known up front. It keeps one typed handler list per event type in a
+// tuple: Notify() indexes the list at compile time, with no virtual call, `std::any` or
+// `type_index` comparison on the way. Each handler costs one indirect call, through a
+// trampoline generated for its callable type (into which the callable's body is inlined).
+//
+// Use it like this:
+//     struct ResizeEvent{int mWidth{}, mHeight{};};
+//     struct CloseEvent{};
+//     StaticEventBus<Window, ResizeEvent, CloseEvent> bus;
+//     auto token = bus.Register<ResizeEvent>([](const Window&, const ResizeEvent&){return 0;});
+//     bus.Notify(window, ResizeEvent{640, 480});
+//     bus.Unregister(token);
+
+namespace detail {
+
+// Move-only handler of (sender, event) for `StaticEventBus`. Unlike `std::function`, there is no
+// type-erased callable object: a callable of at most kInlineSize bytes is stored in place (no
+// allocation), and is called through a plain function pointer to its typed trampoline.
+template<typename SenderType, typename EventType>
+class StaticHandler
+{
+public:
+	static constexpr std::size_t kInlineSize = 2 * sizeof(void*);
+
+public:
+	StaticHandler() = default;
+
+	template<typename Lambda, typename CallableType = std::decay_t<Lambda>,
+		typename = std::enable_if_t<!std::is_same_v<CallableType, StaticHandler>>>
+	explicit StaticHandler(Lambda&& ioLambda);
+
+	~StaticHandler()
+	{
+		Reset();
+	}
+
+	StaticHandler(StaticHandler&& ioOther) noexcept
+	{
+		MoveFrom(ioOther);
+	}
+
+	StaticHandler& operator=(StaticHandler&& ioOther) noexcept
+	{
+		if (this != &ioOther)
+		{
+			Reset();
+			MoveFrom(ioOther);
+		}
+		return *this;
+	}
+
+	StaticHandler(const StaticHandler&) = delete;
+	StaticHandler& operator=(const StaticHandler&) = delete;
+
+public:
+	int operator()(const SenderType& inSender, const EventType& inEvent)
+	{
+		return mInvoke(mStorage, inSender, inEvent);
+	}
+
+private:
+	using InvokeType = int(*)(void*, const SenderType&, const EventType&);
+	using ManageType = void(*)(void*, void*) noexcept;
+
+	// Callables that do not fit in place are allocated, and their pointer is stored instead
+	template<typename CallableType>
+	static constexpr bool IsInline()
+	{
+		return (sizeof(CallableType) <= kInlineSize)
+			&& (alignof(CallableType) <= alignof(void*))
+			&& std::is_nothrow_move_constructible_v<CallableType>;
+	}
+
+	template<typename CallableType>
+	static CallableType& GetCallable(void* inStorage)
+	{
+		if constexpr (IsInline<CallableType>())
+		{
+			return *std::launder(static_cast<CallableType*>(inStorage));
+		}
+		else
+		{
+			return **std::launder(static_cast<CallableType**>(inStorage));
+		}
+	}
+
+	template<typename CallableType>
+	static int Invoke(void* inStorage, const SenderType& inSender, const EventType& inEvent)
+	{
+		return std::invoke(GetCallable<CallableType>(inStorage), inSender, inEvent);
+	}
+
+	// Move the callable in `ioSource` to `outTarget`, then destroy it; or only destroy it, if `outTarget` is null
+	template<typename CallableType>
+	static void Manage(void* outTarget, void* ioSource) noexcept;
+
+	void MoveFrom(StaticHandler& ioOther) noexcept
+	{
+		if (ioOther.mManage != nullptr)
+		{
+			ioOther.mManage(mStorage, ioOther.mStorage);
+			mInvoke = std::exchange(ioOther.mInvoke, nullptr);
+			mManage = std::exchange(ioOther.mManage, nullptr);
+		}
+	}
+
+	void Reset() noexcept
+	{
+		if (mManage != nullptr)
+		{
+			mManage(nullptr, mStorage);
+			mInvoke = nullptr;
+			mManage = nullptr;
+		}
+	}
+
+private:
+	alignas(void*) std::byte mStorage[kInlineSize]{};
+	InvokeType mInvoke{nullptr};
+	ManageType mManage{nullptr};
+
+}; // class StaticHandler
+
+template<typename SenderType, typename EventType>
+template<typename Lambda, typename CallableType, typename>
+inline StaticHandler<SenderType, EventType>::StaticHandler(Lambda&& ioLambda)
+{
+	if constexpr (IsInline<CallableType>())
+	{
+		::new (static_cast<void*>(mStorage)) CallableType(std::forward<Lambda>(ioLambda));
+	}
+	else
+	{
+		::new (static_cast<void*>(mStorage)) CallableType*{new CallableType(std::forward<Lambda>(ioLambda))};
+	}
+	mInvoke = &Invoke<CallableType>;
+	mManage = &Manage<CallableType>;
+}
+
+template<typename SenderType, typename EventType>
+template<typename CallableType>
+inline void StaticHandler<SenderType, EventType>::Manage(void* outTarget, void* ioSource) noexcept
+{
+	if constexpr (IsInline<CallableType>())
+	{
+		auto& source = GetCallable<CallableType>(ioSource);
+		if (outTarget != nullptr)
+		{
+			::new (outTarget) CallableType(std::move(source));
+		}
+		source.~CallableType();
+	}
+	else
+	{
+		// Only the pointer moves: the callable itself stays where it was allocated
+		CallableType* source = &GetCallable<CallableType>(ioSource);
+		if (outTarget != nullptr)
+		{
+			::new (outTarget) CallableType*{source};
+		}
+		else
+		{
+			delete source;
+		}
+	}
+}
+
+} // namespace detail
+
+template<typename SenderType, typename... EventTypes>
+class StaticEventBus
+{
+public:
+	using Token = saber::TaggedType<std::uint64_t, StaticEventBus>;
+
+	template<typename EventType>
+	using HandlerType = detail::StaticHandler<SenderType, EventType>;
+
+public:
+	StaticEventBus() = default;
+	~StaticEventBus() = default;
+
+	// Tokens (and handlers capturing `this` bus) are tied to this instance
+	StaticEventBus(const StaticEventBus&) = delete;
+	StaticEventBus& operator=(const StaticEventBus&) = delete;
+
+public:
+	template<typename EventType, typename Lambda>
+	[[nodiscard]] Token Register(Lambda&& ioLambda);
+
+	void Unregister(Token inToken);
+
+	template<typename EventType>
+	void Notify(const SenderType& inSender, const EventType& inEvent);
+
+private:
+	static_assert(sizeof...(EventTypes) > 0, "StaticEventBus requires at least one event type");
+
+	// Compile-time index of `EventType` in `EventTypes...`
+	template<typename EventType>
+	static constexpr std::size_t IndexOf()
+	{
+		constexpr bool kIsSame[] = {std::is_same_v<EventType, EventTypes>...};
+		for (std::size_t i = 0; i < sizeof...(EventTypes); ++i)
+		{
+			if (kIsSame[i])
+			{
+				return i;
+			}
+		}
+		return sizeof...(EventTypes);
+	}
+
+	template<typename EventType>
+	struct HandlerList
+	{
+		struct Entry
+		{
+			Token mToken{};
+			HandlerType<EventType> mHandler{};
+			bool mIsLive{true}; // false: unregistered during Notify(); removed once it returns
+		};
+
+		std::vector<Entry> mEntries{};
+		std::vector<Entry> mAdded{}; // Registered during Notify(); appended after the outermost Notify()
+	};
+
+	struct Location
+	{
+		std::size_t mEventIndex{};
+		std::size_t mIndex{};
+		bool mIsAdded{}; // index into `mAdded`, rather than `mEntries`
+	};
+
+	// Counts the Notify() depth; once the outermost Notify() returns (or throws), applies the pending changes
+	class NotifyScope
+	{
+	public:
+		explicit NotifyScope(StaticEventBus& ioBus) :
+			mBus{ioBus}
+		{
+			++mBus.mNotifyDepth;
+		}
+
+		~NotifyScope()
+		{
+			if (--mBus.mNotifyDepth == 0 && mBus.mHasPending)
+			{
+				mBus.ApplyPending();
+			}
+		}
+
+		NotifyScope(const NotifyScope&) = delete;
+		NotifyScope& operator=(const NotifyScope&) = delete;
+
+	private:
+		StaticEventBus& mBus;
+	};
+
+	// Call `inFunction(list, kIndex)` with the handler list of runtime event index `inEventIndex`
+	template<typename Function, std::size_t... kIndices>
+	void VisitList(std::size_t inEventIndex, Function&& inFunction, std::index_sequence<kIndices...>)
+	{
+		((kIndices == inEventIndex ? inFunction(std::get<kIndices>(mLists), std::integral_constant<std::size_t, kIndices>{}) : void()), ...);
+	}
+
+	// Apply the Register/Unregister calls made during Notify()
+	void ApplyPending();
+
+private:
+	std::tuple<HandlerList<EventTypes>...> mLists{};
+	detail::TokenSlots<Token, Location> mTokenSlots{}; // Token -> (event, index into its handler list)
+	std::size_t mNotifyDepth{0};
+	bool mHasPending{false};
+
+}; // class StaticEventBus
+
+template<typename SenderType, typename... EventTypes>
+template<typename EventType, typename Lambda>
+inline auto StaticEventBus<SenderType, EventTypes...>::Register(Lambda&& ioLambda) -> Token
+{
+	constexpr std::size_t kIndex = IndexOf<EventType>();
+	static_assert(kIndex < sizeof...(EventTypes), "EventType is not an event of this StaticEventBus");
+	static_assert(std::is_invocable_r_v<int, Lambda, const SenderType&, const EventType&>);
+
+	// TRICKY: Handlers registered during Notify() are held aside, so the list being notified never reallocates
+	auto& list = std::get<kIndex>(mLists);
+	const bool isNotifying = (mNotifyDepth > 0);
+	auto& entries = isNotifying ? list.mAdded : list.mEntries;
+	const Token newToken = mTokenSlots.Acquire(Location{kIndex, entries.size(), isNotifying});
+	entries.push_back({newToken, HandlerType<EventType>{std::forward<Lambda>(ioLambda)}, true});
+	mHasPending = mHasPending || isNotifying;
+	return newToken;
+}
+
+template<typename SenderType, typename... EventTypes>
+inline void StaticEventBus<SenderType, EventTypes...>::Unregister(Token inToken)
+{
+	// O(1) lookup of the token's handler; a stale token (e.g., already unregistered) is ignored
+	const auto* found = mTokenSlots.Find(inToken);
+	if (found == nullptr)
+	{
+		return;
+	}
+
+	const Location location = *found;
+	mTokenSlots.Release(inToken);
+	VisitList(location.mEventIndex, [this, &location](auto& ioList, auto inIndex)
+	{
+		if (mNotifyDepth > 0)
+		{
+			// TRICKY: The handler may be the one running (unregistering itself), so it is not destroyed
+			// here: it is skipped, then removed by ApplyPending()
+			auto& entries = location.mIsAdded ? ioList.mAdded : ioList.mEntries;
+			entries[location.mIndex].mIsLive = false;
+			mHasPending = true;
+			return;
+		}
+
+		// Use an optimal O(1) removal for performance; note that list order is not considered important
+		// NOTE: `mAdded` is normally empty here, unless applying the pending changes failed
+		auto& entries = location.mIsAdded ? ioList.mAdded : ioList.mEntries;
+		if (location.mIndex != entries.size() - 1)
+		{
+			entries[location.mIndex] = std::move(entries.back());
+			mTokenSlots.Move(entries[location.mIndex].mToken, Location{inIndex, location.mIndex, location.mIsAdded});
+		}
+		entries.pop_back();
+	}, std::index_sequence_for<EventTypes...>{});
+}
+
+template<typename SenderType, typename... EventTypes>
+template<typename EventType>
+inline void StaticEventBus<SenderType, EventTypes...>::Notify(const SenderType& inSender, const EventType& inEvent)
+{
+	constexpr std::size_t kIndex = IndexOf<EventType>();
+	static_assert(kIndex < sizeof...(EventTypes), "EventType is not an event of this StaticEventBus");
+
+	// Handlers registered during this Notify() are not called by it
+	NotifyScope scope{*this};
+	auto& entries = std::get<kIndex>(mLists).mEntries;
+	const std::size_t count = entries.size();
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		auto& entry = entries[i];
+		if (entry.mIsLive)
+		{
+			entry.mHandler(inSender, inEvent);
+		}
+	}
+}
+
+template<typename SenderType, typename... EventTypes>
+inline void StaticEventBus<SenderType, EventTypes...>::ApplyPending()
+{
+	mHasPending = false;
+	auto applyList = [this](auto& ioList, auto inIndex)
+	{
+		// Remove the handlers unregistered during Notify()
+		// NOTE: Their tokens are already released (and may be reused), so only live handlers are repointed
+		auto& entries = ioList.mEntries;
+		std::size_t liveCount = 0;
+		for (std::size_t i = 0; i < entries.size(); ++i)
+		{
+			if (!entries[i].mIsLive)
+			{
+				continue;
+			}
+			if (i != liveCount)
+			{
+				entries[liveCount] = std::move(entries[i]);
+				mTokenSlots.Move(entries[liveCount].mToken, Location{inIndex, liveCount, false});
+			}
+			++liveCount;
+		}
+		entries.resize(liveCount);
+
+		// Append the handlers registered during Notify()
+		for (auto& added : ioList.mAdded)
+		{
+			if (added.mIsLive)
+			{
+				mTokenSlots.Move(added.mToken, Location{inIndex, entries.size(), false});
+				entries.push_back(std::move(added));
+			}
+		}
+		ioList.mAdded.clear();
+	};
+	std::apply([&applyList](auto&... ioLists)
+	{
+		std::size_t index = 0;
+		(applyList(ioLists, index++), ...);
+	}, mLists);
+}
+
+} // namespace saber::events
+
+#endif // SABER_EVENTS_STATICEVENTBUS_HPP
@@ -0,0 +1,54 @@
+#ifndef SABER_GEOMETRY_CLIP_HPP
+#define SABER_GEOMETRY_CLIP_HPP
+
+// saber
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/point.hpp"
+#include "saber/geometry/rectangle.hpp"
+#include "saber/geometry/rectangle_ltrb.hpp"
+#include "saber/geometry/detail/clip_helper.hpp"
+
+// std
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace saber::geometry {
+
+// ------------------------------------------------------------------
+#pragma region Segment clipping
+
+/// @brief Clip a batch of line segments to a rectangle (Liang–Barsky), so that geometry outside
+/// the rectangle never reaches a rasterizer. With `ImplKind::kSimd`, four segments are clipped per step.
+/// @tparam T Floating point coordinate type
+/// @tparam Impl Optional implementation kind (scalar or simd)
+/// @param inClip Rectangle to clip to; its edges are inclusive
+/// @param inPoints Pointer to `2 * inCount` points: segment i runs from `inPoints[2*i]` to `inPoints[2*i+1]`
+/// @param outPoints Pointer to `2 * inCount` points receiving the clipped segments; may be the same array
+/// as `inPoints`. Clipped end points keep the direction of the segment, and lie exactly on the edge
+/// clipping them. Rejected segments are left unspecified.
+/// @param inCount Number of segments
+/// @param outAcceptMask Pointer to `(inCount + 31) / 32` words: bit (i % 32) of `outAcceptMask[i / 32]`
+/// is set when any of segment i lies within `inClip`; unused high bits of the last word are cleared
+/// @return Number of accepted segments
+template<typename T, ImplKind Impl>
+inline std::size_t ClipSegments(const RectangleLTRB<T, Impl>& inClip, const Point<T, Impl>* inPoints, Point<T, Impl>* outPoints, std::size_t inCount, std::uint32_t* outAcceptMask)
+{
+	const std::array<T, 4> ltrb{inClip.Left(), inClip.Top(), inClip.Right(), inClip.Bottom()};
+	const auto acceptCount = detail::ClipHelper<T, Impl>::ClipSegments(ltrb, inPoints, outPoints, inCount, outAcceptMask);
+	return acceptCount;
+}
+
+/// @brief Clip a batch of line segments to a rectangle; see `ClipSegments(const RectangleLTRB<>&, ...)`.
+template<typename T, ImplKind Impl>
+inline std::size_t ClipSegments(const Rectangle<T, Impl>& inClip, const Point<T, Impl>* inPoints, Point<T, Impl>* outPoints, std::size_t inCount, std::uint32_t* outAcceptMask)
+{
+	const auto acceptCount = ClipSegments(RectangleLTRB<T, Impl>{inClip}, inPoints, outPoints, inCount, outAcceptMask);
+	return acceptCount;
+}
+
+#pragma endregion
+
+} // namespace saber::geometry
+
+#endif // SABER_GEOMETRY_CLIP_HPP
@@ -15,6 +15,35 @@
 #define SABER_GEOMETRY_CONFIG_ISENABLED_SIMD	1 /*0*/
 #endif // SABER_GEOMETRY_CONFIG_ISENABLED_SIMD
 
+#ifndef SABER_GEOMETRY_CONFIG_ISENABLED_SIMD_VECTOR
+/// @brief Macro controlling whether the SIMD implementation is built on the
+/// portable GCC/Clang vector extensions (`detail/simd_vector.hpp`) instead of
+/// the platform-specific SSE or NEON intrinsics. Enabled by default when no
+/// platform-specific implementation applies: CPUs other than x86 or ARM
+/// (e.g. RISC-V), or GCC/Clang x86 builds without SSE4.1 (e.g. 32bit x86).
+/// To force the vector extension implementation, specify this compiler switch:
+/// @code{.cpp}
+/// -DSABER_GEOMETRY_CONFIG_ISENABLED_SIMD_VECTOR=1
+/// @endcode
+#if SABER_CPU(ARM) || (SABER_CPU(X86) && (SABER_COMPILER(MSVC) || defined(__SSE4_1__)))
+#define SABER_GEOMETRY_CONFIG_ISENABLED_SIMD_VECTOR	0
+#else
+#define SABER_GEOMETRY_CONFIG_ISENABLED_SIMD_VECTOR	1
+#endif
+#endif // SABER_GEOMETRY_CONFIG_ISENABLED_SIMD_VECTOR
+
+#ifndef SABER_GEOMETRY_CONFIG_ISENABLED_FAST_TRIG
+/// @brief Macro controlling whether single rotation builders (`MakeRotation()`)
+/// use the library's polynomial sin/cos approximation instead of `std::sin`/`std::cos`.
+/// Batch builders (`MakeRotations()`) always use the polynomial approximation.
+/// See `detail::SinCosTraits<>` for its documented error bounds.
+/// To enable the fast trigonometry path, specify this compiler switch:
+/// @code{.cpp}
+/// -DSABER_GEOMETRY_CONFIG_ISENABLED_FAST_TRIG=1
+/// @endcode
+#define SABER_GEOMETRY_CONFIG_ISENABLED_FAST_TRIG	0
+#endif // SABER_GEOMETRY_CONFIG_ISENABLED_FAST_TRIG
+
 namespace saber::geometry {
 
 /// @brief The set of all possible implementations for saber geometry classes
@@ -30,6 +59,24 @@ enum class ImplKind
 #endif // SABER_GEOMETRY_CONFIG_ISENABLED_SIMD
 }; // enum class ImplKind
 
+/// @brief Rounding applied when converting floating point geometry to integer geometry.
+/// Each kind matches the semantics of the corresponding `RoundNearest()`,
+/// `RoundFloor()`, `RoundCeil()` and `RoundTrunc()` geometry methods.
+enum class RoundKind
+{
+	kNearest = 0,	// Halfway cases round away from zero, like `std::round()`
+	kFloor,			// Toward -infinity, like `std::floor()`
+	kCeil,			// Toward +infinity, like `std::ceil()`
+	kTrunc			// Toward zero, like `std::trunc()`
+}; // enum class RoundKind
+
+/// @brief Handling of values outside of the destination range when converting geometry.
+enum class OverflowKind
+{
+	kUnchecked = 0,	// Out of range (and NaN) values convert to an unspecified value
+	kSaturate		// Out of range values clamp to the destination limits; NaN converts to 0
+}; // enum class OverflowKind
+
 } // namespace saber::geometry
 
 #endif // SABER_GEOMETRY_CONFIG_HPP
@@ -0,0 +1,313 @@
+#ifndef SABER_GEOMETRY_DETAIL_CLIP_HELPER_HPP
+#define SABER_GEOMETRY_DETAIL_CLIP_HELPER_HPP
+
+// saber
+#include "saber/inexact.hpp"
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/detail/simd.hpp"
+
+// std
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace saber::geometry::detail {
+
+/// @brief Liang–Barsky line segment clipping against the edges {left, top, right, bottom}.
+/// Segments are consecutive pairs of points: {inPoints[2*i], inPoints[2*i+1]}; accept/reject
+/// results are bits of `std::uint32_t` words: bit (i % 32) of `outAcceptMask[i / 32]`.
+template<typename T, ImplKind Impl>
+class ClipHelper; // primary template class ClipHelper<T, Impl>
+
+// ------------------------------------------------------------------
+#pragma region ClipHelper<T, ImplKind::kScalar>
+
+template<typename T>
+class ClipHelper<T, ImplKind::kScalar>
+{
+public:
+	static_assert(std::is_floating_point_v<T>, "ClipHelper<> requires floating point coordinates");
+
+	template<typename PointT>
+	static std::size_t ClipSegments(const std::array<T, 4>& inLTRB, const PointT* inPoints, PointT* outPoints, std::size_t inCount, std::uint32_t* outAcceptMask)
+	{
+		std::size_t acceptCount = 0;
+		for (std::size_t i = 0; i < inCount; ++i)
+		{
+			const bool isAccepted = ClipSegmentAt(inLTRB, inPoints, outPoints, i);
+			SetAccepted(outAcceptMask, i, static_cast<std::uint32_t>(isAccepted));
+			acceptCount += static_cast<std::size_t>(isAccepted);
+		}
+		return acceptCount;
+	}
+
+	/// @brief Clip segment `inIndex` of `inPoints` into the same segment of `outPoints`
+	/// @return true if the segment is accepted
+	template<typename PointT>
+	static bool ClipSegmentAt(const std::array<T, 4>& inLTRB, const PointT* inPoints, PointT* outPoints, std::size_t inIndex)
+	{
+		const auto& from = inPoints[2 * inIndex];
+		const auto& to = inPoints[2 * inIndex + 1];
+		std::array<T, 4> segment{from.X(), from.Y(), to.X(), to.Y()};
+		const bool isAccepted = ClipSegment(inLTRB, segment);
+		outPoints[2 * inIndex] = PointT{segment[0], segment[1]};
+		outPoints[2 * inIndex + 1] = PointT{segment[2], segment[3]};
+		return isAccepted;
+	}
+
+	/// @brief Clip one segment {x0, y0, x1, y1} in place
+	/// @return true if any of the segment lies within the edges (then `ioSegment` is the clipped segment)
+	static bool ClipSegment(const std::array<T, 4>& inLTRB, std::array<T, 4>& ioSegment)
+	{
+		const auto [left, top, right, bottom] = inLTRB;
+		const auto [x0, y0, x1, y1] = ioSegment;
+		const T dx = x1 - x0;
+		const T dy = y1 - y0;
+
+		// Parametric range [tEnter, tExit] of x0 + t * dx within each pair of edges
+		T tEnter = 0;
+		T tExit = 1;
+		bool isAccepted = true;
+		const auto clipAxis = [&](T inFrom, T inDelta, T inLo, T inHi) -> AxisRange
+		{
+			if (inDelta == 0)
+			{
+				// Parallel to this pair of edges: wholly between them, or wholly outside
+				isAccepted = isAccepted && (inFrom >= inLo) && (inFrom <= inHi);
+				return AxisRange{-std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity(), inLo, inHi};
+			}
+
+			const T tLo = (inLo - inFrom) / inDelta;
+			const T tHi = (inHi - inFrom) / inDelta;
+			const AxisRange range = (tLo <= tHi) ? AxisRange{tLo, tHi, inLo, inHi} : AxisRange{tHi, tLo, inHi, inLo};
+			tEnter = std::max(tEnter, range.mEnterT);
+			tExit = std::min(tExit, range.mExitT);
+			return range;
+		};
+		const AxisRange rangeX = clipAxis(x0, dx, left, right);
+		const AxisRange rangeY = clipAxis(y0, dy, top, bottom);
+		isAccepted = isAccepted && ((tEnter <= tExit) || Inexact::IsEq(tEnter, tExit));
+
+		// A clipped end point is set exactly on the edge clipping it: its other coordinate is interpolated
+		// from that edge, rather than from t (whose rounding would move the point off the edge)
+		const auto clipPoint = [&](T inT, T inTX, T inEdgeX, T inTY, T inEdgeY) -> std::array<T, 2>
+		{
+			if (inT == inTX)
+			{
+				return {inEdgeX, (inT == inTY) ? inEdgeY : y0 + (inEdgeX - x0) * dy / dx};
+			}
+			return {x0 + (inEdgeY - y0) * dx / dy, inEdgeY};
+		};
+		const std::array<T, 2> from = (tEnter > 0) ? clipPoint(tEnter, rangeX.mEnterT, rangeX.mEnterEdge, rangeY.mEnterT, rangeY.mEnterEdge) : std::array<T, 2>{x0, y0};
+		const std::array<T, 2> to = (tExit < 1) ? clipPoint(tExit, rangeX.mExitT, rangeX.mExitEdge, rangeY.mExitT, rangeY.mExitEdge) : std::array<T, 2>{x1, y1};
+		ioSegment[0] = std::clamp(from[0], left, right);
+		ioSegment[1] = std::clamp(from[1], top, bottom);
+		ioSegment[2] = std::clamp(to[0], left, right);
+		ioSegment[3] = std::clamp(to[1], top, bottom);
+		return isAccepted;
+	}
+
+	/// @brief Set or clear the accept bit of segment `inIndex`; the first bit of each word clears the word
+	static void SetAccepted(std::uint32_t* outAcceptMask, std::size_t inIndex, std::uint32_t inBits)
+	{
+		auto& word = outAcceptMask[inIndex / 32];
+		if (inIndex % 32 == 0)
+		{
+			word = 0;
+		}
+		word |= inBits << (inIndex % 32);
+	}
+
+private:
+	/// @brief Parametric range of a segment between one pair of edges, and the edge at each end of it
+	struct AxisRange
+	{
+		T mEnterT{};
+		T mExitT{};
+		T mEnterEdge{};
+		T mExitEdge{};
+	};
+};
+
+#pragma endregion
+
+// ------------------------------------------------------------------
+#pragma region ClipHelper<T, ImplKind::kSimd>
+
+template<typename T>
+class ClipHelper<T, ImplKind::kSimd>
+{
+public:
+	static_assert(std::is_floating_point_v<T>, "ClipHelper<> requires floating point coordinates");
+
+	template<typename PointT>
+	static std::size_t ClipSegments(const std::array<T, 4>& inLTRB, const PointT* inPoints, PointT* outPoints, std::size_t inCount, std::uint32_t* outAcceptMask)
+	{
+		using Scalar = ClipHelper<T, ImplKind::kScalar>;
+
+		const auto left = Simd128<T>::Splat(inLTRB[0]);
+		const auto top = Simd128<T>::Splat(inLTRB[1]);
+		const auto right = Simd128<T>::Splat(inLTRB[2]);
+		const auto bottom = Simd128<T>::Splat(inLTRB[3]);
+		const auto zero = Simd128<T>::Splat(0);
+		const auto one = Simd128<T>::Splat(1);
+
+		std::size_t acceptCount = 0;
+		std::size_t i = 0;
+		for (; i + kGroup <= inCount; i += kGroup)
+		{
+			// Transpose kGroup segments into one array per coordinate (structure of arrays)
+			alignas(16) std::array<T, kGroup> x0{};
+			alignas(16) std::array<T, kGroup> y0{};
+			alignas(16) std::array<T, kGroup> x1{};
+			alignas(16) std::array<T, kGroup> y1{};
+			for (std::size_t k = 0; k < kGroup; ++k)
+			{
+				x0[k] = inPoints[2 * (i + k)].X();
+				y0[k] = inPoints[2 * (i + k)].Y();
+				x1[k] = inPoints[2 * (i + k) + 1].X();
+				y1[k] = inPoints[2 * (i + k) + 1].Y();
+			}
+
+			int acceptBits = 0;
+			int scalarBits = 0;
+			for (std::size_t v = 0; v < kGroup; v += kLanes)
+			{
+				const auto fromX = Load(&x0[v]);
+				const auto fromY = Load(&y0[v]);
+				const auto toX = Load(&x1[v]);
+				const auto toY = Load(&y1[v]);
+				const auto dx = Simd128<T>::Sub(toX, fromX);
+				const auto dy = Simd128<T>::Sub(toY, fromY);
+
+				// TRICKY: A segment parallel to a pair of edges divides by zero (0/0 = NaN on an edge);
+				// its lanes are redone by the scalar path, which tests those edges directly
+				const int parallel = Simd128<T>::EqMask(dx, zero) | Simd128<T>::EqMask(dy, zero);
+
+				const auto tLeft = Simd128<T>::Div(Simd128<T>::Sub(left, fromX), dx);
+				const auto tRight = Simd128<T>::Div(Simd128<T>::Sub(right, fromX), dx);
+				const auto tTop = Simd128<T>::Div(Simd128<T>::Sub(top, fromY), dy);
+				const auto tBottom = Simd128<T>::Div(Simd128<T>::Sub(bottom, fromY), dy);
+
+				// Parametric range of each pair of edges, and the edge at each end of it (as in the scalar path)
+				const auto enterTX = Simd128<T>::Min(tLeft, tRight);
+				const auto exitTX = Simd128<T>::Max(tLeft, tRight);
+				const auto enterTY = Simd128<T>::Min(tTop, tBottom);
+				const auto exitTY = Simd128<T>::Max(tTop, tBottom);
+				const auto enterEdgeX = Simd128<T>::Select(Simd128<T>::CompareEq(enterTX, tLeft), left, right);
+				const auto exitEdgeX = Simd128<T>::Select(Simd128<T>::CompareEq(exitTX, tRight), right, left);
+				const auto enterEdgeY = Simd128<T>::Select(Simd128<T>::CompareEq(enterTY, tTop), top, bottom);
+				const auto exitEdgeY = Simd128<T>::Select(Simd128<T>::CompareEq(exitTY, tBottom), bottom, top);
+
+				const auto tEnter = Simd128<T>::Max(Simd128<T>::Max(zero, enterTX), enterTY);
+				const auto tExit = Simd128<T>::Min(Simd128<T>::Min(one, exitTX), exitTY);
+
+				// Accept tEnter <= tExit, or tEnter "inexactly" equal to tExit, as the scalar path does: segments
+				// grazing a corner have tEnter ~= tExit. NOTE: `LeMask()` alone may miss the near-equal lanes
+				const int accept = Simd128<T>::LeMask(tEnter, tExit) | Simd128<T>::EqMask(tEnter, tExit);
+
+				// An end point inside the edges (tEnter == 0, tExit == 1) is kept as is; a clipped one is
+				// set exactly on the edge clipping it, with its other coordinate interpolated from that edge
+				const auto clipPoint = [&](SimdType inT, SimdType inTX, SimdType inEdgeX, SimdType inTY, SimdType inEdgeY, SimdType& outX, SimdType& outY)
+				{
+					const auto isEdgeX = Simd128<T>::CompareEq(inT, inTX);
+					const auto isEdgeY = Simd128<T>::CompareEq(inT, inTY);
+					const auto y = Simd128<T>::Add(fromY, Simd128<T>::Div(Simd128<T>::Mul(Simd128<T>::Sub(inEdgeX, fromX), dy), dx));
+					const auto x = Simd128<T>::Add(fromX, Simd128<T>::Div(Simd128<T>::Mul(Simd128<T>::Sub(inEdgeY, fromY), dx), dy));
+					outX = Simd128<T>::Select(isEdgeX, inEdgeX, x);
+					outY = Simd128<T>::Select(isEdgeY, inEdgeY, Simd128<T>::Select(isEdgeX, y, inEdgeY));
+				};
+				SimdType enterX{};
+				SimdType enterY{};
+				SimdType exitX{};
+				SimdType exitY{};
+				clipPoint(tEnter, enterTX, enterEdgeX, enterTY, enterEdgeY, enterX, enterY);
+				clipPoint(tExit, exitTX, exitEdgeX, exitTY, exitEdgeY, exitX, exitY);
+				const auto isEnterInside = Simd128<T>::CompareEq(tEnter, zero);
+				const auto isExitInside = Simd128<T>::CompareEq(tExit, one);
+				Store(&x0[v], Clamp(Simd128<T>::Select(isEnterInside, fromX, enterX), left, right));
+				Store(&y0[v], Clamp(Simd128<T>::Select(isEnterInside, fromY, enterY), top, bottom));
+				Store(&x1[v], Clamp(Simd128<T>::Select(isExitInside, toX, exitX), left, right));
+				Store(&y1[v], Clamp(Simd128<T>::Select(isExitInside, toY, exitY), top, bottom));
+
+				acceptBits |= (accept & kLaneMask) << v;
+				scalarBits |= (parallel & kLaneMask) << v;
+			}
+
+			for (std::size_t k = 0; k < kGroup; ++k)
+			{
+				if ((scalarBits >> k) & 1)
+				{
+					const int isAccepted = static_cast<int>(Scalar::ClipSegmentAt(inLTRB, inPoints, outPoints, i + k));
+					acceptBits = (acceptBits & ~(1 << k)) | (isAccepted << k);
+					continue;
+				}
+				outPoints[2 * (i + k)] = PointT{x0[k], y0[k]};
+				outPoints[2 * (i + k) + 1] = PointT{x1[k], y1[k]};
+			}
+
+			// NOTE: kGroup divides 32, so a group never straddles two mask words
+			Scalar::SetAccepted(outAcceptMask, i, static_cast<std::uint32_t>(acceptBits));
+			for (std::size_t k = 0; k < kGroup; ++k)
+			{
+				acceptCount += static_cast<std::size_t>((acceptBits >> k) & 1);
+			}
+		}
+
+		// Remaining (fewer than kGroup) segments
+		for (; i < inCount; ++i)
+		{
+			const bool isAccepted = Scalar::ClipSegmentAt(inLTRB, inPoints, outPoints, i);
+			Scalar::SetAccepted(outAcceptMask, i, static_cast<std::uint32_t>(isAccepted));
+			acceptCount += static_cast<std::size_t>(isAccepted);
+		}
+		return acceptCount;
+	}
+
+private:
+	using SimdType = typename Simd128<T>::SimdType;
+
+	/// @brief Segments clipped per iteration: one vector of 4x 32bit lanes, or two of 2x 64bit lanes
+	static constexpr std::size_t kGroup = 4;
+	static constexpr std::size_t kLanes = Simd128Traits<T>::kSize;
+	static constexpr int kLaneMask = (1 << kLanes) - 1;
+	static_assert(kGroup % kLanes == 0, "ClipHelper<> requires whole vectors per group");
+
+	static SimdType Load(const T* inAddr)
+	{
+		if constexpr (kLanes == 4)
+		{
+			return Simd128<T>::Load4(inAddr);
+		}
+		else
+		{
+			return Simd128<T>::Load2(inAddr);
+		}
+	}
+
+	static void Store(T* outAddr, SimdType inStore)
+	{
+		if constexpr (kLanes == 4)
+		{
+			Simd128<T>::Store4(outAddr, inStore);
+		}
+		else
+		{
+			Simd128<T>::Store2(outAddr, inStore);
+		}
+	}
+
+	static SimdType Clamp(SimdType inSimd, SimdType inLo, SimdType inHi)
+	{
+		return Simd128<T>::Max(inLo, Simd128<T>::Min(inHi, inSimd));
+	}
+};
+
+#pragma endregion
+
+} // namespace saber::geometry::detail
+
+#endif // SABER_GEOMETRY_DETAIL_CLIP_HELPER_HPP
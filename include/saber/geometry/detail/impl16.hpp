@@ -0,0 +1,277 @@
+#ifndef SABER_GEOMETRY_DETAIL_IMPL16_HPP
+#define SABER_GEOMETRY_DETAIL_IMPL16_HPP
+
+// saber
+#include "saber/inexact.hpp"
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/detail/impl4.hpp"
+#include "saber/geometry/detail/simd.hpp"
+
+// std
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace saber::geometry::detail {
+
+/// @brief 16 element storage used by 4x4 (and row-padded 3x3) matrices.
+/// Elements are stored row-major: 4 rows of 4 elements, so each row
+/// is exactly one 128bit SIMD vector for 32bit types (or two for 64bit types).
+template<typename T>
+struct Impl16 final
+{
+	static constexpr std::size_t kSize = 16;
+
+	class Simd;
+
+	class Scalar
+	{
+	public:
+		// default ctor
+		constexpr Scalar() = default;
+		~Scalar() = default;
+
+		// alt ctor
+		constexpr Scalar(T in0, T in1, T in2, T in3, T in4, T in5, T in6, T in7,
+						 T in8, T in9, T in10, T in11, T in12, T in13, T in14, T in15) :
+			mArray{in0, in1, in2, in3, in4, in5, in6, in7, in8, in9, in10, in11, in12, in13, in14, in15}
+		{
+			// Do nothing
+		}
+
+		template<std::size_t Index>
+		constexpr const T& Get() const
+		{
+			static_assert(Index < kSize, "Provided index out of bounds.");
+			return mArray[Index];
+		}
+
+		template<std::size_t Index>
+		constexpr T& Get()
+		{
+			static_assert(Index < kSize, "Provided index out of bounds.");
+			return mArray[Index];
+		}
+
+		constexpr Scalar& operator+=(const Scalar& inRHS)
+		{
+			for (std::size_t i = 0; i < kSize; ++i)
+			{
+				mArray[i] += inRHS.mArray[i];
+			}
+			return *this;
+		}
+
+		constexpr Scalar& operator-=(const Scalar& inRHS)
+		{
+			for (std::size_t i = 0; i < kSize; ++i)
+			{
+				mArray[i] -= inRHS.mArray[i];
+			}
+			return *this;
+		}
+
+		constexpr bool IsEqual(const Scalar& inRHS) const
+		{
+			bool result = true;
+			for (std::size_t i = 0; i < kSize && result; ++i)
+			{
+				if constexpr (std::is_floating_point_v<T>)
+				{
+					// Floating point comparisons are always inexact within an epsilon
+					result = Inexact::IsEq(mArray[i], inRHS.mArray[i]);
+				}
+				else
+				{
+					// Integer comparisons are always exact
+					result = (mArray[i] == inRHS.mArray[i]);
+				}
+			}
+			return result;
+		}
+
+	private:
+		friend class Simd; // Permit Simd class to provide constexpr api
+
+	private:
+		std::array<T, kSize> mArray{}; // Impl16: so 16 elements are assumed
+	}; // class Scalar
+
+	class Simd
+	{
+	public:
+		// default ctor
+		constexpr Simd() = default;
+		~Simd() = default;
+
+		// alt ctor
+		constexpr Simd(T in0, T in1, T in2, T in3, T in4, T in5, T in6, T in7,
+					   T in8, T in9, T in10, T in11, T in12, T in13, T in14, T in15) :
+			mArray{{in0, in1, in2, in3, in4, in5, in6, in7, in8, in9, in10, in11, in12, in13, in14, in15}}
+		{
+			// Do nothing
+		}
+
+		template<std::size_t Index>
+		constexpr const T& Get() const
+		{
+			static_assert(Index < kSize, "Provided index out of bounds.");
+			return mArray[Index];
+		}
+
+		template<std::size_t Index>
+		constexpr T& Get()
+		{
+			static_assert(Index < kSize, "Provided index out of bounds.");
+			return mArray[Index];
+		}
+
+		constexpr Simd& operator+=(const Simd& inRHS)
+		{
+			do
+			{
+#if __cpp_lib_is_constant_evaluated
+				if (std::is_constant_evaluated())
+				{
+					// Delegate to Scalar Impl which is constexpr capable
+					Scalar lhs{};
+					Scalar rhs{};
+					lhs.mArray = mArray;
+					rhs.mArray = inRHS.mArray;
+					lhs += rhs;
+					mArray = lhs.mArray;
+					break;
+				}
+#endif // __cpp_lib_is_constant_evaluated
+
+				// 16 elements: 4 loads of 32bit (or smaller) data types, or 8 loads of 64bit data types
+				constexpr std::size_t kStep = kLoadSize;
+				for (std::size_t i = 0; i < kSize; i += kStep)
+				{
+					auto lhs = Load(&mArray[i]);
+					auto rhs = Load(&inRHS.mArray[i]);
+					auto result = Simd128<T>::Add(lhs, rhs);
+					Store(&mArray[i], result);
+				}
+			} while (false);
+
+			return *this;
+		}
+
+		constexpr Simd& operator-=(const Simd& inRHS)
+		{
+			do
+			{
+#if __cpp_lib_is_constant_evaluated
+				if (std::is_constant_evaluated())
+				{
+					// Delegate to Scalar Impl which is constexpr capable
+					Scalar lhs{};
+					Scalar rhs{};
+					lhs.mArray = mArray;
+					rhs.mArray = inRHS.mArray;
+					lhs -= rhs;
+					mArray = lhs.mArray;
+					break;
+				}
+#endif // __cpp_lib_is_constant_evaluated
+
+				constexpr std::size_t kStep = kLoadSize;
+				for (std::size_t i = 0; i < kSize; i += kStep)
+				{
+					auto lhs = Load(&mArray[i]);
+					auto rhs = Load(&inRHS.mArray[i]);
+					auto result = Simd128<T>::Sub(lhs, rhs);
+					Store(&mArray[i], result);
+				}
+			} while (false);
+
+			return *this;
+		}
+
+		constexpr bool IsEqual(const Simd& inRHS) const
+		{
+			bool isEqual = true;
+			do
+			{
+#if __cpp_lib_is_constant_evaluated
+				if (std::is_constant_evaluated())
+				{
+					// Delegate to Scalar Impl which is constexpr capable
+					Scalar lhs{};
+					Scalar rhs{};
+					lhs.mArray = mArray;
+					rhs.mArray = inRHS.mArray;
+					isEqual = lhs.IsEqual(rhs);
+					break;
+				}
+#endif // __cpp_lib_is_constant_evaluated
+
+				constexpr std::size_t kStep = kLoadSize;
+				for (std::size_t i = 0; i < kSize && isEqual; i += kStep)
+				{
+					auto lhs = Load(&mArray[i]);
+					auto rhs = Load(&inRHS.mArray[i]);
+					isEqual = Simd128<T>::IsEq(lhs, rhs);
+				}
+			} while (false);
+
+			return isEqual;
+		}
+
+	private:
+		/// @brief Number of elements read by each `Load()`
+		static constexpr std::size_t kLoadSize = Is32BitDataType<T>() ? 4 : 2;
+
+		// A whole 128bit vector: 4x 32bit elements, or 2x 64bit elements
+		static auto Load(const T* inAddr)
+		{
+			if constexpr (Is32BitDataType<T>())
+			{
+				return Simd128<T>::Load4(inAddr);
+			}
+			else
+			{
+				return Simd128<T>::Load2(inAddr);
+			}
+		}
+
+		static void Store(T* outAddr, typename Simd128<T>::SimdType inStore)
+		{
+			if constexpr (Is32BitDataType<T>())
+			{
+				Simd128<T>::Store4(outAddr, inStore);
+			}
+			else
+			{
+				Simd128<T>::Store2(outAddr, inStore);
+			}
+		}
+
+	private:
+		// TRICKY: Each row is loaded with aligned 128bit loads, so storage must be kSimdAlignment aligned
+		alignas(SimdStorageAlignment<T, kSize>()) std::array<T, kSize> mArray{}; // Impl16: so 16 elements are assumed
+	}; // class Simd
+}; // struct Impl16<>
+
+#pragma region struct Impl16Traits
+template<typename T, ImplKind Impl> // Primary template declaration
+struct Impl16Traits;
+
+template<typename T> // Partial template specialization
+struct Impl16Traits<T, ImplKind::kScalar>
+{
+	using ImplType = typename Impl16<T>::Scalar; // VOODOO: Nested template type requires `typename` prefix
+};
+
+template<typename T> // Partial template specialization
+struct Impl16Traits<T, ImplKind::kSimd>
+{
+	using ImplType = typename Impl16<T>::Simd; // VOODOO: Nested template type requires `typename` prefix
+};
+
+#pragma endregion
+
+} // namespace saber::geometry::detail
+
+#endif // SABER_GEOMETRY_DETAIL_IMPL16_HPP
@@ -73,6 +73,13 @@ struct Impl2 final
             return *this;
         }
 
+        constexpr Scalar& DivBy(const Divisor<T>& inDivisor)
+        {
+            std::get<0>(mTuple) = inDivisor.Divide(std::get<0>(mTuple));
+            std::get<1>(mTuple) = inDivisor.Divide(std::get<1>(mTuple));
+            return *this;
+        }
+
         constexpr bool IsEqual(const Scalar& inRHS) const
         {
             // Point said to copy/paste this section into the scalar portion
@@ -127,6 +134,20 @@ struct Impl2 final
             std::get<1>(mTuple) = std::trunc(std::get<1>(mTuple));
         }
 
+        template<RoundKind Round, OverflowKind Overflow, typename FromT>
+        void ConvertFrom(const typename Impl2<FromT>::Scalar& inImpl2)
+        {
+            std::get<0>(mTuple) = ConvertValue<T, Round, Overflow>(inImpl2.template Get<0>());
+            std::get<1>(mTuple) = ConvertValue<T, Round, Overflow>(inImpl2.template Get<1>());
+        }
+
+        template<RoundKind Round, OverflowKind Overflow, typename FromT>
+        static void ConvertFrom2(const typename Impl2<FromT>::Scalar& inFirst, const typename Impl2<FromT>::Scalar& inSecond, Scalar& outFirst, Scalar& outSecond)
+        {
+            outFirst.template ConvertFrom<Round, Overflow, FromT>(inFirst);
+            outSecond.template ConvertFrom<Round, Overflow, FromT>(inSecond);
+        }
+
     private:
         friend class Simd; // Permit Simd class to provide constexpr api
 
@@ -166,6 +187,11 @@ struct Impl2 final
             return Simd128<T>::Load2(&mArray[0]);
         }
 
+        constexpr void SetSimdType(typename Simd128<T>::SimdType inSimd)
+        {
+            Simd128<T>::Store2(&mArray[0], inSimd);
+        }
+
         constexpr Simd& operator+=(const Simd& inRHS)
         {
             // NOTE: SIMD intrinsic functions lack a constexpr implementation; contaminating our interface
@@ -277,6 +303,40 @@ struct Impl2 final
             return *this;
         }
 
+        constexpr Simd& DivBy(const Divisor<T>& inDivisor)
+        {
+            // protect our interface so it can remain constexpr
+            do 
+            {
+#if __cpp_lib_is_constant_evaluated
+                if (std::is_constant_evaluated())
+                {
+                    // Delegate to Scalar Impl which is constexpr capable
+                    Scalar lhs{mArray[0], mArray[1]};
+                    lhs.DivBy(inDivisor);
+                    mArray[0] = lhs.template Get<0>();
+                    mArray[1] = lhs.template Get<1>();
+                    break;
+                }
+#endif // __cpp_lib_is_constant_evaluated
+
+                if constexpr (std::is_same_v<T, int> || std::is_floating_point_v<T>)
+                {
+                    auto lhs = Simd128<T>::Load2(&mArray[0]);
+                    auto result = Simd128<T>::DivBy(lhs, inDivisor);
+                    Simd128<T>::Store2(&mArray[0], result);
+                }
+                else
+                {
+                    // Compact element types (e.g. `std::int16_t`) divide one element at a time
+                    mArray[0] = inDivisor.Divide(mArray[0]);
+                    mArray[1] = inDivisor.Divide(mArray[1]);
+                }
+            } while (false);
+
+            return *this;
+        }
+
         constexpr bool IsEqual(const Simd& inRHS) const
         {
             bool result = false;
@@ -410,8 +470,50 @@ struct Impl2 final
             } while (false);
         }
 
+        template<RoundKind Round, OverflowKind Overflow, typename FromT>
+        void ConvertFrom(const typename Impl2<FromT>::Simd& inImpl2)
+        {
+            if constexpr (std::is_same_v<T, int> && std::is_floating_point_v<FromT>)
+            {
+                // Round, convert (and saturate) both elements in a single vector operation
+                Simd128<FromT>::template ConvertStore2<Round, Overflow>(&mArray[0], inImpl2.GetSimdType());
+            }
+            else if constexpr (IsSimdLoadStoreConvertible<T, FromT>())
+            {
+                // Same float lanes: widen on load, narrow on store (e.g. Half <-> float)
+                Simd128<T>::Store2(&mArray[0], Simd128<FromT>::Load2(&inImpl2.template Get<0>()));
+            }
+            else
+            {
+                mArray[0] = ConvertValue<T, Round, Overflow>(inImpl2.template Get<0>());
+                mArray[1] = ConvertValue<T, Round, Overflow>(inImpl2.template Get<1>());
+            }
+        }
+
+        // Convert two pairs at once: 2x 2 floats fill a whole 128bit conversion, where one pair only uses half
+        template<RoundKind Round, OverflowKind Overflow, typename FromT>
+        static void ConvertFrom2(const typename Impl2<FromT>::Simd& inFirst, const typename Impl2<FromT>::Simd& inSecond, Simd& outFirst, Simd& outSecond)
+        {
+            if constexpr (std::is_same_v<T, int> && std::is_same_v<FromT, float>)
+            {
+                alignas(16) const std::array<float, 4> from{inFirst.template Get<0>(), inFirst.template Get<1>(), inSecond.template Get<0>(), inSecond.template Get<1>()};
+                alignas(16) std::array<int, 4> to{};
+                Simd128<float>::template ConvertStore4<Round, Overflow>(to.data(), Simd128<float>::Load4(from.data()));
+                outFirst.mArray = {to[0], to[1]};
+                outSecond.mArray = {to[2], to[3]};
+            }
+            else
+            {
+                outFirst.template ConvertFrom<Round, Overflow, FromT>(inFirst);
+                outSecond.template ConvertFrom<Round, Overflow, FromT>(inSecond);
+            }
+        }
+
     private:
-        std::array<T,2> mArray{}; // Impl2: so 2 elements are assumed
+        // TRICKY: Align to the whole 2 element pair rather than kSimdAlignment. 2x 64bit elements
+        // are a full (aligned) 128bit vector, while 2x 32bit (or 16bit) elements only use 64bit
+        // (or 32bit) loads/stores which have no alignment requirement; so Point<float> is not bloated.
+        alignas(SimdStorageAlignment<T, 2>()) std::array<T,2> mArray{}; // Impl2: so 2 elements are assumed
     }; // class Simd
 }; // struct Impl2<>
 
@@ -119,6 +119,15 @@ struct Impl4 final
 			return *this;
 		}
 
+		constexpr Scalar& DivBy(const Divisor<T>& inDivisor)
+		{
+			Get<0>() = inDivisor.Divide(Get<0>());
+			Get<1>() = inDivisor.Divide(Get<1>());
+			Get<2>() = inDivisor.Divide(Get<2>());
+			Get<3>() = inDivisor.Divide(Get<3>());
+			return *this;
+		}
+
 		constexpr bool IsEqual(const Scalar& inRHS) const
 		{
 			// Point said to copy/paste this section into the scalar portion
@@ -186,6 +195,15 @@ struct Impl4 final
 			Get<3>() = std::trunc(Get<3>()); // 3 = Size.Height
 		}
 
+		template<RoundKind Round, OverflowKind Overflow, typename FromT>
+		void ConvertFrom(const typename Impl4<FromT>::Scalar& inImpl4)
+		{
+			Get<0>() = ConvertValue<T, Round, Overflow>(inImpl4.template Get<0>());
+			Get<1>() = ConvertValue<T, Round, Overflow>(inImpl4.template Get<1>());
+			Get<2>() = ConvertValue<T, Round, Overflow>(inImpl4.template Get<2>());
+			Get<3>() = ConvertValue<T, Round, Overflow>(inImpl4.template Get<3>());
+		}
+
 		constexpr Scalar& Union(const Scalar& inImpl4)
 		{
 			// By default Scalar is in X,Y,Width,Height format
@@ -224,7 +242,7 @@ struct Impl4 final
 
 			// Figure out the top left of the intersect rectangle
 			Get<2>() = std::min(Get<2>(), rhs.Get<2>());
-			Get<3>() = std::min(Get<3>(), rhs.Get<2>());
+			Get<3>() = std::min(Get<3>(), rhs.Get<3>());
 
 			// Remember to revert back to XYWH format
 			FromLTRB(*this);
@@ -236,97 +254,117 @@ struct Impl4 final
 		}
 
 		constexpr bool IsOverlapping(const typename Impl2<T>::Scalar& inImpl2) const
+		{
+			const bool isOverlapping = (OverlapMask(inImpl2) == 0x3);
+			return isOverlapping;
+		}
+
+		/// @brief Branchless point in rectangle test, per axis: no early out, so no mispredicted branches in hit testing loops
+		/// @return Bit 0 set if x lies within [left, right); bit 1 set if y lies within [top, bottom)
+		constexpr int OverlapMask(const typename Impl2<T>::Scalar& inImpl2) const
 		{
 			Scalar ltrb = *this;
 			ToLTRB(ltrb);
-			bool isOverlapping = false;
-			do 
-			{
-				// Test the x and left component
-				if (inImpl2.template Get<0>() < ltrb.Get<0>()) // Not greater than or equal
-				{
-					// Extra step needed for floating point equality
-					if constexpr(std::is_floating_point_v<T>)
-					{
-						// Approximately equal values are contained within the rectangle
-						// Eg. x = 2.99999..., left = 3.0
-						if (!Inexact::IsEq(inImpl2.template Get<0>(), ltrb.Get<0>()))
-						{
-							break;
-						}
-						// Continue checking, since point is approximately contained within the rectangle
-					}
-					else
-					{
-						// Point is left of the rectangle
-						break;
-					}
-				}
+			const T x = inImpl2.template Get<0>();
+			const T y = inImpl2.template Get<1>();
+
+			// NOTE: bitwise (not logical) operators, so every comparison is evaluated
+			const int isInX = static_cast<int>(IsGe(x, ltrb.Get<0>()) & !IsGe(x, ltrb.Get<2>()));
+			const int isInY = static_cast<int>(IsGe(y, ltrb.Get<1>()) & !IsGe(y, ltrb.Get<3>()));
+			const int overlapMask = isInX | (isInY << 1);
+			return overlapMask;
+		}
 
-				// Test the y and top component
-				if (inImpl2.template Get<1>() < ltrb.Get<1>()) // Not greater than or equal
-				{
-					// Extra step needed for floating point equality
-					if constexpr(std::is_floating_point_v<T>)
-					{
-						// Approximately equal values are contained within the rectangle
-						// Eg. y = 2.99999..., top = 3.0
-						if (!Inexact::IsEq(inImpl2.template Get<1>(), ltrb.Get<1>()))
-						{
-							break;
-						}
-						// Continue checking, since point is approximately contained within the rectangle
-					}
-					// Point is above the rectangle
-					else
-					{
-						break;
-					}
-				}
+		/// @brief Test whether `inImpl4` lies entirely within this rectangle (edges may touch)
+		constexpr bool Contains(const Scalar& inImpl4) const
+		{
+			const bool isContained = (ContainsMask(inImpl4) == 0xF);
+			return isContained;
+		}
 
-				{
-					// Test the x and right component
-					if (inImpl2.template Get<0>() >= ltrb.Get<2>()) // Not less than
-					{
-						break;
-					}
+		/// @brief Branchless rectangle containment test, per edge
+		/// @return Bits 0..3 set if the left, top, right and bottom edges of `inImpl4` lie within this rectangle
+		constexpr int ContainsMask(const Scalar& inImpl4) const
+		{
+			Scalar outer = *this;
+			Scalar inner = inImpl4;
+			ToLTRB(outer);
+			ToLTRB(inner);
+
+			const int containsMask = static_cast<int>(IsGe(inner.Get<0>(), outer.Get<0>()))
+				| (static_cast<int>(IsGe(inner.Get<1>(), outer.Get<1>())) << 1)
+				| (static_cast<int>(IsGe(outer.Get<2>(), inner.Get<2>())) << 2)
+				| (static_cast<int>(IsGe(outer.Get<3>(), inner.Get<3>())) << 3);
+			return containsMask;
+		}
 
-					// Extra step needed for floating point equality
-					if constexpr(std::is_floating_point_v<T>)
-					{
-						// Approximately equal values are not contained within the rectangle
-						// Eg. y = 2.99999..., right = 3.0
-						if (Inexact::IsEq(inImpl2.template Get<0>(), ltrb.Get<2>()))
-						{
-							break;
-						}
-					}
-				}
+		/// @brief Test one point against `N` rectangles
+		/// @return Bit i set if `inImpl2` lies within `*inImpl4s[i]`
+		template<std::size_t N>
+		static constexpr int HitMask(const std::array<const Scalar*, N>& inImpl4s, const typename Impl2<T>::Scalar& inImpl2)
+		{
+			int hitMask = 0;
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const int isHit = static_cast<int>(inImpl4s[i]->OverlapMask(inImpl2) == 0x3);
+				hitMask |= isHit << i;
+			}
+			return hitMask;
+		}
 
-				{
-					// Test the y and bottom component
-					if (inImpl2.template Get<1>() >= ltrb.Get<3>()) // Not less than 
-					{
-						break;
-					}
+		/// @brief Union of `inCount` rectangles: running left/top minimums and right/bottom maximums,
+		/// converted back to XYWH once at the end rather than once per rectangle.
+		/// @param inGet Callable as `inGet(i)`, returning the i'th rectangle's `const Scalar&`
+		/// @return The union; empty (zero) when `inCount` is 0
+		template<typename GetT>
+		static constexpr Scalar UnionAll(std::size_t inCount, GetT&& inGet)
+		{
+			Scalar result{};
+			if (inCount == 0)
+			{
+				return result;
+			}
 
-					// Extra step needed for floating point equality
-					if constexpr(std::is_floating_point_v<T>)
-					{
-						// Approximately equal values are not contained within the rectangle
-						// Eg. y = 2.99999..., bottom = 3.0
-						if (Inexact::IsEq(inImpl2.template Get<1>(), ltrb.Get<3>()))
-						{
-							break;
-						}
-					}
-				}
+			result = inGet(0);
+			ToLTRB(result);
+			for (std::size_t i = 1; i < inCount; ++i)
+			{
+				Scalar ltrb = inGet(i);
+				ToLTRB(ltrb);
+				result.Get<0>() = std::min(result.Get<0>(), ltrb.Get<0>());
+				result.Get<1>() = std::min(result.Get<1>(), ltrb.Get<1>());
+				result.Get<2>() = std::max(result.Get<2>(), ltrb.Get<2>());
+				result.Get<3>() = std::max(result.Get<3>(), ltrb.Get<3>());
+			}
+			FromLTRB(result);
+			return result;
+		}
 
-				// Point is contained within the rectangle
-				isOverlapping = true;
-			} while (false);
+		/// @brief Bounding box of `inCount` points: from the minimum to the maximum x and y.
+		/// @param inGet Callable as `inGet(i)`, returning the i'th point's `const Impl2<T>::Scalar&`
+		/// @return The bounding box; empty (zero) when `inCount` is 0
+		template<typename GetT>
+		static constexpr Scalar BoundingBox(std::size_t inCount, GetT&& inGet)
+		{
+			Scalar result{};
+			if (inCount == 0)
+			{
+				return result;
+			}
 
-			return isOverlapping;
+			const auto& first = inGet(0);
+			result.Get<0>() = result.Get<2>() = first.template Get<0>();
+			result.Get<1>() = result.Get<3>() = first.template Get<1>();
+			for (std::size_t i = 1; i < inCount; ++i)
+			{
+				const auto& point = inGet(i);
+				result.Get<0>() = std::min(result.Get<0>(), point.template Get<0>());
+				result.Get<1>() = std::min(result.Get<1>(), point.template Get<1>());
+				result.Get<2>() = std::max(result.Get<2>(), point.template Get<0>());
+				result.Get<3>() = std::max(result.Get<3>(), point.template Get<1>());
+			}
+			FromLTRB(result);
+			return result;
 		}
 
 		constexpr bool IsOverlapping(const Scalar& inImpl4) const
@@ -352,6 +390,18 @@ struct Impl4 final
 			inLTRB.Get<3>() -= inLTRB.Get<1>();
 		}
 
+		/// @brief `inLHS >= inRHS`; floating point values approximately equal (`Inexact::IsEq()`) are also "greater or equal"
+		static constexpr bool IsGe(T inLHS, T inRHS)
+		{
+			bool isGe = (inLHS >= inRHS);
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				// Eg. x = 2.99999..., left = 3.0
+				isGe = isGe | Inexact::IsEq(inLHS, inRHS);
+			}
+			return isGe;
+		}
+
 		// Friend meaning free function (and always public)
 		friend constexpr bool IsEmpty(const Scalar& inScalar)
 		{
@@ -634,6 +684,56 @@ struct Impl4 final
 			return *this;
 		}
 
+		constexpr Simd& DivBy(const Divisor<T>& inDivisor)
+		{
+			// protect our interface so it can remain constexpr
+			do 
+			{
+#if __cpp_lib_is_constant_evaluated
+				if (std::is_constant_evaluated())
+				{
+					// Delegate to Scalar Impl which is constexpr capable
+					Scalar lhs{Get<0>(), Get<1>(), Get<2>(), Get<3>()};
+					lhs.DivBy(inDivisor);
+					Get<0>() = lhs.Get<0>();
+					Get<1>() = lhs.Get<1>();
+					Get<2>() = lhs.Get<2>();
+					Get<3>() = lhs.Get<3>();
+					break;
+				}
+#endif // __cpp_lib_is_constant_evaluated
+
+				if constexpr (std::is_same_v<T, int> || std::is_same_v<T, float>) // 32 bit data type
+				{
+					// 32 bits means 4 elements at a time
+					auto lhs = Simd128<T>::Load4(&Get<0>());
+					auto result = Simd128<T>::DivBy(lhs, inDivisor);
+					Simd128<T>::Store4(&Get<0>(), result);
+				}
+				else if constexpr (std::is_same_v<T, double>) // 64 bit data type
+				{
+					// 64 bits means 2 elements at a time
+					auto lhs = Simd128<T>::Load2(&Get<0>());
+					auto result = Simd128<T>::DivBy(lhs, inDivisor);
+					Simd128<T>::Store2(&Get<0>(), result);
+
+					lhs = Simd128<T>::Load2(&Get<2>());
+					result = Simd128<T>::DivBy(lhs, inDivisor);
+					Simd128<T>::Store2(&Get<2>(), result);
+				}
+				else
+				{
+					// Compact element types (e.g. `std::int16_t`) divide one element at a time
+					Get<0>() = inDivisor.Divide(Get<0>());
+					Get<1>() = inDivisor.Divide(Get<1>());
+					Get<2>() = inDivisor.Divide(Get<2>());
+					Get<3>() = inDivisor.Divide(Get<3>());
+				}
+			} while (false);
+
+			return *this;
+		}
+
 		constexpr bool IsEqual(const Simd& inRHS) const
 		{
 			bool isEqual = false;
@@ -871,6 +971,49 @@ struct Impl4 final
 			} while (false);
 		}
 
+		template<RoundKind Round, OverflowKind Overflow, typename FromT>
+		void ConvertFrom(const typename Impl4<FromT>::Simd& inImpl4)
+		{
+			if constexpr (std::is_same_v<T, int> && std::is_floating_point_v<FromT> && Is32BitDataType<FromT>())
+			{
+				// Round, convert (and saturate) all 4 elements in a single vector operation
+				auto convert = Simd128<FromT>::Load4(&inImpl4.template Get<0>());
+				Simd128<FromT>::template ConvertStore4<Round, Overflow>(&Get<0>(), convert);
+			}
+			else if constexpr (std::is_same_v<T, int> && std::is_floating_point_v<FromT> && Is64BitDataType<FromT>())
+			{
+				// 64 bits means 2 elements at a time
+				auto convert1 = Simd128<FromT>::Load2(&inImpl4.template Get<0>());
+				Simd128<FromT>::template ConvertStore2<Round, Overflow>(&Get<0>(), convert1);
+
+				auto convert2 = Simd128<FromT>::Load2(&inImpl4.template Get<2>());
+				Simd128<FromT>::template ConvertStore2<Round, Overflow>(&Get<2>(), convert2);
+			}
+			else if constexpr (IsSimdLoadStoreConvertible<T, FromT>())
+			{
+				// Same float lanes: widen on load, narrow on store (e.g. Half <-> float)
+				Simd128<T>::Store4(&Get<0>(), Simd128<FromT>::Load4(&inImpl4.template Get<0>()));
+			}
+			else if constexpr (std::is_same_v<T, int> && std::is_same_v<FromT, std::int16_t>)
+			{
+				// Sign extend all 4 elements in a single vector operation
+				Simd128<T>::Store4(&Get<0>(), Simd128<FromT>::template LoadWiden4<T>(&inImpl4.template Get<0>()));
+			}
+			else if constexpr (std::is_same_v<T, std::int16_t> && std::is_same_v<FromT, int>)
+			{
+				// Narrow all 4 elements in a single vector operation: out of range values saturate,
+				// which satisfies both OverflowKind::kSaturate and (unspecified) kUnchecked
+				Simd128<T>::template NarrowStore4<FromT>(&Get<0>(), Simd128<FromT>::Load4(&inImpl4.template Get<0>()));
+			}
+			else
+			{
+				Get<0>() = ConvertValue<T, Round, Overflow>(inImpl4.template Get<0>());
+				Get<1>() = ConvertValue<T, Round, Overflow>(inImpl4.template Get<1>());
+				Get<2>() = ConvertValue<T, Round, Overflow>(inImpl4.template Get<2>());
+				Get<3>() = ConvertValue<T, Round, Overflow>(inImpl4.template Get<3>());
+			}
+		}
+
 		constexpr Simd& Union(const Simd& inImpl4)
 		{
 			if constexpr (Is32BitDataType<T>()) // Int/Float up to 32 bit data type
@@ -887,23 +1030,23 @@ struct Impl4 final
 			}
 			else if constexpr (Is64BitDataType<T>()) // Double up to 64 bit data type
 			{
-				// Find the minimum of the left and top values
 				Simd ltrb = inImpl4;
-
+				// Find the minimum of the left and top values
 				auto lt1 = Simd128<T>::Load2(&Get<0>());
 				auto lt2 = Simd128<T>::Load2(&ltrb.Get<0>());
-				auto result = Simd128<T>::Min(lt1, lt2);
-				Simd128<T>::Store2(&Get<0>(), result);
+				auto unionLT = Simd128<T>::Min(lt1, lt2);
 
 				// Find the maximum of the right and bottom values
-				// NOTE: Requires ToLTRB() conversion of width/height to right/bottom
+				// NOTE: Requires ToLTRB() conversion of width/height to right/bottom,
+				// from the original left and top: store the new left and top only afterwards
 				ToLTRB(*this);
 				ToLTRB(ltrb);
 				auto rb1 = Simd128<T>::Load2(&Get<2>());
 				auto rb2 = Simd128<T>::Load2(&ltrb.Get<2>());
-				result = Simd128<T>::Max(rb1, rb2);
+				auto unionRB = Simd128<T>::Max(rb1, rb2);
 
-				Simd128<T>::Store2(&Get<2>(), result);
+				Simd128<T>::Store2(&Get<0>(), unionLT);
+				Simd128<T>::Store2(&Get<2>(), unionRB);
 				// Now convert right and bottom to width and height
 				FromLTRB(*this);
 			}
@@ -960,40 +1103,169 @@ struct Impl4 final
 
 		constexpr bool IsOverlapping(const typename Impl2<T>::Simd& inImpl2) const
 		{
-			bool isOverlapping = false;
+			const bool isOverlapping = (OverlapMask(inImpl2) == 0x3);
+			return isOverlapping;
+		}
+
+		/// @brief Branchless point in rectangle test, per axis: one lane mask instead of separately branching on each comparison
+		/// @return Bit 0 set if x lies within [left, right); bit 1 set if y lies within [top, bottom)
+		constexpr int OverlapMask(const typename Impl2<T>::Simd& inImpl2) const
+		{
 			Simd ltrb = *this;
 			ToLTRB(ltrb);
 
-			auto lt = Simd128<T>::Load2(&ltrb.Get<0>());
-			auto rb = Simd128<T>::Load2(&ltrb.Get<2>());
+			const auto lt = Simd128<T>::Load2(&ltrb.Get<0>());
+			const auto rb = Simd128<T>::Load2(&ltrb.Get<2>());
+			const auto xy = inImpl2.GetSimdType(); // Get the underlying Simd value
+
+			// xy >= lt (inexact), and not xy >= rb: inside the left/top edges, and not touching the right/bottom edges
+			// NOTE: Unused high lanes are zero in all three, so are masked off
+			const int overlapMask = Simd128<T>::GeMask(xy, lt) & ~Simd128<T>::GeMask(xy, rb) & 0x3;
+			return overlapMask;
+		}
 
-			auto xy = inImpl2.GetSimdType(); // Get the underlying Simd value
+		/// @brief Test whether `inImpl4` lies entirely within this rectangle (edges may touch)
+		constexpr bool Contains(const Simd& inImpl4) const
+		{
+			const bool isContained = (ContainsMask(inImpl4) == 0xF);
+			return isContained;
+		}
+
+		/// @brief Branchless rectangle containment test, per edge
+		/// @return Bits 0..3 set if the left, top, right and bottom edges of `inImpl4` lie within this rectangle
+		constexpr int ContainsMask(const Simd& inImpl4) const
+		{
+			Simd outer = *this;
+			Simd inner = inImpl4;
+			ToLTRB(outer);
+			ToLTRB(inner);
+
+			const auto outerLT = Simd128<T>::Load2(&outer.Get<0>());
+			const auto outerRB = Simd128<T>::Load2(&outer.Get<2>());
+			const auto innerLT = Simd128<T>::Load2(&inner.Get<0>());
+			const auto innerRB = Simd128<T>::Load2(&inner.Get<2>());
+
+			const int ltMask = Simd128<T>::GeMask(innerLT, outerLT) & 0x3;
+			const int rbMask = Simd128<T>::GeMask(outerRB, innerRB) & 0x3;
+			const int containsMask = ltMask | (rbMask << 2);
+			return containsMask;
+		}
 
-			if constexpr (Is32BitDataType<T>()) // int/float up to 32 bit data type
+		/// @brief Test one point against `N` rectangles, a whole vector of rectangles at a time:
+		/// the rectangles are transposed to left/top/right/bottom vectors (4x 32bit or 2x 64bit lanes),
+		/// so each vector of rectangles costs four compares and no branches.
+		/// @return Bit i set if `inImpl2` lies within `*inImpl4s[i]`
+		template<std::size_t N>
+		static int HitMask(const std::array<const Simd*, N>& inImpl4s, const typename Impl2<T>::Simd& inImpl2)
+		{
+			constexpr std::size_t kLanes = Is32BitDataType<T>() ? 4 : 2;
+			constexpr std::size_t kCount = ((N + kLanes - 1) / kLanes) * kLanes; // Round up to whole vectors
+			static_assert(N <= 8 * sizeof(int) - 1, "HitMask() result must fit in an int");
+
+			// Transpose LTRB rectangles to one array per edge; padding rectangles are empty, so never hit
+			alignas(kSimdAlignment) std::array<T, kCount> lefts{};
+			alignas(kSimdAlignment) std::array<T, kCount> tops{};
+			alignas(kSimdAlignment) std::array<T, kCount> rights{};
+			alignas(kSimdAlignment) std::array<T, kCount> bottoms{};
+			for (std::size_t i = 0; i < N; ++i)
 			{
-				// Fix high 2 elements, since they're zeroed and can screw up comparison
-				lt = Simd128<T>::DupLo(lt);
-				rb = Simd128<T>::DupLo(rb);
-				xy = Simd128<T>::DupLo(xy);
+				Simd ltrb = *inImpl4s[i];
+				ToLTRB(ltrb);
+				lefts[i] = ltrb.Get<0>();
+				tops[i] = ltrb.Get<1>();
+				rights[i] = ltrb.Get<2>();
+				bottoms[i] = ltrb.Get<3>();
 			}
-			
-			do
+			alignas(kSimdAlignment) std::array<T, kLanes> xs{};
+			alignas(kSimdAlignment) std::array<T, kLanes> ys{};
+			xs.fill(inImpl2.template Get<0>());
+			ys.fill(inImpl2.template Get<1>());
+
+			const auto load = [](const T* inAddr)
 			{
-				if (!Simd128<T>::IsGe(xy, lt)) // Fancy way of saying xy < lt
+				if constexpr (kLanes == 4)
 				{
-					// Impl2 is too far to the left/above the Impl4
-					break;
+					return Simd128<T>::Load4(inAddr);
 				}
-
-				if (Simd128<T>::IsGe(xy, rb)) 
+				else
 				{
-					// Impl2 is too far to the right/below/touching the Impl4
-					break;
+					return Simd128<T>::Load2(inAddr);
 				}
-				isOverlapping = true;
+			};
+			const auto x = load(xs.data());
+			const auto y = load(ys.data());
 
-			} while (false);
-			return isOverlapping;
+			int hitMask = 0;
+			for (std::size_t i = 0; i < kCount; i += kLanes)
+			{
+				const int inside = Simd128<T>::GeMask(x, load(&lefts[i]))
+					& Simd128<T>::GeMask(y, load(&tops[i]))
+					& ~Simd128<T>::GeMask(x, load(&rights[i]))
+					& ~Simd128<T>::GeMask(y, load(&bottoms[i]));
+				hitMask |= (inside & ((1 << kLanes) - 1)) << i;
+			}
+			return hitMask & static_cast<int>((1u << N) - 1);
+		}
+
+		/// @brief Union of `inCount` rectangles, keeping the running left/top minimums and
+		/// right/bottom maximums in vector registers; converted back to XYWH once at the end
+		/// rather than once per rectangle.
+		/// @param inGet Callable as `inGet(i)`, returning the i'th rectangle's `const Simd&`
+		/// @return The union; empty (zero) when `inCount` is 0
+		template<typename GetT>
+		static Simd UnionAll(std::size_t inCount, GetT&& inGet)
+		{
+			Simd result{};
+			if (inCount == 0)
+			{
+				return result;
+			}
+
+			// TRICKY: Left/top and right/bottom are kept in separate vectors, as the 64bit Union() does:
+			// one {left, top, right, bottom} vector per rectangle would need a lane shuffle the backends
+			// lack, and a MinMax() of {x, y, x, y} and {r, b, r, b} is only exact for non-negative sizes
+			const Simd& first = inGet(0);
+			auto lt = Simd128<T>::Load2(&first.Get<0>());
+			auto rb = Simd128<T>::Add(lt, Simd128<T>::Load2(&first.Get<2>()));
+			for (std::size_t i = 1; i < inCount; ++i)
+			{
+				const Simd& rectangle = inGet(i);
+				const auto xy = Simd128<T>::Load2(&rectangle.Get<0>());
+				const auto wh = Simd128<T>::Load2(&rectangle.Get<2>());
+				lt = Simd128<T>::Min(lt, xy);
+				rb = Simd128<T>::Max(rb, Simd128<T>::Add(xy, wh));
+			}
+			Simd128<T>::Store2(&result.Get<0>(), lt);
+			Simd128<T>::Store2(&result.Get<2>(), rb);
+			FromLTRB(result);
+			return result;
+		}
+
+		/// @brief Bounding box of `inCount` points, keeping the running minimums and maximums
+		/// in vector registers: from the minimum to the maximum x and y.
+		/// @param inGet Callable as `inGet(i)`, returning the i'th point's `const Impl2<T>::Simd&`
+		/// @return The bounding box; empty (zero) when `inCount` is 0
+		template<typename GetT>
+		static Simd BoundingBox(std::size_t inCount, GetT&& inGet)
+		{
+			Simd result{};
+			if (inCount == 0)
+			{
+				return result;
+			}
+
+			auto lt = inGet(0).GetSimdType();
+			auto rb = lt;
+			for (std::size_t i = 1; i < inCount; ++i)
+			{
+				const auto xy = inGet(i).GetSimdType();
+				lt = Simd128<T>::Min(lt, xy);
+				rb = Simd128<T>::Max(rb, xy);
+			}
+			Simd128<T>::Store2(&result.Get<0>(), lt);
+			Simd128<T>::Store2(&result.Get<2>(), rb);
+			FromLTRB(result);
+			return result;
 		}
 
 		constexpr bool IsOverlapping(const Simd& inImpl4) const
@@ -1037,7 +1309,9 @@ struct Impl4 final
 		}
 
 	private:
-		std::array<T,4> mArray{}; // Impl4: so 4 elements are assumed
+		// TRICKY: 4x 32bit (or 64bit) elements use aligned 128bit loads, so need kSimdAlignment;
+		// 4x 16bit elements use 64bit loads, so Rectangle<int16_t> stays 8 bytes
+		alignas(SimdStorageAlignment<T, 4>()) std::array<T,4> mArray{}; // Impl4: so 4 elements are assumed
 	}; // class Simd
 }; // struct Impl4<>
 
@@ -0,0 +1,333 @@
+#ifndef SABER_GEOMETRY_DETAIL_IMPL4_LTRB_HPP
+#define SABER_GEOMETRY_DETAIL_IMPL4_LTRB_HPP
+
+// std
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+// saber
+#include "saber/inexact.hpp"
+#include "saber/geometry/detail/impl2.hpp"
+#include "saber/geometry/detail/impl4.hpp"
+#include "saber/geometry/detail/simd.hpp"
+
+namespace saber::geometry::detail {
+
+/// @brief Rectangle implementations storing edges: {left, top, right, bottom}.
+/// Unlike `Impl4<>` rectangles (stored as {x, y, width, height}), union, intersection and
+/// overlap tests need no conversion to edges and back; only `FromXYWH()`/`ToXYWH()` convert.
+template<typename T>
+struct Impl4LTRB final
+{
+	class Scalar
+	{
+	public:
+		// default ctor
+		constexpr Scalar() = default;
+		~Scalar() = default;
+
+		// alt ctor
+		constexpr Scalar(T inLeft, T inTop, T inRight, T inBottom) :
+			mImpl4{inLeft, inTop, inRight, inBottom}
+		{
+			// Do nothing
+		}
+
+		template<std::size_t Index>
+		constexpr const T& Get() const
+		{
+			return mImpl4.template Get<Index>();
+		}
+
+		template<std::size_t Index>
+		constexpr T& Get()
+		{
+			return mImpl4.template Get<Index>();
+		}
+
+		static constexpr Scalar FromXYWH(const typename Impl4<T>::Scalar& inXYWH)
+		{
+			Scalar ltrb{};
+			ltrb.mImpl4 = inXYWH;
+			ltrb.Get<2>() += ltrb.Get<0>();
+			ltrb.Get<3>() += ltrb.Get<1>();
+			return ltrb;
+		}
+
+		constexpr typename Impl4<T>::Scalar ToXYWH() const
+		{
+			auto xywh = mImpl4;
+			xywh.template Get<2>() -= xywh.template Get<0>();
+			xywh.template Get<3>() -= xywh.template Get<1>();
+			return xywh;
+		}
+
+		constexpr bool IsEqual(const Scalar& inRHS) const
+		{
+			return mImpl4.IsEqual(inRHS.mImpl4);
+		}
+
+		constexpr Scalar& Translate(const typename Impl2<T>::Scalar& inOffset)
+		{
+			const T x = inOffset.template Get<0>();
+			const T y = inOffset.template Get<1>();
+			mImpl4 += typename Impl4<T>::Scalar{x, y, x, y};
+			return *this;
+		}
+
+		constexpr Scalar& Union(const Scalar& inLTRB)
+		{
+			Get<0>() = std::min(Get<0>(), inLTRB.Get<0>());
+			Get<1>() = std::min(Get<1>(), inLTRB.Get<1>());
+			Get<2>() = std::max(Get<2>(), inLTRB.Get<2>());
+			Get<3>() = std::max(Get<3>(), inLTRB.Get<3>());
+			return *this;
+		}
+
+		constexpr Scalar& Intersect(const Scalar& inLTRB)
+		{
+			Get<0>() = std::max(Get<0>(), inLTRB.Get<0>());
+			Get<1>() = std::max(Get<1>(), inLTRB.Get<1>());
+
+			// Empty intersections keep right/bottom at left/top: zero (not negative) size, as `Impl4<>`
+			Get<2>() = std::max(std::min(Get<2>(), inLTRB.Get<2>()), Get<0>());
+			Get<3>() = std::max(std::min(Get<3>(), inLTRB.Get<3>()), Get<1>());
+			return *this;
+		}
+
+		constexpr bool IsOverlapping(const typename Impl2<T>::Scalar& inImpl2) const
+		{
+			const bool isOverlapping = (OverlapMask(inImpl2) == 0x3);
+			return isOverlapping;
+		}
+
+		/// @brief Branchless point in rectangle test, per axis
+		/// @return Bit 0 set if x lies within [left, right); bit 1 set if y lies within [top, bottom)
+		constexpr int OverlapMask(const typename Impl2<T>::Scalar& inImpl2) const
+		{
+			const T x = inImpl2.template Get<0>();
+			const T y = inImpl2.template Get<1>();
+
+			// NOTE: bitwise (not logical) operators, so every comparison is evaluated
+			const int isInX = static_cast<int>(IsGe(x, Get<0>()) & !IsGe(x, Get<2>()));
+			const int isInY = static_cast<int>(IsGe(y, Get<1>()) & !IsGe(y, Get<3>()));
+			const int overlapMask = isInX | (isInY << 1);
+			return overlapMask;
+		}
+
+		constexpr bool IsOverlapping(const Scalar& inLTRB) const
+		{
+			auto intersection = *this;
+			intersection.Intersect(inLTRB);
+			const bool isOverlapping = !IsEmpty(intersection);
+			return isOverlapping;
+		}
+
+		/// @brief Test whether `inLTRB` lies entirely within this rectangle (edges may touch)
+		constexpr bool Contains(const Scalar& inLTRB) const
+		{
+			const bool isContained = IsGe(inLTRB.Get<0>(), Get<0>())
+				& IsGe(inLTRB.Get<1>(), Get<1>())
+				& IsGe(Get<2>(), inLTRB.Get<2>())
+				& IsGe(Get<3>(), inLTRB.Get<3>());
+			return isContained;
+		}
+
+		// Friend meaning free function (and always public)
+		friend constexpr bool IsEmpty(const Scalar& inScalar)
+		{
+			return IsEmpty(inScalar.ToXYWH());
+		}
+
+	private:
+		/// @brief `inLHS >= inRHS`; floating point values approximately equal (`Inexact::IsEq()`) are also "greater or equal"
+		static constexpr bool IsGe(T inLHS, T inRHS)
+		{
+			bool isGe = (inLHS >= inRHS);
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				isGe = isGe | Inexact::IsEq(inLHS, inRHS);
+			}
+			return isGe;
+		}
+
+	private:
+		typename Impl4<T>::Scalar mImpl4{}; // {left, top, right, bottom}
+	}; // class Scalar
+
+	class Simd
+	{
+	public:
+		// default ctor
+		constexpr Simd() = default;
+		~Simd() = default;
+
+		// alt ctor
+		constexpr Simd(T inLeft, T inTop, T inRight, T inBottom) :
+			mImpl4{inLeft, inTop, inRight, inBottom}
+		{
+			// Do nothing
+		}
+
+		template<std::size_t Index>
+		constexpr const T& Get() const
+		{
+			return mImpl4.template Get<Index>();
+		}
+
+		template<std::size_t Index>
+		constexpr T& Get()
+		{
+			return mImpl4.template Get<Index>();
+		}
+
+		static constexpr Simd FromXYWH(const typename Impl4<T>::Simd& inXYWH)
+		{
+			Simd ltrb{};
+			ltrb.mImpl4 = inXYWH;
+			const auto xy = Simd128<T>::Load2(&ltrb.Get<0>());
+			const auto wh = Simd128<T>::Load2(&ltrb.Get<2>());
+			Simd128<T>::Store2(&ltrb.Get<2>(), Simd128<T>::Add(xy, wh));
+			return ltrb;
+		}
+
+		constexpr typename Impl4<T>::Simd ToXYWH() const
+		{
+			auto xywh = mImpl4;
+			const auto lt = Simd128<T>::Load2(&Get<0>());
+			const auto rb = Simd128<T>::Load2(&Get<2>());
+			Simd128<T>::Store2(&xywh.template Get<2>(), Simd128<T>::Sub(rb, lt));
+			return xywh;
+		}
+
+		constexpr bool IsEqual(const Simd& inRHS) const
+		{
+			return mImpl4.IsEqual(inRHS.mImpl4);
+		}
+
+		constexpr Simd& Translate(const typename Impl2<T>::Simd& inOffset)
+		{
+			const auto offset = inOffset.GetSimdType();
+			const auto lt = Simd128<T>::Load2(&Get<0>());
+			const auto rb = Simd128<T>::Load2(&Get<2>());
+			Simd128<T>::Store2(&Get<0>(), Simd128<T>::Add(lt, offset));
+			Simd128<T>::Store2(&Get<2>(), Simd128<T>::Add(rb, offset));
+			return *this;
+		}
+
+		constexpr Simd& Union(const Simd& inLTRB)
+		{
+			if constexpr (kIsWholeVector)
+			{
+				// One vector op: minimum left/top, maximum right/bottom
+				const auto lhs = Simd128<T>::Load4(&Get<0>());
+				const auto rhs = Simd128<T>::Load4(&inLTRB.Get<0>());
+				Simd128<T>::Store4(&Get<0>(), Simd128<T>::MinMax(lhs, rhs));
+			}
+			else
+			{
+				const auto lt = Simd128<T>::Min(Simd128<T>::Load2(&Get<0>()), Simd128<T>::Load2(&inLTRB.Get<0>()));
+				const auto rb = Simd128<T>::Max(Simd128<T>::Load2(&Get<2>()), Simd128<T>::Load2(&inLTRB.Get<2>()));
+				Simd128<T>::Store2(&Get<0>(), lt);
+				Simd128<T>::Store2(&Get<2>(), rb);
+			}
+			return *this;
+		}
+
+		constexpr Simd& Intersect(const Simd& inLTRB)
+		{
+			// Empty intersections keep right/bottom at left/top: zero (not negative) size, as `Impl4<>`
+			if constexpr (kIsWholeVector)
+			{
+				// Maximum left/top, minimum right/bottom; then right/bottom = Max(right/bottom, left/top)
+				const auto lhs = Simd128<T>::Load4(&Get<0>());
+				const auto rhs = Simd128<T>::Load4(&inLTRB.Get<0>());
+				const auto intersection = Simd128<T>::MaxMin(lhs, rhs);
+				Simd128<T>::Store4(&Get<0>(), Simd128<T>::MinMax(intersection, Simd128<T>::DupLo(intersection)));
+			}
+			else
+			{
+				const auto lt = Simd128<T>::Max(Simd128<T>::Load2(&Get<0>()), Simd128<T>::Load2(&inLTRB.Get<0>()));
+				const auto rb = Simd128<T>::Min(Simd128<T>::Load2(&Get<2>()), Simd128<T>::Load2(&inLTRB.Get<2>()));
+				Simd128<T>::Store2(&Get<0>(), lt);
+				Simd128<T>::Store2(&Get<2>(), Simd128<T>::Max(rb, lt));
+			}
+			return *this;
+		}
+
+		constexpr bool IsOverlapping(const typename Impl2<T>::Simd& inImpl2) const
+		{
+			const bool isOverlapping = (OverlapMask(inImpl2) == 0x3);
+			return isOverlapping;
+		}
+
+		/// @brief Branchless point in rectangle test, per axis
+		/// @return Bit 0 set if x lies within [left, right); bit 1 set if y lies within [top, bottom)
+		constexpr int OverlapMask(const typename Impl2<T>::Simd& inImpl2) const
+		{
+			const auto lt = Simd128<T>::Load2(&Get<0>());
+			const auto rb = Simd128<T>::Load2(&Get<2>());
+			const auto xy = inImpl2.GetSimdType();
+
+			// NOTE: Unused high lanes are zero in all three, so are masked off
+			const int overlapMask = Simd128<T>::GeMask(xy, lt) & ~Simd128<T>::GeMask(xy, rb) & 0x3;
+			return overlapMask;
+		}
+
+		constexpr bool IsOverlapping(const Simd& inLTRB) const
+		{
+			auto intersection = *this;
+			intersection.Intersect(inLTRB);
+			const bool isOverlapping = !IsEmpty(intersection);
+			return isOverlapping;
+		}
+
+		/// @brief Test whether `inLTRB` lies entirely within this rectangle (edges may touch)
+		constexpr bool Contains(const Simd& inLTRB) const
+		{
+			const auto outerLT = Simd128<T>::Load2(&Get<0>());
+			const auto outerRB = Simd128<T>::Load2(&Get<2>());
+			const auto innerLT = Simd128<T>::Load2(&inLTRB.Get<0>());
+			const auto innerRB = Simd128<T>::Load2(&inLTRB.Get<2>());
+
+			const int containsMask = (Simd128<T>::GeMask(innerLT, outerLT) & Simd128<T>::GeMask(outerRB, innerRB)) & 0x3;
+			return (containsMask == 0x3);
+		}
+
+		// Friend meaning free function (and always public)
+		friend constexpr bool IsEmpty(const Simd& inSimd)
+		{
+			return IsEmpty(inSimd.ToXYWH());
+		}
+
+	private:
+		// Left, top, right and bottom fill exactly one vector (4x 32bit lanes): whole vector MinMax()/MaxMin()
+		static constexpr bool kIsWholeVector = (Simd128Traits<T>::kSize == 4);
+
+	private:
+		typename Impl4<T>::Simd mImpl4{}; // {left, top, right, bottom}
+	}; // class Simd
+}; // struct Impl4LTRB<>
+
+#pragma region struct Impl4LTRBTraits
+template<typename T, ImplKind Impl> // Primary template declaration
+struct Impl4LTRBTraits;
+
+template<typename T> // Partial template specialization
+struct Impl4LTRBTraits<T, ImplKind::kScalar>
+{
+	using ImplType = typename Impl4LTRB<T>::Scalar; // VOODOO: Nested template type requires `typename` prefix
+};
+
+template<typename T> // Partial template specialization
+struct Impl4LTRBTraits<T, ImplKind::kSimd>
+{
+	using ImplType = typename Impl4LTRB<T>::Simd; // VOODOO: Nested template type requires `typename` prefix
+};
+
+#pragma endregion
+
+} // namespace saber::geometry::detail
+
+#endif // SABER_GEOMETRY_DETAIL_IMPL4_LTRB_HPP
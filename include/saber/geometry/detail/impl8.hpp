@@ -415,7 +415,8 @@ struct Impl8 final
 		}
 
 	private:
-		std::array<T,8> mArray{}; // Impl8: so 8 elements are assumed
+		// TRICKY: Elements are loaded with aligned 128bit loads, so storage must be kSimdAlignment aligned
+		alignas(SimdStorageAlignment<T, 8>()) std::array<T,8> mArray{}; // Impl8: so 8 elements are assumed
 	};
 
 }; // struct Impl8<>
@@ -0,0 +1,517 @@
+#ifndef SABER_GEOMETRY_DETAIL_MATRIX4_HELPER_HPP
+#define SABER_GEOMETRY_DETAIL_MATRIX4_HELPER_HPP
+
+// saber
+#include "saber/exception.hpp"
+#include "saber/inexact.hpp"
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/detail/impl2.hpp"
+#include "saber/geometry/detail/impl4.hpp"
+#include "saber/geometry/detail/impl16.hpp"
+#include "saber/geometry/detail/simd.hpp"
+
+// std
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace saber::geometry::detail {
+
+// NOTE: Matrix3 and Matrix4 share the same row-major Impl16 storage.
+// A Matrix3 occupies the upper-left 3x3 of the 4x4, with its 4th row
+// and column held at zero. Because of that, the 4x4 multiply kernel is
+// also a correct 3x3 multiply kernel (the zero padding stays zero).
+//
+// Index layout:
+//     | M11 M12 M13 M14 |     |  0  1  2  3 |
+//     | M21 M22 M23 M24 |  =  |  4  5  6  7 |
+//     | M31 M32 M33 M34 |     |  8  9 10 11 |
+//     | M41 M42 M43 M44 |     | 12 13 14 15 |
+
+template<typename T, ImplKind Impl>
+class Matrix4Helper; // primary template class Matrix4Helper<T>
+
+template<typename T>
+class Matrix4Helper<T, ImplKind::kScalar>
+{
+public:
+	using ImplType = typename Impl16<T>::Scalar;
+	using Impl2Type = typename Impl2<T>::Scalar;
+
+	/// @brief Precomputed terms used to project many points through the same matrix
+	struct Projection
+	{
+		T mXX, mXY, mXW; // x' = (mXX * x) + (mXY * y) + mXW
+		T mYX, mYY, mYW; // y' = (mYX * x) + (mYY * y) + mYW
+		T mWX, mWY, mWW; // w' = (mWX * x) + (mWY * y) + mWW
+	};
+
+	Matrix4Helper()
+	{
+		// Safety check so no one tries to use this with a std::string
+		static_assert(std::is_arithmetic_v<T>, "Matrix does not support non-arithmetic types");
+	}
+
+	static constexpr void Matrix4Mul(ImplType& ioLHS, const ImplType& inRHS)
+	{
+		const T* lhs = &ioLHS.template Get<0>();
+		const T* rhs = &inRHS.template Get<0>();
+
+		ImplType result{};
+		T* out = &result.template Get<0>();
+		for (std::size_t row = 0; row < 4; ++row)
+		{
+			for (std::size_t col = 0; col < 4; ++col)
+			{
+				out[(row * 4) + col] = (lhs[(row * 4) + 0] * rhs[0 + col])
+									 + (lhs[(row * 4) + 1] * rhs[4 + col])
+									 + (lhs[(row * 4) + 2] * rhs[8 + col])
+									 + (lhs[(row * 4) + 3] * rhs[12 + col]);
+			}
+		}
+		ioLHS = result;
+	}
+
+	static constexpr void Matrix3Inv(ImplType& ioLHS)
+	{
+		const T* m = &ioLHS.template Get<0>();
+		const T a = m[0], b = m[1], c = m[2];
+		const T d = m[4], e = m[5], f = m[6];
+		const T g = m[8], h = m[9], i = m[10];
+
+		const T cofA = (e * i) - (f * h);
+		const T cofB = -((d * i) - (f * g));
+		const T cofC = (d * h) - (e * g);
+
+		const T det = (a * cofA) + (b * cofB) + (c * cofC);
+		const bool isInvertible = Inexact::IsNe<T>(det, 0);
+		SABER_REQUIRE(isInvertible);
+
+		// Inverse is the adjugate (transposed cofactors) divided by the determinant
+		ioLHS = ImplType{
+			cofA, -((b * i) - (c * h)), (b * f) - (c * e), 0,
+			cofB, (a * i) - (c * g), -((a * f) - (c * d)), 0,
+			cofC, -((a * h) - (b * g)), (a * e) - (b * d), 0,
+			0, 0, 0, 0 };
+		ScaleByInvDet(ioLHS, det, 3);
+	}
+
+	static constexpr void Matrix4Inv(ImplType& ioLHS)
+	{
+		const T* m = &ioLHS.template Get<0>();
+		const T a00 = m[0],  a01 = m[1],  a02 = m[2],  a03 = m[3];
+		const T a10 = m[4],  a11 = m[5],  a12 = m[6],  a13 = m[7];
+		const T a20 = m[8],  a21 = m[9],  a22 = m[10], a23 = m[11];
+		const T a30 = m[12], a31 = m[13], a32 = m[14], a33 = m[15];
+
+		// 2x2 sub-determinants of the upper (s) and lower (c) row pairs
+		const T s0 = (a00 * a11) - (a10 * a01);
+		const T s1 = (a00 * a12) - (a10 * a02);
+		const T s2 = (a00 * a13) - (a10 * a03);
+		const T s3 = (a01 * a12) - (a11 * a02);
+		const T s4 = (a01 * a13) - (a11 * a03);
+		const T s5 = (a02 * a13) - (a12 * a03);
+
+		const T c5 = (a22 * a33) - (a32 * a23);
+		const T c4 = (a21 * a33) - (a31 * a23);
+		const T c3 = (a21 * a32) - (a31 * a22);
+		const T c2 = (a20 * a33) - (a30 * a23);
+		const T c1 = (a20 * a32) - (a30 * a22);
+		const T c0 = (a20 * a31) - (a30 * a21);
+
+		const T det = (s0 * c5) - (s1 * c4) + (s2 * c3) + (s3 * c2) - (s4 * c1) + (s5 * c0);
+		const bool isInvertible = Inexact::IsNe<T>(det, 0);
+		SABER_REQUIRE(isInvertible);
+
+		ioLHS = ImplType{
+			 (a11 * c5) - (a12 * c4) + (a13 * c3),
+			-(a01 * c5) + (a02 * c4) - (a03 * c3),
+			 (a31 * s5) - (a32 * s4) + (a33 * s3),
+			-(a21 * s5) + (a22 * s4) - (a23 * s3),
+
+			-(a10 * c5) + (a12 * c2) - (a13 * c1),
+			 (a00 * c5) - (a02 * c2) + (a03 * c1),
+			-(a30 * s5) + (a32 * s2) - (a33 * s1),
+			 (a20 * s5) - (a22 * s2) + (a23 * s1),
+
+			 (a10 * c4) - (a11 * c2) + (a13 * c0),
+			-(a00 * c4) + (a01 * c2) - (a03 * c0),
+			 (a30 * s4) - (a31 * s2) + (a33 * s0),
+			-(a20 * s4) + (a21 * s2) - (a23 * s0),
+
+			-(a10 * c3) + (a11 * c1) - (a12 * c0),
+			 (a00 * c3) - (a01 * c1) + (a02 * c0),
+			-(a30 * s3) + (a31 * s1) - (a32 * s0),
+			 (a20 * s3) - (a21 * s1) + (a22 * s0) };
+		ScaleByInvDet(ioLHS, det, 4);
+	}
+
+	/// @brief Gather the terms of a matrix needed to project 2D points.
+	/// @tparam W Index of the homogeneous row/column: 2 for Matrix3, 3 for Matrix4
+	template<std::size_t W>
+	static constexpr Projection MatrixProjection(const ImplType& inMatrix)
+	{
+		const T* m = &inMatrix.template Get<0>();
+		return Projection{
+			m[0],       m[1],       m[W],
+			m[4],       m[5],       m[4 + W],
+			m[W*4 + 0], m[W*4 + 1], m[W*4 + W] };
+	}
+
+	static constexpr Impl2Type MatrixProject(const Projection& inProjection, const Impl2Type& inPoint)
+	{
+		const T x = inPoint.template Get<0>();
+		const T y = inPoint.template Get<1>();
+		const T px = (inProjection.mXX * x) + (inProjection.mXY * y) + inProjection.mXW;
+		const T py = (inProjection.mYX * x) + (inProjection.mYY * y) + inProjection.mYW;
+		const T pw = (inProjection.mWX * x) + (inProjection.mWY * y) + inProjection.mWW;
+		return Impl2Type{PerspectiveDivide(px, pw), PerspectiveDivide(py, pw)};
+	}
+
+private:
+	static constexpr T PerspectiveDivide(T inValue, T inW)
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			return inValue / inW;
+		}
+		else
+		{
+			// Mirror Simd128<int>::Div(): integer divide by zero yields zero
+			return (inW != 0 ? (inValue / inW) : 0);
+		}
+	}
+
+	static constexpr void ScaleByInvDet(ImplType& ioMatrix, T inDet, std::size_t inDim)
+	{
+		T* m = &ioMatrix.template Get<0>();
+		for (std::size_t row = 0; row < inDim; ++row)
+		{
+			for (std::size_t col = 0; col < inDim; ++col)
+			{
+				T& element = m[(row * 4) + col];
+				if constexpr (std::is_floating_point_v<T>)
+				{
+					element *= (T{1} / inDet);
+				}
+				else
+				{
+					// Integer matrices: divide directly, since 1/det truncates to zero
+					element /= inDet;
+				}
+			}
+		}
+	}
+}; // specialized template class Matrix4Helper<T, ImplKind::kScalar>
+
+template<typename T>
+class Matrix4Helper<T, ImplKind::kSimd>
+{
+private:
+	using SimdType = typename Simd128<T>::SimdType;
+
+	// TRICKY: A matrix row is 4 elements. That is one 128bit vector for 32bit
+	// data types, but two 128bit vectors (lo, hi) for 64bit data types
+	static constexpr std::size_t kRowVectors = (Is32BitDataType<T>() ? 1 : 2);
+
+	// NOTE: Plain array, since std::array<> would discard the SimdType's alignment attributes
+	struct Row
+	{
+		SimdType mSimd[kRowVectors];
+
+		SimdType& operator[](std::size_t inIndex) { return mSimd[inIndex]; }
+		const SimdType& operator[](std::size_t inIndex) const { return mSimd[inIndex]; }
+	};
+
+public:
+	using ImplType = typename Impl16<T>::Simd;
+	using Impl2Type = typename Impl2<T>::Simd;
+
+	/// @brief Precomputed column vectors used to project many points through the same matrix
+	/// Each column is laid out as {x', y', w', w'} so the perspective divisor is already in place.
+	struct Projection
+	{
+		Row mX;
+		Row mY;
+		Row mW;
+	};
+
+	Matrix4Helper()
+	{
+		static_assert(std::is_arithmetic_v<T>, "Matrix does not support non-arithmetic types");
+	}
+
+	static void Matrix4Mul(ImplType& ioLHS, const ImplType& inRHS)
+	{
+		const T* lhs = &ioLHS.template Get<0>();
+		const T* rhs = &inRHS.template Get<0>();
+
+		const Row rhs0 = LoadRow(&rhs[0]);
+		const Row rhs1 = LoadRow(&rhs[4]);
+		const Row rhs2 = LoadRow(&rhs[8]);
+		const Row rhs3 = LoadRow(&rhs[12]);
+
+		ImplType result{};
+		T* out = &result.template Get<0>();
+		for (std::size_t row = 0; row < 16; row += 4)
+		{
+			// result.row = lhs[row][0]*rhs.row0 + lhs[row][1]*rhs.row1 + lhs[row][2]*rhs.row2 + lhs[row][3]*rhs.row3
+			Row sum = MulRow(SplatRow(lhs[row + 0]), rhs0);
+			sum = AddRow(sum, MulRow(SplatRow(lhs[row + 1]), rhs1));
+			sum = AddRow(sum, MulRow(SplatRow(lhs[row + 2]), rhs2));
+			sum = AddRow(sum, MulRow(SplatRow(lhs[row + 3]), rhs3));
+			StoreRow(&out[row], sum);
+		}
+		ioLHS = result;
+	}
+
+	static void Matrix3Inv(ImplType& ioLHS)
+	{
+		// NOTE: A 3x3 inverse has too few terms to amortize vector shuffles;
+		// compute cofactors in scalar, then scale the adjugate in SIMD
+		const T* m = &ioLHS.template Get<0>();
+		const T a = m[0], b = m[1], c = m[2];
+		const T d = m[4], e = m[5], f = m[6];
+		const T g = m[8], h = m[9], i = m[10];
+
+		const T cofA = (e * i) - (f * h);
+		const T cofB = -((d * i) - (f * g));
+		const T cofC = (d * h) - (e * g);
+
+		const T det = (a * cofA) + (b * cofB) + (c * cofC);
+		const bool isInvertible = Inexact::IsNe<T>(det, 0);
+		SABER_REQUIRE(isInvertible);
+
+		ImplType adjugate{
+			cofA, -((b * i) - (c * h)), (b * f) - (c * e), 0,
+			cofB, (a * i) - (c * g), -((a * f) - (c * d)), 0,
+			cofC, -((a * h) - (b * g)), (a * e) - (b * d), 0,
+			0, 0, 0, 0 };
+
+		T* out = &adjugate.template Get<0>();
+		for (std::size_t row = 0; row < 12; row += 4)
+		{
+			StoreRow(&out[row], ScaleRowByInvDet(LoadRow(&out[row]), det));
+		}
+		ioLHS = adjugate;
+	}
+
+	static void Matrix4Inv(ImplType& ioLHS)
+	{
+		const T* m = &ioLHS.template Get<0>();
+		const T a00 = m[0],  a01 = m[1],  a02 = m[2],  a03 = m[3];
+		const T a10 = m[4],  a11 = m[5],  a12 = m[6],  a13 = m[7];
+		const T a20 = m[8],  a21 = m[9],  a22 = m[10], a23 = m[11];
+		const T a30 = m[12], a31 = m[13], a32 = m[14], a33 = m[15];
+
+		// 2x2 sub-determinants of the upper (s) and lower (c) row pairs
+		const T s0 = (a00 * a11) - (a10 * a01);
+		const T s1 = (a00 * a12) - (a10 * a02);
+		const T s2 = (a00 * a13) - (a10 * a03);
+		const T s3 = (a01 * a12) - (a11 * a02);
+		const T s4 = (a01 * a13) - (a11 * a03);
+		const T s5 = (a02 * a13) - (a12 * a03);
+
+		const T c5 = (a22 * a33) - (a32 * a23);
+		const T c4 = (a21 * a33) - (a31 * a23);
+		const T c3 = (a21 * a32) - (a31 * a22);
+		const T c2 = (a20 * a33) - (a30 * a23);
+		const T c1 = (a20 * a32) - (a30 * a22);
+		const T c0 = (a20 * a31) - (a30 * a21);
+
+		const T det = (s0 * c5) - (s1 * c4) + (s2 * c3) + (s3 * c2) - (s4 * c1) + (s5 * c0);
+		const bool isInvertible = Inexact::IsNe<T>(det, 0);
+		SABER_REQUIRE(isInvertible);
+
+		// Each row of the adjugate is a sum of 3 products: P[j] * C[k]
+		// where P[j] = {a1j, -a0j, a3j, -a2j} and C[k] = {ck, ck, sk, sk}
+		const Row p0 = MakeRow(a10, -a00, a30, -a20);
+		const Row p1 = MakeRow(a11, -a01, a31, -a21);
+		const Row p2 = MakeRow(a12, -a02, a32, -a22);
+		const Row p3 = MakeRow(a13, -a03, a33, -a23);
+
+		const Row k0 = MakeRow(c0, c0, s0, s0);
+		const Row k1 = MakeRow(c1, c1, s1, s1);
+		const Row k2 = MakeRow(c2, c2, s2, s2);
+		const Row k3 = MakeRow(c3, c3, s3, s3);
+		const Row k4 = MakeRow(c4, c4, s4, s4);
+		const Row k5 = MakeRow(c5, c5, s5, s5);
+
+		// row0 =  P1*C5 - P2*C4 + P3*C3
+		// row1 = -P0*C5 + P2*C2 - P3*C1
+		// row2 =  P0*C4 - P1*C2 + P3*C0
+		// row3 = -P0*C3 + P1*C1 - P2*C0
+		const Row row0 = AddRow(SubRow(MulRow(p1, k5), MulRow(p2, k4)), MulRow(p3, k3));
+		const Row row1 = SubRow(SubRow(MulRow(p2, k2), MulRow(p0, k5)), MulRow(p3, k1));
+		const Row row2 = AddRow(SubRow(MulRow(p0, k4), MulRow(p1, k2)), MulRow(p3, k0));
+		const Row row3 = SubRow(SubRow(MulRow(p1, k1), MulRow(p0, k3)), MulRow(p2, k0));
+
+		T* out = &ioLHS.template Get<0>();
+		StoreRow(&out[0], ScaleRowByInvDet(row0, det));
+		StoreRow(&out[4], ScaleRowByInvDet(row1, det));
+		StoreRow(&out[8], ScaleRowByInvDet(row2, det));
+		StoreRow(&out[12], ScaleRowByInvDet(row3, det));
+	}
+
+	/// @brief Gather the columns of a matrix needed to project 2D points.
+	/// @tparam W Index of the homogeneous row/column: 2 for Matrix3, 3 for Matrix4
+	template<std::size_t W>
+	static Projection MatrixProjection(const ImplType& inMatrix)
+	{
+		const T* m = &inMatrix.template Get<0>();
+		return Projection{
+			MakeRow(m[0], m[4], m[W*4 + 0], m[W*4 + 0]),
+			MakeRow(m[1], m[5], m[W*4 + 1], m[W*4 + 1]),
+			MakeRow(m[W], m[4 + W], m[W*4 + W], m[W*4 + W]) };
+	}
+
+	static Impl2Type MatrixProject(const Projection& inProjection, const Impl2Type& inPoint)
+	{
+		// {x', y', w', w'} = (colX * x) + (colY * y) + colW
+		Row sum = MulRow(inProjection.mX, SplatRow(inPoint.template Get<0>()));
+		sum = AddRow(sum, MulRow(inProjection.mY, SplatRow(inPoint.template Get<1>())));
+		sum = AddRow(sum, inProjection.mW);
+
+		SimdType projected{};
+		if constexpr (Is32BitDataType<T>())
+		{
+			// {x'/w', y'/w', ...}: DupHi() places w' under both x' and y'
+			projected = Simd128<T>::Div(sum[0], Simd128<T>::DupHi(sum[0]));
+		}
+		else
+		{
+			// {x', y'} / {w', w'}
+			projected = Simd128<T>::Div(sum[0], sum[1]);
+		}
+
+		Impl2Type result{};
+		result.SetSimdType(projected);
+		return result;
+	}
+
+private:
+	static Row LoadRow(const T* inAddr)
+	{
+		Row row{};
+		if constexpr (Is32BitDataType<T>())
+		{
+			row[0] = Simd128<T>::Load4(inAddr);
+		}
+		else
+		{
+			row[0] = Simd128<T>::Load2(&inAddr[0]);
+			row[1] = Simd128<T>::Load2(&inAddr[2]);
+		}
+		return row;
+	}
+
+	static void StoreRow(T* outAddr, const Row& inRow)
+	{
+		if constexpr (Is32BitDataType<T>())
+		{
+			Simd128<T>::Store4(outAddr, inRow[0]);
+		}
+		else
+		{
+			Simd128<T>::Store2(&outAddr[0], inRow[0]);
+			Simd128<T>::Store2(&outAddr[2], inRow[1]);
+		}
+	}
+
+	static Row MakeRow(T in0, T in1, T in2, T in3)
+	{
+		alignas(16) const std::array<T, 4> row{{in0, in1, in2, in3}};
+		return LoadRow(row.data());
+	}
+
+	static Row SplatRow(T inValue)
+	{
+		Row row{};
+		for (std::size_t i = 0; i < kRowVectors; ++i)
+		{
+			row[i] = Simd128<T>::Splat(inValue);
+		}
+		return row;
+	}
+
+	static Row AddRow(const Row& inLHS, const Row& inRHS)
+	{
+		Row row{};
+		for (std::size_t i = 0; i < kRowVectors; ++i)
+		{
+			row[i] = Simd128<T>::Add(inLHS[i], inRHS[i]);
+		}
+		return row;
+	}
+
+	static Row SubRow(const Row& inLHS, const Row& inRHS)
+	{
+		Row row{};
+		for (std::size_t i = 0; i < kRowVectors; ++i)
+		{
+			row[i] = Simd128<T>::Sub(inLHS[i], inRHS[i]);
+		}
+		return row;
+	}
+
+	static Row MulRow(const Row& inLHS, const Row& inRHS)
+	{
+		Row row{};
+		for (std::size_t i = 0; i < kRowVectors; ++i)
+		{
+			row[i] = Simd128<T>::Mul(inLHS[i], inRHS[i]);
+		}
+		return row;
+	}
+
+	static Row ScaleRowByInvDet(const Row& inRow, T inDet)
+	{
+		Row row{};
+		for (std::size_t i = 0; i < kRowVectors; ++i)
+		{
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				row[i] = Simd128<T>::Mul(inRow[i], Simd128<T>::Splat(T{1} / inDet));
+			}
+			else
+			{
+				row[i] = Simd128<T>::Div(inRow[i], Simd128<T>::Splat(inDet));
+			}
+		}
+		return row;
+	}
+}; // specialized template class Matrix4Helper<T, ImplKind::kSimd>
+
+template<typename T, ImplKind Impl>
+constexpr void Matrix4Mul(typename Impl16Traits<T, Impl>::ImplType& ioLHS, const typename Impl16Traits<T, Impl>::ImplType& inRHS)
+{
+	Matrix4Helper<T, Impl>::Matrix4Mul(ioLHS, inRHS);
+}
+
+template<typename T, ImplKind Impl>
+constexpr void Matrix3Inv(typename Impl16Traits<T, Impl>::ImplType& ioLHS)
+{
+	Matrix4Helper<T, Impl>::Matrix3Inv(ioLHS);
+}
+
+template<typename T, ImplKind Impl>
+constexpr void Matrix4Inv(typename Impl16Traits<T, Impl>::ImplType& ioLHS)
+{
+	Matrix4Helper<T, Impl>::Matrix4Inv(ioLHS);
+}
+
+template<typename T, ImplKind Impl, std::size_t W>
+constexpr auto MatrixProjection(const typename Impl16Traits<T, Impl>::ImplType& inMatrix)
+{
+	return Matrix4Helper<T, Impl>::template MatrixProjection<W>(inMatrix);
+}
+
+template<typename T, ImplKind Impl>
+constexpr auto MatrixProject(const typename Matrix4Helper<T, Impl>::Projection& inProjection, const typename Impl2Traits<T, Impl>::ImplType& inPoint)
+{
+	return Matrix4Helper<T, Impl>::MatrixProject(inProjection, inPoint);
+}
+
+} // namespace saber::geometry::detail
+
+#endif // SABER_GEOMETRY_DETAIL_MATRIX4_HELPER_HPP
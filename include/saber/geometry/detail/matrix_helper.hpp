@@ -6,8 +6,10 @@
 #include "saber/inexact.hpp"
 #include "saber/geometry/config.hpp"
 #include "saber/geometry/detail/impl8.hpp"
+#include "saber/geometry/detail/sincos.hpp"
 
 // std
+#include <cstddef>
 #include <type_traits>
 
 namespace saber::geometry::detail {
@@ -70,13 +72,29 @@ public:
 
 	static typename Impl8<T>::Scalar MatrixRotation(T inRads)
 	{
-		const T sin = std::sin(inRads);
-		const T cos = std::cos(inRads);
+		T sin{};
+		T cos{};
+		RotationSinCos(inRads, sin, cos);
 		return { cos, -sin, 0,
 				sin, cos, 0,
 				0, 0 };
 	}
 
+	static void MatrixRotationsSinCos(const T* inRads, T* outSin, T* outCos, std::size_t inCount)
+	{
+		for (std::size_t i = 0; i < inCount; ++i)
+		{
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				SinCosHelper<T>::SinCos(inRads[i], outSin[i], outCos[i]);
+			}
+			else
+			{
+				RotationSinCos(inRads[i], outSin[i], outCos[i]);
+			}
+		}
+	}
+
 	static typename Impl8<T>::Scalar MatrixMul(typename Impl8<T>::Scalar& ioLHS, const typename Impl8<T>::Scalar& inRHS)
 	{
 		// NOTE: 3x2 Matrixes only. We treat inRHS as if it were Transpose 2x3
@@ -185,13 +203,30 @@ public:
 
 	static typename Impl8<T>::Simd MatrixRotation(T inRads)
 	{
-		const T sinv = std::sin(inRads);
-		const T cosv = std::cos(inRads);
+		T sinv{};
+		T cosv{};
+		RotationSinCos(inRads, sinv, cosv);
 		return { cosv, -sinv, 0,
 				 sinv, cosv, 0,
 				 0, 0 };
 	}
 
+	static void MatrixRotationsSinCos(const T* inRads, T* outSin, T* outCos, std::size_t inCount)
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			// Whole Simd128<T> vectors of angles at a time
+			SinCosHelper<T>::SinCos(inRads, outSin, outCos, inCount);
+		}
+		else
+		{
+			for (std::size_t i = 0; i < inCount; ++i)
+			{
+				RotationSinCos(inRads[i], outSin[i], outCos[i]);
+			}
+		}
+	}
+
 	static typename Impl8<T>::Simd MatrixMul(typename Impl8<T>::Simd& ioLHS, const typename Impl8<T>::Simd& inRHS)
 	{
 		// NOTE: 3x2 Matrixes only. We treat inRHS as if it were Transpose 2x3
@@ -302,6 +337,12 @@ constexpr auto MatrixRotation(T inRads)
 	return MatrixHelper<T, Impl>::MatrixRotation(inRads);
 }
 
+template<typename T, ImplKind Impl>
+void MatrixRotationsSinCos(const T* inRads, T* outSin, T* outCos, std::size_t inCount)
+{
+	MatrixHelper<T, Impl>::MatrixRotationsSinCos(inRads, outSin, outCos, inCount);
+}
+
 template<typename T>
 constexpr auto MatrixMul(typename Impl8<T>::Scalar& ioLHS, const typename Impl8<T>::Scalar& inRHS)
 {
@@ -0,0 +1,393 @@
+#ifndef SABER_GEOMETRY_DETAIL_PACKER_HELPER_HPP
+#define SABER_GEOMETRY_DETAIL_PACKER_HELPER_HPP
+
+// saber
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/detail/simd.hpp"
+
+// std
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace saber::geometry::detail {
+
+/// @brief Free rectangles of a `RectanglePacker<>`: one array per edge (structure of arrays),
+/// so that a vector of left (top, right, bottom) edges of consecutive rectangles is one load.
+/// A summary of their sizes tells, without scanning them, when none of them can fit a rectangle.
+template<typename T>
+struct FreeRects
+{
+	std::size_t Size() const
+	{
+		return mLeft.size();
+	}
+
+	void Push(T inLeft, T inTop, T inRight, T inBottom)
+	{
+		mLeft.push_back(inLeft);
+		mTop.push_back(inTop);
+		mRight.push_back(inRight);
+		mBottom.push_back(inBottom);
+		AddFit(inRight - inLeft, inBottom - inTop);
+	}
+
+	/// @brief False when no free rectangle is at least `inWidth` by `inHeight`; true when one may be
+	/// (sizes from `kFitClasses - 1` up share one class, and erased rectangles count until `Refit()`)
+	bool MayFit(T inWidth, T inHeight) const
+	{
+		const std::size_t minWidth = FitClass(inWidth);
+		for (std::size_t height = FitClass(inHeight); height < kFitClasses; ++height)
+		{
+			if ((mFitMasks[height] >> minWidth) != 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/// @brief Drop erased rectangles from the summary of `MayFit()`, e.g. when a scan found no fit after all
+	void Refit()
+	{
+		if (!mIsFitStale)
+		{
+			return;
+		}
+		mFitMasks.fill(0);
+		for (std::size_t i = 0; i < Size(); ++i)
+		{
+			AddFit(mRight[i] - mLeft[i], mBottom[i] - mTop[i]);
+		}
+		mIsFitStale = false;
+	}
+
+	/// @brief Remove rectangle `inIndex`, moving the last rectangle into its place
+	void Erase(std::size_t inIndex)
+	{
+		mLeft[inIndex] = mLeft.back();
+		mTop[inIndex] = mTop.back();
+		mRight[inIndex] = mRight.back();
+		mBottom[inIndex] = mBottom.back();
+		mLeft.pop_back();
+		mTop.pop_back();
+		mRight.pop_back();
+		mBottom.pop_back();
+		mIsFitStale = true;
+	}
+
+	void Clear()
+	{
+		mLeft.clear();
+		mTop.clear();
+		mRight.clear();
+		mBottom.clear();
+		mFitMasks.fill(0);
+		mIsFitStale = false;
+	}
+
+	std::vector<T> mLeft;
+	std::vector<T> mTop;
+	std::vector<T> mRight;
+	std::vector<T> mBottom;
+
+private:
+	/// @brief Sizes are summarized exactly below `kFitClasses - 1`: small free rectangles are the common ones
+	static constexpr std::size_t kFitClasses = 64;
+
+	static std::size_t FitClass(T inSize)
+	{
+		return static_cast<std::size_t>(std::clamp<T>(inSize, 0, static_cast<T>(kFitClasses - 1)));
+	}
+
+	void AddFit(T inWidth, T inHeight)
+	{
+		mFitMasks[FitClass(inHeight)] |= std::uint64_t{1} << FitClass(inWidth);
+	}
+
+	// Bit w of `mFitMasks[h]`: a free rectangle of width (class) w and height (class) h
+	std::array<std::uint64_t, kFitClasses> mFitMasks{};
+	bool mIsFitStale = false; // Rectangles were erased since the masks were last rebuilt
+};
+
+template<typename T, ImplKind Impl>
+class PackerHelper; // primary template class PackerHelper<T, Impl>
+
+// ------------------------------------------------------------------
+#pragma region PackerHelper<T, ImplKind::kScalar>
+
+template<typename T>
+class PackerHelper<T, ImplKind::kScalar>
+{
+public:
+	static constexpr std::size_t kNotFound = ~std::size_t{0};
+
+	/// @brief Best short side fit: the free rectangle leaving the least space along its shorter
+	/// leftover side, then along its longer leftover side; ties go to the lowest index
+	/// @return Index of the best free rectangle, or `kNotFound` when none fits
+	static std::size_t FindBestFit(const FreeRects<T>& inFree, T inWidth, T inHeight)
+	{
+		std::size_t best = kNotFound;
+		T bestShort{};
+		T bestLong{};
+		for (std::size_t i = 0; i < inFree.Size(); ++i)
+		{
+			const T leftoverWidth = (inFree.mRight[i] - inFree.mLeft[i]) - inWidth;
+			const T leftoverHeight = (inFree.mBottom[i] - inFree.mTop[i]) - inHeight;
+			if (leftoverWidth < 0 || leftoverHeight < 0)
+			{
+				continue;
+			}
+			UpdateBest(i, std::min(leftoverWidth, leftoverHeight), std::max(leftoverWidth, leftoverHeight), best, bestShort, bestLong);
+		}
+		return best;
+	}
+
+	/// @brief Collect (ascending) indices of the free rectangles with a non-empty intersection with {left, top, right, bottom}
+	static void FindOverlapping(const FreeRects<T>& inFree, T inLeft, T inTop, T inRight, T inBottom, std::vector<std::size_t>& outIndices)
+	{
+		outIndices.clear();
+		for (std::size_t i = 0; i < inFree.Size(); ++i)
+		{
+			const bool isOverlapping = (inFree.mLeft[i] < inRight) & (inFree.mRight[i] > inLeft)
+				& (inFree.mTop[i] < inBottom) & (inFree.mBottom[i] > inTop);
+			if (isOverlapping)
+			{
+				outIndices.push_back(i);
+			}
+		}
+	}
+
+	/// @brief Test whether any of the first `inEnd` free rectangles contains {left, top, right, bottom}
+	static bool IsContained(const FreeRects<T>& inFree, std::size_t inEnd, T inLeft, T inTop, T inRight, T inBottom)
+	{
+		for (std::size_t i = 0; i < inEnd; ++i)
+		{
+			const bool isContaining = (inFree.mLeft[i] <= inLeft) & (inFree.mTop[i] <= inTop)
+				& (inFree.mRight[i] >= inRight) & (inFree.mBottom[i] >= inBottom);
+			if (isContaining)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/// @brief Collect (ascending) indices of the first `inEnd` free rectangles contained in {left, top, right, bottom}
+	static void FindContained(const FreeRects<T>& inFree, std::size_t inEnd, T inLeft, T inTop, T inRight, T inBottom, std::vector<std::size_t>& outIndices)
+	{
+		outIndices.clear();
+		for (std::size_t i = 0; i < inEnd; ++i)
+		{
+			const bool isContained = (inFree.mLeft[i] >= inLeft) & (inFree.mTop[i] >= inTop)
+				& (inFree.mRight[i] <= inRight) & (inFree.mBottom[i] <= inBottom);
+			if (isContained)
+			{
+				outIndices.push_back(i);
+			}
+		}
+	}
+
+protected:
+	static void UpdateBest(std::size_t inIndex, T inShort, T inLong, std::size_t& ioBest, T& ioBestShort, T& ioBestLong)
+	{
+		const bool isBetter = (ioBest == kNotFound) || (inShort < ioBestShort) || ((inShort == ioBestShort) && (inLong < ioBestLong));
+		if (isBetter)
+		{
+			ioBest = inIndex;
+			ioBestShort = inShort;
+			ioBestLong = inLong;
+		}
+	}
+};
+
+#pragma endregion
+
+// ------------------------------------------------------------------
+#pragma region PackerHelper<T, ImplKind::kSimd>
+
+/// @brief Same results as `PackerHelper<T, ImplKind::kScalar>`; for `int` coordinates, each step
+/// tests a vector of 4 free rectangles and only visits the lanes whose mask bit is set.
+template<typename T>
+class PackerHelper<T, ImplKind::kSimd> :
+	public PackerHelper<T, ImplKind::kScalar>
+{
+	using Scalar = PackerHelper<T, ImplKind::kScalar>;
+	using Simd = Simd128<T>;
+
+public:
+	using Scalar::kNotFound;
+
+	static std::size_t FindBestFit(const FreeRects<T>& inFree, T inWidth, T inHeight)
+	{
+		if constexpr (!kIsVectorizable)
+		{
+			return Scalar::FindBestFit(inFree, inWidth, inHeight);
+		}
+		else
+		{
+			const auto width = Simd::Splat(inWidth);
+			const auto height = Simd::Splat(inHeight);
+			const auto zero = Simd::Splat(0);
+
+			std::size_t best = kNotFound;
+			T bestShort{};
+			T bestLong{};
+			alignas(16) std::array<T, kLanes> shortSides{};
+			alignas(16) std::array<T, kLanes> longSides{};
+			Scan(inFree, inFree.Size(), [&](auto inLeft, auto inTop, auto inRight, auto inBottom)
+			{
+				const auto leftoverWidth = Simd::Sub(Simd::Sub(inRight, inLeft), width);
+				const auto leftoverHeight = Simd::Sub(Simd::Sub(inBottom, inTop), height);
+				const int fit = Simd::GeMask(leftoverWidth, zero) & Simd::GeMask(leftoverHeight, zero);
+				if (fit != 0)
+				{
+					// Most vectors have no fitting lane: only then are the scores needed
+					Simd::Store4(shortSides.data(), Simd::Min(leftoverWidth, leftoverHeight));
+					Simd::Store4(longSides.data(), Simd::Max(leftoverWidth, leftoverHeight));
+				}
+				return fit;
+			},
+			[&](std::size_t inIndex, std::size_t inLane)
+			{
+				Scalar::UpdateBest(inIndex, shortSides[inLane], longSides[inLane], best, bestShort, bestLong);
+			});
+			return best;
+		}
+	}
+
+	static void FindOverlapping(const FreeRects<T>& inFree, T inLeft, T inTop, T inRight, T inBottom, std::vector<std::size_t>& outIndices)
+	{
+		if constexpr (!kIsVectorizable)
+		{
+			Scalar::FindOverlapping(inFree, inLeft, inTop, inRight, inBottom, outIndices);
+		}
+		else
+		{
+			const auto left = Simd::Splat(inLeft);
+			const auto top = Simd::Splat(inTop);
+			const auto right = Simd::Splat(inRight);
+			const auto bottom = Simd::Splat(inBottom);
+
+			outIndices.clear();
+			Scan(inFree, inFree.Size(), [&](auto inFreeLeft, auto inFreeTop, auto inFreeRight, auto inFreeBottom)
+			{
+				// Disjoint: wholly right of, left of, below or above {left, top, right, bottom}
+				const int disjoint = Simd::GeMask(inFreeLeft, right) | Simd::LeMask(inFreeRight, left)
+					| Simd::GeMask(inFreeTop, bottom) | Simd::LeMask(inFreeBottom, top);
+				return ~disjoint;
+			},
+			[&](std::size_t inIndex, std::size_t)
+			{
+				outIndices.push_back(inIndex);
+			});
+		}
+	}
+
+	static bool IsContained(const FreeRects<T>& inFree, std::size_t inEnd, T inLeft, T inTop, T inRight, T inBottom)
+	{
+		if constexpr (!kIsVectorizable)
+		{
+			return Scalar::IsContained(inFree, inEnd, inLeft, inTop, inRight, inBottom);
+		}
+		else
+		{
+			const auto left = Simd::Splat(inLeft);
+			const auto top = Simd::Splat(inTop);
+			const auto right = Simd::Splat(inRight);
+			const auto bottom = Simd::Splat(inBottom);
+
+			const bool isContained = IsAnyOf(inFree, inEnd, [&](auto inFreeLeft, auto inFreeTop, auto inFreeRight, auto inFreeBottom)
+			{
+				return Simd::LeMask(inFreeLeft, left) & Simd::LeMask(inFreeTop, top)
+					& Simd::GeMask(inFreeRight, right) & Simd::GeMask(inFreeBottom, bottom);
+			});
+			return isContained;
+		}
+	}
+
+	static void FindContained(const FreeRects<T>& inFree, std::size_t inEnd, T inLeft, T inTop, T inRight, T inBottom, std::vector<std::size_t>& outIndices)
+	{
+		if constexpr (!kIsVectorizable)
+		{
+			Scalar::FindContained(inFree, inEnd, inLeft, inTop, inRight, inBottom, outIndices);
+		}
+		else
+		{
+			const auto left = Simd::Splat(inLeft);
+			const auto top = Simd::Splat(inTop);
+			const auto right = Simd::Splat(inRight);
+			const auto bottom = Simd::Splat(inBottom);
+
+			outIndices.clear();
+			Scan(inFree, inEnd, [&](auto inFreeLeft, auto inFreeTop, auto inFreeRight, auto inFreeBottom)
+			{
+				return Simd::GeMask(inFreeLeft, left) & Simd::GeMask(inFreeTop, top)
+					& Simd::LeMask(inFreeRight, right) & Simd::LeMask(inFreeBottom, bottom);
+			},
+			[&](std::size_t inIndex, std::size_t)
+			{
+				outIndices.push_back(inIndex);
+			});
+		}
+	}
+
+private:
+	// Only `int` has a whole vector of 32bit lanes with exact integer comparisons in every `Simd128<>` backend
+	static constexpr bool kIsVectorizable = std::is_same_v<T, int>;
+	static constexpr std::size_t kLanes = 4;
+
+	/// @brief Test whether `inKernel(left, top, right, bottom)` sets a lane for any of the first `inEnd`
+	/// free rectangles, stopping at the first vector that does
+	template<typename KernelT>
+	static bool IsAnyOf(const FreeRects<T>& inFree, std::size_t inEnd, KernelT&& inKernel)
+	{
+		for (std::size_t i = 0; i < inEnd; i += kLanes)
+		{
+			const std::size_t count = std::min(kLanes, inEnd - i);
+			const auto left = Simd::LoadN(&inFree.mLeft[i], count);
+			const auto top = Simd::LoadN(&inFree.mTop[i], count);
+			const auto right = Simd::LoadN(&inFree.mRight[i], count);
+			const auto bottom = Simd::LoadN(&inFree.mBottom[i], count);
+			if (inKernel(left, top, right, bottom) & ((1 << count) - 1))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/// @brief Call `inKernel(left, top, right, bottom)` for each vector of the first `inEnd` free
+	/// rectangles, then `inVisit(index, lane)` for each lane set in the lane mask it returns
+	template<typename KernelT, typename VisitT>
+	static void Scan(const FreeRects<T>& inFree, std::size_t inEnd, KernelT&& inKernel, VisitT&& inVisit)
+	{
+		for (std::size_t i = 0; i < inEnd; i += kLanes)
+		{
+			// NOTE: The tail vector's unused lanes are zero; they are masked off, not visited
+			const std::size_t count = std::min(kLanes, inEnd - i);
+			const auto left = Simd::LoadN(&inFree.mLeft[i], count);
+			const auto top = Simd::LoadN(&inFree.mTop[i], count);
+			const auto right = Simd::LoadN(&inFree.mRight[i], count);
+			const auto bottom = Simd::LoadN(&inFree.mBottom[i], count);
+
+			int mask = inKernel(left, top, right, bottom) & ((1 << count) - 1);
+			for (std::size_t lane = 0; mask != 0; ++lane, mask >>= 1)
+			{
+				if (mask & 1)
+				{
+					inVisit(i + lane, lane);
+				}
+			}
+		}
+	}
+};
+
+#pragma endregion
+
+} // namespace saber::geometry::detail
+
+#endif // SABER_GEOMETRY_DETAIL_PACKER_HELPER_HPP
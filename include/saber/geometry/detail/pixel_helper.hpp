@@ -0,0 +1,186 @@
+#ifndef SABER_GEOMETRY_DETAIL_PIXEL_HELPER_HPP
+#define SABER_GEOMETRY_DETAIL_PIXEL_HELPER_HPP
+
+// saber
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/detail/simd.hpp"
+
+// std
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace saber::geometry::detail {
+
+/// @brief Element types with whole vector `LoadUnaligned<kSize>()`/`StoreUnaligned<kSize>()`
+/// in every `Simd128<>` backend
+template<typename T>
+constexpr bool IsSimdPixelType()
+{
+	return std::is_same_v<T, std::uint8_t>
+		|| std::is_same_v<T, std::int16_t>
+		|| std::is_same_v<T, std::uint16_t>
+		|| std::is_same_v<T, int>
+		|| std::is_same_v<T, float>
+		|| std::is_same_v<T, double>;
+}
+
+template<typename T, std::size_t NChannels, ImplKind Impl>
+class PixelHelper; // primary template class PixelHelper<T>
+
+// ------------------------------------------------------------------
+#pragma region PixelHelper<T, NChannels, ImplKind::kScalar>
+
+template<typename T, std::size_t NChannels>
+class PixelHelper<T, NChannels, ImplKind::kScalar>
+{
+public:
+	/// @brief Set `inWidth` pixels starting at `outRow` to `inPixel`
+	static void FillRow(T* outRow, std::size_t inWidth, const std::array<T, NChannels>& inPixel)
+	{
+		for (std::size_t x = 0; x < inWidth; ++x)
+		{
+			std::copy(inPixel.begin(), inPixel.end(), outRow + x * NChannels);
+		}
+	}
+
+	/// @brief Copy `inWidth` pixels from `inRow` to `outRow`; the rows must not overlap
+	static void CopyRow(T* outRow, const T* inRow, std::size_t inWidth)
+	{
+		std::copy(inRow, inRow + inWidth * NChannels, outRow);
+	}
+};
+
+#pragma endregion
+
+// ------------------------------------------------------------------
+#pragma region PixelHelper<T, NChannels, ImplKind::kSimd>
+
+template<typename T, std::size_t NChannels>
+class PixelHelper<T, NChannels, ImplKind::kSimd>
+{
+public:
+	/// @brief Set `inWidth` pixels starting at `outRow` to `inPixel`
+	static void FillRow(T* outRow, std::size_t inWidth, const std::array<T, NChannels>& inPixel)
+	{
+		if constexpr (IsVectorizable())
+		{
+			const std::size_t count = inWidth * NChannels;
+			if (count >= kLanes)
+			{
+				// Repeat the pixel across a whole vector: kLanes is a multiple of NChannels,
+				// so every vector store (at a multiple of NChannels) writes whole pixels
+				std::array<T, kLanes> pattern{};
+				for (std::size_t i = 0; i < kLanes; ++i)
+				{
+					pattern[i] = inPixel[i % NChannels];
+				}
+				const auto fill = LoadVector(pattern.data());
+
+				std::size_t i = 0;
+				for (; i + kLanes <= count; i += kLanes)
+				{
+					StoreVector(outRow + i, fill);
+				}
+				if (i < count)
+				{
+					// TRICKY: Overlap the last whole vector with the previous one, rather than
+					// finishing element by element; it ends exactly at the end of the row
+					StoreVector(outRow + count - kLanes, fill);
+				}
+				return;
+			}
+		}
+		PixelHelper<T, NChannels, ImplKind::kScalar>::FillRow(outRow, inWidth, inPixel);
+	}
+
+	/// @brief Copy `inWidth` pixels from `inRow` to `outRow`; the rows must not overlap
+	static void CopyRow(T* outRow, const T* inRow, std::size_t inWidth)
+	{
+		if constexpr (IsVectorizable())
+		{
+			const std::size_t count = inWidth * NChannels;
+			if (count >= kLanes)
+			{
+				std::size_t i = 0;
+				for (; i + kLanes <= count; i += kLanes)
+				{
+					StoreVector(outRow + i, LoadVector(inRow + i));
+				}
+				if (i < count)
+				{
+					// Overlapping last vector: safe because the source and destination do not alias
+					const std::size_t last = count - kLanes;
+					StoreVector(outRow + last, LoadVector(inRow + last));
+				}
+				return;
+			}
+		}
+		PixelHelper<T, NChannels, ImplKind::kScalar>::CopyRow(outRow, inRow, inWidth);
+	}
+
+private:
+	static constexpr std::size_t kLanes = Simd128<T>::kSize;
+
+	static constexpr bool IsVectorizable()
+	{
+		if constexpr (IsSimdPixelType<T>())
+		{
+			return (kLanes % NChannels) == 0;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	/// @brief Load a whole vector of type`<T>` elements, of any alignment
+	static auto LoadVector(const T* inAddr)
+	{
+		if constexpr (kLanes == 16)
+		{
+			return Simd128<T>::LoadUnaligned16(inAddr);
+		}
+		else if constexpr (kLanes == 8)
+		{
+			return Simd128<T>::LoadUnaligned8(inAddr);
+		}
+		else if constexpr (kLanes == 4)
+		{
+			return Simd128<T>::LoadUnaligned4(inAddr);
+		}
+		else
+		{
+			return Simd128<T>::LoadUnaligned2(inAddr);
+		}
+	}
+
+	/// @brief Store a whole vector of type`<T>` elements, of any alignment
+	static void StoreVector(T* outAddr, typename Simd128<T>::SimdType inStore)
+	{
+		if constexpr (kLanes == 16)
+		{
+			Simd128<T>::StoreUnaligned16(outAddr, inStore);
+		}
+		else if constexpr (kLanes == 8)
+		{
+			Simd128<T>::StoreUnaligned8(outAddr, inStore);
+		}
+		else if constexpr (kLanes == 4)
+		{
+			Simd128<T>::StoreUnaligned4(outAddr, inStore);
+		}
+		else
+		{
+			Simd128<T>::StoreUnaligned2(outAddr, inStore);
+		}
+	}
+};
+
+#pragma endregion
+
+} // namespace saber::geometry::detail
+
+#endif // SABER_GEOMETRY_DETAIL_PIXEL_HELPER_HPP
@@ -3,9 +3,122 @@
 
 // saber
 #include "saber/geometry/config.hpp"
+#include "saber/geometry/numeric.hpp"
+
+// std
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 namespace saber::geometry::detail {
 
+// ------------------------------------------------------------------
+#pragma region kSimdAlignment
+
+/// @brief Byte alignment required by aligned SIMD loads/stores (`Load4()`, `Store4()`, etc).
+/// All SIMD Impl storage is declared `alignas(kSimdAlignment)`; raise this
+/// when wider vectors (e.g. 256bit AVX = 32 bytes) are introduced.
+inline constexpr std::size_t kSimdAlignment = 16;
+
+/// @brief Test whether `inAddr` satisfies `kSimdAlignment`, so aligned loads/stores are safe.
+/// @param inAddr Address to test
+/// @return `true` if `inAddr` is a multiple of `kSimdAlignment`
+inline bool IsSimdAligned(const void* inAddr)
+{
+	return (reinterpret_cast<std::uintptr_t>(inAddr) % kSimdAlignment) == 0;
+}
+
+/// @brief Alignment of SIMD Impl storage holding `N` elements of type`<T>`.
+/// Storage of a whole 128bit vector (or more) is `kSimdAlignment` aligned; smaller
+/// storage (e.g. 4x 16bit elements) is only loaded with narrower loads, so it is
+/// aligned to its own size rather than padded.
+/// @tparam T Type of element
+/// @tparam N Number of elements
+template<typename T, std::size_t N>
+constexpr std::size_t SimdStorageAlignment()
+{
+	constexpr std::size_t kBytes = N * sizeof(T);
+	return (kBytes < kSimdAlignment) ? kBytes : kSimdAlignment;
+}
+
+#pragma endregion
+
+// ------------------------------------------------------------------
+#pragma region ConvertValue<>
+
+/// @brief Convert a single value of type`<FromT>` to type`<ToT>`.
+/// Floating point to integer conversions first round according to `Round`,
+/// then (if `Overflow` is `kSaturate`) clamp to the limits of `<ToT>`.
+/// All other conversions are a plain `static_cast<>`.
+/// @tparam ToT Destination type
+/// @tparam Round Rounding applied to floating point to integer conversions
+/// @tparam Overflow Out of range handling of floating point to integer conversions
+/// @tparam FromT Source type
+/// @param inValue Value to convert
+/// @return Converted value
+template<typename ToT, RoundKind Round, OverflowKind Overflow, typename FromT>
+ToT ConvertValue(FromT inValue)
+{
+	if constexpr (!std::is_arithmetic_v<FromT>)
+	{
+		// Compact element types (e.g. `Half`) convert via their (wider) compute type
+		using ComputeType = typename ElementTraits<FromT>::ComputeType;
+		return ConvertValue<ToT, Round, Overflow>(static_cast<ComputeType>(inValue));
+	}
+	else if constexpr (std::is_floating_point_v<FromT> && std::is_integral_v<ToT>)
+	{
+		FromT round = inValue;
+		if constexpr (Round == RoundKind::kNearest)
+		{
+			round = std::round(inValue);
+		}
+		else if constexpr (Round == RoundKind::kFloor)
+		{
+			round = std::floor(inValue);
+		}
+		else if constexpr (Round == RoundKind::kCeil)
+		{
+			round = std::ceil(inValue);
+		}
+		else
+		{
+			round = std::trunc(inValue);
+		}
+
+		if constexpr (Overflow == OverflowKind::kSaturate)
+		{
+			// NOTE: static_cast<FromT>(max) may round up (e.g. float(INT_MAX) == 2^31), so compare with >=
+			constexpr auto kMax = std::numeric_limits<ToT>::max();
+			constexpr auto kMin = std::numeric_limits<ToT>::lowest();
+			if (std::isnan(round))
+			{
+				return ToT{0};
+			}
+			if (round >= static_cast<FromT>(kMax))
+			{
+				return kMax;
+			}
+			if (round <= static_cast<FromT>(kMin))
+			{
+				return kMin;
+			}
+		}
+		return static_cast<ToT>(round);
+	}
+	else
+	{
+		return static_cast<ToT>(inValue);
+	}
+}
+
+#pragma endregion
+
 // ------------------------------------------------------------------
 #pragma region SimdTraits<NBits, T>
 
@@ -74,8 +187,9 @@ struct Simd128 :
 	/// SimdType[3] = inAddr[3];
 	/// return SimdType;
 	/// @endcode
-	/// @param inAddr Address of &elements[4] to load
+	/// @param inAddr Address of &elements[4] to load; must be `kSimdAlignment` aligned
 	/// @return Vector type`<T>` of loaded elements
+	/// @see LoadUnaligned4()
 	static constexpr SimdType Load4(const T* inAddr)
 	{
 		static_assert(sizeof(SimdType) >= 4*sizeof(T) , "4 elements of type<T> are too large to fit in 128bit SimdType");
@@ -123,6 +237,23 @@ struct Simd128 :
 		return load1;
 	}
 
+	/// @brief Broadcast a single element of type`<T>` to all elements of a vector.
+	/// @code{.cpp}
+	/// SimdType[0..MAX] = inValue;
+	/// return SimdType;
+	/// @endcode
+	/// @param inValue Value to broadcast
+	/// @return Vector type`<T>` of broadcast elements
+	static constexpr SimdType Splat(T inValue)
+	{
+		SimdType splat{};
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; ++i)
+		{
+			splat[i] = inValue;
+		}
+		return splat;
+	}
+
 	/// @brief Store 4 elements of type`<T>` to memory specified by `outAddr`.
 	/// @code{.cpp}
 	/// outAddr[0] = SimdType[0];
@@ -130,8 +261,9 @@ struct Simd128 :
 	/// outAddr[2] = SimdType[2];
 	/// outAddr[3] = SimdType[3];
 	/// @endcode
-	/// @param outAddr Address to store &elements[4]
+	/// @param outAddr Address to store &elements[4]; must be `kSimdAlignment` aligned
 	/// @param inStore4 Vector type`<T>` of elements to store
+	/// @see StoreUnaligned4()
 	static constexpr void Store4(T* outAddr, SimdType inStore4)
 	{
 		static_assert(sizeof(SimdType) >= 4*sizeof(T), "128bit SimdType is too small to contain 4 elements of type<T>");
@@ -157,6 +289,42 @@ struct Simd128 :
 		outAddr[1] = inStore2[1];
 	}
 
+	/// @brief Load 4 elements of type`<T>` from memory specified by `inAddr`, of any alignment.
+	/// Same as `Load4()`, but without requiring `inAddr` to be `kSimdAlignment` aligned.
+	/// @param inAddr Address of &elements[4] to load
+	/// @return Vector type`<T>` of loaded elements
+	static constexpr SimdType LoadUnaligned4(const T* inAddr)
+	{
+		return Load4(inAddr);
+	}
+
+	/// @brief Load 2 elements of type`<T>` from memory specified by `inAddr`, of any alignment.
+	/// Same as `Load2()`, but without requiring `inAddr` to be aligned.
+	/// @param inAddr Address of &elements[2] to load
+	/// @return Vector type`<T>` of loaded elements
+	static constexpr SimdType LoadUnaligned2(const T* inAddr)
+	{
+		return Load2(inAddr);
+	}
+
+	/// @brief Store 4 elements of type`<T>` to memory specified by `outAddr`, of any alignment.
+	/// Same as `Store4()`, but without requiring `outAddr` to be `kSimdAlignment` aligned.
+	/// @param outAddr Address to store &elements[4]
+	/// @param inStore4 Vector type`<T>` of elements to store
+	static constexpr void StoreUnaligned4(T* outAddr, SimdType inStore4)
+	{
+		Store4(outAddr, inStore4);
+	}
+
+	/// @brief Store 2 elements of type`<T>` to memory specified by `outAddr`, of any alignment.
+	/// Same as `Store2()`, but without requiring `outAddr` to be aligned.
+	/// @param outAddr Address to store &elements[2]
+	/// @param inStore2 Vector type`<T>` of elements to store
+	static constexpr void StoreUnaligned2(T* outAddr, SimdType inStore2)
+	{
+		Store2(outAddr, inStore2);
+	}
+
 	/// @brief Store 1 element of type`<T>` to memory specified by `outAddr`.
 	/// The lowest order element is stored to memory.
 	/// Any higher order elements are ignored.
@@ -171,6 +339,46 @@ struct Simd128 :
 		outAddr[0] = inStore1[0];
 	}
 
+	/// @brief Load the first `inCount` elements of type`<T>` from memory specified by `inAddr`, of any alignment.
+	/// Elements at and beyond `inCount` are set to zero, and are never read from memory; so a partial
+	/// (tail) vector may end exactly at the end of an array.
+	/// @code{.cpp}
+	/// SimdType[0..inCount] = inAddr[0..inCount];
+	/// SimdType[inCount..MAX] = 0;
+	/// return SimdType;
+	/// @endcode
+	/// @param inAddr Address of &elements[inCount] to load
+	/// @param inCount Number of elements to load; counts of `kSize` or more load a whole vector
+	/// @return Vector type`<T>` of loaded elements
+	static constexpr SimdType LoadN(const T* inAddr, std::size_t inCount)
+	{
+		SimdType loadN{}; // zero
+		const std::size_t count = std::min(inCount, Simd128Traits<T>::kSize);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			loadN[i] = inAddr[i];
+		}
+		return loadN;
+	}
+
+	/// @brief Store the first `inCount` elements of type`<T>` to memory specified by `outAddr`, of any alignment.
+	/// Memory at and beyond `outAddr[inCount]` is never written.
+	/// @code{.cpp}
+	/// outAddr[0..inCount] = SimdType[0..inCount];
+	/// (void) SimdType[inCount..MAX]; // unused
+	/// @endcode
+	/// @param outAddr Address to store &elements[inCount]
+	/// @param inStoreN Vector type`<T>` of elements to store
+	/// @param inCount Number of elements to store; counts of `kSize` or more store a whole vector
+	static constexpr void StoreN(T* outAddr, SimdType inStoreN, std::size_t inCount)
+	{
+		const std::size_t count = std::min(inCount, Simd128Traits<T>::kSize);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			outAddr[i] = inStoreN[i];
+		}
+	}
+
 	/// @brief Add all vector type`<T>` elements in `inRHS` to `inLHS`.
 	/// @code{.cpp}
 	/// for (i = 0; i < MAX; ++i)
@@ -247,6 +455,21 @@ struct Simd128 :
 		return div;
 	}
 
+	/// @brief Divide all vector type`<T>` elements of `inLHS` by the same prepared divisor.
+	/// Cheaper than `Div()` when one divisor is applied to many vectors.
+	/// @param inLHS Left hand side vector term
+	/// @param inDivisor Divisor prepared once by the caller
+	/// @return Result vector type`<T>`
+	static constexpr SimdType DivBy(SimdType inLHS, const Divisor<T>& inDivisor)
+	{
+		SimdType div{};
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; ++i)
+		{
+			div[i] = inDivisor.Divide(inLHS[i]);
+		}
+		return div;
+	}
+
 	// DupLo
 	static constexpr SimdType DupLo(SimdType inSimd)
 	{
@@ -295,7 +518,7 @@ struct Simd128 :
 			// check for "inexact" equality for floating point types
 			if constexpr(std::is_floating_point_v<T>)
 			{
-				if (Inexact::Eq(inRHS[i], inLHS[i]))
+				if (Inexact::IsEq(inRHS[i], inLHS[i]))
 				{
 					continue;
 				}
@@ -326,7 +549,7 @@ struct Simd128 :
 			// check for "inexact" equality for floating point types
 			if constexpr(std::is_floating_point_v<T>)
 			{
-				if (Inexact::Eq(inRHS[i], inLHS[i]))
+				if (Inexact::IsEq(inRHS[i], inLHS[i]))
 				{
 					eqMask |= (1 << i);
 					continue;
@@ -350,7 +573,7 @@ struct Simd128 :
 			// check for "inexact" equality for floating point types
 			if constexpr(std::is_floating_point_v<T>)
 			{
-				if (Inexact::Eq(inLHS[i], inRHS[i]))
+				if (Inexact::IsEq(inLHS[i], inRHS[i]))
 				{
 					continue;
 				}
@@ -376,14 +599,12 @@ struct Simd128 :
 			// check for "inexact" equality for floating point types
 			if constexpr(std::is_floating_point_v<T>)
 			{
-				if (Inexact::Eq(inLHS[i], inRHS[i]))
+				if (Inexact::IsEq(inLHS[i], inRHS[i]))
 				{
 					geMask |= (1 << i);
 					continue;
 				}
 			}
-
-			break;
 		}
 		return geMask;
 	}
@@ -403,7 +624,7 @@ struct Simd128 :
 			// check for "inexact" equality for floating point types
 			if constexpr(std::is_floating_point_v<T>)
 			{
-				if (Inexact::Eq(inLHS[i], inRHS[i]))
+				if (Inexact::IsEq(inLHS[i], inRHS[i]))
 				{
 					continue;
 				}
@@ -429,14 +650,12 @@ struct Simd128 :
 			// check for "inexact" equality for floating point types
 			if constexpr(std::is_floating_point_v<T>)
 			{
-				if (Inexact::Eq(inLHS[i], inRHS[i]))
+				if (Inexact::IsEq(inLHS[i], inRHS[i]))
 				{
 					leMask |= (1 << i);
 					continue;
 				}
 			}
-
-			break;
 		}
 		return leMask;
 	}
@@ -446,7 +665,7 @@ struct Simd128 :
 		bool isGt = !IsLe(inRHS, inLHS);
 		return isGt;
 	}
-	static constexpr bool GtMask(SimdType inLHS, SimdType inRHS)
+	static constexpr int GtMask(SimdType inLHS, SimdType inRHS)
 	{
 		int leMask = LeMask(inRHS, inLHS);
 		int gtMask = leMask ^ ((1U << Simd128Traits<T>::kSize)-1);
@@ -465,6 +684,91 @@ struct Simd128 :
 		return ltMask;
 	}
 
+	/// @brief Round then convert 4 elements of type`<T>` to `int`, and store them
+	/// to memory specified by `outAddr`.
+	/// @tparam Round Rounding applied before conversion
+	/// @tparam Overflow Out of range handling
+	/// @param outAddr Address to store &elements[4]
+	/// @param inConvert Vector type`<T>` of elements to convert
+	template<RoundKind Round, OverflowKind Overflow>
+	static constexpr void ConvertStore4(int* outAddr, SimdType inConvert)
+	{
+		static_assert(Simd128Traits<T>::kSize >= 4, "128bit SimdType is too small to contain 4 elements of type<T>");
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			outAddr[i] = ConvertValue<int, Round, Overflow>(inConvert[i]);
+		}
+	}
+
+	/// @brief Round then convert the 2 lowest order elements of type`<T>` to `int`,
+	/// and store them to memory specified by `outAddr`.
+	/// @tparam Round Rounding applied before conversion
+	/// @tparam Overflow Out of range handling
+	/// @param outAddr Address to store &elements[2]
+	/// @param inConvert Vector type`<T>` of elements to convert
+	template<RoundKind Round, OverflowKind Overflow>
+	static constexpr void ConvertStore2(int* outAddr, SimdType inConvert)
+	{
+		for (std::size_t i = 0; i < 2; ++i)
+		{
+			outAddr[i] = ConvertValue<int, Round, Overflow>(inConvert[i]);
+		}
+	}
+
+	/// @brief Load 4 elements of type`<T>`, sign extended to a vector of wider type`<WideT>`.
+	/// @code{.cpp}
+	/// Simd128<WideT>::SimdType[0..3] = WideT{inAddr[0..3]};
+	/// @endcode
+	/// @tparam WideT Wider integer type of the result vector elements
+	/// @param inAddr Address of &elements[4] to load
+	/// @return Vector type`<WideT>` of widened elements
+	template<typename WideT>
+	static constexpr typename Simd128<WideT>::SimdType LoadWiden4(const T* inAddr)
+	{
+		static_assert(sizeof(WideT) > sizeof(T), "LoadWiden4() requires a wider type<WideT>");
+		alignas(kSimdAlignment) std::array<WideT, 4> wide{};
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			wide[i] = static_cast<WideT>(inAddr[i]);
+		}
+		return Simd128<WideT>::Load4(wide.data());
+	}
+
+	/// @brief Narrow 4 elements of wider type`<WideT>` to type`<T>` (saturating to the
+	/// limits of `<T>`), and store them to memory specified by `outAddr`.
+	/// @code{.cpp}
+	/// outAddr[0..3] = clamp(inWiden[0..3], lowest<T>, max<T>);
+	/// @endcode
+	/// @tparam WideT Wider integer type of the source vector elements
+	/// @param outAddr Address to store &elements[4]
+	/// @param inWiden Vector type`<WideT>` of elements to narrow
+	template<typename WideT>
+	static constexpr void NarrowStore4(T* outAddr, typename Simd128<WideT>::SimdType inWiden)
+	{
+		static_assert(sizeof(WideT) > sizeof(T), "NarrowStore4() requires a wider type<WideT>");
+		constexpr WideT kMin = static_cast<WideT>(std::numeric_limits<T>::lowest());
+		constexpr WideT kMax = static_cast<WideT>(std::numeric_limits<T>::max());
+		alignas(kSimdAlignment) std::array<WideT, 4> wide{};
+		Simd128<WideT>::Store4(wide.data(), inWiden);
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			outAddr[i] = static_cast<T>(std::min(std::max(wide[i], kMin), kMax));
+		}
+	}
+
+	/// @brief Round all elements of SimdType toward the nearest whole number
+	/// (halfway cases are rounded away from zero)
+	/// @param inRound The SimdType to be rounded
+	/// @return Return the rounded result
+	static constexpr SimdType RoundNearest(SimdType inRound)
+	{
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; ++i)
+		{
+			inRound[i] = std::round(inRound[i]);
+		}
+		return inRound;
+	}
+
 	/// @brief Round all elements of SimdType toward positive infinity 
 	/// @param inRound The SimdType to be rounded
 	/// @return Return the rounded result
@@ -501,6 +805,34 @@ struct Simd128 :
 		return inRound;
 	}
 
+	/// @brief Find the minimum value for each pair of element of SimdType
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Return the minimum value for each pair of element of SimdType
+	static constexpr SimdType Min(SimdType inLHS, SimdType inRHS)
+	{
+		SimdType min{};
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; i++)
+		{
+			min[i] = std::min(inLHS[i], inRHS[i]);
+		}
+		return min;
+	}
+
+	/// @brief Find the maximum value for each pair of element of SimdType
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Return the maximum value for each pair of element of SimdType
+	static constexpr SimdType Max(SimdType inLHS, SimdType inRHS)
+	{
+		SimdType max{};
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; i++)
+		{
+			max[i] = std::max(inLHS[i], inRHS[i]);
+		}
+		return max;
+	}
+
 	/// @brief Find the minimum/maximum values for each pair ofelement of SimdType
 	/// @param inLHS Left hand side vector term
 	/// @param inRHS Right hand side vector term
@@ -508,15 +840,15 @@ struct Simd128 :
 	static constexpr SimdType MinMax(SimdType inLHS, SimdType inRHS)
 	{
 		// Make sure the SimdType is even
-		static_assert(Simd128Traits<T>::kSize & 1 == 0, "Number of SimdType elements must be even");
+		static_assert((Simd128Traits<T>::kSize & 1) == 0, "Number of SimdType elements must be even");
 
-		constexpr auto kMin = 0;
-		constexpr auto kMax = Simd128Traits<T>::kSize/2;
+		// Elements 0 and 1 (left/top) are the low pair; wider vectors (e.g. 8x 16bit) apply
+		// the second operation to all remaining elements, right/bottom included
+		constexpr std::size_t kPair = std::min<std::size_t>(Simd128Traits<T>::kSize/2, 2);
 		SimdType minMax{};
-		for (std::size_t i = 0; i < Simd128Traits<T>::kSize/2; i++)
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; i++)
 		{
-			minMax[i+kMin] = std::min(inLHS[i+kMin], inRHS[i+kMin]);
-			minMax[i+kMax] = std::max(inLHS[i+kMax], inRHS[i+kMax]);
+			minMax[i] = (i < kPair) ? std::min(inLHS[i], inRHS[i]) : std::max(inLHS[i], inRHS[i]);
 		}
 		return minMax;
 	}
@@ -528,23 +860,353 @@ struct Simd128 :
 	static constexpr SimdType MaxMin(SimdType inLHS, SimdType inRHS)
 	{
 		// Make sure the SimdType is even
-		static_assert(Simd128Traits<T>::kSize & 1 == 0, "Number of SimdType elements must be even");
+		static_assert((Simd128Traits<T>::kSize & 1) == 0, "Number of SimdType elements must be even");
 
-		constexpr auto kMin = 0;
-		constexpr auto kMax = Simd128Traits<T>::kSize/2;
+		// Elements 0 and 1 (left/top) are the low pair; wider vectors (e.g. 8x 16bit) apply
+		// the second operation to all remaining elements, right/bottom included
+		constexpr std::size_t kPair = std::min<std::size_t>(Simd128Traits<T>::kSize/2, 2);
 		SimdType maxMin{};
-		for (std::size_t i = 0; i < Simd128Traits<T>::kSize/2; i++)
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; i++)
 		{
-			maxMin[i+kMin] = std::max(inLHS[i+kMin], inRHS[i+kMin]);
-			maxMin[i+kMax] = std::min(inLHS[i+kMax], inRHS[i+kMax]);
+			maxMin[i] = (i < kPair) ? std::max(inLHS[i], inRHS[i]) : std::min(inLHS[i], inRHS[i]);
 		}
 		return maxMin;
 	}
 
+	// Packed 8/16bit lanes (pixels, tile coordinates): whole vector loads/stores,
+	// saturating arithmetic, widening/narrowing and masked blends
+
+	/// @brief Load 8 elements of type`<T>` (a whole vector of 16bit lanes) from memory
+	/// specified by `inAddr`, of any alignment.
+	/// @param inAddr Address of &elements[8] to load
+	/// @return Vector type`<T>` of loaded elements
+	static constexpr SimdType LoadUnaligned8(const T* inAddr)
+	{
+		static_assert(Simd128Traits<T>::kSize >= 8, "8 elements of type<T> are too large to fit in 128bit SimdType");
+		SimdType load8{}; // zero
+		for (std::size_t i = 0; i < 8; ++i)
+		{
+			load8[i] = inAddr[i];
+		}
+		return load8;
+	}
+
+	/// @brief Store 8 elements of type`<T>` (a whole vector of 16bit lanes) to memory
+	/// specified by `outAddr`, of any alignment.
+	/// @param outAddr Address to store &elements[8]
+	/// @param inStore8 Vector type`<T>` of elements to store
+	static constexpr void StoreUnaligned8(T* outAddr, SimdType inStore8)
+	{
+		static_assert(Simd128Traits<T>::kSize >= 8, "128bit SimdType is too small to contain 8 elements of type<T>");
+		for (std::size_t i = 0; i < 8; ++i)
+		{
+			outAddr[i] = inStore8[i];
+		}
+	}
+
+	/// @brief Load 16 elements of type`<T>` (a whole vector of 8bit lanes) from memory
+	/// specified by `inAddr`, of any alignment.
+	/// @param inAddr Address of &elements[16] to load
+	/// @return Vector type`<T>` of loaded elements
+	static constexpr SimdType LoadUnaligned16(const T* inAddr)
+	{
+		static_assert(Simd128Traits<T>::kSize >= 16, "16 elements of type<T> are too large to fit in 128bit SimdType");
+		SimdType load16{}; // zero
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			load16[i] = inAddr[i];
+		}
+		return load16;
+	}
+
+	/// @brief Store 16 elements of type`<T>` (a whole vector of 8bit lanes) to memory
+	/// specified by `outAddr`, of any alignment.
+	/// @param outAddr Address to store &elements[16]
+	/// @param inStore16 Vector type`<T>` of elements to store
+	static constexpr void StoreUnaligned16(T* outAddr, SimdType inStore16)
+	{
+		static_assert(Simd128Traits<T>::kSize >= 16, "128bit SimdType is too small to contain 16 elements of type<T>");
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			outAddr[i] = inStore16[i];
+		}
+	}
+
+	/// @brief Add all vector type`<T>` elements in `inRHS` to `inLHS`, saturating
+	/// to the limits of `<T>` rather than wrapping.
+	/// @code{.cpp}
+	/// for (i = 0; i < MAX; ++i)
+	///     SimdType[i] = clamp(inLHS[i] + inRHS[i], lowest<T>, max<T>);
+	/// return SimdType;
+	/// @endcode
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Result vector type`<T>`
+	static constexpr SimdType AddSat(SimdType inLHS, SimdType inRHS)
+	{
+		static_assert(std::is_integral_v<T> && sizeof(T) < sizeof(long long), "AddSat() requires narrow integer elements");
+		SimdType add{};
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; ++i)
+		{
+			add[i] = Saturate(static_cast<long long>(inLHS[i]) + inRHS[i]);
+		}
+		return add;
+	}
+
+	/// @brief Subtract all vector type`<T>` elements in `inRHS` from `inLHS`, saturating
+	/// to the limits of `<T>` rather than wrapping.
+	/// @code{.cpp}
+	/// for (i = 0; i < MAX; ++i)
+	///     SimdType[i] = clamp(inLHS[i] - inRHS[i], lowest<T>, max<T>);
+	/// return SimdType;
+	/// @endcode
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Result vector type`<T>`
+	static constexpr SimdType SubSat(SimdType inLHS, SimdType inRHS)
+	{
+		static_assert(std::is_integral_v<T> && sizeof(T) < sizeof(long long), "SubSat() requires narrow integer elements");
+		SimdType sub{};
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; ++i)
+		{
+			sub[i] = Saturate(static_cast<long long>(inLHS[i]) - inRHS[i]);
+		}
+		return sub;
+	}
+
+	/// @brief Widen the low half of the elements of `inSimd` to a whole vector of wider type`<WideT>`.
+	/// @code{.cpp}
+	/// Simd128<WideT>::SimdType[0..MAX/2] = WideT{inSimd[0..MAX/2]};
+	/// @endcode
+	/// @tparam WideT Integer type twice the size of type`<T>`
+	/// @param inSimd Vector type`<T>` of elements to widen
+	/// @return Vector type`<WideT>` of widened elements
+	template<typename WideT>
+	static typename Simd128<WideT>::SimdType WidenLo(SimdType inSimd)
+	{
+		return Widen<WideT>(inSimd, 0);
+	}
+
+	/// @brief Widen the high half of the elements of `inSimd` to a whole vector of wider type`<WideT>`.
+	/// @code{.cpp}
+	/// Simd128<WideT>::SimdType[0..MAX/2] = WideT{inSimd[MAX/2..MAX]};
+	/// @endcode
+	/// @tparam WideT Integer type twice the size of type`<T>`
+	/// @param inSimd Vector type`<T>` of elements to widen
+	/// @return Vector type`<WideT>` of widened elements
+	template<typename WideT>
+	static typename Simd128<WideT>::SimdType WidenHi(SimdType inSimd)
+	{
+		return Widen<WideT>(inSimd, Simd128Traits<T>::kSize / 2);
+	}
+
+	/// @brief Narrow two vectors of wider type`<WideT>` into one vector of type`<T>`,
+	/// saturating to the limits of `<T>`. The reverse of `WidenLo()`, `WidenHi()`.
+	/// @code{.cpp}
+	/// SimdType[0..MAX/2] = clamp(inLo[0..MAX/2], lowest<T>, max<T>);
+	/// SimdType[MAX/2..MAX] = clamp(inHi[0..MAX/2], lowest<T>, max<T>);
+	/// @endcode
+	/// @tparam WideT Integer type twice the size of type`<T>`
+	/// @param inLo Vector type`<WideT>` of the low elements
+	/// @param inHi Vector type`<WideT>` of the high elements
+	/// @return Vector type`<T>` of narrowed elements
+	template<typename WideT>
+	static SimdType Narrow(typename Simd128<WideT>::SimdType inLo, typename Simd128<WideT>::SimdType inHi)
+	{
+		static_assert(sizeof(WideT) == 2 * sizeof(T), "Narrow() requires a type<WideT> twice the size of type<T>");
+		// NOTE: Every backend's SimdType is 16 bytes of consecutive elements, so copy through memory
+		constexpr std::size_t kHalf = Simd128Traits<T>::kSize / 2;
+		std::array<WideT, 2 * kHalf> wide{};
+		std::memcpy(&wide[0], &inLo, sizeof(inLo));
+		std::memcpy(&wide[kHalf], &inHi, sizeof(inHi));
+		SimdType narrow{};
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; ++i)
+		{
+			narrow[i] = Saturate(static_cast<long long>(wide[i]));
+		}
+		return narrow;
+	}
+
+	/// @brief Compare all vector type`<T>` elements in `inRHS` to `inLHS` for equality.
+	/// @code{.cpp}
+	/// for (i = 0; i < MAX; ++i)
+	///     SimdType[i] = (inLHS[i] == inRHS[i]) ? ~0 : 0;
+	/// return SimdType;
+	/// @endcode
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Lane mask for `Select()`: all bits set in the elements that are equal
+	static constexpr SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+	{
+		T allBits{};
+		if constexpr (std::is_integral_v<T>)
+		{
+			allBits = static_cast<T>(~T{0});
+		}
+		else
+		{
+			// Floating point lanes hold the bit pattern, like the SSE/NEON compares (it reads as a NaN)
+			const auto bits = ~std::uint64_t{0};
+			std::memcpy(&allBits, &bits, sizeof(allBits));
+		}
+		SimdType eq{};
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; ++i)
+		{
+			eq[i] = (inLHS[i] == inRHS[i]) ? allBits : T{0};
+		}
+		return eq;
+	}
+
+	/// @brief Compare all vector type`<T>` elements of `inLHS` to be greater than `inRHS`.
+	/// @code{.cpp}
+	/// for (i = 0; i < MAX; ++i)
+	///     SimdType[i] = (inLHS[i] > inRHS[i]) ? ~0 : 0;
+	/// return SimdType;
+	/// @endcode
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Lane mask for `Select()`: all bits set in the elements of `inLHS` that are greater
+	static constexpr SimdType CompareGt(SimdType inLHS, SimdType inRHS)
+	{
+		static_assert(std::is_integral_v<T>, "CompareGt() requires integer elements");
+		SimdType gt{};
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; ++i)
+		{
+			gt[i] = (inLHS[i] > inRHS[i]) ? static_cast<T>(~T{0}) : T{0};
+		}
+		return gt;
+	}
+
+	/// @brief Masked blend: select each element from `inTrue` where the corresponding
+	/// element of `inMask` has all bits set, otherwise from `inFalse`.
+	/// @code{.cpp}
+	/// for (i = 0; i < MAX; ++i)
+	///     SimdType[i] = inMask[i] ? inTrue[i] : inFalse[i];
+	/// return SimdType;
+	/// @endcode
+	/// @param inMask Lane mask (e.g. from `CompareEq()`); each element all bits set or zero
+	/// @param inTrue Elements selected where the mask is set
+	/// @param inFalse Elements selected where the mask is zero
+	/// @return Result vector type`<T>`
+	static constexpr SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+	{
+		SimdType select{};
+		for (std::size_t i = 0; i < Simd128Traits<T>::kSize; ++i)
+		{
+			select[i] = (inMask[i] != T{0}) ? inTrue[i] : inFalse[i]; // NOTE: a NaN (set) lane is != 0
+		}
+		return select;
+	}
+
+private:
+	/// @brief Clamp `inValue` to the limits of `<T>`
+	static constexpr T Saturate(long long inValue)
+	{
+		constexpr auto kMin = static_cast<long long>(std::numeric_limits<T>::lowest());
+		constexpr auto kMax = static_cast<long long>(std::numeric_limits<T>::max());
+		return static_cast<T>(std::min(std::max(inValue, kMin), kMax));
+	}
+
+	/// @brief Widen half of the elements of `inSimd`, starting at element `inFirst`
+	template<typename WideT>
+	static typename Simd128<WideT>::SimdType Widen(SimdType inSimd, std::size_t inFirst)
+	{
+		static_assert(sizeof(WideT) == 2 * sizeof(T), "Widen() requires a type<WideT> twice the size of type<T>");
+		constexpr std::size_t kHalf = Simd128Traits<T>::kSize / 2;
+		std::array<WideT, kHalf> wide{};
+		for (std::size_t i = 0; i < kHalf; ++i)
+		{
+			wide[i] = static_cast<WideT>(inSimd[inFirst + i]);
+		}
+		// NOTE: Every backend's SimdType is 16 bytes of consecutive elements, so copy through memory
+		typename Simd128<WideT>::SimdType widen{};
+		std::memcpy(&widen, wide.data(), sizeof(widen));
+		return widen;
+	}
+
 }; // struct Simd128<T>
 
 #pragma endregion {}
 
+// ------------------------------------------------------------------
+#pragma region ForEachSimd()
+
+/// @brief Apply a vector kernel to every element of an array of any length, `Simd128<T>::kSize`
+/// elements at a time. The tail (fewer than `kSize` elements) is also a vector: a masked `LoadN()`
+/// and `StoreN()`, rather than a scalar epilogue, so short spans cost one extra vector, not a loop.
+/// @code{.cpp}
+/// // Scale 13 floats: 3 whole vectors, then 1 masked tail vector of 1 element
+/// ForEachSimd(values, values, 13, [](auto inSimd) { return Simd128<float>::Mul(inSimd, Simd128<float>::Splat(2.0f)); });
+/// @endcode
+/// @tparam T Type of element: one with whole vector unaligned loads (`int`, `float`, `double`)
+/// @tparam KernelT Callable `SimdType(SimdType)`. The unused lanes of a tail vector are zero, and
+/// their results are discarded; so the kernel must not fault on zero (e.g. integer `Div()` is safe)
+/// @param inAddr Address of &elements[inCount] to read; of any alignment
+/// @param outAddr Address of &elements[inCount] to write; of any alignment. May equal `inAddr` (in-place)
+/// @param inCount Number of elements
+/// @param inKernel Kernel applied to each vector of elements
+template<typename T, typename KernelT>
+void ForEachSimd(const T* inAddr, T* outAddr, std::size_t inCount, KernelT&& inKernel)
+{
+	using Simd = Simd128<T>;
+	constexpr std::size_t kStep = Simd::kSize;
+	static_assert(kStep == 4 || kStep == 2, "ForEachSimd() requires a type<T> of 4 (32bit) or 2 (64bit) lanes");
+
+	std::size_t i = 0;
+	for (; i + kStep <= inCount; i += kStep)
+	{
+		if constexpr (kStep == 4)
+		{
+			Simd::StoreUnaligned4(&outAddr[i], inKernel(Simd::LoadUnaligned4(&inAddr[i])));
+		}
+		else
+		{
+			Simd::StoreUnaligned2(&outAddr[i], inKernel(Simd::LoadUnaligned2(&inAddr[i])));
+		}
+	}
+
+	const std::size_t tailCount = inCount - i;
+	if (tailCount > 0)
+	{
+		Simd::StoreN(&outAddr[i], inKernel(Simd::LoadN(&inAddr[i], tailCount)), tailCount);
+	}
+}
+
+/// @brief Apply a vector kernel in-place to every element of an array of any length.
+/// @see ForEachSimd(const T*, T*, std::size_t, KernelT&&)
+/// @param ioAddr Address of &elements[inCount] to transform; of any alignment
+/// @param inCount Number of elements
+/// @param inKernel Callable `SimdType(SimdType)` applied to each vector of elements
+template<typename T, typename KernelT>
+void ForEachSimd(T* ioAddr, std::size_t inCount, KernelT&& inKernel)
+{
+	ForEachSimd<T>(ioAddr, ioAddr, inCount, std::forward<KernelT>(inKernel));
+}
+
+#pragma endregion
+
+// ------------------------------------------------------------------
+#pragma region IsSimdLoadStoreConvertible<>
+
+/// @brief Whether two different element types share the same (`float`) SIMD lanes, so a
+/// conversion is just a (widening) load of one and a (narrowing) store of the other.
+/// e.g. `Half` <-> `float`, with a `Simd128<Half>` specialization that widens on load.
+/// @tparam ToT Destination element type
+/// @tparam FromT Source element type
+template<typename ToT, typename FromT>
+constexpr bool IsSimdLoadStoreConvertible()
+{
+	using ToCompute = typename ElementTraits<ToT>::ComputeType;
+	using FromCompute = typename ElementTraits<FromT>::ComputeType;
+	constexpr bool kIsFloatLanes = std::is_same_v<ToCompute, float> && std::is_same_v<FromCompute, float>;
+	// NOTE: Compare the Simd128<> types rather than their SimdType (e.g. __m128), whose attributes
+	// are ignored when used as a template argument
+	constexpr bool kIsFloatSimd = std::is_base_of_v<Simd128<float>, Simd128<ToT>> && std::is_base_of_v<Simd128<float>, Simd128<FromT>>;
+	return !std::is_same_v<ToT, FromT> && kIsFloatLanes && kIsFloatSimd;
+}
+
+#pragma endregion
+
 } // namespace saber::geometry::detail
 
 #if SABER_GEOMETRY_CONFIG_ISENABLED_SIMD
@@ -552,7 +1214,9 @@ struct Simd128 :
 // If `saber::geometery` is enabled for SIMD...
 // Include platform-specific SIMD template specializations here
 
-#if SABER_CPU(X86)
+#if SABER_GEOMETRY_CONFIG_ISENABLED_SIMD_VECTOR
+#include "saber/geometry/detail/simd_vector.hpp" // Any CPU: GCC/Clang vector extensions
+#elif SABER_CPU(X86)
 #include "saber/geometry/detail/simd_sse.hpp"
 #elif SABER_CPU(ARM)
 #include "saber/geometry/detail/simd_neon.hpp"
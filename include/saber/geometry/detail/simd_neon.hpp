@@ -12,8 +12,12 @@
 #include "saber/geometry/detail/simd.hpp"
 
 // std
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <cstring>
 #include <limits>
+#include <type_traits>
 
 //neon
 #if SABER_COMPILER(MSVC)
@@ -74,6 +78,51 @@ struct Simd128Traits<double>
 
 }; // struct SimdTraits<>
 
+// int16_t
+template<>
+struct Simd128Traits<std::int16_t>
+{
+    /// @brief Number of elements of type T in a SIMD vector
+    static constexpr std::size_t kSize = 8;
+
+    /// @brief Underlying type of a SIMD element
+    using ValueType = std::int16_t;
+
+    /// @brief Platform-specific type of a SIMD vector of elements
+    using SimdType = int16x8_t; // vector of int16_t
+
+}; // struct SimdTraits<>
+
+// uint16_t
+template<>
+struct Simd128Traits<std::uint16_t>
+{
+    /// @brief Number of elements of type T in a SIMD vector
+    static constexpr std::size_t kSize = 8;
+
+    /// @brief Underlying type of a SIMD element
+    using ValueType = std::uint16_t;
+
+    /// @brief Platform-specific type of a SIMD vector of elements
+    using SimdType = uint16x8_t; // vector of uint16_t
+
+}; // struct SimdTraits<>
+
+// uint8_t
+template<>
+struct Simd128Traits<std::uint8_t>
+{
+    /// @brief Number of elements of type T in a SIMD vector
+    static constexpr std::size_t kSize = 16;
+
+    /// @brief Underlying type of a SIMD element
+    using ValueType = std::uint8_t;
+
+    /// @brief Platform-specific type of a SIMD vector of elements
+    using SimdType = uint8x16_t; // vector of uint8_t
+
+}; // struct SimdTraits<>
+
 #pragma endregion {}
 
 // ------------------------------------------------------------------
@@ -115,6 +164,14 @@ struct Simd128<int> :
         return vsetq_lane_s32(inAddr[0], vdupq_n_s32(0), 0);
     }
 
+    /// @brief Broadcast a single element of type`<int>` to all elements of a vector.
+    /// @param inValue Value to broadcast
+    /// @return Vector type`<int>` of broadcast elements
+    static SimdType Splat(int inValue)
+    {
+        return vdupq_n_s32(inValue);
+    }
+
     /// @brief Store 4 elements of type`<int>` to memory specified by `outAddr`.
     /// @param outAddr Address to store &elements[4]
     /// @param inStore4 Vector type`<int>` of elements to store
@@ -133,6 +190,39 @@ struct Simd128<int> :
         vst1_s32(outAddr, vget_low_s32(inStore2));
     }
 
+    /// @brief Load 4 elements of type`<int>` from memory specified by `inAddr`, of any alignment.
+    /// NEON `vld1q` has no alignment requirement, so this is the same as `Load4()`.
+    /// @param inAddr Address of &elements[4] to load
+    /// @return Vector type`<int>` of loaded elements
+    static SimdType LoadUnaligned4(const int* inAddr)
+    {
+        return Load4(inAddr);
+    }
+
+    /// @brief Load 2 elements of type`<int>` from memory specified by `inAddr`, of any alignment.
+    /// @param inAddr Address of &elements[2] to load
+    /// @return Vector type`<int>` of loaded elements
+    static SimdType LoadUnaligned2(const int* inAddr)
+    {
+        return Load2(inAddr);
+    }
+
+    /// @brief Store 4 elements of type`<int>` to memory specified by `outAddr`, of any alignment.
+    /// @param outAddr Address to store &elements[4]
+    /// @param inStore4 Vector type`<int>` of elements to store
+    static void StoreUnaligned4(int* outAddr, SimdType inStore4)
+    {
+        Store4(outAddr, inStore4);
+    }
+
+    /// @brief Store 2 elements of type`<int>` to memory specified by `outAddr`, of any alignment.
+    /// @param outAddr Address to store &elements[2]
+    /// @param inStore2 Vector type`<int>` of elements to store
+    static void StoreUnaligned2(int* outAddr, SimdType inStore2)
+    {
+        Store2(outAddr, inStore2);
+    }
+
     /// @brief Store 1 element of type`<int>` to memory specified by `outAddr`.
     /// The lowest order element is stored to memory.
     /// Any higher order elements are ignored.
@@ -143,6 +233,31 @@ struct Simd128<int> :
         outAddr[0] = vgetq_lane_s32(inStore1, 0);
     }
 
+    /// @brief Load the first `inCount` elements of type`<int>` from memory specified by `inAddr`, of any alignment.
+    /// Elements at and beyond `inCount` are set to zero, and are never read from memory.
+    /// @param inAddr Address of &elements[inCount] to load
+    /// @param inCount Number of elements to load; counts of 4 or more load a whole vector
+    /// @return Vector type`<int>` of loaded elements
+    static SimdType LoadN(const int* inAddr, std::size_t inCount)
+    {
+        // NEON has no masked load: stage the elements in a zeroed vector sized buffer
+        alignas(kSimdAlignment) std::array<int, 4> loadN{};
+        std::memcpy(loadN.data(), inAddr, std::min<std::size_t>(inCount, 4) * sizeof(int));
+        return vld1q_s32(loadN.data());
+    }
+
+    /// @brief Store the first `inCount` elements of type`<int>` to memory specified by `outAddr`, of any alignment.
+    /// Memory at and beyond `outAddr[inCount]` is never written.
+    /// @param outAddr Address to store &elements[inCount]
+    /// @param inStoreN Vector type`<int>` of elements to store
+    /// @param inCount Number of elements to store; counts of 4 or more store a whole vector
+    static void StoreN(int* outAddr, SimdType inStoreN, std::size_t inCount)
+    {
+        alignas(kSimdAlignment) std::array<int, 4> storeN{};
+        vst1q_s32(storeN.data(), inStoreN);
+        std::memcpy(outAddr, storeN.data(), std::min<std::size_t>(inCount, 4) * sizeof(int));
+    }
+
     /// @brief Add all vector type`<int>` elements in `inRHS` to `inLHS`.
     /// @param inLHS Left hand side vector term
     /// @param inRHS Right hand side vector term
@@ -176,12 +291,35 @@ struct Simd128<int> :
     /// @return Result vector type`<int>`
     static SimdType Div(SimdType inLHS, SimdType inRHS)
     {
-        std::array<int, 4> lhs, rhs;
-        Store4(lhs.data(), inLHS);
-        Store4(rhs.data(), inRHS);
-        for (int i = 0; i < 4; ++i)
-            lhs[i] = (rhs[i] != 0 ? lhs[i] / rhs[i] : 0);
-        return Load4(lhs.data());
+        // NEON has no SIMD integer division. Every int32 is exact as a double, and a correctly
+        // rounded double quotient of two int32 truncates to the exact int quotient
+        const float64x2_t lhsLo = vcvtq_f64_s64(vmovl_s32(vget_low_s32(inLHS)));
+        const float64x2_t rhsLo = vcvtq_f64_s64(vmovl_s32(vget_low_s32(inRHS)));
+        const float64x2_t lhsHi = vcvtq_f64_s64(vmovl_high_s32(inLHS));
+        const float64x2_t rhsHi = vcvtq_f64_s64(vmovl_high_s32(inRHS));
+        const int32x2_t divLo = vmovn_s64(vcvtq_s64_f64(vdivq_f64(lhsLo, rhsLo)));
+        const int32x2_t divHi = vmovn_s64(vcvtq_s64_f64(vdivq_f64(lhsHi, rhsHi)));
+        const int32x4_t div = vcombine_s32(divLo, divHi);
+        // Division by zero returns zero
+        const uint32x4_t isZero = vceqq_s32(inRHS, vdupq_n_s32(0));
+        return vbicq_s32(div, vreinterpretq_s32_u32(isZero));
+    }
+
+    /// @brief Divide all vector type`<int>` elements of `inLHS` by the same prepared divisor,
+    /// with a multiply, add and shift instead of a divide.
+    /// @param inLHS Left hand side vector term
+    /// @param inDivisor Divisor prepared once by the caller
+    /// @return Result vector type`<int>`
+    static SimdType DivBy(SimdType inLHS, const Divisor<int>& inDivisor)
+    {
+        const int32x4_t magic = vdupq_n_s32(inDivisor.Magic());
+        const int64x2_t lo = vmull_s32(vget_low_s32(inLHS), vget_low_s32(magic));
+        const int64x2_t hi = vmull_high_s32(inLHS, magic);
+        int32x4_t div = vcombine_s32(vshrn_n_s64(lo, 32), vshrn_n_s64(hi, 32));
+        div = vaddq_s32(div, vmulq_n_s32(inLHS, inDivisor.Add()));
+        div = vshlq_s32(div, vdupq_n_s32(-inDivisor.Shift())); // Negative shift left: arithmetic shift right
+        const uint32x4_t roundUp = vandq_u32(vshrq_n_u32(vreinterpretq_u32_s32(div), 31), vdupq_n_u32(inDivisor.RoundUp()));
+        return vaddq_s32(div, vreinterpretq_s32_u32(roundUp));
     }
 
     /// @brief Duplicate the low half of the SIMD register into both halves.
@@ -363,6 +501,14 @@ struct Simd128<float> :
         return vsetq_lane_f32(inAddr[0], vdupq_n_f32(0.0f), 0);
     }
 
+    /// @brief Broadcast a single element of type`<float>` to all elements of a vector.
+    /// @param inValue Value to broadcast
+    /// @return Vector type`<float>` of broadcast elements
+    static SimdType Splat(float inValue)
+    {
+        return vdupq_n_f32(inValue);
+    }
+
     /// @brief Store 4 elements of type`<float>` to memory specified by `outAddr`.
     /// @param outAddr Address to store &elements[4]
     /// @param inStore4 Vector type`<float>` of elements to store
@@ -381,6 +527,39 @@ struct Simd128<float> :
         vst1_f32(outAddr, vget_low_f32(inStore2));
     }
 
+    /// @brief Load 4 elements of type`<float>` from memory specified by `inAddr`, of any alignment.
+    /// NEON `vld1q` has no alignment requirement, so this is the same as `Load4()`.
+    /// @param inAddr Address of &elements[4] to load
+    /// @return Vector type`<float>` of loaded elements
+    static SimdType LoadUnaligned4(const float* inAddr)
+    {
+        return Load4(inAddr);
+    }
+
+    /// @brief Load 2 elements of type`<float>` from memory specified by `inAddr`, of any alignment.
+    /// @param inAddr Address of &elements[2] to load
+    /// @return Vector type`<float>` of loaded elements
+    static SimdType LoadUnaligned2(const float* inAddr)
+    {
+        return Load2(inAddr);
+    }
+
+    /// @brief Store 4 elements of type`<float>` to memory specified by `outAddr`, of any alignment.
+    /// @param outAddr Address to store &elements[4]
+    /// @param inStore4 Vector type`<float>` of elements to store
+    static void StoreUnaligned4(float* outAddr, SimdType inStore4)
+    {
+        Store4(outAddr, inStore4);
+    }
+
+    /// @brief Store 2 elements of type`<float>` to memory specified by `outAddr`, of any alignment.
+    /// @param outAddr Address to store &elements[2]
+    /// @param inStore2 Vector type`<float>` of elements to store
+    static void StoreUnaligned2(float* outAddr, SimdType inStore2)
+    {
+        Store2(outAddr, inStore2);
+    }
+
     /// @brief Store 1 element of type`<float>` to memory specified by `outAddr`.
     /// The lowest order element is stored to memory.
     /// Any higher order elements are ignored.
@@ -391,6 +570,31 @@ struct Simd128<float> :
         outAddr[0] = vgetq_lane_f32(inStore1, 0);
     }
 
+    /// @brief Load the first `inCount` elements of type`<float>` from memory specified by `inAddr`, of any alignment.
+    /// Elements at and beyond `inCount` are set to zero, and are never read from memory.
+    /// @param inAddr Address of &elements[inCount] to load
+    /// @param inCount Number of elements to load; counts of 4 or more load a whole vector
+    /// @return Vector type`<float>` of loaded elements
+    static SimdType LoadN(const float* inAddr, std::size_t inCount)
+    {
+        // NEON has no masked load: stage the elements in a zeroed vector sized buffer
+        alignas(kSimdAlignment) std::array<float, 4> loadN{};
+        std::memcpy(loadN.data(), inAddr, std::min<std::size_t>(inCount, 4) * sizeof(float));
+        return vld1q_f32(loadN.data());
+    }
+
+    /// @brief Store the first `inCount` elements of type`<float>` to memory specified by `outAddr`, of any alignment.
+    /// Memory at and beyond `outAddr[inCount]` is never written.
+    /// @param outAddr Address to store &elements[inCount]
+    /// @param inStoreN Vector type`<float>` of elements to store
+    /// @param inCount Number of elements to store; counts of 4 or more store a whole vector
+    static void StoreN(float* outAddr, SimdType inStoreN, std::size_t inCount)
+    {
+        alignas(kSimdAlignment) std::array<float, 4> storeN{};
+        vst1q_f32(storeN.data(), inStoreN);
+        std::memcpy(outAddr, storeN.data(), std::min<std::size_t>(inCount, 4) * sizeof(float));
+    }
+
     /// @brief Add all vector type`<float>` elements in `inRHS` to `inLHS`.
     /// @param inLHS Left hand side vector term
     /// @param inRHS Right hand side vector term
@@ -427,6 +631,15 @@ struct Simd128<float> :
         return vdivq_f32(inLHS, inRHS);
     }
 
+    /// @brief Divide all vector type`<float>` elements of `inLHS` by the same divisor.
+    /// @param inLHS Left hand side vector term
+    /// @param inDivisor Divisor to divide by
+    /// @return Result vector type`<float>`
+    static SimdType DivBy(SimdType inLHS, const Divisor<float>& inDivisor)
+    {
+        return vdivq_f32(inLHS, vdupq_n_f32(inDivisor.Value()));
+    }
+
     /// @brief Duplicate the low half of the SIMD register into both halves.
     /// @param inSimd Input SIMD register.
     /// @return SIMD register with low half duplicated.
@@ -513,6 +726,30 @@ struct Simd128<float> :
         return vrndq_f32(inRound);
     }
 
+    /// @brief Round then convert 4 elements of type`<float>` to `int`, and store them
+    /// to memory specified by `outAddr`.
+    /// @tparam Round Rounding applied before conversion
+    /// @tparam Overflow Out of range handling
+    /// @param outAddr Address to store &elements[4]
+    /// @param inConvert Vector type`<float>` of elements to convert
+    template<RoundKind Round, OverflowKind Overflow>
+    static void ConvertStore4(int* outAddr, SimdType inConvert)
+    {
+        vst1q_s32(outAddr, ConvertToInt<Round>(inConvert));
+    }
+
+    /// @brief Round then convert the 2 lowest order elements of type`<float>` to `int`,
+    /// and store them to memory specified by `outAddr`.
+    /// @tparam Round Rounding applied before conversion
+    /// @tparam Overflow Out of range handling
+    /// @param outAddr Address to store &elements[2]
+    /// @param inConvert Vector type`<float>` of elements to convert
+    template<RoundKind Round, OverflowKind Overflow>
+    static void ConvertStore2(int* outAddr, SimdType inConvert)
+    {
+        vst1_s32(outAddr, vget_low_s32(ConvertToInt<Round>(inConvert)));
+    }
+
     /// @brief Find the minimum value for each pair of element of SimdType
     /// @param inLHS Left hand side vector term
     /// @param inRHS Right hand side vector term
@@ -618,6 +855,42 @@ struct Simd128<float> :
         }
         return leMask;
     }
+
+    /// @brief Lane mask for `Select()`: all bits set in the elements that are exactly equal
+    static SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+    {
+        return vreinterpretq_f32_u32(vceqq_f32(inLHS, inRHS));
+    }
+
+    /// @brief Masked blend: elements of `inTrue` where `inMask` is set, otherwise of `inFalse`
+    static SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+    {
+        return vbslq_f32(vreinterpretq_u32_f32(inMask), inTrue, inFalse);
+    }
+
+private:
+    // NOTE: NEON conversions fuse rounding into the instruction, and always saturate
+    // (NaN converts to 0), which satisfies both `OverflowKind` policies
+    template<RoundKind Round>
+    static int32x4_t ConvertToInt(SimdType inConvert)
+    {
+        if constexpr (Round == RoundKind::kNearest)
+        {
+            return vcvtaq_s32_f32(inConvert);
+        }
+        else if constexpr (Round == RoundKind::kFloor)
+        {
+            return vcvtmq_s32_f32(inConvert);
+        }
+        else if constexpr (Round == RoundKind::kCeil)
+        {
+            return vcvtpq_s32_f32(inConvert);
+        }
+        else
+        {
+            return vcvtq_s32_f32(inConvert);
+        }
+    }
 };
 
 #pragma endregion {}
@@ -652,6 +925,14 @@ struct Simd128<double> :
         return vsetq_lane_f64(inAddr[0], vdupq_n_f64(0.0), 0);
     }
 
+    /// @brief Broadcast a single element of type`<double>` to all elements of a vector.
+    /// @param inValue Value to broadcast
+    /// @return Vector type`<double>` of broadcast elements
+    static SimdType Splat(double inValue)
+    {
+        return vdupq_n_f64(inValue);
+    }
+
     /// @brief Store 2 elements of type`<double>` to memory specified by `outAddr`.
     /// The 2 lowest order elements are stored to memory.
     /// Any high order elements are ignored.
@@ -662,6 +943,22 @@ struct Simd128<double> :
         vst1q_f64(outAddr, inStore2);
     }
 
+    /// @brief Load 2 elements of type`<double>` from memory specified by `inAddr`, of any alignment.
+    /// @param inAddr Address of &elements[2] to load
+    /// @return Vector type`<double>` of loaded elements
+    static SimdType LoadUnaligned2(const double* inAddr)
+    {
+        return Load2(inAddr);
+    }
+
+    /// @brief Store 2 elements of type`<double>` to memory specified by `outAddr`, of any alignment.
+    /// @param outAddr Address to store &elements[2]
+    /// @param inStore2 Vector type`<double>` of elements to store
+    static void StoreUnaligned2(double* outAddr, SimdType inStore2)
+    {
+        Store2(outAddr, inStore2);
+    }
+
     /// @brief Store 1 element of type`<double>` to memory specified by `outAddr`.
     /// The lowest order element is stored to memory.
     /// Any higher order elements are ignored.
@@ -672,6 +969,31 @@ struct Simd128<double> :
         outAddr[0] = vgetq_lane_f64(inStore1, 0);
     }
 
+    /// @brief Load the first `inCount` elements of type`<double>` from memory specified by `inAddr`, of any alignment.
+    /// Elements at and beyond `inCount` are set to zero, and are never read from memory.
+    /// @param inAddr Address of &elements[inCount] to load
+    /// @param inCount Number of elements to load; counts of 2 or more load a whole vector
+    /// @return Vector type`<double>` of loaded elements
+    static SimdType LoadN(const double* inAddr, std::size_t inCount)
+    {
+        // NEON has no masked load: stage the elements in a zeroed vector sized buffer
+        alignas(kSimdAlignment) std::array<double, 2> loadN{};
+        std::memcpy(loadN.data(), inAddr, std::min<std::size_t>(inCount, 2) * sizeof(double));
+        return vld1q_f64(loadN.data());
+    }
+
+    /// @brief Store the first `inCount` elements of type`<double>` to memory specified by `outAddr`, of any alignment.
+    /// Memory at and beyond `outAddr[inCount]` is never written.
+    /// @param outAddr Address to store &elements[inCount]
+    /// @param inStoreN Vector type`<double>` of elements to store
+    /// @param inCount Number of elements to store; counts of 2 or more store a whole vector
+    static void StoreN(double* outAddr, SimdType inStoreN, std::size_t inCount)
+    {
+        alignas(kSimdAlignment) std::array<double, 2> storeN{};
+        vst1q_f64(storeN.data(), inStoreN);
+        std::memcpy(outAddr, storeN.data(), std::min<std::size_t>(inCount, 2) * sizeof(double));
+    }
+
     /// @brief Add all vector type`<double>` elements in `inRHS` to `inLHS`.
     /// @param inLHS Left hand side vector term
     /// @param inRHS Right hand side vector term
@@ -708,6 +1030,15 @@ struct Simd128<double> :
         return vdivq_f64(inLHS, inRHS);
     }
 
+    /// @brief Divide all vector type`<double>` elements of `inLHS` by the same divisor.
+    /// @param inLHS Left hand side vector term
+    /// @param inDivisor Divisor to divide by
+    /// @return Result vector type`<double>`
+    static SimdType DivBy(SimdType inLHS, const Divisor<double>& inDivisor)
+    {
+        return vdivq_f64(inLHS, vdupq_n_f64(inDivisor.Value()));
+    }
+
     /// @brief Duplicate the low half of the SIMD register into both halves.
     /// @param inSimd Input SIMD register.
     /// @return SIMD register with low half duplicated.
@@ -791,6 +1122,18 @@ struct Simd128<double> :
         return vrndq_f64(inRound);
     }
 
+    /// @brief Round then convert 2 elements of type`<double>` to `int`, and store them
+    /// to memory specified by `outAddr`.
+    /// @tparam Round Rounding applied before conversion
+    /// @tparam Overflow Out of range handling
+    /// @param outAddr Address to store &elements[2]
+    /// @param inConvert Vector type`<double>` of elements to convert
+    template<RoundKind Round, OverflowKind Overflow>
+    static void ConvertStore2(int* outAddr, SimdType inConvert)
+    {
+        vst1_s32(outAddr, ConvertToInt<Round>(inConvert));
+    }
+
     /// @brief Find the minimum value for each pair of element of SimdType
     /// @param inLHS Left hand side vector term
     /// @param inRHS Right hand side vector term
@@ -893,6 +1236,873 @@ struct Simd128<double> :
         }
         return leMask;
     }
+
+    /// @brief Lane mask for `Select()`: all bits set in the elements that are exactly equal
+    static SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+    {
+        return vreinterpretq_f64_u64(vceqq_f64(inLHS, inRHS));
+    }
+
+    /// @brief Masked blend: elements of `inTrue` where `inMask` is set, otherwise of `inFalse`
+    static SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+    {
+        return vbslq_f64(vreinterpretq_u64_f64(inMask), inTrue, inFalse);
+    }
+
+private:
+    // NOTE: Convert to 64bit with rounding fused into the instruction, then narrow with saturation.
+    // Both steps saturate (NaN converts to 0), which satisfies both `OverflowKind` policies
+    template<RoundKind Round>
+    static int32x2_t ConvertToInt(SimdType inConvert)
+    {
+        int64x2_t convert{};
+        if constexpr (Round == RoundKind::kNearest)
+        {
+            convert = vcvtaq_s64_f64(inConvert);
+        }
+        else if constexpr (Round == RoundKind::kFloor)
+        {
+            convert = vcvtmq_s64_f64(inConvert);
+        }
+        else if constexpr (Round == RoundKind::kCeil)
+        {
+            convert = vcvtpq_s64_f64(inConvert);
+        }
+        else
+        {
+            convert = vcvtq_s64_f64(inConvert);
+        }
+        return vqmovn_s64(convert);
+    }
+};
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region Simd128<int16_t> NEON specialization
+
+/// @brief 8x 16bit lanes. As geometry storage only the low 4 lanes are loaded
+/// (`Load4()` is a 64bit load), and the upper lanes stay zero.
+/// Arithmetic wraps, like `std::int16_t` arithmetic does.
+template<>
+struct Simd128<std::int16_t> :
+    public Simd128Traits<std::int16_t>
+{
+    using typename Simd128Traits<std::int16_t>::SimdType; // int16x8_t
+    using typename Simd128Traits<std::int16_t>::ValueType; // int16_t
+
+    /// @brief Load 4 elements of type`<int16_t>` from memory specified by `inAddr`.
+    /// Any unused high order elements are set to zero.
+    /// @param inAddr Address of &elements[4] to load
+    /// @return Vector type`<int16_t>` of loaded elements
+    static SimdType Load4(const std::int16_t* inAddr)
+    {
+        return vcombine_s16(vld1_s16(inAddr), vdup_n_s16(0));
+    }
+
+    /// @brief Load 2 elements of type`<int16_t>` from memory specified by `inAddr`.
+    /// Any unused high order elements are set to zero.
+    /// @param inAddr Address of &elements[2] to load
+    /// @return Vector type`<int16_t>` of loaded elements
+    static SimdType Load2(const std::int16_t* inAddr)
+    {
+        std::int32_t pair;
+        std::memcpy(&pair, inAddr, sizeof(pair));
+        return vreinterpretq_s16_s32(vsetq_lane_s32(pair, vdupq_n_s32(0), 0));
+    }
+
+    /// @brief Load 1 element of type`<int16_t>` from memory specified by `inAddr`.
+    /// Any unused high order elements are set to zero.
+    /// @param inAddr Address of &element[1] to load
+    /// @return Vector type`<int16_t>` of loaded elements
+    static SimdType Load1(const std::int16_t* inAddr)
+    {
+        return vsetq_lane_s16(inAddr[0], vdupq_n_s16(0), 0);
+    }
+
+    /// @brief Broadcast a single element of type`<int16_t>` to all elements of a vector.
+    /// @param inValue Value to broadcast
+    /// @return Vector type`<int16_t>` of broadcast elements
+    static SimdType Splat(std::int16_t inValue)
+    {
+        return vdupq_n_s16(inValue);
+    }
+
+    /// @brief Store 4 elements of type`<int16_t>` to memory specified by `outAddr`.
+    /// @param outAddr Address to store &elements[4]
+    /// @param inStore4 Vector type`<int16_t>` of elements to store
+    static void Store4(std::int16_t* outAddr, SimdType inStore4)
+    {
+        vst1_s16(outAddr, vget_low_s16(inStore4));
+    }
+
+    /// @brief Store 2 elements of type`<int16_t>` to memory specified by `outAddr`.
+    /// @param outAddr Address to store &elements[2]
+    /// @param inStore2 Vector type`<int16_t>` of elements to store
+    static void Store2(std::int16_t* outAddr, SimdType inStore2)
+    {
+        const std::int32_t pair = vgetq_lane_s32(vreinterpretq_s32_s16(inStore2), 0);
+        std::memcpy(outAddr, &pair, sizeof(pair));
+    }
+
+    /// @brief Store 1 element of type`<int16_t>` to memory specified by `outAddr`.
+    /// @param outAddr Address to store &element[1]
+    /// @param inStore1 Vector type`<int16_t>` of elements to store
+    static void Store1(std::int16_t* outAddr, SimdType inStore1)
+    {
+        outAddr[0] = vgetq_lane_s16(inStore1, 0);
+    }
+
+    /// @brief Same as `Load4()`: no alignment requirement
+    static SimdType LoadUnaligned4(const std::int16_t* inAddr)
+    {
+        return Load4(inAddr);
+    }
+
+    /// @brief Same as `Load2()`: no alignment requirement
+    static SimdType LoadUnaligned2(const std::int16_t* inAddr)
+    {
+        return Load2(inAddr);
+    }
+
+    /// @brief Same as `Store4()`: no alignment requirement
+    static void StoreUnaligned4(std::int16_t* outAddr, SimdType inStore4)
+    {
+        Store4(outAddr, inStore4);
+    }
+
+    /// @brief Same as `Store2()`: no alignment requirement
+    static void StoreUnaligned2(std::int16_t* outAddr, SimdType inStore2)
+    {
+        Store2(outAddr, inStore2);
+    }
+
+    /// @brief Load 4 elements of type`<int16_t>`, sign extended to a vector of type`<int>`.
+    /// @tparam WideT Must be `int`
+    /// @param inAddr Address of &elements[4] to load
+    /// @return Vector type`<int>` of widened elements
+    template<typename WideT>
+    static typename Simd128<WideT>::SimdType LoadWiden4(const std::int16_t* inAddr)
+    {
+        static_assert(std::is_same_v<WideT, int>, "NEON only widens type<int16_t> to type<int>");
+        return vmovl_s16(vld1_s16(inAddr));
+    }
+
+    /// @brief Narrow 4 elements of type`<int>` to type`<int16_t>` (saturating), and store them
+    /// to memory specified by `outAddr`.
+    /// @tparam WideT Must be `int`
+    /// @param outAddr Address to store &elements[4]
+    /// @param inWiden Vector type`<int>` of elements to narrow
+    template<typename WideT>
+    static void NarrowStore4(std::int16_t* outAddr, typename Simd128<WideT>::SimdType inWiden)
+    {
+        static_assert(std::is_same_v<WideT, int>, "NEON only narrows type<int> to type<int16_t>");
+        vst1_s16(outAddr, vqmovn_s32(inWiden));
+    }
+
+    /// @brief Add all vector type`<int16_t>` elements in `inRHS` to `inLHS`.
+    /// @param inLHS Left hand side vector term
+    /// @param inRHS Right hand side vector term
+    /// @return Result vector type`<int16_t>`
+    static SimdType Add(SimdType inLHS, SimdType inRHS)
+    {
+        return vaddq_s16(inLHS, inRHS);
+    }
+
+    /// @brief Subtract all vector type`<int16_t>` elements in `inRHS` from `inLHS`.
+    /// @param inLHS Left hand side vector term
+    /// @param inRHS Right hand side vector term
+    /// @return Result vector type`<int16_t>`
+    static SimdType Sub(SimdType inLHS, SimdType inRHS)
+    {
+        return vsubq_s16(inLHS, inRHS);
+    }
+
+    /// @brief Multiply all vector type`<int16_t>` elements in `inRHS` to `inLHS`.
+    /// @param inLHS Left hand side vector term
+    /// @param inRHS Right hand side vector term
+    /// @return Result vector type`<int16_t>`
+    static SimdType Mul(SimdType inLHS, SimdType inRHS)
+    {
+        return vmulq_s16(inLHS, inRHS);
+    }
+
+    /// @brief Divide all vector type`<int16_t>` elements in `inRHS` from `inLHS`.
+    /// @param inLHS Left hand side vector term
+    /// @param inRHS Right hand side vector term
+    /// @return Result vector type`<int16_t>`
+    static SimdType Div(SimdType inLHS, SimdType inRHS)
+    {
+        std::array<std::int16_t, 8> lhs, rhs;
+        vst1q_s16(lhs.data(), inLHS);
+        vst1q_s16(rhs.data(), inRHS);
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+            lhs[i] = static_cast<std::int16_t>(rhs[i] != 0 ? lhs[i] / rhs[i] : 0);
+        return vld1q_s16(lhs.data());
+    }
+
+    /// @brief Duplicate elements 0 and 1 into elements 2 and 3.
+    /// @param inSimd Input SIMD register.
+    /// @return SIMD register with low pair duplicated.
+    static SimdType DupLo(SimdType inSimd)
+    {
+        const int32x4_t pairs = vreinterpretq_s32_s16(inSimd);
+        return vreinterpretq_s16_s32(vdupq_laneq_s32(pairs, 0));
+    }
+
+    /// @brief Duplicate elements 2 and 3 into elements 0 and 1.
+    /// @param inSimd Input SIMD register.
+    /// @return SIMD register with high pair duplicated.
+    static SimdType DupHi(SimdType inSimd)
+    {
+        const int32x4_t pairs = vreinterpretq_s32_s16(inSimd);
+        return vreinterpretq_s16_s32(vdupq_laneq_s32(pairs, 1));
+    }
+
+    /// @brief Compare two vector<int16_t> values to check if all elements equal.
+    static bool IsEq(SimdType inLHS, SimdType inRHS)
+    {
+        return vminvq_u16(vceqq_s16(inLHS, inRHS)) != 0;
+    }
+
+    /// @brief Compare two vector<int16_t> values to check if all elements are greater than or equal.
+    static bool IsGe(SimdType inLHS, SimdType inRHS)
+    {
+        return vminvq_u16(vcgeq_s16(inLHS, inRHS)) != 0;
+    }
+
+    /// @brief Compare two vector<int16_t> values to check if all elements are less than or equal.
+    static bool IsLe(SimdType inLHS, SimdType inRHS)
+    {
+        return vminvq_u16(vcleq_s16(inLHS, inRHS)) != 0;
+    }
+
+    /// @brief 8-bit mask: bit i set if lane i elements are equal.
+    static int EqMask(SimdType inLHS, SimdType inRHS)
+    {
+        return LaneMask(vceqq_s16(inLHS, inRHS));
+    }
+
+    /// @brief 8-bit mask: bit i set if lane i of `inLHS` is greater than or equal.
+    static int GeMask(SimdType inLHS, SimdType inRHS)
+    {
+        return LaneMask(vcgeq_s16(inLHS, inRHS));
+    }
+
+    /// @brief 8-bit mask: bit i set if lane i of `inLHS` is less than or equal.
+    static int LeMask(SimdType inLHS, SimdType inRHS)
+    {
+        return LaneMask(vcleq_s16(inLHS, inRHS));
+    }
+
+    /// @brief Find the minimum value for each pair of element of SimdType
+    static SimdType Min(SimdType inLHS, SimdType inRHS)
+    {
+        return vminq_s16(inLHS, inRHS);
+    }
+
+    /// @brief Find the maximum value for each pair of element of SimdType
+    static SimdType Max(SimdType inLHS, SimdType inRHS)
+    {
+        return vmaxq_s16(inLHS, inRHS);
+    }
+
+    /// @brief Minimum of elements 0 and 1; maximum of elements 2 and 3 (and above)
+    static SimdType MinMax(SimdType inLHS, SimdType inRHS)
+    {
+        const int32x4_t min = vreinterpretq_s32_s16(vminq_s16(inLHS, inRHS));
+        const int32x4_t max = vreinterpretq_s32_s16(vmaxq_s16(inLHS, inRHS));
+        return vreinterpretq_s16_s32(vcopyq_laneq_s32(max, 0, min, 0));
+    }
+
+    /// @brief Maximum of elements 0 and 1; minimum of elements 2 and 3 (and above)
+    static SimdType MaxMin(SimdType inLHS, SimdType inRHS)
+    {
+        const int32x4_t max = vreinterpretq_s32_s16(vmaxq_s16(inLHS, inRHS));
+        const int32x4_t min = vreinterpretq_s32_s16(vminq_s16(inLHS, inRHS));
+        return vreinterpretq_s16_s32(vcopyq_laneq_s32(min, 0, max, 0));
+    }
+
+    /// @brief Load 8 elements of type`<int16_t>` (a whole vector) from memory specified by `inAddr`, of any alignment.
+    /// @param inAddr Address of &elements[8] to load
+    /// @return Vector type`<int16_t>` of loaded elements
+    static SimdType LoadUnaligned8(const std::int16_t* inAddr)
+    {
+        return vld1q_s16(inAddr);
+    }
+
+    /// @brief Store 8 elements of type`<int16_t>` (a whole vector) to memory specified by `outAddr`, of any alignment.
+    /// @param outAddr Address to store &elements[8]
+    /// @param inStore8 Vector type`<int16_t>` of elements to store
+    static void StoreUnaligned8(std::int16_t* outAddr, SimdType inStore8)
+    {
+        vst1q_s16(outAddr, inStore8);
+    }
+
+    /// @brief Add all vector type`<int16_t>` elements in `inRHS` to `inLHS`, saturating.
+    static SimdType AddSat(SimdType inLHS, SimdType inRHS)
+    {
+        return vqaddq_s16(inLHS, inRHS);
+    }
+
+    /// @brief Subtract all vector type`<int16_t>` elements in `inRHS` from `inLHS`, saturating.
+    static SimdType SubSat(SimdType inLHS, SimdType inRHS)
+    {
+        return vqsubq_s16(inLHS, inRHS);
+    }
+
+    /// @brief Sign extend elements 0..3 to a vector of type`<int>`.
+    /// @tparam WideT Must be `int`
+    template<typename WideT>
+    static typename Simd128<WideT>::SimdType WidenLo(SimdType inSimd)
+    {
+        static_assert(std::is_same_v<WideT, int>, "NEON only widens type<int16_t> to type<int>");
+        return vmovl_s16(vget_low_s16(inSimd));
+    }
+
+    /// @brief Sign extend elements 4..7 to a vector of type`<int>`.
+    /// @tparam WideT Must be `int`
+    template<typename WideT>
+    static typename Simd128<WideT>::SimdType WidenHi(SimdType inSimd)
+    {
+        static_assert(std::is_same_v<WideT, int>, "NEON only widens type<int16_t> to type<int>");
+        return vmovl_s16(vget_high_s16(inSimd));
+    }
+
+    /// @brief Narrow two vectors of type`<int>` into one vector of type`<int16_t>` (saturating).
+    /// @tparam WideT Must be `int`
+    template<typename WideT>
+    static SimdType Narrow(typename Simd128<WideT>::SimdType inLo, typename Simd128<WideT>::SimdType inHi)
+    {
+        static_assert(std::is_same_v<WideT, int>, "NEON only narrows type<int> to type<int16_t>");
+        return vcombine_s16(vqmovn_s32(inLo), vqmovn_s32(inHi));
+    }
+
+    /// @brief Lane mask for `Select()`: all bits set in the elements that are equal
+    static SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+    {
+        return vreinterpretq_s16_u16(vceqq_s16(inLHS, inRHS));
+    }
+
+    /// @brief Lane mask for `Select()`: all bits set in the elements of `inLHS` that are greater
+    static SimdType CompareGt(SimdType inLHS, SimdType inRHS)
+    {
+        return vreinterpretq_s16_u16(vcgtq_s16(inLHS, inRHS));
+    }
+
+    /// @brief Masked blend: elements of `inTrue` where `inMask` is set, otherwise of `inFalse`
+    static SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+    {
+        return vbslq_s16(vreinterpretq_u16_s16(inMask), inTrue, inFalse);
+    }
+
+private:
+    /// @brief One bit per 16bit lane of a comparison result
+    static int LaneMask(uint16x8_t inCompare)
+    {
+        constexpr std::uint16_t kMask[8] = {1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u};
+        const uint16x8_t mask = vandq_u16(inCompare, vld1q_u16(kMask));
+        return static_cast<int>(vaddvq_u16(mask));
+    }
+};
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region Simd128<uint16_t> NEON specialization
+
+/// @brief 8x 16bit unsigned lanes, for packed pixel channels and tile coordinates.
+/// Only whole vector loads/stores: these are not geometry element types.
+/// Arithmetic wraps, like `std::uint16_t` arithmetic does; `AddSat()`/`SubSat()` saturate.
+template<>
+struct Simd128<std::uint16_t> :
+    public Simd128Traits<std::uint16_t>
+{
+    using typename Simd128Traits<std::uint16_t>::SimdType; // uint16x8_t
+    using typename Simd128Traits<std::uint16_t>::ValueType; // uint16_t
+
+    /// @brief Load 8 elements of type`<uint16_t>` (a whole vector) from memory specified by `inAddr`, of any alignment.
+    /// @param inAddr Address of &elements[8] to load
+    /// @return Vector type`<uint16_t>` of loaded elements
+    static SimdType LoadUnaligned8(const std::uint16_t* inAddr)
+    {
+        return vld1q_u16(inAddr);
+    }
+
+    /// @brief Store 8 elements of type`<uint16_t>` (a whole vector) to memory specified by `outAddr`, of any alignment.
+    /// @param outAddr Address to store &elements[8]
+    /// @param inStore8 Vector type`<uint16_t>` of elements to store
+    static void StoreUnaligned8(std::uint16_t* outAddr, SimdType inStore8)
+    {
+        vst1q_u16(outAddr, inStore8);
+    }
+
+    /// @brief Broadcast a single element of type`<uint16_t>` to all elements of a vector.
+    static SimdType Splat(std::uint16_t inValue)
+    {
+        return vdupq_n_u16(inValue);
+    }
+
+    /// @brief Add all vector type`<uint16_t>` elements in `inRHS` to `inLHS` (wrapping).
+    static SimdType Add(SimdType inLHS, SimdType inRHS)
+    {
+        return vaddq_u16(inLHS, inRHS);
+    }
+
+    /// @brief Subtract all vector type`<uint16_t>` elements in `inRHS` from `inLHS` (wrapping).
+    static SimdType Sub(SimdType inLHS, SimdType inRHS)
+    {
+        return vsubq_u16(inLHS, inRHS);
+    }
+
+    /// @brief Add all vector type`<uint16_t>` elements in `inRHS` to `inLHS`, saturating.
+    static SimdType AddSat(SimdType inLHS, SimdType inRHS)
+    {
+        return vqaddq_u16(inLHS, inRHS);
+    }
+
+    /// @brief Subtract all vector type`<uint16_t>` elements in `inRHS` from `inLHS`, saturating at 0.
+    static SimdType SubSat(SimdType inLHS, SimdType inRHS)
+    {
+        return vqsubq_u16(inLHS, inRHS);
+    }
+
+    /// @brief Find the minimum value for each pair of element of SimdType
+    static SimdType Min(SimdType inLHS, SimdType inRHS)
+    {
+        return vminq_u16(inLHS, inRHS);
+    }
+
+    /// @brief Find the maximum value for each pair of element of SimdType
+    static SimdType Max(SimdType inLHS, SimdType inRHS)
+    {
+        return vmaxq_u16(inLHS, inRHS);
+    }
+
+    /// @brief Zero extend elements 0..3 to a vector of type`<int>`.
+    /// @tparam WideT Must be `int`
+    template<typename WideT>
+    static typename Simd128<WideT>::SimdType WidenLo(SimdType inSimd)
+    {
+        static_assert(std::is_same_v<WideT, int>, "NEON only widens type<uint16_t> to type<int>");
+        return vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(inSimd)));
+    }
+
+    /// @brief Zero extend elements 4..7 to a vector of type`<int>`.
+    /// @tparam WideT Must be `int`
+    template<typename WideT>
+    static typename Simd128<WideT>::SimdType WidenHi(SimdType inSimd)
+    {
+        static_assert(std::is_same_v<WideT, int>, "NEON only widens type<uint16_t> to type<int>");
+        return vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(inSimd)));
+    }
+
+    /// @brief Narrow two vectors of type`<int>` into one vector of type`<uint16_t>` (saturating).
+    /// @tparam WideT Must be `int`
+    template<typename WideT>
+    static SimdType Narrow(typename Simd128<WideT>::SimdType inLo, typename Simd128<WideT>::SimdType inHi)
+    {
+        static_assert(std::is_same_v<WideT, int>, "NEON only narrows type<int> to type<uint16_t>");
+        return vcombine_u16(vqmovun_s32(inLo), vqmovun_s32(inHi));
+    }
+
+    /// @brief Compare two vector<uint16_t> values to check if all elements equal.
+    static bool IsEq(SimdType inLHS, SimdType inRHS)
+    {
+        return vminvq_u16(vceqq_u16(inLHS, inRHS)) != 0;
+    }
+
+    /// @brief 8-bit mask: bit i set if lane i elements are equal.
+    static int EqMask(SimdType inLHS, SimdType inRHS)
+    {
+        constexpr std::uint16_t kMask[8] = {1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u};
+        const uint16x8_t mask = vandq_u16(vceqq_u16(inLHS, inRHS), vld1q_u16(kMask));
+        return static_cast<int>(vaddvq_u16(mask));
+    }
+
+    /// @brief Lane mask for `Select()`: all bits set in the elements that are equal
+    static SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+    {
+        return vceqq_u16(inLHS, inRHS);
+    }
+
+    /// @brief Lane mask for `Select()`: all bits set in the elements of `inLHS` that are greater
+    static SimdType CompareGt(SimdType inLHS, SimdType inRHS)
+    {
+        return vcgtq_u16(inLHS, inRHS);
+    }
+
+    /// @brief Masked blend: elements of `inTrue` where `inMask` is set, otherwise of `inFalse`
+    static SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+    {
+        return vbslq_u16(inMask, inTrue, inFalse);
+    }
+};
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region Simd128<uint8_t> NEON specialization
+
+/// @brief 16x 8bit unsigned lanes, for packed pixels (e.g. 4x RGBA8 pixels per vector).
+/// Only whole vector loads/stores: these are not geometry element types.
+/// Arithmetic wraps, like `std::uint8_t` arithmetic does; `AddSat()`/`SubSat()` saturate.
+template<>
+struct Simd128<std::uint8_t> :
+    public Simd128Traits<std::uint8_t>
+{
+    using typename Simd128Traits<std::uint8_t>::SimdType; // uint8x16_t
+    using typename Simd128Traits<std::uint8_t>::ValueType; // uint8_t
+
+    /// @brief Load 16 elements of type`<uint8_t>` (a whole vector) from memory specified by `inAddr`, of any alignment.
+    /// @param inAddr Address of &elements[16] to load
+    /// @return Vector type`<uint8_t>` of loaded elements
+    static SimdType LoadUnaligned16(const std::uint8_t* inAddr)
+    {
+        return vld1q_u8(inAddr);
+    }
+
+    /// @brief Store 16 elements of type`<uint8_t>` (a whole vector) to memory specified by `outAddr`, of any alignment.
+    /// @param outAddr Address to store &elements[16]
+    /// @param inStore16 Vector type`<uint8_t>` of elements to store
+    static void StoreUnaligned16(std::uint8_t* outAddr, SimdType inStore16)
+    {
+        vst1q_u8(outAddr, inStore16);
+    }
+
+    /// @brief Broadcast a single element of type`<uint8_t>` to all elements of a vector.
+    static SimdType Splat(std::uint8_t inValue)
+    {
+        return vdupq_n_u8(inValue);
+    }
+
+    /// @brief Add all vector type`<uint8_t>` elements in `inRHS` to `inLHS` (wrapping).
+    static SimdType Add(SimdType inLHS, SimdType inRHS)
+    {
+        return vaddq_u8(inLHS, inRHS);
+    }
+
+    /// @brief Subtract all vector type`<uint8_t>` elements in `inRHS` from `inLHS` (wrapping).
+    static SimdType Sub(SimdType inLHS, SimdType inRHS)
+    {
+        return vsubq_u8(inLHS, inRHS);
+    }
+
+    /// @brief Add all vector type`<uint8_t>` elements in `inRHS` to `inLHS`, saturating at 255.
+    static SimdType AddSat(SimdType inLHS, SimdType inRHS)
+    {
+        return vqaddq_u8(inLHS, inRHS);
+    }
+
+    /// @brief Subtract all vector type`<uint8_t>` elements in `inRHS` from `inLHS`, saturating at 0.
+    static SimdType SubSat(SimdType inLHS, SimdType inRHS)
+    {
+        return vqsubq_u8(inLHS, inRHS);
+    }
+
+    /// @brief Find the minimum value for each pair of element of SimdType
+    static SimdType Min(SimdType inLHS, SimdType inRHS)
+    {
+        return vminq_u8(inLHS, inRHS);
+    }
+
+    /// @brief Find the maximum value for each pair of element of SimdType
+    static SimdType Max(SimdType inLHS, SimdType inRHS)
+    {
+        return vmaxq_u8(inLHS, inRHS);
+    }
+
+    /// @brief Zero extend elements 0..7 to a vector of type`<uint16_t>`.
+    /// @tparam WideT Must be `uint16_t`
+    template<typename WideT>
+    static typename Simd128<WideT>::SimdType WidenLo(SimdType inSimd)
+    {
+        static_assert(std::is_same_v<WideT, std::uint16_t>, "NEON only widens type<uint8_t> to type<uint16_t>");
+        return vmovl_u8(vget_low_u8(inSimd));
+    }
+
+    /// @brief Zero extend elements 8..15 to a vector of type`<uint16_t>`.
+    /// @tparam WideT Must be `uint16_t`
+    template<typename WideT>
+    static typename Simd128<WideT>::SimdType WidenHi(SimdType inSimd)
+    {
+        static_assert(std::is_same_v<WideT, std::uint16_t>, "NEON only widens type<uint8_t> to type<uint16_t>");
+        return vmovl_u8(vget_high_u8(inSimd));
+    }
+
+    /// @brief Narrow two vectors of type`<uint16_t>` into one vector of type`<uint8_t>` (saturating at 255).
+    /// @tparam WideT Must be `uint16_t`
+    template<typename WideT>
+    static SimdType Narrow(typename Simd128<WideT>::SimdType inLo, typename Simd128<WideT>::SimdType inHi)
+    {
+        static_assert(std::is_same_v<WideT, std::uint16_t>, "NEON only narrows type<uint16_t> to type<uint8_t>");
+        return vcombine_u8(vqmovn_u16(inLo), vqmovn_u16(inHi));
+    }
+
+    /// @brief Compare two vector<uint8_t> values to check if all elements equal.
+    static bool IsEq(SimdType inLHS, SimdType inRHS)
+    {
+        return vminvq_u8(vceqq_u8(inLHS, inRHS)) != 0;
+    }
+
+    /// @brief 16-bit mask: bit i set if lane i elements are equal.
+    static int EqMask(SimdType inLHS, SimdType inRHS)
+    {
+        constexpr std::uint8_t kMask[16] = {1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u, 1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u};
+        const uint8x16_t mask = vandq_u8(vceqq_u8(inLHS, inRHS), vld1q_u8(kMask));
+        const int lo = vaddv_u8(vget_low_u8(mask));
+        const int hi = vaddv_u8(vget_high_u8(mask));
+        return lo | (hi << 8);
+    }
+
+    /// @brief Lane mask for `Select()`: all bits set in the elements that are equal
+    static SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+    {
+        return vceqq_u8(inLHS, inRHS);
+    }
+
+    /// @brief Lane mask for `Select()`: all bits set in the elements of `inLHS` that are greater
+    static SimdType CompareGt(SimdType inLHS, SimdType inRHS)
+    {
+        return vcgtq_u8(inLHS, inRHS);
+    }
+
+    /// @brief Masked blend: elements of `inTrue` where `inMask` is set, otherwise of `inFalse`
+    static SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+    {
+        return vbslq_u8(inMask, inTrue, inFalse);
+    }
+};
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region Simd128<BFloat16>/Simd128<Half> NEON specializations
+
+/// @brief 16bit floating point storage: loads widen 4 elements into `float` lanes and
+/// stores narrow them again (round to nearest even); all arithmetic is `Simd128<float>`.
+/// @tparam T `BFloat16` or `Half`
+template<typename T>
+struct Simd128Float16 :
+    public Simd128<float>
+{
+    using typename Simd128<float>::SimdType; // float32x4_t
+    using ValueType = T;
+
+    /// @brief Load and widen 4 elements of type`<T>`; no alignment requirement
+    static SimdType Load4(const T* inAddr)
+    {
+        return Widen(vld1_u16(reinterpret_cast<const std::uint16_t*>(inAddr)));
+    }
+
+    /// @brief Load and widen 2 elements of type`<T>`; unused high order elements are zero
+    static SimdType Load2(const T* inAddr)
+    {
+        std::uint32_t pair;
+        std::memcpy(&pair, inAddr, sizeof(pair));
+        return Widen(vreinterpret_u16_u32(vset_lane_u32(pair, vdup_n_u32(0), 0)));
+    }
+
+    /// @brief Load and widen 1 element of type`<T>`; unused high order elements are zero
+    static SimdType Load1(const T* inAddr)
+    {
+        return Widen(vset_lane_u16(inAddr[0].Bits(), vdup_n_u16(0), 0));
+    }
+
+    /// @brief Broadcast a single element of type`<T>` to all (`float`) elements of a vector.
+    static SimdType Splat(T inValue)
+    {
+        return vdupq_n_f32(T::ToFloat(inValue.Bits()));
+    }
+
+    /// @brief Narrow and store 4 elements of type`<T>`; no alignment requirement
+    static void Store4(T* outAddr, SimdType inStore4)
+    {
+        vst1_u16(reinterpret_cast<std::uint16_t*>(outAddr), Narrow(inStore4));
+    }
+
+    /// @brief Narrow and store the 2 lowest order elements of type`<T>`
+    static void Store2(T* outAddr, SimdType inStore2)
+    {
+        const std::uint32_t pair = vget_lane_u32(vreinterpret_u32_u16(Narrow(inStore2)), 0);
+        std::memcpy(outAddr, &pair, sizeof(pair));
+    }
+
+    /// @brief Narrow and store the lowest order element of type`<T>`
+    static void Store1(T* outAddr, SimdType inStore1)
+    {
+        outAddr[0] = T::FromBits(vget_lane_u16(Narrow(inStore1), 0));
+    }
+
+    static SimdType LoadUnaligned4(const T* inAddr)
+    {
+        return Load4(inAddr);
+    }
+
+    static SimdType LoadUnaligned2(const T* inAddr)
+    {
+        return Load2(inAddr);
+    }
+
+    static void StoreUnaligned4(T* outAddr, SimdType inStore4)
+    {
+        Store4(outAddr, inStore4);
+    }
+
+    static void StoreUnaligned2(T* outAddr, SimdType inStore2)
+    {
+        Store2(outAddr, inStore2);
+    }
+
+private:
+    /// @brief Widen 4 16bit lanes into 4 `float` lanes (exact)
+    static SimdType Widen(uint16x4_t inBits)
+    {
+        if constexpr (std::is_same_v<T, BFloat16>)
+        {
+            // bfloat16 is the upper half of a float
+            return vreinterpretq_f32_u32(vshll_n_u16(inBits, 16));
+        }
+        else
+        {
+            return vcvt_f32_f16(vreinterpret_f16_u16(inBits));
+        }
+    }
+
+    /// @brief Narrow 4 `float` lanes (round to nearest even) into 4 16bit lanes
+    static uint16x4_t Narrow(SimdType inFloat)
+    {
+        if constexpr (std::is_same_v<T, BFloat16>)
+        {
+            // Same as BFloat16::FromFloat(): add half an ulp (ties to even), then truncate
+            const uint32x4_t bits = vreinterpretq_u32_f32(inFloat);
+            const uint32x4_t isNan = vmvnq_u32(vceqq_f32(inFloat, inFloat));
+            const uint32x4_t lsb = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+            const uint32x4_t round = vaddq_u32(vaddq_u32(bits, vdupq_n_u32(0x7FFF)), lsb);
+            const uint32x4_t quietNan = vorrq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(0x0040));
+            const uint32x4_t narrow = vbslq_u32(isNan, quietNan, vshrq_n_u32(round, 16));
+            return vmovn_u32(narrow);
+        }
+        else
+        {
+            return vreinterpret_u16_f16(vcvt_f16_f32(inFloat));
+        }
+    }
+};
+
+template<>
+struct Simd128<BFloat16> :
+    public Simd128Float16<BFloat16>
+{
+};
+
+template<>
+struct Simd128<Half> :
+    public Simd128Float16<Half>
+{
+};
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region Simd128<Fixed16> NEON specialization
+
+/// @brief Q16.16 fixed point lanes: the raw values are `int` lanes, so loads, stores,
+/// add, subtract, min/max and comparisons are all `Simd128<int>`. Only multiply and
+/// divide need fixed point semantics.
+template<>
+struct Simd128<Fixed16> :
+    public Simd128<int>
+{
+    using typename Simd128<int>::SimdType; // int32x4_t
+    using ValueType = Fixed16;
+
+    static SimdType Load4(const Fixed16* inAddr)
+    {
+        return Simd128<int>::Load4(Raw(inAddr));
+    }
+
+    static SimdType Load2(const Fixed16* inAddr)
+    {
+        return Simd128<int>::Load2(Raw(inAddr));
+    }
+
+    static SimdType Load1(const Fixed16* inAddr)
+    {
+        return Simd128<int>::Load1(Raw(inAddr));
+    }
+
+    static SimdType Splat(Fixed16 inValue)
+    {
+        return Simd128<int>::Splat(inValue.Raw());
+    }
+
+    static void Store4(Fixed16* outAddr, SimdType inStore4)
+    {
+        Simd128<int>::Store4(Raw(outAddr), inStore4);
+    }
+
+    static void Store2(Fixed16* outAddr, SimdType inStore2)
+    {
+        Simd128<int>::Store2(Raw(outAddr), inStore2);
+    }
+
+    static void Store1(Fixed16* outAddr, SimdType inStore1)
+    {
+        Simd128<int>::Store1(Raw(outAddr), inStore1);
+    }
+
+    static SimdType LoadUnaligned4(const Fixed16* inAddr)
+    {
+        return Load4(inAddr);
+    }
+
+    static SimdType LoadUnaligned2(const Fixed16* inAddr)
+    {
+        return Load2(inAddr);
+    }
+
+    static void StoreUnaligned4(Fixed16* outAddr, SimdType inStore4)
+    {
+        Store4(outAddr, inStore4);
+    }
+
+    static void StoreUnaligned2(Fixed16* outAddr, SimdType inStore2)
+    {
+        Store2(outAddr, inStore2);
+    }
+
+    /// @brief Fixed point multiply: (64bit product >> 16) of each lane, like `Fixed16::operator*=`
+    static SimdType Mul(SimdType inLHS, SimdType inRHS)
+    {
+        const int64x2_t lo = vmull_s32(vget_low_s32(inLHS), vget_low_s32(inRHS));
+        const int64x2_t hi = vmull_high_s32(inLHS, inRHS);
+        // Bits 16..47 of each 64bit product are the Q16.16 result
+        return vcombine_s32(vshrn_n_s64(lo, Fixed16::kFracBits), vshrn_n_s64(hi, Fixed16::kFracBits));
+    }
+
+    /// @brief Fixed point divide of each lane, like `Fixed16::operator/=`
+    static SimdType Div(SimdType inLHS, SimdType inRHS)
+    {
+        std::array<Fixed16, 4> lhs, rhs;
+        Store4(lhs.data(), inLHS);
+        Store4(rhs.data(), inRHS);
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+            lhs[i] /= rhs[i];
+        return Load4(lhs.data());
+    }
+
+private:
+    // Fixed16 is standard layout: its address is the address of its raw int32_t
+    static const int* Raw(const Fixed16* inAddr)
+    {
+        return reinterpret_cast<const int*>(inAddr);
+    }
+
+    static int* Raw(Fixed16* inAddr)
+    {
+        return reinterpret_cast<int*>(inAddr);
+    }
 };
 
 #pragma endregion {}
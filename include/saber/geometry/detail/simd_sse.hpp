@@ -5,6 +5,12 @@
 #include "saber/config.hpp"
 #include "saber/geometry/detail/simd.hpp"
 
+// std
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
 // sse
 #include <immintrin.h>
 
@@ -60,6 +66,51 @@ struct Simd128Traits<double>
 
 }; // struct SimdTraits<>
 
+// int16_t
+template<>
+struct Simd128Traits<std::int16_t>
+{
+	/// @brief Number of elements of type T in a SIMD vector
+	static constexpr std::size_t kSize = 8;
+
+	/// @brief Underlying type of a SIMD element
+	using ValueType = std::int16_t;
+
+	/// @brief Platform-specific type of a SIMD vector of elements
+	using SimdType = __m128i; // vector of int16_t
+
+}; // struct SimdTraits<>
+
+// uint16_t
+template<>
+struct Simd128Traits<std::uint16_t>
+{
+	/// @brief Number of elements of type T in a SIMD vector
+	static constexpr std::size_t kSize = 8;
+
+	/// @brief Underlying type of a SIMD element
+	using ValueType = std::uint16_t;
+
+	/// @brief Platform-specific type of a SIMD vector of elements
+	using SimdType = __m128i; // vector of uint16_t
+
+}; // struct SimdTraits<>
+
+// uint8_t
+template<>
+struct Simd128Traits<std::uint8_t>
+{
+	/// @brief Number of elements of type T in a SIMD vector
+	static constexpr std::size_t kSize = 16;
+
+	/// @brief Underlying type of a SIMD element
+	using ValueType = std::uint8_t;
+
+	/// @brief Platform-specific type of a SIMD vector of elements
+	using SimdType = __m128i; // vector of uint8_t
+
+}; // struct SimdTraits<>
+
 #pragma endregion {}
 
 // ------------------------------------------------------------------
@@ -73,7 +124,7 @@ struct Simd128<int> :
 	using typename Simd128Traits<int>::ValueType; // int
 
 	/// @brief Load 4 elements of type`<int>` from memory specified by `inAddr`.
-	/// @param inAddr Address of &elements[4] to load
+	/// @param inAddr Address of &elements[4] to load; must be `kSimdAlignment` aligned
 	/// @return Vector type`<int>` of loaded elements
 	static SimdType Load4(const int* inAddr)
 	{
@@ -104,6 +155,15 @@ struct Simd128<int> :
 		return load1;
 	}
 
+	/// @brief Broadcast a single element of type`<int>` to all elements of a vector.
+	/// @param inValue Value to broadcast
+	/// @return Vector type`<int>` of broadcast elements
+	static SimdType Splat(int inValue)
+	{
+		auto splat = _mm_set1_epi32(inValue);
+		return splat;
+	}
+
 	/// @brief Store 4 elements of type`<int>` to memory specified by `outAddr`.
 	/// @param outAddr Address to store &elements[4]
 	/// @param inStore4 Vector type`<int>` of elements to store
@@ -124,6 +184,39 @@ struct Simd128<int> :
 
 	}
 
+	/// @brief Load 4 elements of type`<int>` from memory specified by `inAddr`, of any alignment.
+	/// @param inAddr Address of &elements[4] to load
+	/// @return Vector type`<int>` of loaded elements
+	static SimdType LoadUnaligned4(const int* inAddr)
+	{
+		auto load4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inAddr));
+		return load4;
+	}
+
+	/// @brief Load 2 elements of type`<int>` from memory specified by `inAddr`, of any alignment.
+	/// @param inAddr Address of &elements[2] to load
+	/// @return Vector type`<int>` of loaded elements
+	static SimdType LoadUnaligned2(const int* inAddr)
+	{
+		return Load2(inAddr); // 64bit load: no alignment requirement
+	}
+
+	/// @brief Store 4 elements of type`<int>` to memory specified by `outAddr`, of any alignment.
+	/// @param outAddr Address to store &elements[4]
+	/// @param inStore4 Vector type`<int>` of elements to store
+	static void StoreUnaligned4(int* outAddr, SimdType inStore4)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(outAddr), inStore4);
+	}
+
+	/// @brief Store 2 elements of type`<int>` to memory specified by `outAddr`, of any alignment.
+	/// @param outAddr Address to store &elements[2]
+	/// @param inStore2 Vector type`<int>` of elements to store
+	static void StoreUnaligned2(int* outAddr, SimdType inStore2)
+	{
+		Store2(outAddr, inStore2); // 64bit store: no alignment requirement
+	}
+
 	/// @brief Store 1 element of type`<int>` to memory specified by `outAddr`.
 	/// The lowest order element is stored to memory.
 	/// Any higher order elements are ignored.
@@ -134,6 +227,72 @@ struct Simd128<int> :
         _mm_storeu_si32(reinterpret_cast<__m128i*>(outAddr), inStore1);
 	}
 
+	/// @brief Load the first `inCount` elements of type`<int>` from memory specified by `inAddr`, of any alignment.
+	/// Elements at and beyond `inCount` are set to zero, and are never read from memory.
+	/// @param inAddr Address of &elements[inCount] to load
+	/// @param inCount Number of elements to load; counts of 4 or more load a whole vector
+	/// @return Vector type`<int>` of loaded elements
+	static SimdType LoadN(const int* inAddr, std::size_t inCount)
+	{
+#if defined(__AVX__)
+		// AVX masked load: masked off lanes are zeroed, and do not fault
+		auto loadN = _mm_castps_si128(_mm_maskload_ps(reinterpret_cast<const float*>(inAddr), LaneMaskN(inCount)));
+#else
+		// SSE has no masked load: combine the narrower (non-faulting) loads
+		SimdType loadN;
+		switch (inCount)
+		{
+		case 0:
+			loadN = _mm_setzero_si128();
+			break;
+		case 1:
+			loadN = Load1(inAddr);
+			break;
+		case 2:
+			loadN = Load2(inAddr);
+			break;
+		case 3:
+			loadN = _mm_insert_epi32(Load2(inAddr), inAddr[2], 2);
+			break;
+		default:
+			loadN = LoadUnaligned4(inAddr);
+			break;
+		}
+#endif
+		return loadN;
+	}
+
+	/// @brief Store the first `inCount` elements of type`<int>` to memory specified by `outAddr`, of any alignment.
+	/// Memory at and beyond `outAddr[inCount]` is never written.
+	/// @param outAddr Address to store &elements[inCount]
+	/// @param inStoreN Vector type`<int>` of elements to store
+	/// @param inCount Number of elements to store; counts of 4 or more store a whole vector
+	static void StoreN(int* outAddr, SimdType inStoreN, std::size_t inCount)
+	{
+#if defined(__AVX__)
+		_mm_maskstore_ps(reinterpret_cast<float*>(outAddr), LaneMaskN(inCount), _mm_castsi128_ps(inStoreN));
+#else
+		switch (inCount)
+		{
+		case 0:
+			break;
+		case 1:
+			Store1(outAddr, inStoreN);
+			break;
+		case 2:
+			Store2(outAddr, inStoreN);
+			break;
+		case 3:
+			Store2(outAddr, inStoreN);
+			outAddr[2] = _mm_extract_epi32(inStoreN, 2);
+			break;
+		default:
+			StoreUnaligned4(outAddr, inStoreN);
+			break;
+		}
+#endif
+	}
+
 	/// @brief Add all vector type`<int>` elements in `inRHS` to `inLHS`.
 	/// @param inLHS Left hand side vector term
 	/// @param inRHS Right hand side vector term
@@ -170,14 +329,38 @@ struct Simd128<int> :
 	/// @return Result vector type`<int>`
 	static SimdType Div(SimdType inLHS, SimdType inRHS)
 	{
-		// Note: Intel SSE does not support SIMD integer division
-		// Therefore, we do it the hard way
-		std::array<int, 4> lhs, rhs;
-        Store4(lhs.data(), inLHS);
-        Store4(rhs.data(), inRHS);
-        for (int i = 0; i < 4; ++i)
-            lhs[i] = (rhs[i] != 0 ? lhs[i] / rhs[i] : 0);
-        return Load4(lhs.data());
+		// Note: Intel SSE does not support SIMD integer division.
+		// Every int32 is exact as a double, and a correctly rounded double quotient of two
+		// int32 never crosses an integer boundary; so truncating it is the exact int quotient
+		const auto lhsLo = _mm_cvtepi32_pd(inLHS);
+		const auto rhsLo = _mm_cvtepi32_pd(inRHS);
+		const auto lhsHi = _mm_cvtepi32_pd(_mm_unpackhi_epi64(inLHS, inLHS));
+		const auto rhsHi = _mm_cvtepi32_pd(_mm_unpackhi_epi64(inRHS, inRHS));
+		const auto divLo = _mm_cvttpd_epi32(_mm_div_pd(lhsLo, rhsLo));
+		const auto divHi = _mm_cvttpd_epi32(_mm_div_pd(lhsHi, rhsHi));
+		const auto div = _mm_unpacklo_epi64(divLo, divHi);
+		// Division by zero returns zero
+		const auto isZero = _mm_cmpeq_epi32(inRHS, _mm_setzero_si128());
+		return _mm_andnot_si128(isZero, div);
+	}
+
+	/// @brief Divide all vector type`<int>` elements of `inLHS` by the same prepared divisor,
+	/// with a multiply, add and shift instead of a divide.
+	/// @param inLHS Left hand side vector term
+	/// @param inDivisor Divisor prepared once by the caller
+	/// @return Result vector type`<int>`
+	static SimdType DivBy(SimdType inLHS, const Divisor<int>& inDivisor)
+	{
+		// High 32bits of each signed 64bit product: _mm_mul_epi32 multiplies lanes 0 and 2
+		const auto magic = _mm_set1_epi32(inDivisor.Magic());
+		const auto even = _mm_srli_epi64(_mm_mul_epi32(inLHS, magic), 32);
+		const auto odd = _mm_mul_epi32(_mm_srli_epi64(inLHS, 32), magic);
+		auto div = _mm_blend_epi16(even, odd, 0xCC);
+		// _mm_sign_epi32() adds +/-dividend, or nothing, according to the sign of Add()
+		div = _mm_add_epi32(div, _mm_sign_epi32(inLHS, _mm_set1_epi32(inDivisor.Add())));
+		div = _mm_sra_epi32(div, _mm_cvtsi32_si128(inDivisor.Shift()));
+		const auto roundUp = _mm_and_si128(_mm_srli_epi32(div, 31), _mm_set1_epi32(inDivisor.RoundUp()));
+		return _mm_add_epi32(div, roundUp);
 	}
 
 	/// @brief Duplicate the low half of the SIMD register into both halves.
@@ -301,6 +484,16 @@ struct Simd128<int> :
 		auto maxMin = _mm_blend_epi16(max, min, 0xF0);
 		return maxMin;
 	}
+
+#if defined(__AVX__)
+	/// @brief Lane mask of `_mm_maskload_ps()`/`_mm_maskstore_ps()` for the first `inCount` 32bit lanes
+	static SimdType LaneMaskN(std::size_t inCount)
+	{
+		const auto count = _mm_set1_epi32(static_cast<int>(std::min<std::size_t>(inCount, kSize)));
+		auto mask = _mm_cmpgt_epi32(count, _mm_setr_epi32(0, 1, 2, 3)); // lane i: inCount > i
+		return mask;
+	}
+#endif // __AVX__
 };
 
 #pragma endregion {}
@@ -316,7 +509,7 @@ struct Simd128<float> :
 	using typename Simd128Traits<float>::ValueType; // float
 
 	/// @brief Load 4 elements of type`<float>` from memory specified by `inAddr`.
-	/// @param inAddr Address of &elements[4] to load
+	/// @param inAddr Address of &elements[4] to load; must be `kSimdAlignment` aligned
 	/// @return Vector type`<float>` of loaded elements
 	static SimdType Load4(const float* inAddr)
 	{
@@ -348,6 +541,15 @@ struct Simd128<float> :
 		return load1;
 	}
 
+	/// @brief Broadcast a single element of type`<float>` to all elements of a vector.
+	/// @param inValue Value to broadcast
+	/// @return Vector type`<float>` of broadcast elements
+	static SimdType Splat(float inValue)
+	{
+		auto splat = _mm_set1_ps(inValue);
+		return splat;
+	}
+
 	/// @brief Store 4 elements of type`<float>` to memory specified by `outAddr`.
 	/// @param outAddr Address to store &elements[4]
 	/// @param inStore4 Vector type`<float>` of elements to store
@@ -367,6 +569,39 @@ struct Simd128<float> :
         _mm_storel_pi(reinterpret_cast<__m64*>(outAddr), inStore2);
 	}
 
+	/// @brief Load 4 elements of type`<float>` from memory specified by `inAddr`, of any alignment.
+	/// @param inAddr Address of &elements[4] to load
+	/// @return Vector type`<float>` of loaded elements
+	static SimdType LoadUnaligned4(const float* inAddr)
+	{
+		auto load4 = _mm_loadu_ps(inAddr);
+		return load4;
+	}
+
+	/// @brief Load 2 elements of type`<float>` from memory specified by `inAddr`, of any alignment.
+	/// @param inAddr Address of &elements[2] to load
+	/// @return Vector type`<float>` of loaded elements
+	static SimdType LoadUnaligned2(const float* inAddr)
+	{
+		return Load2(inAddr); // 64bit load: no alignment requirement
+	}
+
+	/// @brief Store 4 elements of type`<float>` to memory specified by `outAddr`, of any alignment.
+	/// @param outAddr Address to store &elements[4]
+	/// @param inStore4 Vector type`<float>` of elements to store
+	static void StoreUnaligned4(float* outAddr, SimdType inStore4)
+	{
+		_mm_storeu_ps(outAddr, inStore4);
+	}
+
+	/// @brief Store 2 elements of type`<float>` to memory specified by `outAddr`, of any alignment.
+	/// @param outAddr Address to store &elements[2]
+	/// @param inStore2 Vector type`<float>` of elements to store
+	static void StoreUnaligned2(float* outAddr, SimdType inStore2)
+	{
+		Store2(outAddr, inStore2); // 64bit store: no alignment requirement
+	}
+
 	/// @brief Store 1 element of type`<float>` to memory specified by `outAddr`.
 	/// The lowest order element is stored to memory.
 	/// Any higher order elements are ignored.
@@ -377,6 +612,72 @@ struct Simd128<float> :
         _mm_store_ss(outAddr, inStore1);
 	}
 
+	/// @brief Load the first `inCount` elements of type`<float>` from memory specified by `inAddr`, of any alignment.
+	/// Elements at and beyond `inCount` are set to zero, and are never read from memory.
+	/// @param inAddr Address of &elements[inCount] to load
+	/// @param inCount Number of elements to load; counts of 4 or more load a whole vector
+	/// @return Vector type`<float>` of loaded elements
+	static SimdType LoadN(const float* inAddr, std::size_t inCount)
+	{
+#if defined(__AVX__)
+		// AVX masked load: masked off lanes are zeroed, and do not fault
+		auto loadN = _mm_maskload_ps(inAddr, Simd128<int>::LaneMaskN(inCount));
+#else
+		// SSE has no masked load: combine the narrower (non-faulting) loads
+		SimdType loadN;
+		switch (inCount)
+		{
+		case 0:
+			loadN = _mm_setzero_ps();
+			break;
+		case 1:
+			loadN = Load1(inAddr);
+			break;
+		case 2:
+			loadN = Load2(inAddr);
+			break;
+		case 3:
+			loadN = _mm_movelh_ps(Load2(inAddr), Load1(&inAddr[2]));
+			break;
+		default:
+			loadN = LoadUnaligned4(inAddr);
+			break;
+		}
+#endif
+		return loadN;
+	}
+
+	/// @brief Store the first `inCount` elements of type`<float>` to memory specified by `outAddr`, of any alignment.
+	/// Memory at and beyond `outAddr[inCount]` is never written.
+	/// @param outAddr Address to store &elements[inCount]
+	/// @param inStoreN Vector type`<float>` of elements to store
+	/// @param inCount Number of elements to store; counts of 4 or more store a whole vector
+	static void StoreN(float* outAddr, SimdType inStoreN, std::size_t inCount)
+	{
+#if defined(__AVX__)
+		_mm_maskstore_ps(outAddr, Simd128<int>::LaneMaskN(inCount), inStoreN);
+#else
+		switch (inCount)
+		{
+		case 0:
+			break;
+		case 1:
+			Store1(outAddr, inStoreN);
+			break;
+		case 2:
+			Store2(outAddr, inStoreN);
+			break;
+		case 3:
+			Store2(outAddr, inStoreN);
+			Store1(&outAddr[2], _mm_movehl_ps(inStoreN, inStoreN));
+			break;
+		default:
+			StoreUnaligned4(outAddr, inStoreN);
+			break;
+		}
+#endif
+	}
+
 	/// @brief Add all vector type`<float>` elements in `inRHS` to `inLHS`.
 	/// @param inLHS Left hand side vector term
 	/// @param inRHS Right hand side vector term
@@ -417,6 +718,17 @@ struct Simd128<float> :
 		return div;
 	}
 
+	/// @brief Divide all vector type`<float>` elements of `inLHS` by the same divisor.
+	/// @param inLHS Left hand side vector term
+	/// @param inDivisor Divisor to divide by
+	/// @return Result vector type`<float>`
+	static SimdType DivBy(SimdType inLHS, const Divisor<float>& inDivisor)
+	{
+		// NOTE: Divide rather than multiply by a reciprocal, so results match Div() exactly
+		auto div = _mm_div_ps(inLHS, _mm_set1_ps(inDivisor.Value()));
+		return div;
+	}
+
 	/// @brief Duplicate the low half of the SIMD register into both halves.
     /// @param inSimd Input SIMD register.
     /// @return SIMD register with low half duplicated.
@@ -587,17 +899,33 @@ struct Simd128<float> :
 		return mask;
 	}
 
+	/// @brief Lane mask for `Select()`: all bits set in the elements that are exactly equal
+	static SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+	{
+		auto eq = _mm_cmpeq_ps(inLHS, inRHS);
+		return eq;
+	}
+
+	/// @brief Masked blend: elements of `inTrue` where `inMask` is set, otherwise of `inFalse`
+	static SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+	{
+		auto select = _mm_blendv_ps(inFalse, inTrue, inMask);
+		return select;
+	}
+
 	/// @brief Round all <float> values toward the nearest whole number
 	/// @param inRound Input to be rounded
 	/// @return Return rounded SimdType values
 	static SimdType RoundNearest(SimdType inRound)
 	{
-		const auto pos = _mm_set_ps(0.5f, 0.5f, 0.5f, 0.5f);
-		const auto neg = _mm_set_ps(-0.5f, -0.5f, -0.5f, -0.5f);
-
-		const auto byHalf = _mm_blendv_ps(pos, neg, inRound);
-		const auto round = _mm_add_ps(inRound, byHalf);
-		return RoundTrunc(round);
+		// NOTE: Not trunc(x +/- 0.5): the sum itself rounds (e.g. 0.49999997f + 0.5f == 1.0f).
+		// The fraction x - trunc(x) is always exact, so compare it with 0.5 instead
+		const auto absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		const auto trunc = RoundTrunc(inRound);
+		const auto fraction = _mm_and_ps(_mm_sub_ps(inRound, trunc), absMask);
+		const auto isHalfOrMore = _mm_cmpge_ps(fraction, _mm_set1_ps(0.5f));
+		const auto one = _mm_or_ps(_mm_set1_ps(1.0f), _mm_andnot_ps(absMask, inRound)); // +/-1, sign of inRound
+		return _mm_blendv_ps(trunc, _mm_add_ps(trunc, one), isHalfOrMore);
 	}
 
 	/// @brief Round all <float> values toward positive infinity
@@ -627,6 +955,32 @@ struct Simd128<float> :
 		return round;
 	}
 
+	/// @brief Round then convert 4 elements of type`<float>` to `int`, and store them
+	/// to memory specified by `outAddr`.
+	/// @tparam Round Rounding applied before conversion
+	/// @tparam Overflow Out of range handling
+	/// @param outAddr Address to store &elements[4]
+	/// @param inConvert Vector type`<float>` of elements to convert
+	template<RoundKind Round, OverflowKind Overflow>
+	static void ConvertStore4(int* outAddr, SimdType inConvert)
+	{
+		auto convert = ConvertToInt<Round, Overflow>(inConvert);
+		_mm_store_si128(reinterpret_cast<__m128i*>(outAddr), convert);
+	}
+
+	/// @brief Round then convert the 2 lowest order elements of type`<float>` to `int`,
+	/// and store them to memory specified by `outAddr`.
+	/// @tparam Round Rounding applied before conversion
+	/// @tparam Overflow Out of range handling
+	/// @param outAddr Address to store &elements[2]
+	/// @param inConvert Vector type`<float>` of elements to convert
+	template<RoundKind Round, OverflowKind Overflow>
+	static void ConvertStore2(int* outAddr, SimdType inConvert)
+	{
+		auto convert = ConvertToInt<Round, Overflow>(inConvert);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(outAddr), convert);
+	}
+
 	/// @brief Find the minimum value for each pair of element of SimdType
 	/// @param inLHS Left hand side vector term
 	/// @param inRHS Right hand side vector term
@@ -672,6 +1026,40 @@ struct Simd128<float> :
 		auto maxMin = _mm_blend_ps(max, min, 0x0C);
 		return maxMin;
 	}
+
+private:
+	template<RoundKind Round, OverflowKind Overflow>
+	static __m128i ConvertToInt(SimdType inConvert)
+	{
+		// NOTE: _mm_cvtps_epi32() rounds half to even (MXCSR default), which is not `RoundKind::kNearest`.
+		// So round with our own semantics, then truncate: exact since every element is already whole
+		auto round = inConvert;
+		if constexpr (Round == RoundKind::kNearest)
+		{
+			round = RoundNearest(inConvert);
+		}
+		else if constexpr (Round == RoundKind::kFloor)
+		{
+			round = RoundFloor(inConvert);
+		}
+		else if constexpr (Round == RoundKind::kCeil)
+		{
+			round = RoundCeil(inConvert);
+		}
+		auto convert = _mm_cvttps_epi32(round); // kTrunc: truncation is fused into the conversion
+
+		if constexpr (Overflow == OverflowKind::kSaturate)
+		{
+			// TRICKY: cvtt yields 0x80000000 for NaN and every out of range element.
+			// That is already correct for negative overflow. XOR with an all ones mask flips
+			// positive overflow to 0x7FFFFFFF, then an "ordered" mask zeroes NaN elements.
+			const auto overflow = _mm_castps_si128(_mm_cmpge_ps(round, _mm_set1_ps(2147483648.0f)));
+			const auto ordered = _mm_castps_si128(_mm_cmpord_ps(round, round));
+			convert = _mm_xor_si128(convert, overflow);
+			convert = _mm_and_si128(convert, ordered);
+		}
+		return convert;
+	}
 };
 
 #pragma endregion {}
@@ -699,7 +1087,7 @@ struct Simd128<double> :
 	/// @brief Load 2 elements of type`<double>` from memory specified by `inAddr`.
 	/// Loaded elements are placed in low order position in result SimdType.
 	/// Any unused high order elements are set to zero.
-	/// @param inAddr Address of &elements[2] to load
+	/// @param inAddr Address of &elements[2] to load; must be `kSimdAlignment` aligned
 	/// @return Vector type`<double>` of loaded elements
 	static SimdType Load2(const double* inAddr)
 	{
@@ -718,6 +1106,15 @@ struct Simd128<double> :
 		return load1;
 	}
 
+	/// @brief Broadcast a single element of type`<double>` to all elements of a vector.
+	/// @param inValue Value to broadcast
+	/// @return Vector type`<double>` of broadcast elements
+	static SimdType Splat(double inValue)
+	{
+		auto splat = _mm_set1_pd(inValue);
+		return splat;
+	}
+
 /*
 	/// @brief Store 4 elements of type`<double>` to memory specified by `outAddr`.
 	/// @param outAddr Address to store &elements[4]
@@ -739,6 +1136,23 @@ struct Simd128<double> :
         _mm_store_pd(outAddr, inStore2);
 	}
 
+	/// @brief Load 2 elements of type`<double>` from memory specified by `inAddr`, of any alignment.
+	/// @param inAddr Address of &elements[2] to load
+	/// @return Vector type`<double>` of loaded elements
+	static SimdType LoadUnaligned2(const double* inAddr)
+	{
+		auto load2 = _mm_loadu_pd(inAddr);
+		return load2;
+	}
+
+	/// @brief Store 2 elements of type`<double>` to memory specified by `outAddr`, of any alignment.
+	/// @param outAddr Address to store &elements[2]
+	/// @param inStore2 Vector type`<double>` of elements to store
+	static void StoreUnaligned2(double* outAddr, SimdType inStore2)
+	{
+		_mm_storeu_pd(outAddr, inStore2);
+	}
+
 	/// @brief Store 1 element of type`<double>` to memory specified by `outAddr`.
 	/// The lowest order element is stored to memory.
 	/// Any higher order elements are ignored.
@@ -749,6 +1163,49 @@ struct Simd128<double> :
         _mm_store_sd(outAddr, inStore1);
 	}
 
+	/// @brief Load the first `inCount` elements of type`<double>` from memory specified by `inAddr`, of any alignment.
+	/// Elements at and beyond `inCount` are set to zero, and are never read from memory.
+	/// @param inAddr Address of &elements[inCount] to load
+	/// @param inCount Number of elements to load; counts of 2 or more load a whole vector
+	/// @return Vector type`<double>` of loaded elements
+	static SimdType LoadN(const double* inAddr, std::size_t inCount)
+	{
+		SimdType loadN;
+		switch (inCount)
+		{
+		case 0:
+			loadN = _mm_setzero_pd();
+			break;
+		case 1:
+			loadN = Load1(inAddr);
+			break;
+		default:
+			loadN = LoadUnaligned2(inAddr);
+			break;
+		}
+		return loadN;
+	}
+
+	/// @brief Store the first `inCount` elements of type`<double>` to memory specified by `outAddr`, of any alignment.
+	/// Memory at and beyond `outAddr[inCount]` is never written.
+	/// @param outAddr Address to store &elements[inCount]
+	/// @param inStoreN Vector type`<double>` of elements to store
+	/// @param inCount Number of elements to store; counts of 2 or more store a whole vector
+	static void StoreN(double* outAddr, SimdType inStoreN, std::size_t inCount)
+	{
+		switch (inCount)
+		{
+		case 0:
+			break;
+		case 1:
+			Store1(outAddr, inStoreN);
+			break;
+		default:
+			StoreUnaligned2(outAddr, inStoreN);
+			break;
+		}
+	}
+
 	/// @brief Add all vector type`<double>` elements in `inRHS` to `inLHS`.
 	/// @param inLHS Left hand side vector term
 	/// @param inRHS Right hand side vector term
@@ -789,6 +1246,17 @@ struct Simd128<double> :
 		return div;
 	}
 
+	/// @brief Divide all vector type`<double>` elements of `inLHS` by the same divisor.
+	/// @param inLHS Left hand side vector term
+	/// @param inDivisor Divisor to divide by
+	/// @return Result vector type`<double>`
+	static SimdType DivBy(SimdType inLHS, const Divisor<double>& inDivisor)
+	{
+		// NOTE: Divide rather than multiply by a reciprocal, so results match Div() exactly
+		auto div = _mm_div_pd(inLHS, _mm_set1_pd(inDivisor.Value()));
+		return div;
+	}
+
 	/// @brief Duplicate the low half of the SIMD register into both halves.
     /// @param inSimd Input SIMD register.
     /// @return SIMD register with low half duplicated.
@@ -803,7 +1271,7 @@ struct Simd128<double> :
     /// @return SIMD register with high half duplicated.
 	static SimdType DupHi(SimdType inSimd)
 	{
-		auto dup = _mm_shuffle_pd(inSimd, inSimd, 0x1);
+		auto dup = _mm_shuffle_pd(inSimd, inSimd, 0x3); // Both elements from element[1]
 		return dup;
 	}
 
@@ -908,17 +1376,33 @@ struct Simd128<double> :
 		return mask;
 	}
 
+	/// @brief Lane mask for `Select()`: all bits set in the elements that are exactly equal
+	static SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+	{
+		auto eq = _mm_cmpeq_pd(inLHS, inRHS);
+		return eq;
+	}
+
+	/// @brief Masked blend: elements of `inTrue` where `inMask` is set, otherwise of `inFalse`
+	static SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+	{
+		auto select = _mm_blendv_pd(inFalse, inTrue, inMask);
+		return select;
+	}
+
 	/// @brief Round all <double> values toward the nearest whole number
 	/// @param inRound Input to be rounded
 	/// @return Return rounded SimdType values
 	static SimdType RoundNearest(SimdType inRound)
 	{
-		const auto pos = _mm_set_pd(0.5, 0.5);
-		const auto neg = _mm_set_pd(-0.5, -0.5);
-
-		const auto byHalf = _mm_blendv_pd(pos, neg, inRound);
-		const auto round = _mm_add_pd(inRound, byHalf);
-		return RoundTrunc(round);
+		// NOTE: Not trunc(x +/- 0.5): the sum itself rounds (e.g. 0.49999997f + 0.5f == 1.0f).
+		// The fraction x - trunc(x) is always exact, so compare it with 0.5 instead
+		const auto absMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+		const auto trunc = RoundTrunc(inRound);
+		const auto fraction = _mm_and_pd(_mm_sub_pd(inRound, trunc), absMask);
+		const auto isHalfOrMore = _mm_cmpge_pd(fraction, _mm_set1_pd(0.5));
+		const auto one = _mm_or_pd(_mm_set1_pd(1.0), _mm_andnot_pd(absMask, inRound)); // +/-1, sign of inRound
+		return _mm_blendv_pd(trunc, _mm_add_pd(trunc, one), isHalfOrMore);
 	}
 
 	/// @brief Round all <double> values toward positive infinity
@@ -948,6 +1432,19 @@ struct Simd128<double> :
 		return round;
 	}
 
+	/// @brief Round then convert 2 elements of type`<double>` to `int`, and store them
+	/// to memory specified by `outAddr`.
+	/// @tparam Round Rounding applied before conversion
+	/// @tparam Overflow Out of range handling
+	/// @param outAddr Address to store &elements[2]
+	/// @param inConvert Vector type`<double>` of elements to convert
+	template<RoundKind Round, OverflowKind Overflow>
+	static void ConvertStore2(int* outAddr, SimdType inConvert)
+	{
+		auto convert = ConvertToInt<Round, Overflow>(inConvert);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(outAddr), convert);
+	}
+
 	/// @brief Find the minimum value for each pair of element of SimdType
 	/// @param inLHS Left hand side vector term
 	/// @param inRHS Right hand side vector term
@@ -993,6 +1490,975 @@ struct Simd128<double> :
 		auto maxMin = _mm_blend_pd(max, min, 0x02);
 		return maxMin;
 	}
+
+private:
+	template<RoundKind Round, OverflowKind Overflow>
+	static __m128i ConvertToInt(SimdType inConvert)
+	{
+		// NOTE: _mm_cvtpd_epi32() rounds half to even (MXCSR default), which is not `RoundKind::kNearest`.
+		// So round with our own semantics, then truncate: exact since every element is already whole
+		auto round = inConvert;
+		if constexpr (Round == RoundKind::kNearest)
+		{
+			round = RoundNearest(inConvert);
+		}
+		else if constexpr (Round == RoundKind::kFloor)
+		{
+			round = RoundFloor(inConvert);
+		}
+		else if constexpr (Round == RoundKind::kCeil)
+		{
+			round = RoundCeil(inConvert);
+		}
+		auto convert = _mm_cvttpd_epi32(round); // 2 ints in the low order elements
+
+		if constexpr (Overflow == OverflowKind::kSaturate)
+		{
+			// TRICKY: Same fixups as Simd128<float>, but the 64bit compare masks
+			// must first be packed down into the 2 low order 32bit elements
+			const auto overflow = _mm_castpd_si128(_mm_cmpge_pd(round, _mm_set1_pd(2147483648.0)));
+			const auto ordered = _mm_castpd_si128(_mm_cmpord_pd(round, round));
+			convert = _mm_xor_si128(convert, _mm_shuffle_epi32(overflow, _MM_SHUFFLE(3, 3, 2, 0)));
+			convert = _mm_and_si128(convert, _mm_shuffle_epi32(ordered, _MM_SHUFFLE(3, 3, 2, 0)));
+		}
+		return convert;
+	}
+};
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region Simd128<int16_t> SSE specialization
+
+/// @brief 8x 16bit lanes. As geometry storage only the low 4 lanes are loaded
+/// (`Load4()` is a 64bit load), and the upper lanes stay zero.
+/// Arithmetic wraps, like `std::int16_t` arithmetic does.
+template<>
+struct Simd128<std::int16_t> :
+    public Simd128Traits<std::int16_t> // is-a: Simd128Traits<int16_t>
+{
+	using typename Simd128Traits<std::int16_t>::SimdType; // __m128i
+	using typename Simd128Traits<std::int16_t>::ValueType; // int16_t
+
+	/// @brief Load 4 elements of type`<int16_t>` from memory specified by `inAddr`.
+	/// Any unused high order elements are set to zero.
+	/// @param inAddr Address of &elements[4] to load; 64bit load has no alignment requirement
+	/// @return Vector type`<int16_t>` of loaded elements
+	static SimdType Load4(const std::int16_t* inAddr)
+	{
+		auto load4 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(inAddr));
+		return load4;
+	}
+
+	/// @brief Load 2 elements of type`<int16_t>` from memory specified by `inAddr`.
+	/// Any unused high order elements are set to zero.
+	/// @param inAddr Address of &elements[2] to load
+	/// @return Vector type`<int16_t>` of loaded elements
+	static SimdType Load2(const std::int16_t* inAddr)
+	{
+		auto load2 = _mm_loadu_si32(inAddr);
+		return load2;
+	}
+
+	/// @brief Load 1 element of type`<int16_t>` from memory specified by `inAddr`.
+	/// Any unused high order elements are set to zero.
+	/// @param inAddr Address of &element[1] to load
+	/// @return Vector type`<int16_t>` of loaded elements
+	static SimdType Load1(const std::int16_t* inAddr)
+	{
+		auto load1 = _mm_cvtsi32_si128(static_cast<std::uint16_t>(inAddr[0]));
+		return load1;
+	}
+
+	/// @brief Broadcast a single element of type`<int16_t>` to all elements of a vector.
+	/// @param inValue Value to broadcast
+	/// @return Vector type`<int16_t>` of broadcast elements
+	static SimdType Splat(std::int16_t inValue)
+	{
+		auto splat = _mm_set1_epi16(inValue);
+		return splat;
+	}
+
+	/// @brief Store 4 elements of type`<int16_t>` to memory specified by `outAddr`.
+	/// @param outAddr Address to store &elements[4]
+	/// @param inStore4 Vector type`<int16_t>` of elements to store
+	static void Store4(std::int16_t* outAddr, SimdType inStore4)
+	{
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(outAddr), inStore4);
+	}
+
+	/// @brief Store 2 elements of type`<int16_t>` to memory specified by `outAddr`.
+	/// @param outAddr Address to store &elements[2]
+	/// @param inStore2 Vector type`<int16_t>` of elements to store
+	static void Store2(std::int16_t* outAddr, SimdType inStore2)
+	{
+		_mm_storeu_si32(outAddr, inStore2);
+	}
+
+	/// @brief Store 1 element of type`<int16_t>` to memory specified by `outAddr`.
+	/// @param outAddr Address to store &element[1]
+	/// @param inStore1 Vector type`<int16_t>` of elements to store
+	static void Store1(std::int16_t* outAddr, SimdType inStore1)
+	{
+		outAddr[0] = static_cast<std::int16_t>(_mm_cvtsi128_si32(inStore1));
+	}
+
+	/// @brief Same as `Load4()`: no alignment requirement
+	static SimdType LoadUnaligned4(const std::int16_t* inAddr)
+	{
+		return Load4(inAddr);
+	}
+
+	/// @brief Same as `Load2()`: no alignment requirement
+	static SimdType LoadUnaligned2(const std::int16_t* inAddr)
+	{
+		return Load2(inAddr);
+	}
+
+	/// @brief Same as `Store4()`: no alignment requirement
+	static void StoreUnaligned4(std::int16_t* outAddr, SimdType inStore4)
+	{
+		Store4(outAddr, inStore4);
+	}
+
+	/// @brief Same as `Store2()`: no alignment requirement
+	static void StoreUnaligned2(std::int16_t* outAddr, SimdType inStore2)
+	{
+		Store2(outAddr, inStore2);
+	}
+
+	/// @brief Load 4 elements of type`<int16_t>`, sign extended to a vector of type`<int>`.
+	/// @tparam WideT Must be `int`
+	/// @param inAddr Address of &elements[4] to load
+	/// @return Vector type`<int>` of widened elements
+	template<typename WideT>
+	static typename Simd128<WideT>::SimdType LoadWiden4(const std::int16_t* inAddr)
+	{
+		static_assert(std::is_same_v<WideT, int>, "SSE only widens type<int16_t> to type<int>");
+		auto widen = _mm_cvtepi16_epi32(Load4(inAddr));
+		return widen;
+	}
+
+	/// @brief Narrow 4 elements of type`<int>` to type`<int16_t>` (saturating), and store them
+	/// to memory specified by `outAddr`.
+	/// @tparam WideT Must be `int`
+	/// @param outAddr Address to store &elements[4]
+	/// @param inWiden Vector type`<int>` of elements to narrow
+	template<typename WideT>
+	static void NarrowStore4(std::int16_t* outAddr, typename Simd128<WideT>::SimdType inWiden)
+	{
+		static_assert(std::is_same_v<WideT, int>, "SSE only narrows type<int> to type<int16_t>");
+		Store4(outAddr, _mm_packs_epi32(inWiden, inWiden));
+	}
+
+	/// @brief Add all vector type`<int16_t>` elements in `inRHS` to `inLHS`.
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Result vector type`<int16_t>`
+	static SimdType Add(SimdType inLHS, SimdType inRHS)
+	{
+		auto add = _mm_add_epi16(inLHS, inRHS);
+		return add;
+	}
+
+	/// @brief Subtract all vector type`<int16_t>` elements in `inRHS` from `inLHS`.
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Result vector type`<int16_t>`
+	static SimdType Sub(SimdType inLHS, SimdType inRHS)
+	{
+		auto sub = _mm_sub_epi16(inLHS, inRHS);
+		return sub;
+	}
+
+	/// @brief Multiply all vector type`<int16_t>` elements in `inRHS` to `inLHS`.
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Result vector type`<int16_t>`
+	static SimdType Mul(SimdType inLHS, SimdType inRHS)
+	{
+		auto mul = _mm_mullo_epi16(inLHS, inRHS);
+		return mul;
+	}
+
+	/// @brief Divide all vector type`<int16_t>` elements in `inRHS` from `inLHS`.
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Result vector type`<int16_t>`
+	static SimdType Div(SimdType inLHS, SimdType inRHS)
+	{
+		// Note: Intel SSE does not support SIMD integer division
+		std::array<std::int16_t, 8> lhs, rhs;
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lhs.data()), inLHS);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(rhs.data()), inRHS);
+		for (std::size_t i = 0; i < lhs.size(); ++i)
+		{
+			lhs[i] = static_cast<std::int16_t>(rhs[i] != 0 ? lhs[i] / rhs[i] : 0);
+		}
+		return _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs.data()));
+	}
+
+	/// @brief Duplicate elements 0 and 1 into elements 2 and 3.
+	/// @param inSimd Input SIMD register.
+	/// @return SIMD register with low pair duplicated.
+	static SimdType DupLo(SimdType inSimd)
+	{
+		auto dup = _mm_shufflelo_epi16(inSimd, _MM_SHUFFLE(1, 0, 1, 0));
+		return dup;
+	}
+
+	/// @brief Duplicate elements 2 and 3 into elements 0 and 1.
+	/// @param inSimd Input SIMD register.
+	/// @return SIMD register with high pair duplicated.
+	static SimdType DupHi(SimdType inSimd)
+	{
+		auto dup = _mm_shufflelo_epi16(inSimd, _MM_SHUFFLE(3, 2, 3, 2));
+		return dup;
+	}
+
+	/// @brief Compare two vector<int16_t> values to check if all elements equal.
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Return true if corresponding elements are equal, false otherwise
+	static bool IsEq(SimdType inLHS, SimdType inRHS)
+	{
+		const auto eq = _mm_cmpeq_epi16(inLHS, inRHS);
+		const bool allEq = (_mm_movemask_epi8(eq) == 0xFFFF);
+		return allEq;
+	}
+
+	/// @brief Compare two vector<int16_t> values for equality
+	/// @return 8-bit mask: bit i set if lane i comparison is true.
+	static int EqMask(SimdType inLHS, SimdType inRHS)
+	{
+		const auto eq = _mm_cmpeq_epi16(inLHS, inRHS);
+		return LaneMask(eq);
+	}
+
+	static bool IsGe(SimdType inLHS, SimdType inRHS)
+	{
+		const auto lt = _mm_cmplt_epi16(inLHS, inRHS);
+		const bool allGe = (_mm_movemask_epi8(lt) == 0x0000); // Note: inverted logic, !LT == GE
+		return allGe;
+	}
+
+	static int GeMask(SimdType inLHS, SimdType inRHS)
+	{
+		const auto lt = _mm_cmplt_epi16(inLHS, inRHS);
+		return LaneMask(lt) ^ 0x00FF; // Note: inverted logic (^=), !LT == GE
+	}
+
+	static bool IsLe(SimdType inLHS, SimdType inRHS)
+	{
+		const auto gt = _mm_cmpgt_epi16(inLHS, inRHS);
+		const bool allLe = (_mm_movemask_epi8(gt) == 0x0000); // Note: inverted logic, !GT == LE
+		return allLe;
+	}
+
+	static int LeMask(SimdType inLHS, SimdType inRHS)
+	{
+		const auto gt = _mm_cmpgt_epi16(inLHS, inRHS);
+		return LaneMask(gt) ^ 0x00FF; // Note: inverted logic (^=), !GT == LE
+	}
+
+	/// @brief Find the minimum value for each pair of element of SimdType
+	static SimdType Min(SimdType inLHS, SimdType inRHS)
+	{
+		auto min = _mm_min_epi16(inLHS, inRHS);
+		return min;
+	}
+
+	/// @brief Find the maximum value for each pair of element of SimdType
+	static SimdType Max(SimdType inLHS, SimdType inRHS)
+	{
+		auto max = _mm_max_epi16(inLHS, inRHS);
+		return max;
+	}
+
+	/// @brief Minimum of elements 0 and 1; maximum of elements 2 and 3 (and above)
+	static SimdType MinMax(SimdType inLHS, SimdType inRHS)
+	{
+		auto min = _mm_min_epi16(inLHS, inRHS);
+		auto max = _mm_max_epi16(inLHS, inRHS);
+		auto minMax = _mm_blend_epi16(min, max, 0xFC);
+		return minMax;
+	}
+
+	/// @brief Maximum of elements 0 and 1; minimum of elements 2 and 3 (and above)
+	static SimdType MaxMin(SimdType inLHS, SimdType inRHS)
+	{
+		auto max = _mm_max_epi16(inLHS, inRHS);
+		auto min = _mm_min_epi16(inLHS, inRHS);
+		auto maxMin = _mm_blend_epi16(max, min, 0xFC);
+		return maxMin;
+	}
+
+	/// @brief Load 8 elements of type`<int16_t>` (a whole vector) from memory specified by `inAddr`, of any alignment.
+	/// @param inAddr Address of &elements[8] to load
+	/// @return Vector type`<int16_t>` of loaded elements
+	static SimdType LoadUnaligned8(const std::int16_t* inAddr)
+	{
+		auto load8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inAddr));
+		return load8;
+	}
+
+	/// @brief Store 8 elements of type`<int16_t>` (a whole vector) to memory specified by `outAddr`, of any alignment.
+	/// @param outAddr Address to store &elements[8]
+	/// @param inStore8 Vector type`<int16_t>` of elements to store
+	static void StoreUnaligned8(std::int16_t* outAddr, SimdType inStore8)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(outAddr), inStore8);
+	}
+
+	/// @brief Add all vector type`<int16_t>` elements in `inRHS` to `inLHS`, saturating.
+	static SimdType AddSat(SimdType inLHS, SimdType inRHS)
+	{
+		auto add = _mm_adds_epi16(inLHS, inRHS);
+		return add;
+	}
+
+	/// @brief Subtract all vector type`<int16_t>` elements in `inRHS` from `inLHS`, saturating.
+	static SimdType SubSat(SimdType inLHS, SimdType inRHS)
+	{
+		auto sub = _mm_subs_epi16(inLHS, inRHS);
+		return sub;
+	}
+
+	/// @brief Sign extend elements 0..3 to a vector of type`<int>`.
+	/// @tparam WideT Must be `int`
+	template<typename WideT>
+	static typename Simd128<WideT>::SimdType WidenLo(SimdType inSimd)
+	{
+		static_assert(std::is_same_v<WideT, int>, "SSE only widens type<int16_t> to type<int>");
+		auto widen = _mm_cvtepi16_epi32(inSimd);
+		return widen;
+	}
+
+	/// @brief Sign extend elements 4..7 to a vector of type`<int>`.
+	/// @tparam WideT Must be `int`
+	template<typename WideT>
+	static typename Simd128<WideT>::SimdType WidenHi(SimdType inSimd)
+	{
+		static_assert(std::is_same_v<WideT, int>, "SSE only widens type<int16_t> to type<int>");
+		auto widen = _mm_cvtepi16_epi32(_mm_srli_si128(inSimd, 8));
+		return widen;
+	}
+
+	/// @brief Narrow two vectors of type`<int>` into one vector of type`<int16_t>` (saturating).
+	/// @tparam WideT Must be `int`
+	template<typename WideT>
+	static SimdType Narrow(typename Simd128<WideT>::SimdType inLo, typename Simd128<WideT>::SimdType inHi)
+	{
+		static_assert(std::is_same_v<WideT, int>, "SSE only narrows type<int> to type<int16_t>");
+		auto narrow = _mm_packs_epi32(inLo, inHi);
+		return narrow;
+	}
+
+	/// @brief Lane mask for `Select()`: all bits set in the elements that are equal
+	static SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+	{
+		auto eq = _mm_cmpeq_epi16(inLHS, inRHS);
+		return eq;
+	}
+
+	/// @brief Lane mask for `Select()`: all bits set in the elements of `inLHS` that are greater
+	static SimdType CompareGt(SimdType inLHS, SimdType inRHS)
+	{
+		auto gt = _mm_cmpgt_epi16(inLHS, inRHS);
+		return gt;
+	}
+
+	/// @brief Masked blend: elements of `inTrue` where `inMask` is set, otherwise of `inFalse`
+	static SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+	{
+		auto select = _mm_blendv_epi8(inFalse, inTrue, inMask);
+		return select;
+	}
+
+private:
+	/// @brief One bit per 16bit lane of a comparison result
+	static int LaneMask(SimdType inCompare)
+	{
+		const auto pack = _mm_packs_epi16(inCompare, _mm_setzero_si128()); // 8 lanes into 8 bytes
+		return _mm_movemask_epi8(pack);
+	}
+};
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region Simd128<uint16_t> SSE specialization
+
+/// @brief 8x 16bit unsigned lanes, for packed pixel channels and tile coordinates.
+/// Only whole vector loads/stores: these are not geometry element types.
+/// Arithmetic wraps, like `std::uint16_t` arithmetic does; `AddSat()`/`SubSat()` saturate.
+template<>
+struct Simd128<std::uint16_t> :
+    public Simd128Traits<std::uint16_t> // is-a: Simd128Traits<uint16_t>
+{
+	using typename Simd128Traits<std::uint16_t>::SimdType; // __m128i
+	using typename Simd128Traits<std::uint16_t>::ValueType; // uint16_t
+
+	/// @brief Load 8 elements of type`<uint16_t>` (a whole vector) from memory specified by `inAddr`, of any alignment.
+	/// @param inAddr Address of &elements[8] to load
+	/// @return Vector type`<uint16_t>` of loaded elements
+	static SimdType LoadUnaligned8(const std::uint16_t* inAddr)
+	{
+		auto load8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inAddr));
+		return load8;
+	}
+
+	/// @brief Store 8 elements of type`<uint16_t>` (a whole vector) to memory specified by `outAddr`, of any alignment.
+	/// @param outAddr Address to store &elements[8]
+	/// @param inStore8 Vector type`<uint16_t>` of elements to store
+	static void StoreUnaligned8(std::uint16_t* outAddr, SimdType inStore8)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(outAddr), inStore8);
+	}
+
+	/// @brief Broadcast a single element of type`<uint16_t>` to all elements of a vector.
+	static SimdType Splat(std::uint16_t inValue)
+	{
+		auto splat = _mm_set1_epi16(static_cast<short>(inValue));
+		return splat;
+	}
+
+	/// @brief Add all vector type`<uint16_t>` elements in `inRHS` to `inLHS` (wrapping).
+	static SimdType Add(SimdType inLHS, SimdType inRHS)
+	{
+		auto add = _mm_add_epi16(inLHS, inRHS);
+		return add;
+	}
+
+	/// @brief Subtract all vector type`<uint16_t>` elements in `inRHS` from `inLHS` (wrapping).
+	static SimdType Sub(SimdType inLHS, SimdType inRHS)
+	{
+		auto sub = _mm_sub_epi16(inLHS, inRHS);
+		return sub;
+	}
+
+	/// @brief Add all vector type`<uint16_t>` elements in `inRHS` to `inLHS`, saturating.
+	static SimdType AddSat(SimdType inLHS, SimdType inRHS)
+	{
+		auto add = _mm_adds_epu16(inLHS, inRHS);
+		return add;
+	}
+
+	/// @brief Subtract all vector type`<uint16_t>` elements in `inRHS` from `inLHS`, saturating at 0.
+	static SimdType SubSat(SimdType inLHS, SimdType inRHS)
+	{
+		auto sub = _mm_subs_epu16(inLHS, inRHS);
+		return sub;
+	}
+
+	/// @brief Find the minimum value for each pair of element of SimdType
+	static SimdType Min(SimdType inLHS, SimdType inRHS)
+	{
+		auto min = _mm_min_epu16(inLHS, inRHS);
+		return min;
+	}
+
+	/// @brief Find the maximum value for each pair of element of SimdType
+	static SimdType Max(SimdType inLHS, SimdType inRHS)
+	{
+		auto max = _mm_max_epu16(inLHS, inRHS);
+		return max;
+	}
+
+	/// @brief Zero extend elements 0..3 to a vector of type`<int>`.
+	/// @tparam WideT Must be `int`
+	template<typename WideT>
+	static typename Simd128<WideT>::SimdType WidenLo(SimdType inSimd)
+	{
+		static_assert(std::is_same_v<WideT, int>, "SSE only widens type<uint16_t> to type<int>");
+		auto widen = _mm_cvtepu16_epi32(inSimd);
+		return widen;
+	}
+
+	/// @brief Zero extend elements 4..7 to a vector of type`<int>`.
+	/// @tparam WideT Must be `int`
+	template<typename WideT>
+	static typename Simd128<WideT>::SimdType WidenHi(SimdType inSimd)
+	{
+		static_assert(std::is_same_v<WideT, int>, "SSE only widens type<uint16_t> to type<int>");
+		auto widen = _mm_unpackhi_epi16(inSimd, _mm_setzero_si128());
+		return widen;
+	}
+
+	/// @brief Narrow two vectors of type`<int>` into one vector of type`<uint16_t>` (saturating).
+	/// @tparam WideT Must be `int`
+	template<typename WideT>
+	static SimdType Narrow(typename Simd128<WideT>::SimdType inLo, typename Simd128<WideT>::SimdType inHi)
+	{
+		static_assert(std::is_same_v<WideT, int>, "SSE only narrows type<int> to type<uint16_t>");
+		auto narrow = _mm_packus_epi32(inLo, inHi);
+		return narrow;
+	}
+
+	/// @brief Compare two vector<uint16_t> values to check if all elements equal.
+	static bool IsEq(SimdType inLHS, SimdType inRHS)
+	{
+		const auto eq = _mm_cmpeq_epi16(inLHS, inRHS);
+		const bool allEq = (_mm_movemask_epi8(eq) == 0xFFFF);
+		return allEq;
+	}
+
+	/// @brief 8-bit mask: bit i set if lane i elements are equal.
+	static int EqMask(SimdType inLHS, SimdType inRHS)
+	{
+		const auto eq = _mm_cmpeq_epi16(inLHS, inRHS);
+		const auto pack = _mm_packs_epi16(eq, _mm_setzero_si128()); // 8 lanes into 8 bytes
+		return _mm_movemask_epi8(pack);
+	}
+
+	/// @brief Lane mask for `Select()`: all bits set in the elements that are equal
+	static SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+	{
+		auto eq = _mm_cmpeq_epi16(inLHS, inRHS);
+		return eq;
+	}
+
+	/// @brief Lane mask for `Select()`: all bits set in the elements of `inLHS` that are greater
+	static SimdType CompareGt(SimdType inLHS, SimdType inRHS)
+	{
+		// SSE has no unsigned compare: LHS > RHS exactly when min(LHS, RHS) != LHS
+		const auto le = _mm_cmpeq_epi16(_mm_min_epu16(inLHS, inRHS), inLHS);
+		auto gt = _mm_xor_si128(le, _mm_set1_epi32(-1));
+		return gt;
+	}
+
+	/// @brief Masked blend: elements of `inTrue` where `inMask` is set, otherwise of `inFalse`
+	static SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+	{
+		auto select = _mm_blendv_epi8(inFalse, inTrue, inMask);
+		return select;
+	}
+};
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region Simd128<uint8_t> SSE specialization
+
+/// @brief 16x 8bit unsigned lanes, for packed pixels (e.g. 4x RGBA8 pixels per vector).
+/// Only whole vector loads/stores: these are not geometry element types.
+/// Arithmetic wraps, like `std::uint8_t` arithmetic does; `AddSat()`/`SubSat()` saturate.
+template<>
+struct Simd128<std::uint8_t> :
+    public Simd128Traits<std::uint8_t> // is-a: Simd128Traits<uint8_t>
+{
+	using typename Simd128Traits<std::uint8_t>::SimdType; // __m128i
+	using typename Simd128Traits<std::uint8_t>::ValueType; // uint8_t
+
+	/// @brief Load 16 elements of type`<uint8_t>` (a whole vector) from memory specified by `inAddr`, of any alignment.
+	/// @param inAddr Address of &elements[16] to load
+	/// @return Vector type`<uint8_t>` of loaded elements
+	static SimdType LoadUnaligned16(const std::uint8_t* inAddr)
+	{
+		auto load16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inAddr));
+		return load16;
+	}
+
+	/// @brief Store 16 elements of type`<uint8_t>` (a whole vector) to memory specified by `outAddr`, of any alignment.
+	/// @param outAddr Address to store &elements[16]
+	/// @param inStore16 Vector type`<uint8_t>` of elements to store
+	static void StoreUnaligned16(std::uint8_t* outAddr, SimdType inStore16)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(outAddr), inStore16);
+	}
+
+	/// @brief Broadcast a single element of type`<uint8_t>` to all elements of a vector.
+	static SimdType Splat(std::uint8_t inValue)
+	{
+		auto splat = _mm_set1_epi8(static_cast<char>(inValue));
+		return splat;
+	}
+
+	/// @brief Add all vector type`<uint8_t>` elements in `inRHS` to `inLHS` (wrapping).
+	static SimdType Add(SimdType inLHS, SimdType inRHS)
+	{
+		auto add = _mm_add_epi8(inLHS, inRHS);
+		return add;
+	}
+
+	/// @brief Subtract all vector type`<uint8_t>` elements in `inRHS` from `inLHS` (wrapping).
+	static SimdType Sub(SimdType inLHS, SimdType inRHS)
+	{
+		auto sub = _mm_sub_epi8(inLHS, inRHS);
+		return sub;
+	}
+
+	/// @brief Add all vector type`<uint8_t>` elements in `inRHS` to `inLHS`, saturating at 255.
+	static SimdType AddSat(SimdType inLHS, SimdType inRHS)
+	{
+		auto add = _mm_adds_epu8(inLHS, inRHS);
+		return add;
+	}
+
+	/// @brief Subtract all vector type`<uint8_t>` elements in `inRHS` from `inLHS`, saturating at 0.
+	static SimdType SubSat(SimdType inLHS, SimdType inRHS)
+	{
+		auto sub = _mm_subs_epu8(inLHS, inRHS);
+		return sub;
+	}
+
+	/// @brief Find the minimum value for each pair of element of SimdType
+	static SimdType Min(SimdType inLHS, SimdType inRHS)
+	{
+		auto min = _mm_min_epu8(inLHS, inRHS);
+		return min;
+	}
+
+	/// @brief Find the maximum value for each pair of element of SimdType
+	static SimdType Max(SimdType inLHS, SimdType inRHS)
+	{
+		auto max = _mm_max_epu8(inLHS, inRHS);
+		return max;
+	}
+
+	/// @brief Zero extend elements 0..7 to a vector of type`<uint16_t>`.
+	/// @tparam WideT Must be `uint16_t`
+	template<typename WideT>
+	static typename Simd128<WideT>::SimdType WidenLo(SimdType inSimd)
+	{
+		static_assert(std::is_same_v<WideT, std::uint16_t>, "SSE only widens type<uint8_t> to type<uint16_t>");
+		auto widen = _mm_unpacklo_epi8(inSimd, _mm_setzero_si128());
+		return widen;
+	}
+
+	/// @brief Zero extend elements 8..15 to a vector of type`<uint16_t>`.
+	/// @tparam WideT Must be `uint16_t`
+	template<typename WideT>
+	static typename Simd128<WideT>::SimdType WidenHi(SimdType inSimd)
+	{
+		static_assert(std::is_same_v<WideT, std::uint16_t>, "SSE only widens type<uint8_t> to type<uint16_t>");
+		auto widen = _mm_unpackhi_epi8(inSimd, _mm_setzero_si128());
+		return widen;
+	}
+
+	/// @brief Narrow two vectors of type`<uint16_t>` into one vector of type`<uint8_t>` (saturating at 255).
+	/// @tparam WideT Must be `uint16_t`
+	template<typename WideT>
+	static SimdType Narrow(typename Simd128<WideT>::SimdType inLo, typename Simd128<WideT>::SimdType inHi)
+	{
+		static_assert(std::is_same_v<WideT, std::uint16_t>, "SSE only narrows type<uint16_t> to type<uint8_t>");
+		// NOTE: packus saturates *signed* 16bit lanes, so first clamp (unsigned) to 255
+		const auto kMax = _mm_set1_epi16(0x00FF);
+		auto narrow = _mm_packus_epi16(_mm_min_epu16(inLo, kMax), _mm_min_epu16(inHi, kMax));
+		return narrow;
+	}
+
+	/// @brief Compare two vector<uint8_t> values to check if all elements equal.
+	static bool IsEq(SimdType inLHS, SimdType inRHS)
+	{
+		const auto eq = _mm_cmpeq_epi8(inLHS, inRHS);
+		const bool allEq = (_mm_movemask_epi8(eq) == 0xFFFF);
+		return allEq;
+	}
+
+	/// @brief 16-bit mask: bit i set if lane i elements are equal.
+	static int EqMask(SimdType inLHS, SimdType inRHS)
+	{
+		const auto eq = _mm_cmpeq_epi8(inLHS, inRHS);
+		return _mm_movemask_epi8(eq);
+	}
+
+	/// @brief Lane mask for `Select()`: all bits set in the elements that are equal
+	static SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+	{
+		auto eq = _mm_cmpeq_epi8(inLHS, inRHS);
+		return eq;
+	}
+
+	/// @brief Lane mask for `Select()`: all bits set in the elements of `inLHS` that are greater
+	static SimdType CompareGt(SimdType inLHS, SimdType inRHS)
+	{
+		// SSE has no unsigned compare: LHS > RHS exactly when min(LHS, RHS) != LHS
+		const auto le = _mm_cmpeq_epi8(_mm_min_epu8(inLHS, inRHS), inLHS);
+		auto gt = _mm_xor_si128(le, _mm_set1_epi32(-1));
+		return gt;
+	}
+
+	/// @brief Masked blend: elements of `inTrue` where `inMask` is set, otherwise of `inFalse`
+	static SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+	{
+		auto select = _mm_blendv_epi8(inFalse, inTrue, inMask);
+		return select;
+	}
+};
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region Simd128<BFloat16>/Simd128<Half> SSE specializations
+
+/// @brief 16bit floating point storage: loads widen 4 elements into `float` lanes and
+/// stores narrow them again (round to nearest even); all arithmetic is `Simd128<float>`.
+/// @tparam T `BFloat16` or `Half`
+template<typename T>
+struct Simd128Float16 :
+    public Simd128<float> // is-a: Simd128<float>
+{
+	using typename Simd128<float>::SimdType; // __m128
+	using ValueType = T;
+
+	/// @brief Load and widen 4 elements of type`<T>`; no alignment requirement
+	static SimdType Load4(const T* inAddr)
+	{
+		return Widen(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(inAddr)));
+	}
+
+	/// @brief Load and widen 2 elements of type`<T>`; unused high order elements are zero
+	static SimdType Load2(const T* inAddr)
+	{
+		return Widen(_mm_loadu_si32(inAddr));
+	}
+
+	/// @brief Load and widen 1 element of type`<T>`; unused high order elements are zero
+	static SimdType Load1(const T* inAddr)
+	{
+		return Widen(_mm_cvtsi32_si128(inAddr[0].Bits()));
+	}
+
+	/// @brief Broadcast a single element of type`<T>` to all (`float`) elements of a vector.
+	static SimdType Splat(T inValue)
+	{
+		return _mm_set1_ps(T::ToFloat(inValue.Bits()));
+	}
+
+	/// @brief Narrow and store 4 elements of type`<T>`; no alignment requirement
+	static void Store4(T* outAddr, SimdType inStore4)
+	{
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(outAddr), Narrow(inStore4));
+	}
+
+	/// @brief Narrow and store the 2 lowest order elements of type`<T>`
+	static void Store2(T* outAddr, SimdType inStore2)
+	{
+		_mm_storeu_si32(outAddr, Narrow(inStore2));
+	}
+
+	/// @brief Narrow and store the lowest order element of type`<T>`
+	static void Store1(T* outAddr, SimdType inStore1)
+	{
+		const auto bits = static_cast<std::uint16_t>(_mm_cvtsi128_si32(Narrow(inStore1)));
+		outAddr[0] = T::FromBits(bits);
+	}
+
+	static SimdType LoadUnaligned4(const T* inAddr)
+	{
+		return Load4(inAddr);
+	}
+
+	static SimdType LoadUnaligned2(const T* inAddr)
+	{
+		return Load2(inAddr);
+	}
+
+	static void StoreUnaligned4(T* outAddr, SimdType inStore4)
+	{
+		Store4(outAddr, inStore4);
+	}
+
+	static void StoreUnaligned2(T* outAddr, SimdType inStore2)
+	{
+		Store2(outAddr, inStore2);
+	}
+
+private:
+	/// @brief Widen the 4 low order 16bit lanes of `inBits` into 4 `float` lanes (exact)
+	static SimdType Widen(__m128i inBits)
+	{
+		if constexpr (std::is_same_v<T, BFloat16>)
+		{
+			// bfloat16 is the upper half of a float
+			return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), inBits));
+		}
+		else
+		{
+			// NOTE: MSVC never defines __F16C__, but its /arch:AVX2 implies F16C (GCC/Clang -mavx2 does not)
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+			return _mm_cvtph_ps(inBits);
+#else
+			// Scale the rebased exponent/mantissa by 2^112 (this also normalizes subnormals),
+			// then force the exponent of infinity/NaN
+			const auto half = _mm_cvtepu16_epi32(inBits);
+			const auto expMant = _mm_and_si128(half, _mm_set1_epi32(0x7FFF));
+			const auto sign = _mm_slli_epi32(_mm_xor_si128(half, expMant), 16);
+			const auto scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMant, 13)),
+										   _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+			const auto isInfNan = _mm_cmpgt_epi32(expMant, _mm_set1_epi32(0x7BFF));
+			const auto infNanExp = _mm_and_si128(isInfNan, _mm_set1_epi32(255 << 23));
+			return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infNanExp)));
+#endif // __F16C__
+		}
+	}
+
+	/// @brief Narrow 4 `float` lanes (round to nearest even) into the 4 low order 16bit lanes
+	static __m128i Narrow(SimdType inFloat)
+	{
+		if constexpr (std::is_same_v<T, BFloat16>)
+		{
+			// Same as BFloat16::FromFloat(): add half an ulp (ties to even), then truncate
+			const auto bits = _mm_castps_si128(inFloat);
+			const auto isNan = _mm_castps_si128(_mm_cmpunord_ps(inFloat, inFloat));
+			const auto lsb = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(1));
+			const auto round = _mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32(0x7FFF)), lsb);
+			const auto quietNan = _mm_or_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x0040));
+			const auto narrow = _mm_blendv_epi8(_mm_srli_epi32(round, 16), quietNan, isNan);
+			return _mm_packus_epi32(narrow, narrow);
+		}
+		else
+		{
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+			return _mm_cvtps_ph(inFloat, _MM_FROUND_TO_NEAREST_INT);
+#else
+			// Same as Half::FromFloat(), computing every case then selecting per lane
+			const auto bits = _mm_castps_si128(inFloat);
+			const auto isNan = _mm_castps_si128(_mm_cmpunord_ps(inFloat, inFloat));
+			const auto sign = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+			const auto abs = _mm_xor_si128(bits, sign);
+
+			const auto isOverflow = _mm_cmpgt_epi32(abs, _mm_set1_epi32(((127 + 16) << 23) - 1));
+			const auto infNan = _mm_blendv_epi8(_mm_set1_epi32(0x7C00), _mm_set1_epi32(0x7E00), isNan);
+
+			const auto isSubnormal = _mm_cmplt_epi32(abs, _mm_set1_epi32(113 << 23));
+			const auto denormMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+			const auto magic = _mm_add_ps(_mm_castsi128_ps(abs), _mm_castsi128_ps(denormMagic));
+			const auto subnormal = _mm_sub_epi32(_mm_castps_si128(magic), denormMagic);
+
+			const auto oddMantissa = _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(1));
+			auto normal = _mm_add_epi32(abs, _mm_set1_epi32(-(112 << 23) + 0xFFF));
+			normal = _mm_srli_epi32(_mm_add_epi32(normal, oddMantissa), 13);
+
+			auto narrow = _mm_blendv_epi8(normal, subnormal, isSubnormal);
+			narrow = _mm_blendv_epi8(narrow, infNan, isOverflow);
+			narrow = _mm_or_si128(narrow, _mm_srli_epi32(sign, 16));
+			return _mm_packus_epi32(narrow, narrow);
+#endif // __F16C__
+		}
+	}
+};
+
+template<>
+struct Simd128<BFloat16> :
+    public Simd128Float16<BFloat16> // is-a: Simd128Float16<BFloat16>
+{
+};
+
+template<>
+struct Simd128<Half> :
+    public Simd128Float16<Half> // is-a: Simd128Float16<Half>
+{
+};
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region Simd128<Fixed16> SSE specialization
+
+/// @brief Q16.16 fixed point lanes: the raw values are `int` lanes, so loads, stores,
+/// add, subtract, min/max and comparisons are all `Simd128<int>`. Only multiply and
+/// divide need fixed point semantics.
+template<>
+struct Simd128<Fixed16> :
+    public Simd128<int> // is-a: Simd128<int>
+{
+	using typename Simd128<int>::SimdType; // __m128i
+	using ValueType = Fixed16;
+
+	static SimdType Load4(const Fixed16* inAddr)
+	{
+		return Simd128<int>::Load4(Raw(inAddr));
+	}
+
+	static SimdType Load2(const Fixed16* inAddr)
+	{
+		return Simd128<int>::Load2(Raw(inAddr));
+	}
+
+	static SimdType Load1(const Fixed16* inAddr)
+	{
+		return Simd128<int>::Load1(Raw(inAddr));
+	}
+
+	static SimdType Splat(Fixed16 inValue)
+	{
+		return Simd128<int>::Splat(inValue.Raw());
+	}
+
+	static void Store4(Fixed16* outAddr, SimdType inStore4)
+	{
+		Simd128<int>::Store4(Raw(outAddr), inStore4);
+	}
+
+	static void Store2(Fixed16* outAddr, SimdType inStore2)
+	{
+		Simd128<int>::Store2(Raw(outAddr), inStore2);
+	}
+
+	static void Store1(Fixed16* outAddr, SimdType inStore1)
+	{
+		Simd128<int>::Store1(Raw(outAddr), inStore1);
+	}
+
+	static SimdType LoadUnaligned4(const Fixed16* inAddr)
+	{
+		return Simd128<int>::LoadUnaligned4(Raw(inAddr));
+	}
+
+	static SimdType LoadUnaligned2(const Fixed16* inAddr)
+	{
+		return Simd128<int>::LoadUnaligned2(Raw(inAddr));
+	}
+
+	static void StoreUnaligned4(Fixed16* outAddr, SimdType inStore4)
+	{
+		Simd128<int>::StoreUnaligned4(Raw(outAddr), inStore4);
+	}
+
+	static void StoreUnaligned2(Fixed16* outAddr, SimdType inStore2)
+	{
+		Simd128<int>::StoreUnaligned2(Raw(outAddr), inStore2);
+	}
+
+	/// @brief Fixed point multiply: (64bit product >> 16) of each lane, like `Fixed16::operator*=`
+	static SimdType Mul(SimdType inLHS, SimdType inRHS)
+	{
+		// _mm_mul_epi32 multiplies lanes 0 and 2; shift lanes 1 and 3 down to multiply them too
+		const auto even = _mm_mul_epi32(inLHS, inRHS);
+		const auto odd = _mm_mul_epi32(_mm_srli_epi64(inLHS, 32), _mm_srli_epi64(inRHS, 32));
+		// Bits 16..47 of each 64bit product are the Q16.16 result
+		const auto evenResult = _mm_srli_epi64(even, Fixed16::kFracBits);
+		const auto oddResult = _mm_slli_epi64(odd, 32 - Fixed16::kFracBits);
+		auto mul = _mm_blend_epi16(evenResult, oddResult, 0xCC);
+		return mul;
+	}
+
+	/// @brief Fixed point divide of each lane, like `Fixed16::operator/=`
+	static SimdType Div(SimdType inLHS, SimdType inRHS)
+	{
+		alignas(kSimdAlignment) std::array<Fixed16, 4> lhs, rhs;
+		Store4(lhs.data(), inLHS);
+		Store4(rhs.data(), inRHS);
+		for (std::size_t i = 0; i < lhs.size(); ++i)
+		{
+			lhs[i] /= rhs[i];
+		}
+		return Load4(lhs.data());
+	}
+
+private:
+	// Fixed16 is standard layout: its address is the address of its raw int32_t
+	static const int* Raw(const Fixed16* inAddr)
+	{
+		return reinterpret_cast<const int*>(inAddr);
+	}
+
+	static int* Raw(Fixed16* inAddr)
+	{
+		return reinterpret_cast<int*>(inAddr);
+	}
 };
 
 #pragma endregion {}
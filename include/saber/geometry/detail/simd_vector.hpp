@@ -0,0 +1,740 @@
+#ifndef SABER_GEOMETRY_DETAIL_SIMD_VECTOR_HPP
+#define SABER_GEOMETRY_DETAIL_SIMD_VECTOR_HPP
+
+// saber
+#include "saber/config.hpp"
+#include "saber/geometry/detail/simd.hpp"
+
+// std
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// Portable SIMD using GCC/Clang vector extensions: `__attribute__((vector_size(N)))`.
+// The compiler lowers each vector operation to the native instructions of any
+// target (SSE2, NEON, RVV, WebAssembly SIMD128, etc), or to scalar code when the
+// target has no vector unit. Selected by `SABER_GEOMETRY_CONFIG_ISENABLED_SIMD_VECTOR`.
+#if !(SABER_COMPILER(GCC) || SABER_COMPILER(CLANG))
+#error "SABER_GEOMETRY_CONFIG_ISENABLED_SIMD_VECTOR requires GCC or Clang vector extensions"
+#endif
+
+namespace saber::geometry::detail {
+
+// ------------------------------------------------------------------
+#pragma region SimdVectorTraits<>
+
+/// @brief Compiler vector extension types of a 128bit vector of elements of type`<T>`.
+/// @tparam T Type of vector elements
+template<typename T>
+struct SimdVectorTraits; // Specialized below for each supported element type
+
+// int
+template<>
+struct SimdVectorTraits<int>
+{
+	/// @brief 128bit vector of elements
+	using VectorType = int __attribute__((vector_size(16)));
+
+	/// @brief Integer vector of the same element width: the result type of vector comparisons
+	using MaskType = decltype(std::declval<VectorType>() < std::declval<VectorType>());
+
+	/// @brief Type of mask elements
+	using MaskValueType = std::int32_t;
+
+	/// @brief Unsigned vector of the same element width, for arithmetic that wraps
+	using UnsignedType = std::uint32_t __attribute__((vector_size(16)));
+
+}; // struct SimdVectorTraits<>
+
+// float
+template<>
+struct SimdVectorTraits<float>
+{
+	/// @brief 128bit vector of elements
+	using VectorType = float __attribute__((vector_size(16)));
+
+	/// @brief Integer vector of the same element width: the result type of vector comparisons
+	using MaskType = decltype(std::declval<VectorType>() < std::declval<VectorType>());
+
+	/// @brief Type of mask elements
+	using MaskValueType = std::int32_t;
+
+}; // struct SimdVectorTraits<>
+
+// double
+template<>
+struct SimdVectorTraits<double>
+{
+	/// @brief 128bit vector of elements
+	using VectorType = double __attribute__((vector_size(16)));
+
+	/// @brief Integer vector of the same element width: the result type of vector comparisons
+	using MaskType = decltype(std::declval<VectorType>() < std::declval<VectorType>());
+
+	/// @brief Type of mask elements
+	using MaskValueType = std::int64_t;
+
+}; // struct SimdVectorTraits<>
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region SimdTraits<> vector extension specializations
+
+// int
+template<>
+struct Simd128Traits<int>
+{
+	/// @brief Number of elements of type T in a SIMD vector
+	static constexpr std::size_t kSize = 4;
+
+	/// @brief Underlying type of a SIMD element
+	using ValueType = int;
+
+	/// @brief Platform-specific type of a SIMD vector of elements
+	using SimdType = SimdVectorTraits<int>::VectorType; // vector of int
+
+}; // struct SimdTraits<>
+
+// float
+template<>
+struct Simd128Traits<float>
+{
+	/// @brief Number of elements of type T in a SIMD vector
+	static constexpr std::size_t kSize = 4;
+
+	/// @brief Underlying type of a SIMD element
+	using ValueType = float;
+
+	/// @brief Platform-specific type of a SIMD vector of elements
+	using SimdType = SimdVectorTraits<float>::VectorType; // vector of float
+
+}; // struct SimdTraits<>
+
+// double
+template<>
+struct Simd128Traits<double>
+{
+	/// @brief Number of elements of type T in a SIMD vector
+	static constexpr std::size_t kSize = 2;
+
+	/// @brief Underlying type of a SIMD element
+	using ValueType = double;
+
+	/// @brief Platform-specific type of a SIMD vector of elements
+	using SimdType = SimdVectorTraits<double>::VectorType; // vector of double
+
+}; // struct SimdTraits<>
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region Simd128Vector<T>
+
+/// @brief Implementation of the `Simd128<T>` API shared by every element type
+/// supported by the vector extension backend (`int`, `float` and `double`).
+/// Matches the semantics of the SSE and NEON specializations, including the
+/// "inexact" comparison of floating point elements.
+/// @tparam T Underlying type of element of a SIMD vector
+template<typename T>
+struct Simd128Vector :
+	public Simd128Traits<T> // is-a: Simd128Traits<T>
+{
+	using typename Simd128Traits<T>::SimdType; // Expose `SimdType` as our own
+	using typename Simd128Traits<T>::ValueType; // Expose `ValueType` as our own
+	using MaskType = typename SimdVectorTraits<T>::MaskType;
+	using MaskValueType = typename SimdVectorTraits<T>::MaskValueType;
+	static constexpr std::size_t kSize = Simd128Traits<T>::kSize;
+
+	/// @brief Load 4 elements of type`<T>` from memory specified by `inAddr`.
+	/// @param inAddr Address of &elements[4] to load; must be `kSimdAlignment` aligned
+	/// @return Vector type`<T>` of loaded elements
+	static SimdType Load4(const T* inAddr)
+	{
+		static_assert(kSize >= 4, "4 elements of type<T> are too large to fit in 128bit SimdType");
+		SimdType load4;
+		std::memcpy(&load4, __builtin_assume_aligned(inAddr, kSimdAlignment), sizeof(load4));
+		return load4;
+	}
+
+	/// @brief Load 2 elements of type`<T>` from memory specified by `inAddr`.
+	/// Loaded elements are placed in low order position in result SimdType.
+	/// Any unused high order elements are set to zero.
+	/// @param inAddr Address of &elements[2] to load
+	/// @return Vector type`<T>` of loaded elements
+	static SimdType Load2(const T* inAddr)
+	{
+		SimdType load2{}; // zero
+		std::memcpy(&load2, inAddr, 2 * sizeof(T));
+		return load2;
+	}
+
+	/// @brief Load 1 element of type`<T>` from memory specified by `inAddr`.
+	/// Loaded element is placed in low order position in result SimdType.
+	/// Any unused high order elements are set to zero.
+	/// @param inAddr Address of &element[1] to load
+	/// @return Vector type`<T>` of loaded elements
+	static SimdType Load1(const T* inAddr)
+	{
+		SimdType load1{}; // zero
+		load1[0] = *inAddr;
+		return load1;
+	}
+
+	/// @brief Broadcast a single element of type`<T>` to all elements of a vector.
+	/// @param inValue Value to broadcast
+	/// @return Vector type`<T>` of broadcast elements
+	static SimdType Splat(T inValue)
+	{
+		// NOTE: Not `SimdType{} + inValue`, which turns -0.0 into +0.0. Compilers emit a single broadcast for this loop
+		SimdType splat{};
+		for (std::size_t i = 0; i < kSize; ++i)
+		{
+			splat[i] = inValue;
+		}
+		return splat;
+	}
+
+	/// @brief Store 4 elements of type`<T>` to memory specified by `outAddr`.
+	/// @param outAddr Address to store &elements[4]; must be `kSimdAlignment` aligned
+	/// @param inStore4 Vector type`<T>` of elements to store
+	static void Store4(T* outAddr, SimdType inStore4)
+	{
+		static_assert(kSize >= 4, "128bit SimdType is too small to contain 4 elements of type<T>");
+		std::memcpy(__builtin_assume_aligned(outAddr, kSimdAlignment), &inStore4, sizeof(inStore4));
+	}
+
+	/// @brief Store 2 elements of type`<T>` to memory specified by `outAddr`.
+	/// The 2 lowest order elements are stored to memory.
+	/// Any high order elements are ignored.
+	/// @param outAddr Address to store &elements[2]
+	/// @param inStore2 Vector type`<T>` of elements to store
+	static void Store2(T* outAddr, SimdType inStore2)
+	{
+		std::memcpy(outAddr, &inStore2, 2 * sizeof(T));
+	}
+
+	/// @brief Load 4 elements of type`<T>` from memory specified by `inAddr`, of any alignment.
+	/// @param inAddr Address of &elements[4] to load
+	/// @return Vector type`<T>` of loaded elements
+	static SimdType LoadUnaligned4(const T* inAddr)
+	{
+		static_assert(kSize >= 4, "4 elements of type<T> are too large to fit in 128bit SimdType");
+		SimdType load4;
+		std::memcpy(&load4, inAddr, sizeof(load4));
+		return load4;
+	}
+
+	/// @brief Load 2 elements of type`<T>` from memory specified by `inAddr`, of any alignment.
+	/// @param inAddr Address of &elements[2] to load
+	/// @return Vector type`<T>` of loaded elements
+	static SimdType LoadUnaligned2(const T* inAddr)
+	{
+		return Load2(inAddr); // memcpy(): no alignment requirement
+	}
+
+	/// @brief Store 4 elements of type`<T>` to memory specified by `outAddr`, of any alignment.
+	/// @param outAddr Address to store &elements[4]
+	/// @param inStore4 Vector type`<T>` of elements to store
+	static void StoreUnaligned4(T* outAddr, SimdType inStore4)
+	{
+		static_assert(kSize >= 4, "128bit SimdType is too small to contain 4 elements of type<T>");
+		std::memcpy(outAddr, &inStore4, sizeof(inStore4));
+	}
+
+	/// @brief Store 2 elements of type`<T>` to memory specified by `outAddr`, of any alignment.
+	/// @param outAddr Address to store &elements[2]
+	/// @param inStore2 Vector type`<T>` of elements to store
+	static void StoreUnaligned2(T* outAddr, SimdType inStore2)
+	{
+		Store2(outAddr, inStore2); // memcpy(): no alignment requirement
+	}
+
+	/// @brief Store 1 element of type`<T>` to memory specified by `outAddr`.
+	/// The lowest order element is stored to memory.
+	/// Any higher order elements are ignored.
+	/// @param outAddr Address to store &element[1]
+	/// @param inStore1 Vector type`<T>` of elements to store
+	static void Store1(T* outAddr, SimdType inStore1)
+	{
+		*outAddr = inStore1[0];
+	}
+
+	/// @brief Load the first `inCount` elements of type`<T>` from memory specified by `inAddr`, of any alignment.
+	/// Elements at and beyond `inCount` are set to zero, and are never read from memory.
+	/// @param inAddr Address of &elements[inCount] to load
+	/// @param inCount Number of elements to load; counts of `kSize` or more load a whole vector
+	/// @return Vector type`<T>` of loaded elements
+	static SimdType LoadN(const T* inAddr, std::size_t inCount)
+	{
+		SimdType loadN{}; // zero
+		std::memcpy(&loadN, inAddr, std::min(inCount, kSize) * sizeof(T));
+		return loadN;
+	}
+
+	/// @brief Store the first `inCount` elements of type`<T>` to memory specified by `outAddr`, of any alignment.
+	/// Memory at and beyond `outAddr[inCount]` is never written.
+	/// @param outAddr Address to store &elements[inCount]
+	/// @param inStoreN Vector type`<T>` of elements to store
+	/// @param inCount Number of elements to store; counts of `kSize` or more store a whole vector
+	static void StoreN(T* outAddr, SimdType inStoreN, std::size_t inCount)
+	{
+		std::memcpy(outAddr, &inStoreN, std::min(inCount, kSize) * sizeof(T));
+	}
+
+	/// @brief Add all vector type`<T>` elements in `inRHS` to `inLHS`.
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Result vector type`<T>`
+	static SimdType Add(SimdType inLHS, SimdType inRHS)
+	{
+		if constexpr (std::is_integral_v<T>)
+		{
+			// Unsigned arithmetic: overflow wraps, like SSE/NEON, instead of being undefined
+			using UnsignedType = typename SimdVectorTraits<T>::UnsignedType;
+			return (SimdType) ((UnsignedType) inLHS + (UnsignedType) inRHS);
+		}
+		else
+		{
+			return inLHS + inRHS;
+		}
+	}
+
+	/// @brief Subtract all vector type`<T>` elements in `inRHS` from `inLHS`.
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Result vector type`<T>`
+	static SimdType Sub(SimdType inLHS, SimdType inRHS)
+	{
+		if constexpr (std::is_integral_v<T>)
+		{
+			using UnsignedType = typename SimdVectorTraits<T>::UnsignedType;
+			return (SimdType) ((UnsignedType) inLHS - (UnsignedType) inRHS);
+		}
+		else
+		{
+			return inLHS - inRHS;
+		}
+	}
+
+	/// @brief Multiply all vector type`<T>` elements in `inRHS` to `inLHS`.
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Result vector type`<T>`
+	static SimdType Mul(SimdType inLHS, SimdType inRHS)
+	{
+		if constexpr (std::is_integral_v<T>)
+		{
+			using UnsignedType = typename SimdVectorTraits<T>::UnsignedType;
+			return (SimdType) ((UnsignedType) inLHS * (UnsignedType) inRHS);
+		}
+		else
+		{
+			return inLHS * inRHS;
+		}
+	}
+
+	/// @brief Divide all vector type`<T>` elements in `inRHS` from `inLHS`.
+	/// Integer elements divided by zero are set to zero.
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Result vector type`<T>`
+	static SimdType Div(SimdType inLHS, SimdType inRHS)
+	{
+		if constexpr (std::is_integral_v<T>)
+		{
+			// Few targets have vector integer division, so divide as double: exact for every 32bit
+			// quotient, since a fraction is never closer than 2^-31 (relative) to a whole number
+			using WideType = double __attribute__((vector_size(32))); // 4x double
+			const MaskType isZero = (inRHS == 0);
+			const SimdType rhs = inRHS - isZero; // Divide by 1 (not 0) where the divisor is zero...
+			const auto div = __builtin_convertvector(inLHS, WideType) / __builtin_convertvector(rhs, WideType);
+			return __builtin_convertvector(div, SimdType) & ~isZero; // ...then zero those quotients
+		}
+		else
+		{
+			return inLHS / inRHS;
+		}
+	}
+
+	/// @brief Divide all vector type`<T>` elements of `inLHS` by the same prepared divisor.
+	/// Cheaper than `Div()` when one divisor is applied to many vectors.
+	/// @param inLHS Left hand side vector term
+	/// @param inDivisor Divisor prepared once by the caller
+	/// @return Result vector type`<T>`
+	static SimdType DivBy(SimdType inLHS, const Divisor<T>& inDivisor)
+	{
+		if constexpr (std::is_integral_v<T>)
+		{
+			// Multiply by magic number (see `Divisor<int>::Divide()`) in 64bit lanes, keeping the high half
+			using UnsignedType = typename SimdVectorTraits<T>::UnsignedType;
+			using WideType = std::int64_t __attribute__((vector_size(32))); // 4x int64_t
+			const WideType product = __builtin_convertvector(inLHS, WideType) * std::int64_t{inDivisor.Magic()};
+			const auto high = __builtin_convertvector(product >> 32, UnsignedType);
+			const auto add = (UnsignedType) inLHS * static_cast<std::uint32_t>(inDivisor.Add()); // Wraps, never overflows
+			const auto sum = (SimdType) (high + add);
+			const auto quotient = (UnsignedType) (sum >> inDivisor.Shift());
+			return (SimdType) (quotient + ((quotient >> 31) & static_cast<std::uint32_t>(inDivisor.RoundUp())));
+		}
+		else
+		{
+			return inLHS / inDivisor.Value(); // Scalar operand is broadcast to every element
+		}
+	}
+
+	// DupLo
+	static SimdType DupLo(SimdType inSimd)
+	{
+		// DupLo(0123) = 0101;
+		// DupLo(45) = 44;
+		if constexpr (kSize == 4)
+		{
+			return Shuffle<0, 1, 0, 1>(inSimd);
+		}
+		else
+		{
+			return Shuffle<0, 0>(inSimd);
+		}
+	}
+
+	// DupHi
+	static SimdType DupHi(SimdType inSimd)
+	{
+		// DupHi(0123) = 2323;
+		// DupHi(45) = 55;
+		if constexpr (kSize == 4)
+		{
+			return Shuffle<2, 3, 2, 3>(inSimd);
+		}
+		else
+		{
+			return Shuffle<1, 1>(inSimd);
+		}
+	}
+
+	/// @brief Compare two vector<T> values to check if all elements equal or inexactly equal.
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Return true if corresponding elements are equal, false otherwise
+	static bool IsEq(SimdType inLHS, SimdType inRHS)
+	{
+		return EqMask(inLHS, inRHS) == kAllMask;
+	}
+
+	/// @brief Compare two vector<T> values to find elements that are equal or inexactly equal.
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Return mask of all corresponding vector elements that are equal
+	static int EqMask(SimdType inLHS, SimdType inRHS)
+	{
+		if constexpr (std::is_integral_v<T>)
+		{
+			return MoveMask(inLHS == inRHS);
+		}
+		else
+		{
+			// Same tolerance as `Inexact::Eq`: |lhs - rhs| <= epsilon * max(|lhs|, |rhs|, 1)
+			const SimdType magnitude = Max(Max(Abs(inLHS), Abs(inRHS)), Splat(T{1}));
+			const SimdType epsilon = magnitude * std::numeric_limits<T>::epsilon();
+			return MoveMask(Abs(inLHS - inRHS) <= epsilon);
+		}
+	}
+
+	static bool IsGe(SimdType inLHS, SimdType inRHS)
+	{
+		return GeMask(inLHS, inRHS) == kAllMask;
+	}
+
+	static int GeMask(SimdType inLHS, SimdType inRHS)
+	{
+		const MaskType ge = (inLHS >= inRHS);
+		if constexpr (std::is_integral_v<T>)
+		{
+			return MoveMask(ge);
+		}
+		else
+		{
+			// Elements that are not 'exactly' greater than or equal may still be 'inexactly' equal:
+			// Swap the ones that are for the corresponding RHS element, then check them all for equality
+			return EqMask(Select(ge, inRHS, inLHS), inRHS);
+		}
+	}
+
+	static bool IsLe(SimdType inLHS, SimdType inRHS)
+	{
+		return LeMask(inLHS, inRHS) == kAllMask;
+	}
+
+	static int LeMask(SimdType inLHS, SimdType inRHS)
+	{
+		const MaskType le = (inLHS <= inRHS);
+		if constexpr (std::is_integral_v<T>)
+		{
+			return MoveMask(le);
+		}
+		else
+		{
+			// See GeMask()
+			return EqMask(Select(le, inRHS, inLHS), inRHS);
+		}
+	}
+
+	/// @brief Round all <T> values toward the nearest whole number
+	/// (halfway cases are rounded away from zero)
+	/// @param inRound Input to be rounded
+	/// @return Return rounded SimdType values
+	static SimdType RoundNearest(SimdType inRound)
+	{
+		// NOTE: Not trunc(x + 0.5), which rounds the float just below 0.5 up to 1.
+		// The fraction x - trunc(x) is always exact, so compare it with 0.5 instead
+		const SimdType trunc = RoundTrunc(inRound);
+		const MaskType isHalfOrMore = (Abs(inRound - trunc) >= T{0.5});
+		const SimdType one = (SimdType) ((MaskType) Splat(T{1}) | ((MaskType) inRound & kSignMask)); // +/-1, sign of inRound
+		return Select(isHalfOrMore, trunc + one, trunc); // Not trunc + 0, which turns -0 into +0
+	}
+
+	/// @brief Round all <T> values toward positive infinity
+	/// @param inRound Input to be rounded
+	/// @return Return rounded SimdType values
+	static SimdType RoundCeil(SimdType inRound)
+	{
+		const SimdType trunc = RoundTrunc(inRound);
+		return trunc - __builtin_convertvector(trunc < inRound, SimdType); // True is -1: add 1
+	}
+
+	/// @brief Round all <T> values toward negative infinity
+	/// @param inRound Input to be rounded
+	/// @return Return rounded SimdType values
+	static SimdType RoundFloor(SimdType inRound)
+	{
+		const SimdType trunc = RoundTrunc(inRound);
+		return trunc - __builtin_convertvector(-(trunc > inRound), SimdType); // True is 1: subtract 1
+	}
+
+	/// @brief Round all <T> values toward zero
+	/// @param inRound Input to be rounded
+	/// @return Return rounded SimdType values
+	static SimdType RoundTrunc(SimdType inRound)
+	{
+		// Converting to integer truncates. Magnitudes of 2^(digits-1) or more (and NaN, inf)
+		// are already whole, and are kept as is (rather than converted out of range)
+		constexpr T kWhole = static_cast<T>(MaskValueType{1} << (std::numeric_limits<T>::digits - 1));
+		const MaskType isFraction = (Abs(inRound) < kWhole);
+		const SimdType fraction = Select(isFraction, inRound, SimdType{});
+		SimdType trunc = __builtin_convertvector(__builtin_convertvector(fraction, MaskType), SimdType);
+		trunc = (SimdType) ((MaskType) trunc | ((MaskType) inRound & kSignMask)); // Keep the sign: trunc(-0.5) is -0
+		return Select(isFraction, trunc, inRound);
+	}
+
+	/// @brief Round then convert 4 elements of type`<T>` to `int`, and store them
+	/// to memory specified by `outAddr`.
+	/// @tparam Round Rounding applied before conversion
+	/// @tparam Overflow Out of range handling
+	/// @param outAddr Address to store &elements[4]
+	/// @param inConvert Vector type`<T>` of elements to convert
+	template<RoundKind Round, OverflowKind Overflow>
+	static void ConvertStore4(int* outAddr, SimdType inConvert)
+	{
+		static_assert(kSize >= 4, "128bit SimdType is too small to contain 4 elements of type<T>");
+		const auto convert = ConvertToInt<Round, Overflow>(inConvert);
+		std::memcpy(outAddr, &convert, 4 * sizeof(int));
+	}
+
+	/// @brief Round then convert the 2 lowest order elements of type`<T>` to `int`,
+	/// and store them to memory specified by `outAddr`.
+	/// @tparam Round Rounding applied before conversion
+	/// @tparam Overflow Out of range handling
+	/// @param outAddr Address to store &elements[2]
+	/// @param inConvert Vector type`<T>` of elements to convert
+	template<RoundKind Round, OverflowKind Overflow>
+	static void ConvertStore2(int* outAddr, SimdType inConvert)
+	{
+		const auto convert = ConvertToInt<Round, Overflow>(inConvert);
+		outAddr[0] = static_cast<int>(convert[0]);
+		outAddr[1] = static_cast<int>(convert[1]);
+	}
+
+	/// @brief Find the minimum value for each pair of element of SimdType
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Return the minimum value for each pair of element of SimdType
+	static SimdType Min(SimdType inLHS, SimdType inRHS)
+	{
+		return Select(inLHS < inRHS, inLHS, inRHS); // Same as SSE `minps`: RHS when unordered
+	}
+
+	/// @brief Find the maximum value for each pair of element of SimdType
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Return the maximum value for each pair of element of SimdType
+	static SimdType Max(SimdType inLHS, SimdType inRHS)
+	{
+		return Select(inLHS > inRHS, inLHS, inRHS); // Same as SSE `maxps`: RHS when unordered
+	}
+
+	/// @brief Find the minimum/maximum values for each pair ofelement of SimdType
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Return the minimum/maximum values for each pair of element of SimdType
+	static SimdType MinMax(SimdType inLHS, SimdType inRHS)
+	{
+		return Select(LoPairMask(), Min(inLHS, inRHS), Max(inLHS, inRHS));
+	}
+
+	/// @brief Find the maximum/minimum values for each pair ofelement of SimdType
+	/// @param inLHS Left hand side vector term
+	/// @param inRHS Right hand side vector term
+	/// @return Return the maximum/minimum values for each pair of element of SimdType
+	static SimdType MaxMin(SimdType inLHS, SimdType inRHS)
+	{
+		return Select(LoPairMask(), Max(inLHS, inRHS), Min(inLHS, inRHS));
+	}
+
+private:
+	/// @brief Bitmask with one bit set per element (e.g. 0b1111 for 4 elements)
+	static constexpr int kAllMask = (1 << kSize) - 1;
+
+	/// @brief Mask of the sign bit of each element
+	static constexpr MaskValueType kSignMask = std::numeric_limits<MaskValueType>::min();
+
+	/// @brief Convert a vector comparison result to a bitmask: bit[i] set if element[i] is true.
+	/// (Portable equivalent of SSE `movemask`)
+	static int MoveMask(MaskType inMask)
+	{
+		int mask = 0;
+		for (std::size_t i = 0; i < kSize; ++i)
+		{
+			mask |= static_cast<int>(inMask[i] & 1) << i;
+		}
+		return mask;
+	}
+
+	/// @brief Blend two vectors: each element is taken from `inTrue` where `inMask` is true,
+	/// otherwise from `inFalse`. (Portable equivalent of SSE `blendv`)
+	static SimdType Select(MaskType inMask, SimdType inTrue, SimdType inFalse)
+	{
+		return (SimdType) (((MaskType) inTrue & inMask) | ((MaskType) inFalse & ~inMask));
+	}
+
+	/// @brief Absolute value of each element: clear its sign bit
+	static SimdType Abs(SimdType inSimd)
+	{
+		return (SimdType) ((MaskType) inSimd & ~kSignMask);
+	}
+
+	/// @brief Mask selecting the low pair of elements (left/top) for `MinMax()` and `MaxMin()`
+	static MaskType LoPairMask()
+	{
+		constexpr std::size_t kPair = (kSize / 2 < 2) ? (kSize / 2) : 2;
+		MaskType loPair{};
+		for (std::size_t i = 0; i < kPair; ++i)
+		{
+			loPair[i] = -1;
+		}
+		return loPair;
+	}
+
+	/// @brief Rearrange the elements of a vector: result[i] = inSimd[Index[i]]
+	template<int... Index>
+	static SimdType Shuffle(SimdType inSimd)
+	{
+		static_assert(sizeof...(Index) == kSize, "Shuffle() requires one index per element");
+#if SABER_COMPILER(CLANG)
+		return __builtin_shufflevector(inSimd, inSimd, Index...);
+#else
+		return __builtin_shuffle(inSimd, MaskType{Index...});
+#endif
+	}
+
+	/// @brief Round, then convert each element to an integer of the same width
+	template<RoundKind Round, OverflowKind Overflow>
+	static MaskType ConvertToInt(SimdType inConvert)
+	{
+		auto round = inConvert;
+		if constexpr (Round == RoundKind::kNearest)
+		{
+			round = RoundNearest(inConvert);
+		}
+		else if constexpr (Round == RoundKind::kFloor)
+		{
+			round = RoundFloor(inConvert);
+		}
+		else if constexpr (Round == RoundKind::kCeil)
+		{
+			round = RoundCeil(inConvert);
+		}
+
+		if constexpr (Overflow == OverflowKind::kSaturate)
+		{
+			// Convert only the elements within `int` range (NaN is not): the rest would be undefined.
+			// Then replace the out of range elements with the `int` limits; NaN elements stay 0
+			constexpr T kMax = static_cast<T>(std::numeric_limits<int>::max()) + T{1}; // Exactly 2^31
+			constexpr T kMin = static_cast<T>(std::numeric_limits<int>::lowest());
+			const MaskType isHigh = (round >= kMax);
+			const MaskType isLow = (round < kMin);
+			const MaskType isInRange = (round == round) & ~isHigh & ~isLow;
+			MaskType convert = __builtin_convertvector(Select(isInRange, round, SimdType{}), MaskType);
+			convert = (convert & ~isHigh) | (isHigh & std::numeric_limits<int>::max());
+			convert = (convert & ~isLow) | (isLow & std::numeric_limits<int>::lowest());
+			return convert;
+		}
+		else
+		{
+			return __builtin_convertvector(round, MaskType); // kTrunc: truncation is fused into the conversion
+		}
+	}
+}; // struct Simd128Vector<T>
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+#pragma region Simd128<int>, Simd128<float>, Simd128<double> vector extension specializations
+
+template<>
+struct Simd128<int> :
+	public Simd128Vector<int> // is-a: Simd128Vector<int>
+{
+};
+
+template<>
+struct Simd128<float> :
+	public Simd128Vector<float> // is-a: Simd128Vector<float>
+{
+	/// @brief Lane mask for `Select()`: all bits set in the elements that are exactly equal
+	static SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+	{
+		return (SimdType) (inLHS == inRHS);
+	}
+
+	/// @brief Masked blend: elements of `inTrue` where `inMask` is set, otherwise of `inFalse`
+	static SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+	{
+		return (SimdType) (((MaskType) inTrue & (MaskType) inMask) | ((MaskType) inFalse & ~(MaskType) inMask));
+	}
+};
+
+template<>
+struct Simd128<double> :
+	public Simd128Vector<double> // is-a: Simd128Vector<double>
+{
+	/// @brief Lane mask for `Select()`: all bits set in the elements that are exactly equal
+	static SimdType CompareEq(SimdType inLHS, SimdType inRHS)
+	{
+		return (SimdType) (inLHS == inRHS);
+	}
+
+	/// @brief Masked blend: elements of `inTrue` where `inMask` is set, otherwise of `inFalse`
+	static SimdType Select(SimdType inMask, SimdType inTrue, SimdType inFalse)
+	{
+		return (SimdType) (((MaskType) inTrue & (MaskType) inMask) | ((MaskType) inFalse & ~(MaskType) inMask));
+	}
+};
+
+#pragma endregion {}
+
+} // namespace saber::geometry::detail
+
+#endif // SABER_GEOMETRY_DETAIL_SIMD_VECTOR_HPP
@@ -0,0 +1,283 @@
+#ifndef SABER_GEOMETRY_DETAIL_SINCOS_HPP
+#define SABER_GEOMETRY_DETAIL_SINCOS_HPP
+
+// saber
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/detail/impl4.hpp"
+#include "saber/geometry/detail/simd.hpp"
+
+// std
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace saber::geometry::detail {
+
+// ------------------------------------------------------------------
+#pragma region struct SinCosTraits<T>
+
+/// @brief Constants used by the polynomial sin/cos approximation.
+///
+/// Arguments are reduced by the nearest multiple of pi/2 (Cody-Waite: pi/2 is
+/// split into 3 parts, each exactly representable in T, so `k * kPiBy2Hi`
+/// incurs no rounding error), leaving |r| <= pi/4. Then minimax polynomials
+/// in r^2 approximate sin and cos over that range (Cephes coefficients).
+///
+/// Measured max absolute error versus `std::sin`/`std::cos`:
+/// - `float`:  <= 1e-7 for |x| <= 8192
+/// - `double`: <= 1 ulp of 1 (2.22e-16, measured at x ~= -999151) for |x| <= 1e6
+///
+/// Beyond those ranges the reduction loses accuracy (but the result stays in [-1, 1]).
+/// @tparam T Floating point type
+template<typename T>
+struct SinCosTraits; // Primary template declaration
+
+template<>
+struct SinCosTraits<float>
+{
+	static constexpr float kTwoByPi = 0.636619772367581343f;
+	static constexpr float kPiBy2Hi = 1.5703125f;
+	static constexpr float kPiBy2Mid = 4.837512969970703125e-4f;
+	static constexpr float kPiBy2Lo = 7.54978995489188216e-8f;
+
+	// sin(r) = r + r * r^2 * P(r^2); highest order coefficient first
+	static constexpr std::array<float, 3> kSinCoeffs{
+		-1.9515295891e-4f,
+		8.3321608736e-3f,
+		-1.6666654611e-1f};
+
+	// cos(r) = 1 - r^2/2 + r^4 * Q(r^2); highest order coefficient first
+	static constexpr std::array<float, 3> kCosCoeffs{
+		2.443315711809948e-5f,
+		-1.388731625493765e-3f,
+		4.166664568298827e-2f};
+};
+
+template<>
+struct SinCosTraits<double>
+{
+	static constexpr double kTwoByPi = 0.636619772367581343075535;
+	static constexpr double kPiBy2Hi = 1.57079625129699707031;
+	static constexpr double kPiBy2Mid = 7.54978941586159635336e-8;
+	static constexpr double kPiBy2Lo = 5.39030285815811905290e-15;
+
+	static constexpr std::array<double, 6> kSinCoeffs{
+		1.58962301576546568060e-10,
+		-2.50507477628578072866e-8,
+		2.75573136213857245213e-6,
+		-1.98412698295895385996e-4,
+		8.33333333332211858878e-3,
+		-1.66666666666666307295e-1};
+
+	static constexpr std::array<double, 6> kCosCoeffs{
+		-1.13585365213876817300e-11,
+		2.08757008419747316778e-9,
+		-2.75573141792967388112e-7,
+		2.48015872888517045348e-5,
+		-1.38888888888730564116e-3,
+		4.16666666666665929218e-2};
+};
+
+#pragma endregion
+
+// ------------------------------------------------------------------
+#pragma region class SinCosHelper<T>
+
+/// @brief Polynomial sin/cos evaluated on either a single value or a whole `Simd128<T>` vector.
+///
+/// All overloads run the same reduction and polynomials, so they share the
+/// error bounds documented on `SinCosTraits<>`.
+/// @tparam T Floating point type (`float` or `double`)
+template<typename T>
+class SinCosHelper
+{
+public:
+	static_assert(std::is_floating_point_v<T>, "SinCosHelper requires a floating point type");
+
+	using Traits = SinCosTraits<T>;
+	using SimdType = typename Simd128<T>::SimdType;
+
+	/// @brief Compute sin and cos of a single angle.
+	/// @param inRads Angle in radians
+	/// @param outSin Receives sin(inRads)
+	/// @param outCos Receives cos(inRads)
+	static void SinCos(T inRads, T& outSin, T& outCos)
+	{
+		const T k = std::round(inRads * Traits::kTwoByPi);
+		T r = inRads - (k * Traits::kPiBy2Hi);
+		r -= (k * Traits::kPiBy2Mid);
+		r -= (k * Traits::kPiBy2Lo);
+
+		const T z = r * r;
+		T sinPoly = Traits::kSinCoeffs[0];
+		for (std::size_t i = 1; i < Traits::kSinCoeffs.size(); ++i)
+		{
+			sinPoly = (sinPoly * z) + Traits::kSinCoeffs[i];
+		}
+		T cosPoly = Traits::kCosCoeffs[0];
+		for (std::size_t i = 1; i < Traits::kCosCoeffs.size(); ++i)
+		{
+			cosPoly = (cosPoly * z) + Traits::kCosCoeffs[i];
+		}
+		const T sin = r + ((r * z) * sinPoly);
+		const T cos = (1 - (z * T{0.5})) + ((z * z) * cosPoly);
+
+		// Quadrant q = k mod 4: {sin, cos} = {s, c}, {c, -s}, {-s, -c}, {-c, s}
+		const T q = k - (4 * std::floor(k * T{0.25}));
+		const T q1 = std::floor(q * T{0.5}); // 1 for quadrants 2 and 3: negate
+		const T q0 = q - (2 * q1);           // 1 for quadrants 1 and 3: swap
+		const T sign = 1 - (2 * q1);
+
+		outSin = ((sin * (1 - q0)) + (cos * q0)) * sign;
+		outCos = ((cos * (1 - q0)) - (sin * q0)) * sign;
+	}
+
+	/// @brief Compute sin and cos of every element of a vector of angles.
+	/// @param inRads Angles in radians
+	/// @param outSin Receives sin() of each element
+	/// @param outCos Receives cos() of each element
+	static void SinCos(SimdType inRads, SimdType& outSin, SimdType& outCos)
+	{
+		using S = Simd128<T>;
+
+		// TRICKY: Branchless quadrant selection by multiplying with 0/1 factors,
+		// so no lane-wise blend or integer conversion is required from Simd128<T>
+		const auto k = S::RoundNearest(S::Mul(inRads, S::Splat(Traits::kTwoByPi)));
+		auto r = S::Sub(inRads, S::Mul(k, S::Splat(Traits::kPiBy2Hi)));
+		r = S::Sub(r, S::Mul(k, S::Splat(Traits::kPiBy2Mid)));
+		r = S::Sub(r, S::Mul(k, S::Splat(Traits::kPiBy2Lo)));
+
+		const auto z = S::Mul(r, r);
+		auto sinPoly = S::Splat(Traits::kSinCoeffs[0]);
+		for (std::size_t i = 1; i < Traits::kSinCoeffs.size(); ++i)
+		{
+			sinPoly = S::Add(S::Mul(sinPoly, z), S::Splat(Traits::kSinCoeffs[i]));
+		}
+		auto cosPoly = S::Splat(Traits::kCosCoeffs[0]);
+		for (std::size_t i = 1; i < Traits::kCosCoeffs.size(); ++i)
+		{
+			cosPoly = S::Add(S::Mul(cosPoly, z), S::Splat(Traits::kCosCoeffs[i]));
+		}
+		const auto one = S::Splat(1);
+		const auto two = S::Splat(2);
+		const auto sin = S::Add(r, S::Mul(S::Mul(r, z), sinPoly));
+		const auto cos = S::Add(S::Sub(one, S::Mul(z, S::Splat(T{0.5}))), S::Mul(S::Mul(z, z), cosPoly));
+
+		const auto q = S::Sub(k, S::Mul(S::Splat(4), S::RoundFloor(S::Mul(k, S::Splat(T{0.25})))));
+		const auto q1 = S::RoundFloor(S::Mul(q, S::Splat(T{0.5})));
+		const auto q0 = S::Sub(q, S::Mul(two, q1));
+		const auto notQ0 = S::Sub(one, q0);
+		const auto sign = S::Sub(one, S::Mul(two, q1));
+
+		outSin = S::Mul(S::Add(S::Mul(sin, notQ0), S::Mul(cos, q0)), sign);
+		outCos = S::Mul(S::Sub(S::Mul(cos, notQ0), S::Mul(sin, q0)), sign);
+	}
+
+	/// @brief Compute sin and cos of an array of angles, a whole vector at a time.
+	/// Aligned loads/stores are used when all 3 arrays are `kSimdAlignment` aligned
+	/// (e.g. allocated with `saber::AlignedAllocator<T, kSimdAlignment>`); otherwise unaligned.
+	/// @param inRads Pointer to `inCount` angles in radians
+	/// @param outSin Pointer to `inCount` results of sin()
+	/// @param outCos Pointer to `inCount` results of cos()
+	/// @param inCount Number of angles
+	static void SinCos(const T* inRads, T* outSin, T* outCos, std::size_t inCount)
+	{
+		constexpr std::size_t kStep = Simd128<T>::kSize;
+		const std::size_t fullCount = inCount - (inCount % kStep);
+
+		const bool isAligned = IsSimdAligned(inRads) && IsSimdAligned(outSin) && IsSimdAligned(outCos);
+		if (isAligned)
+		{
+			SinCosFull<true>(inRads, outSin, outCos, fullCount);
+		}
+		else
+		{
+			SinCosFull<false>(inRads, outSin, outCos, fullCount);
+		}
+
+		const std::size_t tailCount = inCount - fullCount;
+		if (tailCount > 0)
+		{
+			// Partial tail vector: masked load (extra lanes are zero) and masked stores (extra lanes are discarded)
+			SimdType sinv{};
+			SimdType cosv{};
+			SinCos(Simd128<T>::LoadN(&inRads[fullCount], tailCount), sinv, cosv);
+			Simd128<T>::StoreN(&outSin[fullCount], sinv, tailCount);
+			Simd128<T>::StoreN(&outCos[fullCount], cosv, tailCount);
+		}
+	}
+
+private:
+	/// @brief Compute sin and cos of `inCount` angles, which must be a multiple of the vector size.
+	/// @tparam IsAligned `true` if all 3 arrays are `kSimdAlignment` aligned
+	template<bool IsAligned>
+	static void SinCosFull(const T* inRads, T* outSin, T* outCos, std::size_t inCount)
+	{
+		constexpr std::size_t kStep = Simd128<T>::kSize;
+		for (std::size_t i = 0; i < inCount; i += kStep)
+		{
+			SimdType sinv{};
+			SimdType cosv{};
+			SinCos(Load<IsAligned>(&inRads[i]), sinv, cosv);
+			Store<IsAligned>(&outSin[i], sinv);
+			Store<IsAligned>(&outCos[i], cosv);
+		}
+	}
+
+	template<bool IsAligned>
+	static SimdType Load(const T* inAddr)
+	{
+		if constexpr (Is32BitDataType<T>())
+		{
+			return IsAligned ? Simd128<T>::Load4(inAddr) : Simd128<T>::LoadUnaligned4(inAddr);
+		}
+		else
+		{
+			return IsAligned ? Simd128<T>::Load2(inAddr) : Simd128<T>::LoadUnaligned2(inAddr);
+		}
+	}
+
+	template<bool IsAligned>
+	static void Store(T* outAddr, SimdType inStore)
+	{
+		if constexpr (Is32BitDataType<T>())
+		{
+			IsAligned ? Simd128<T>::Store4(outAddr, inStore) : Simd128<T>::StoreUnaligned4(outAddr, inStore);
+		}
+		else
+		{
+			IsAligned ? Simd128<T>::Store2(outAddr, inStore) : Simd128<T>::StoreUnaligned2(outAddr, inStore);
+		}
+	}
+}; // class SinCosHelper<>
+
+#pragma endregion
+
+// ------------------------------------------------------------------
+#pragma region RotationSinCos()
+
+/// @brief sin/cos of a single rotation angle.
+/// Uses `SinCosHelper<T>` when `SABER_GEOMETRY_CONFIG_ISENABLED_FAST_TRIG` is enabled
+/// (floating point types only), otherwise `std::sin`/`std::cos`.
+template<typename T>
+void RotationSinCos(T inRads, T& outSin, T& outCos)
+{
+	constexpr bool kIsFastTrig = (SABER_GEOMETRY_CONFIG_ISENABLED_FAST_TRIG != 0);
+	if constexpr (kIsFastTrig && std::is_floating_point_v<T>)
+	{
+		SinCosHelper<T>::SinCos(inRads, outSin, outCos);
+	}
+	else
+	{
+		outSin = static_cast<T>(std::sin(inRads));
+		outCos = static_cast<T>(std::cos(inRads));
+	}
+}
+
+#pragma endregion
+
+} // namespace saber::geometry::detail
+
+#endif // SABER_GEOMETRY_DETAIL_SINCOS_HPP
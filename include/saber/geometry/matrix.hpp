@@ -11,6 +11,9 @@
 #include "saber/utility.hpp"
 
 // std
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <utility>
 
 namespace saber::geometry {
@@ -40,6 +43,14 @@ public:
 	constexpr static Matrix MakeTranslation(const Size<T, Impl>& inSize);
 	constexpr static Matrix MakeRotation(T inRads);
 
+	/// @brief Build a rotation matrix for each of an array of angles.
+	/// sin/cos are computed a whole SIMD vector of angles at a time using a polynomial
+	/// approximation (see `detail::SinCosTraits<>` for its max error).
+	/// @param inRads Pointer to `inCount` angles in radians
+	/// @param outMatrices Pointer to `inCount` matrices receiving the rotations
+	/// @param inCount Number of angles/matrices
+	static void MakeRotations(const T* inRads, Matrix* outMatrices, std::size_t inCount);
+
 	/// @brief Destructor.
 	~Matrix() = default;
 
@@ -178,6 +189,27 @@ inline constexpr Matrix<T, Impl> Matrix<T, Impl>::MakeRotation(T inRads)
 	return Matrix{detail::MatrixRotation<T, Impl>(inRads)};
 }
 
+template<typename T, ImplKind Impl>
+inline void Matrix<T, Impl>::MakeRotations(const T* inRads, Matrix* outMatrices, std::size_t inCount)
+{
+	// Compute sin/cos a block of angles at a time, then scatter them into matrices
+	// Aligned block storage: the batch sin/cos takes its aligned fast path whenever `inRads` is aligned too
+	constexpr std::size_t kBlockSize = 64;
+	alignas(detail::kSimdAlignment) std::array<T, kBlockSize> sin{};
+	alignas(detail::kSimdAlignment) std::array<T, kBlockSize> cos{};
+
+	for (std::size_t i = 0; i < inCount; i += kBlockSize)
+	{
+		const std::size_t count = std::min(kBlockSize, inCount - i);
+		detail::MatrixRotationsSinCos<T, Impl>(&inRads[i], sin.data(), cos.data(), count);
+		for (std::size_t j = 0; j < count; ++j)
+		{
+			outMatrices[i + j] = Matrix{cos[j], -sin[j], 0,
+										sin[j], cos[j], 0};
+		}
+	}
+}
+
 template<typename T, ImplKind Impl>
 inline constexpr bool Matrix<T, Impl>::IsEqual(const Matrix& inMatrix) const
 {
@@ -0,0 +1,369 @@
+#ifndef SABER_GEOMETRY_MATRIX3_HPP
+#define SABER_GEOMETRY_MATRIX3_HPP
+
+// saber
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/matrix.hpp"
+#include "saber/geometry/operators.hpp"
+#include "saber/geometry/point.hpp"
+#include "saber/geometry/detail/impl16.hpp"
+#include "saber/geometry/detail/matrix4_helper.hpp"
+#include "saber/geometry/detail/sincos.hpp"
+
+// std
+#include <cstddef>
+#include <utility>
+
+namespace saber::geometry {
+
+/// @brief Represents a 3x3 projective (homography) matrix in 2D space.
+///
+/// Unlike the affine 2x3 `Matrix`, the bottom row is not assumed to be {0, 0, 1},
+/// so points are projected with a perspective divide:
+/// @code{.cpp}
+/// | x' |   | M11 M12 M13 |   | x |
+/// | y' | = | M21 M22 M23 | * | y |     result = { x'/w', y'/w' }
+/// | w' |   | M31 M32 M33 |   | 1 |
+/// @endcode
+/// @tparam T The type of the matrix's coordinates (e.g., float, double).
+/// @tparam ImplType The implementation kind (e.g., scalar or SIMD).
+template<typename T, ImplKind Impl = ImplKind::kDefault>
+class Matrix3
+{
+public:
+	using ValueType = T;
+
+public:
+	/// @brief Default constructor. Initializes a matrix with default 0 values.
+	constexpr Matrix3() = default;
+
+	constexpr Matrix3(T inM11, T inM12, T inM13, T inM21, T inM22, T inM23, T inM31, T inM32, T inM33);
+
+	/// @brief Promote an affine 2x3 `Matrix` to a 3x3 matrix with bottom row {0, 0, 1}.
+	/// @param inAffine The affine matrix to promote
+	constexpr explicit Matrix3(const Matrix<T, Impl>& inAffine);
+
+	constexpr static Matrix3 MakeIdentity();
+	constexpr static Matrix3 MakeZero();
+	constexpr static Matrix3 MakeScale(T inX, T inY);
+	constexpr static Matrix3 MakeTranslation(T inX, T inY);
+	static Matrix3 MakeRotation(T inRads);
+
+	/// @brief Destructor.
+	~Matrix3() = default;
+
+	/// @brief Move constructor.
+	constexpr Matrix3(Matrix3&& ioMove) noexcept = default;
+
+	/// @brief Move assignment operator.
+	constexpr Matrix3& operator=(Matrix3&& ioMove) noexcept = default;
+
+	/// @brief Copy constructor.
+	constexpr Matrix3(const Matrix3& inCopy) = default;
+
+	/// @brief Copy assignment operator.
+	constexpr Matrix3& operator=(const Matrix3& inCopy) = default;
+
+	// Math Operations
+	constexpr Matrix3& operator+=(const Matrix3& inRHS);
+	constexpr Matrix3& operator-=(const Matrix3& inRHS);
+	constexpr Matrix3& operator*=(const Matrix3& inRHS);
+
+	/// @brief Invert this matrix in place.
+	/// @throws saber::Exception if the matrix is singular
+	constexpr void Invert();
+
+	/// @brief Project a single point through this matrix (with perspective divide).
+	/// @param inPoint The point to project
+	/// @return The projected point
+	constexpr Point<T, Impl> Project(const Point<T, Impl>& inPoint) const;
+
+	/// @brief Project a batch of points through this matrix (with perspective divide).
+	/// The matrix terms are gathered once and reused for every point in the batch.
+	/// `inPoints` and `outPoints` may refer to the same array.
+	/// @param inPoints Address of &points[inCount] to project
+	/// @param outPoints Address to store &points[inCount] results
+	/// @param inCount Number of points to project
+	void ProjectPoints(const Point<T, Impl>* inPoints, Point<T, Impl>* outPoints, std::size_t inCount) const;
+
+	// Getters
+	constexpr T M11() const;
+	constexpr T M12() const;
+	constexpr T M13() const;
+	constexpr T M21() const;
+	constexpr T M22() const;
+	constexpr T M23() const;
+	constexpr T M31() const;
+	constexpr T M32() const;
+	constexpr T M33() const;
+
+	// Setters
+	constexpr void M11(T inT);
+	constexpr void M12(T inT);
+	constexpr void M13(T inT);
+	constexpr void M21(T inT);
+	constexpr void M22(T inT);
+	constexpr void M23(T inT);
+	constexpr void M31(T inT);
+	constexpr void M32(T inT);
+	constexpr void M33(T inT);
+
+private:
+	using ImplType = typename detail::Impl16Traits<T, Impl>::ImplType; // VOODOO: Nested template type requires `typename` prefix
+
+	// Row/column index of the homogeneous `w` term within Impl16 storage
+	static constexpr std::size_t kW = 2;
+
+private:
+	// Private APIs
+	/// @brief Checks if this matrix is equal to another.
+	/// @param inMatrix The matrix to compare with.
+	/// @return True if equal, false otherwise.
+	constexpr bool IsEqual(const Matrix3& inMatrix) const;
+
+	// Friend functions
+private:
+	friend constexpr bool operator== <Matrix3>(const Matrix3& inLHS, const Matrix3& inRHS);
+	friend constexpr bool operator!= <Matrix3>(const Matrix3& inLHS, const Matrix3& inRHS);
+
+	// Data Members
+	// NOTE: Stored row-padded as a 4x4; the 4th row and column are always zero
+	ImplType mImpl{};
+}; // class Matrix3<>
+
+// ------------------------------------------------------------------
+#pragma region Inline Class Functions
+
+// Ctors
+template<typename T, ImplKind Impl>
+inline constexpr Matrix3<T, Impl>::Matrix3(T inM11, T inM12, T inM13, T inM21, T inM22, T inM23, T inM31, T inM32, T inM33) :
+	mImpl{inM11, inM12, inM13, 0,
+		  inM21, inM22, inM23, 0,
+		  inM31, inM32, inM33, 0,
+		  0, 0, 0, 0}
+{
+	// Do nothing
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix3<T, Impl>::Matrix3(const Matrix<T, Impl>& inAffine) :
+	Matrix3{inAffine.M11(), inAffine.M12(), inAffine.M13(),
+			inAffine.M21(), inAffine.M22(), inAffine.M23(),
+			0, 0, 1}
+{
+	// Do nothing
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix3<T, Impl> Matrix3<T, Impl>::MakeIdentity()
+{
+	return Matrix3{1, 0, 0,
+				   0, 1, 0,
+				   0, 0, 1};
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix3<T, Impl> Matrix3<T, Impl>::MakeZero()
+{
+	return Matrix3{};
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix3<T, Impl> Matrix3<T, Impl>::MakeScale(T inX, T inY)
+{
+	return Matrix3{inX, 0, 0,
+				   0, inY, 0,
+				   0, 0, 1};
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix3<T, Impl> Matrix3<T, Impl>::MakeTranslation(T inX, T inY)
+{
+	return Matrix3{1, 0, inX,
+				   0, 1, inY,
+				   0, 0, 1};
+}
+
+template<typename T, ImplKind Impl>
+inline Matrix3<T, Impl> Matrix3<T, Impl>::MakeRotation(T inRads)
+{
+	T sin{};
+	T cos{};
+	detail::RotationSinCos(inRads, sin, cos);
+	return Matrix3{cos, -sin, 0,
+				   sin, cos, 0,
+				   0, 0, 1};
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr bool Matrix3<T, Impl>::IsEqual(const Matrix3& inMatrix) const
+{
+	auto result = mImpl.IsEqual(inMatrix.mImpl);
+	return result;
+}
+
+// Math Operations
+template<typename T, ImplKind Impl>
+inline constexpr Matrix3<T, Impl>& Matrix3<T, Impl>::operator+=(const Matrix3& inRHS)
+{
+	mImpl += inRHS.mImpl;
+	return *this;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix3<T, Impl>& Matrix3<T, Impl>::operator-=(const Matrix3& inRHS)
+{
+	mImpl -= inRHS.mImpl;
+	return *this;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix3<T, Impl>& Matrix3<T, Impl>::operator*=(const Matrix3& inRHS)
+{
+	// NOTE: The zero padded 4th row/column keeps a 4x4 product a valid 3x3 product
+	detail::Matrix4Mul<T, Impl>(mImpl, inRHS.mImpl);
+	return *this;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix3<T, Impl>::Invert()
+{
+	detail::Matrix3Inv<T, Impl>(mImpl);
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Point<T, Impl> Matrix3<T, Impl>::Project(const Point<T, Impl>& inPoint) const
+{
+	const auto projection = detail::MatrixProjection<T, Impl, kW>(mImpl);
+	Point<T, Impl> result{};
+	result.mImpl = detail::MatrixProject<T, Impl>(projection, inPoint.mImpl);
+	return result;
+}
+
+template<typename T, ImplKind Impl>
+inline void Matrix3<T, Impl>::ProjectPoints(const Point<T, Impl>* inPoints, Point<T, Impl>* outPoints, std::size_t inCount) const
+{
+	// Gather the matrix terms once, then stream the points through them
+	const auto projection = detail::MatrixProjection<T, Impl, kW>(mImpl);
+	for (std::size_t i = 0; i < inCount; ++i)
+	{
+		outPoints[i].mImpl = detail::MatrixProject<T, Impl>(projection, inPoints[i].mImpl);
+	}
+}
+
+// Getters
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix3<T, Impl>::M11() const
+{
+	return mImpl.template Get<0>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix3<T, Impl>::M12() const
+{
+	return mImpl.template Get<1>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix3<T, Impl>::M13() const
+{
+	return mImpl.template Get<2>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix3<T, Impl>::M21() const
+{
+	return mImpl.template Get<4>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix3<T, Impl>::M22() const
+{
+	return mImpl.template Get<5>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix3<T, Impl>::M23() const
+{
+	return mImpl.template Get<6>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix3<T, Impl>::M31() const
+{
+	return mImpl.template Get<8>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix3<T, Impl>::M32() const
+{
+	return mImpl.template Get<9>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix3<T, Impl>::M33() const
+{
+	return mImpl.template Get<10>();
+}
+
+// Setters
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix3<T, Impl>::M11(T inT)
+{
+	mImpl.template Get<0>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix3<T, Impl>::M12(T inT)
+{
+	mImpl.template Get<1>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix3<T, Impl>::M13(T inT)
+{
+	mImpl.template Get<2>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix3<T, Impl>::M21(T inT)
+{
+	mImpl.template Get<4>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix3<T, Impl>::M22(T inT)
+{
+	mImpl.template Get<5>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix3<T, Impl>::M23(T inT)
+{
+	mImpl.template Get<6>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix3<T, Impl>::M31(T inT)
+{
+	mImpl.template Get<8>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix3<T, Impl>::M32(T inT)
+{
+	mImpl.template Get<9>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix3<T, Impl>::M33(T inT)
+{
+	mImpl.template Get<10>() = inT;
+}
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+} // namespace saber::geometry
+
+#endif // SABER_GEOMETRY_MATRIX3_HPP
@@ -0,0 +1,496 @@
+#ifndef SABER_GEOMETRY_MATRIX4_HPP
+#define SABER_GEOMETRY_MATRIX4_HPP
+
+// saber
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/matrix3.hpp"
+#include "saber/geometry/operators.hpp"
+#include "saber/geometry/point.hpp"
+#include "saber/geometry/detail/impl16.hpp"
+#include "saber/geometry/detail/matrix4_helper.hpp"
+#include "saber/geometry/detail/sincos.hpp"
+
+// std
+#include <cstddef>
+#include <utility>
+
+namespace saber::geometry {
+
+/// @brief Represents a 4x4 transform matrix.
+///
+/// 2D points are treated as {x, y, 0, 1} and projected with a perspective divide:
+/// @code{.cpp}
+/// | x' |   | M11 M12 M13 M14 |   | x |
+/// | y' | = | M21 M22 M23 M24 | * | y |     result = { x'/w', y'/w' }
+/// | z' |   | M31 M32 M33 M34 |   | 0 |
+/// | w' |   | M41 M42 M43 M44 |   | 1 |
+/// @endcode
+/// @tparam T The type of the matrix's coordinates (e.g., float, double).
+/// @tparam ImplType The implementation kind (e.g., scalar or SIMD).
+template<typename T, ImplKind Impl = ImplKind::kDefault>
+class Matrix4
+{
+public:
+	using ValueType = T;
+
+public:
+	/// @brief Default constructor. Initializes a matrix with default 0 values.
+	constexpr Matrix4() = default;
+
+	constexpr Matrix4(T inM11, T inM12, T inM13, T inM14, T inM21, T inM22, T inM23, T inM24, T inM31, T inM32, T inM33, T inM34, T inM41, T inM42, T inM43, T inM44);
+
+	/// @brief Promote a 3x3 projective `Matrix3` to a 4x4 matrix that leaves z untouched.
+	/// @param inMatrix3 The 3x3 matrix to promote
+	constexpr explicit Matrix4(const Matrix3<T, Impl>& inMatrix3);
+
+	constexpr static Matrix4 MakeIdentity();
+	constexpr static Matrix4 MakeZero();
+	constexpr static Matrix4 MakeScale(T inX, T inY, T inZ);
+	constexpr static Matrix4 MakeTranslation(T inX, T inY, T inZ);
+	static Matrix4 MakeRotationX(T inRads);
+	static Matrix4 MakeRotationY(T inRads);
+	static Matrix4 MakeRotationZ(T inRads);
+
+	/// @brief Destructor.
+	~Matrix4() = default;
+
+	/// @brief Move constructor.
+	constexpr Matrix4(Matrix4&& ioMove) noexcept = default;
+
+	/// @brief Move assignment operator.
+	constexpr Matrix4& operator=(Matrix4&& ioMove) noexcept = default;
+
+	/// @brief Copy constructor.
+	constexpr Matrix4(const Matrix4& inCopy) = default;
+
+	/// @brief Copy assignment operator.
+	constexpr Matrix4& operator=(const Matrix4& inCopy) = default;
+
+	// Math Operations
+	constexpr Matrix4& operator+=(const Matrix4& inRHS);
+	constexpr Matrix4& operator-=(const Matrix4& inRHS);
+	constexpr Matrix4& operator*=(const Matrix4& inRHS);
+
+	/// @brief Invert this matrix in place.
+	/// @throws saber::Exception if the matrix is singular
+	constexpr void Invert();
+
+	/// @brief Project a single 2D point (z = 0) through this matrix (with perspective divide).
+	/// @param inPoint The point to project
+	/// @return The projected point
+	constexpr Point<T, Impl> Project(const Point<T, Impl>& inPoint) const;
+
+	/// @brief Project a batch of 2D points (z = 0) through this matrix (with perspective divide).
+	/// The matrix terms are gathered once and reused for every point in the batch.
+	/// `inPoints` and `outPoints` may refer to the same array.
+	/// @param inPoints Address of &points[inCount] to project
+	/// @param outPoints Address to store &points[inCount] results
+	/// @param inCount Number of points to project
+	void ProjectPoints(const Point<T, Impl>* inPoints, Point<T, Impl>* outPoints, std::size_t inCount) const;
+
+	// Getters
+	constexpr T M11() const;
+	constexpr T M12() const;
+	constexpr T M13() const;
+	constexpr T M14() const;
+	constexpr T M21() const;
+	constexpr T M22() const;
+	constexpr T M23() const;
+	constexpr T M24() const;
+	constexpr T M31() const;
+	constexpr T M32() const;
+	constexpr T M33() const;
+	constexpr T M34() const;
+	constexpr T M41() const;
+	constexpr T M42() const;
+	constexpr T M43() const;
+	constexpr T M44() const;
+
+	// Setters
+	constexpr void M11(T inT);
+	constexpr void M12(T inT);
+	constexpr void M13(T inT);
+	constexpr void M14(T inT);
+	constexpr void M21(T inT);
+	constexpr void M22(T inT);
+	constexpr void M23(T inT);
+	constexpr void M24(T inT);
+	constexpr void M31(T inT);
+	constexpr void M32(T inT);
+	constexpr void M33(T inT);
+	constexpr void M34(T inT);
+	constexpr void M41(T inT);
+	constexpr void M42(T inT);
+	constexpr void M43(T inT);
+	constexpr void M44(T inT);
+
+private:
+	using ImplType = typename detail::Impl16Traits<T, Impl>::ImplType; // VOODOO: Nested template type requires `typename` prefix
+
+	// Row/column index of the homogeneous `w` term within Impl16 storage
+	static constexpr std::size_t kW = 3;
+
+private:
+	// Private APIs
+	/// @brief Checks if this matrix is equal to another.
+	/// @param inMatrix The matrix to compare with.
+	/// @return True if equal, false otherwise.
+	constexpr bool IsEqual(const Matrix4& inMatrix) const;
+
+	// Friend functions
+private:
+	friend constexpr bool operator== <Matrix4>(const Matrix4& inLHS, const Matrix4& inRHS);
+	friend constexpr bool operator!= <Matrix4>(const Matrix4& inLHS, const Matrix4& inRHS);
+
+	// Data Members
+	ImplType mImpl{};
+}; // class Matrix4<>
+
+// ------------------------------------------------------------------
+#pragma region Inline Class Functions
+
+// Ctors
+template<typename T, ImplKind Impl>
+inline constexpr Matrix4<T, Impl>::Matrix4(T inM11, T inM12, T inM13, T inM14, T inM21, T inM22, T inM23, T inM24, T inM31, T inM32, T inM33, T inM34, T inM41, T inM42, T inM43, T inM44) :
+	mImpl{inM11, inM12, inM13, inM14,
+		  inM21, inM22, inM23, inM24,
+		  inM31, inM32, inM33, inM34,
+		  inM41, inM42, inM43, inM44}
+{
+	// Do nothing
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix4<T, Impl>::Matrix4(const Matrix3<T, Impl>& inMatrix3) :
+	Matrix4{inMatrix3.M11(), inMatrix3.M12(), 0, inMatrix3.M13(),
+			inMatrix3.M21(), inMatrix3.M22(), 0, inMatrix3.M23(),
+			0, 0, 1, 0,
+			inMatrix3.M31(), inMatrix3.M32(), 0, inMatrix3.M33()}
+{
+	// Do nothing
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix4<T, Impl> Matrix4<T, Impl>::MakeIdentity()
+{
+	return Matrix4{1, 0, 0, 0,
+				   0, 1, 0, 0,
+				   0, 0, 1, 0,
+				   0, 0, 0, 1};
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix4<T, Impl> Matrix4<T, Impl>::MakeZero()
+{
+	return Matrix4{};
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix4<T, Impl> Matrix4<T, Impl>::MakeScale(T inX, T inY, T inZ)
+{
+	return Matrix4{inX, 0, 0, 0,
+				   0, inY, 0, 0,
+				   0, 0, inZ, 0,
+				   0, 0, 0, 1};
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix4<T, Impl> Matrix4<T, Impl>::MakeTranslation(T inX, T inY, T inZ)
+{
+	return Matrix4{1, 0, 0, inX,
+				   0, 1, 0, inY,
+				   0, 0, 1, inZ,
+				   0, 0, 0, 1};
+}
+
+template<typename T, ImplKind Impl>
+inline Matrix4<T, Impl> Matrix4<T, Impl>::MakeRotationX(T inRads)
+{
+	T sin{};
+	T cos{};
+	detail::RotationSinCos(inRads, sin, cos);
+	return Matrix4{1, 0, 0, 0,
+				   0, cos, -sin, 0,
+				   0, sin, cos, 0,
+				   0, 0, 0, 1};
+}
+
+template<typename T, ImplKind Impl>
+inline Matrix4<T, Impl> Matrix4<T, Impl>::MakeRotationY(T inRads)
+{
+	T sin{};
+	T cos{};
+	detail::RotationSinCos(inRads, sin, cos);
+	return Matrix4{cos, 0, sin, 0,
+				   0, 1, 0, 0,
+				   -sin, 0, cos, 0,
+				   0, 0, 0, 1};
+}
+
+template<typename T, ImplKind Impl>
+inline Matrix4<T, Impl> Matrix4<T, Impl>::MakeRotationZ(T inRads)
+{
+	T sin{};
+	T cos{};
+	detail::RotationSinCos(inRads, sin, cos);
+	return Matrix4{cos, -sin, 0, 0,
+				   sin, cos, 0, 0,
+				   0, 0, 1, 0,
+				   0, 0, 0, 1};
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr bool Matrix4<T, Impl>::IsEqual(const Matrix4& inMatrix) const
+{
+	auto result = mImpl.IsEqual(inMatrix.mImpl);
+	return result;
+}
+
+// Math Operations
+template<typename T, ImplKind Impl>
+inline constexpr Matrix4<T, Impl>& Matrix4<T, Impl>::operator+=(const Matrix4& inRHS)
+{
+	mImpl += inRHS.mImpl;
+	return *this;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix4<T, Impl>& Matrix4<T, Impl>::operator-=(const Matrix4& inRHS)
+{
+	mImpl -= inRHS.mImpl;
+	return *this;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Matrix4<T, Impl>& Matrix4<T, Impl>::operator*=(const Matrix4& inRHS)
+{
+	detail::Matrix4Mul<T, Impl>(mImpl, inRHS.mImpl);
+	return *this;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::Invert()
+{
+	detail::Matrix4Inv<T, Impl>(mImpl);
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Point<T, Impl> Matrix4<T, Impl>::Project(const Point<T, Impl>& inPoint) const
+{
+	const auto projection = detail::MatrixProjection<T, Impl, kW>(mImpl);
+	Point<T, Impl> result{};
+	result.mImpl = detail::MatrixProject<T, Impl>(projection, inPoint.mImpl);
+	return result;
+}
+
+template<typename T, ImplKind Impl>
+inline void Matrix4<T, Impl>::ProjectPoints(const Point<T, Impl>* inPoints, Point<T, Impl>* outPoints, std::size_t inCount) const
+{
+	// Gather the matrix terms once, then stream the points through them
+	const auto projection = detail::MatrixProjection<T, Impl, kW>(mImpl);
+	for (std::size_t i = 0; i < inCount; ++i)
+	{
+		outPoints[i].mImpl = detail::MatrixProject<T, Impl>(projection, inPoints[i].mImpl);
+	}
+}
+
+// Getters
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M11() const
+{
+	return mImpl.template Get<0>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M12() const
+{
+	return mImpl.template Get<1>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M13() const
+{
+	return mImpl.template Get<2>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M14() const
+{
+	return mImpl.template Get<3>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M21() const
+{
+	return mImpl.template Get<4>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M22() const
+{
+	return mImpl.template Get<5>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M23() const
+{
+	return mImpl.template Get<6>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M24() const
+{
+	return mImpl.template Get<7>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M31() const
+{
+	return mImpl.template Get<8>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M32() const
+{
+	return mImpl.template Get<9>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M33() const
+{
+	return mImpl.template Get<10>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M34() const
+{
+	return mImpl.template Get<11>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M41() const
+{
+	return mImpl.template Get<12>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M42() const
+{
+	return mImpl.template Get<13>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M43() const
+{
+	return mImpl.template Get<14>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T Matrix4<T, Impl>::M44() const
+{
+	return mImpl.template Get<15>();
+}
+
+// Setters
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M11(T inT)
+{
+	mImpl.template Get<0>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M12(T inT)
+{
+	mImpl.template Get<1>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M13(T inT)
+{
+	mImpl.template Get<2>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M14(T inT)
+{
+	mImpl.template Get<3>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M21(T inT)
+{
+	mImpl.template Get<4>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M22(T inT)
+{
+	mImpl.template Get<5>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M23(T inT)
+{
+	mImpl.template Get<6>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M24(T inT)
+{
+	mImpl.template Get<7>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M31(T inT)
+{
+	mImpl.template Get<8>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M32(T inT)
+{
+	mImpl.template Get<9>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M33(T inT)
+{
+	mImpl.template Get<10>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M34(T inT)
+{
+	mImpl.template Get<11>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M41(T inT)
+{
+	mImpl.template Get<12>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M42(T inT)
+{
+	mImpl.template Get<13>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M43(T inT)
+{
+	mImpl.template Get<14>() = inT;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void Matrix4<T, Impl>::M44(T inT)
+{
+	mImpl.template Get<15>() = inT;
+}
+
+#pragma endregion {}
+
+// ------------------------------------------------------------------
+} // namespace saber::geometry
+
+#endif // SABER_GEOMETRY_MATRIX4_HPP
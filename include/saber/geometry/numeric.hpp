@@ -0,0 +1,613 @@
+#ifndef SABER_GEOMETRY_NUMERIC_HPP
+#define SABER_GEOMETRY_NUMERIC_HPP
+
+// saber
+#include "saber/geometry/config.hpp"
+
+// std
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace saber::geometry {
+
+// Compact element types for memory bound geometry: `Point`, `Size`, `Rectangle`
+// and `Matrix` accept these (and `std::int16_t`) in addition to `int`, `float` and `double`.
+// With `ImplKind::kSimd`, 16bit floating point elements are widened to `float` lanes
+// on load, and narrowed (round to nearest even) on store, by the `Simd128<>` layer.
+
+// ------------------------------------------------------------------
+#pragma region class Fixed16
+
+/// @brief Q16.16 signed fixed point number: 16 integer bits, 16 fraction bits.
+///
+/// Addition and subtraction are exact; multiplication rounds toward -infinity;
+/// division truncates toward zero. Results wrap on overflow, like `int` arithmetic.
+/// Division by zero returns zero (matching the `Simd128<int>::Div()` lanes).
+class Fixed16
+{
+public:
+	/// @brief Number of fraction bits
+	static constexpr int kFracBits = 16;
+
+	/// @brief Raw value representing 1.0
+	static constexpr std::int32_t kOne = std::int32_t{1} << kFracBits;
+
+public:
+	constexpr Fixed16() = default;
+	~Fixed16() = default;
+
+	constexpr Fixed16(const Fixed16& inCopy) = default;
+	constexpr Fixed16& operator=(const Fixed16& inCopy) = default;
+
+	/// @brief Convert from any arithmetic type: floating point values round to nearest
+	/// @param inValue Value to convert
+	template<typename U, typename SFINAE = std::enable_if_t<std::is_arithmetic_v<U>>>
+	constexpr Fixed16(U inValue);
+
+	/// @brief Convert to any arithmetic type: integral types truncate toward zero
+	template<typename U, typename SFINAE = std::enable_if_t<std::is_arithmetic_v<U>>>
+	explicit constexpr operator U() const;
+
+	/// @brief Construct from a raw Q16.16 value
+	/// @param inRaw Raw value (`kOne` represents 1.0)
+	static constexpr Fixed16 FromRaw(std::int32_t inRaw);
+
+	/// @brief Raw Q16.16 value (`kOne` represents 1.0)
+	constexpr std::int32_t Raw() const;
+
+	constexpr Fixed16& operator+=(Fixed16 inRHS);
+	constexpr Fixed16& operator-=(Fixed16 inRHS);
+	constexpr Fixed16& operator*=(Fixed16 inRHS);
+	constexpr Fixed16& operator/=(Fixed16 inRHS);
+
+	friend constexpr Fixed16 operator-(Fixed16 inValue) { return FromRaw(Wrap(-std::int64_t{inValue.mRaw})); }
+	friend constexpr Fixed16 operator+(Fixed16 inLHS, Fixed16 inRHS) { return inLHS += inRHS; }
+	friend constexpr Fixed16 operator-(Fixed16 inLHS, Fixed16 inRHS) { return inLHS -= inRHS; }
+	friend constexpr Fixed16 operator*(Fixed16 inLHS, Fixed16 inRHS) { return inLHS *= inRHS; }
+	friend constexpr Fixed16 operator/(Fixed16 inLHS, Fixed16 inRHS) { return inLHS /= inRHS; }
+
+	friend constexpr bool operator==(Fixed16 inLHS, Fixed16 inRHS) { return inLHS.mRaw == inRHS.mRaw; }
+	friend constexpr bool operator!=(Fixed16 inLHS, Fixed16 inRHS) { return inLHS.mRaw != inRHS.mRaw; }
+	friend constexpr bool operator<(Fixed16 inLHS, Fixed16 inRHS) { return inLHS.mRaw < inRHS.mRaw; }
+	friend constexpr bool operator<=(Fixed16 inLHS, Fixed16 inRHS) { return inLHS.mRaw <= inRHS.mRaw; }
+	friend constexpr bool operator>(Fixed16 inLHS, Fixed16 inRHS) { return inLHS.mRaw > inRHS.mRaw; }
+	friend constexpr bool operator>=(Fixed16 inLHS, Fixed16 inRHS) { return inLHS.mRaw >= inRHS.mRaw; }
+
+private:
+	/// @brief Two's complement wrap of a 64bit intermediate result to 32bits
+	static constexpr std::int32_t Wrap(std::int64_t inValue);
+
+private:
+	std::int32_t mRaw{};
+}; // class Fixed16
+
+template<typename U, typename SFINAE>
+inline constexpr Fixed16::Fixed16(U inValue)
+{
+	if constexpr (std::is_floating_point_v<U>)
+	{
+		const U scaled = inValue * static_cast<U>(kOne);
+		const U half = (scaled < 0) ? U{-0.5} : U{0.5};
+		mRaw = Wrap(static_cast<std::int64_t>(scaled + half)); // Halfway cases round away from zero
+	}
+	else
+	{
+		mRaw = Wrap(static_cast<std::int64_t>(inValue) * kOne);
+	}
+}
+
+template<typename U, typename SFINAE>
+inline constexpr Fixed16::operator U() const
+{
+	if constexpr (std::is_floating_point_v<U>)
+	{
+		return static_cast<U>(mRaw) / static_cast<U>(kOne);
+	}
+	else
+	{
+		return static_cast<U>(static_cast<std::int64_t>(mRaw) / kOne); // Truncate toward zero, like float to int
+	}
+}
+
+inline constexpr Fixed16 Fixed16::FromRaw(std::int32_t inRaw)
+{
+	Fixed16 fixed{};
+	fixed.mRaw = inRaw;
+	return fixed;
+}
+
+inline constexpr std::int32_t Fixed16::Raw() const
+{
+	return mRaw;
+}
+
+inline constexpr Fixed16& Fixed16::operator+=(Fixed16 inRHS)
+{
+	mRaw = Wrap(std::int64_t{mRaw} + inRHS.mRaw);
+	return *this;
+}
+
+inline constexpr Fixed16& Fixed16::operator-=(Fixed16 inRHS)
+{
+	mRaw = Wrap(std::int64_t{mRaw} - inRHS.mRaw);
+	return *this;
+}
+
+inline constexpr Fixed16& Fixed16::operator*=(Fixed16 inRHS)
+{
+	// TRICKY: Arithmetic shift of the 64bit product floors; identical to the SIMD lanes
+	const std::int64_t product = std::int64_t{mRaw} * inRHS.mRaw;
+	mRaw = Wrap(product >> kFracBits);
+	return *this;
+}
+
+inline constexpr Fixed16& Fixed16::operator/=(Fixed16 inRHS)
+{
+	const std::int64_t dividend = std::int64_t{mRaw} * kOne;
+	mRaw = (inRHS.mRaw != 0) ? Wrap(dividend / inRHS.mRaw) : 0;
+	return *this;
+}
+
+inline constexpr std::int32_t Fixed16::Wrap(std::int64_t inValue)
+{
+	return static_cast<std::int32_t>(static_cast<std::uint32_t>(static_cast<std::uint64_t>(inValue)));
+}
+
+#pragma endregion
+
+namespace detail {
+
+// ------------------------------------------------------------------
+#pragma region class Float16Storage<Derived>
+
+/// @brief Common arithmetic of 16bit floating point storage types (`BFloat16`, `Half`).
+/// Every operation is computed in `float`, then rounded (to nearest even) back to 16bits.
+/// @tparam Derived Storage type providing `static std::uint16_t FromFloat(float)`
+/// and `static float ToFloat(std::uint16_t)`
+template<typename Derived>
+class Float16Storage
+{
+public:
+	/// @brief Construct from raw 16bit storage
+	/// @param inBits Raw bits
+	static constexpr Derived FromBits(std::uint16_t inBits)
+	{
+		Derived value{};
+		value.mBits = inBits;
+		return value;
+	}
+
+	/// @brief Raw 16bit storage
+	constexpr std::uint16_t Bits() const
+	{
+		return mBits;
+	}
+
+	/// @brief Convert to any arithmetic type (via `float`)
+	template<typename U, typename SFINAE = std::enable_if_t<std::is_arithmetic_v<U>>>
+	explicit operator U() const
+	{
+		return static_cast<U>(Derived::ToFloat(mBits));
+	}
+
+	Derived& operator+=(Derived inRHS) { return Assign(Float() + inRHS.Float()); }
+	Derived& operator-=(Derived inRHS) { return Assign(Float() - inRHS.Float()); }
+	Derived& operator*=(Derived inRHS) { return Assign(Float() * inRHS.Float()); }
+	Derived& operator/=(Derived inRHS) { return Assign(Float() / inRHS.Float()); }
+
+	friend Derived operator-(Derived inValue) { return FromBits(static_cast<std::uint16_t>(inValue.mBits ^ 0x8000u)); }
+	friend Derived operator+(Derived inLHS, Derived inRHS) { return inLHS += inRHS; }
+	friend Derived operator-(Derived inLHS, Derived inRHS) { return inLHS -= inRHS; }
+	friend Derived operator*(Derived inLHS, Derived inRHS) { return inLHS *= inRHS; }
+	friend Derived operator/(Derived inLHS, Derived inRHS) { return inLHS /= inRHS; }
+
+	friend bool operator==(Derived inLHS, Derived inRHS) { return inLHS.Float() == inRHS.Float(); }
+	friend bool operator!=(Derived inLHS, Derived inRHS) { return inLHS.Float() != inRHS.Float(); }
+	friend bool operator<(Derived inLHS, Derived inRHS) { return inLHS.Float() < inRHS.Float(); }
+	friend bool operator<=(Derived inLHS, Derived inRHS) { return inLHS.Float() <= inRHS.Float(); }
+	friend bool operator>(Derived inLHS, Derived inRHS) { return inLHS.Float() > inRHS.Float(); }
+	friend bool operator>=(Derived inLHS, Derived inRHS) { return inLHS.Float() >= inRHS.Float(); }
+
+protected:
+	constexpr Float16Storage() = default;
+	~Float16Storage() = default;
+
+	constexpr Float16Storage(const Float16Storage& inCopy) = default;
+	constexpr Float16Storage& operator=(const Float16Storage& inCopy) = default;
+
+	static std::uint32_t FloatBits(float inValue)
+	{
+		std::uint32_t bits{};
+		std::memcpy(&bits, &inValue, sizeof(bits));
+		return bits;
+	}
+
+	static float BitsFloat(std::uint32_t inBits)
+	{
+		float value{};
+		std::memcpy(&value, &inBits, sizeof(value));
+		return value;
+	}
+
+private:
+	float Float() const
+	{
+		return Derived::ToFloat(mBits);
+	}
+
+	Derived& Assign(float inValue)
+	{
+		mBits = Derived::FromFloat(inValue);
+		return static_cast<Derived&>(*this);
+	}
+
+protected:
+	std::uint16_t mBits{};
+}; // class Float16Storage<>
+
+#pragma endregion
+
+} // namespace detail
+
+// ------------------------------------------------------------------
+#pragma region class BFloat16
+
+/// @brief "Brain" floating point: the upper 16bits of an IEEE `float`.
+/// Same exponent range as `float`, with 8 significant bits (~2-3 decimal digits).
+class BFloat16 :
+	public detail::Float16Storage<BFloat16> // is-a: 16bit float storage
+{
+public:
+	constexpr BFloat16() = default;
+	~BFloat16() = default;
+
+	constexpr BFloat16(const BFloat16& inCopy) = default;
+	constexpr BFloat16& operator=(const BFloat16& inCopy) = default;
+
+	/// @brief Convert from any arithmetic type (via `float`), rounding to nearest even
+	/// @param inValue Value to convert
+	template<typename U, typename SFINAE = std::enable_if_t<std::is_arithmetic_v<U>>>
+	BFloat16(U inValue)
+	{
+		mBits = FromFloat(static_cast<float>(inValue));
+	}
+
+	/// @brief Round a `float` to the nearest even bfloat16 bits
+	static std::uint16_t FromFloat(float inValue);
+
+	/// @brief Widen bfloat16 bits to a `float` (exact)
+	static float ToFloat(std::uint16_t inBits);
+}; // class BFloat16
+
+inline std::uint16_t BFloat16::FromFloat(float inValue)
+{
+	const std::uint32_t bits = FloatBits(inValue);
+	if ((bits & 0x7FFFFFFFu) > 0x7F800000u)
+	{
+		// NaN: keep sign and payload top bits, but force it quiet so it cannot round to infinity
+		return static_cast<std::uint16_t>((bits >> 16) | 0x0040u);
+	}
+	const std::uint32_t lsb = (bits >> 16) & 1u;
+	return static_cast<std::uint16_t>((bits + 0x7FFFu + lsb) >> 16);
+}
+
+inline float BFloat16::ToFloat(std::uint16_t inBits)
+{
+	return BitsFloat(static_cast<std::uint32_t>(inBits) << 16);
+}
+
+#pragma endregion
+
+// ------------------------------------------------------------------
+#pragma region class Half
+
+/// @brief IEEE 754 binary16 half precision float (layout compatible with `_Float16`).
+/// 11 significant bits (~3 decimal digits); finite range is +/-65504.
+class Half :
+	public detail::Float16Storage<Half> // is-a: 16bit float storage
+{
+public:
+	constexpr Half() = default;
+	~Half() = default;
+
+	constexpr Half(const Half& inCopy) = default;
+	constexpr Half& operator=(const Half& inCopy) = default;
+
+	/// @brief Convert from any arithmetic type (via `float`), rounding to nearest even
+	/// @param inValue Value to convert
+	template<typename U, typename SFINAE = std::enable_if_t<std::is_arithmetic_v<U>>>
+	Half(U inValue)
+	{
+		mBits = FromFloat(static_cast<float>(inValue));
+	}
+
+	/// @brief Round a `float` to the nearest even binary16 bits (overflow becomes infinity)
+	static std::uint16_t FromFloat(float inValue);
+
+	/// @brief Widen binary16 bits to a `float` (exact)
+	static float ToFloat(std::uint16_t inBits);
+}; // class Half
+
+inline std::uint16_t Half::FromFloat(float inValue)
+{
+	constexpr std::uint32_t kFloatInf = 255u << 23;
+	constexpr std::uint32_t kHalfOverflow = (127u + 16u) << 23; // 65536.0f: always rounds to infinity
+	constexpr std::uint32_t kHalfMinNormal = 113u << 23;          // 2^-14
+	constexpr std::uint32_t kDenormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+	std::uint32_t bits = FloatBits(inValue);
+	const std::uint32_t sign = bits & 0x80000000u;
+	bits ^= sign;
+
+	std::uint32_t half = 0;
+	if (bits >= kHalfOverflow)
+	{
+		half = (bits > kFloatInf) ? 0x7E00u : 0x7C00u; // NaN stays (quiet) NaN, otherwise infinity
+	}
+	else if (bits < kHalfMinNormal)
+	{
+		// TRICKY: Adding a magic number makes the FPU round the subnormal mantissa for us
+		const float magic = BitsFloat(bits) + BitsFloat(kDenormMagic);
+		half = FloatBits(magic) - kDenormMagic;
+	}
+	else
+	{
+		// Rebias the exponent, then round the 13 dropped mantissa bits to nearest even
+		const std::uint32_t oddMantissa = (bits >> 13) & 1u;
+		bits += (static_cast<std::uint32_t>(15 - 127) << 23) + 0xFFFu;
+		bits += oddMantissa;
+		half = bits >> 13;
+	}
+	return static_cast<std::uint16_t>(half | (sign >> 16));
+}
+
+inline float Half::ToFloat(std::uint16_t inBits)
+{
+	constexpr std::uint32_t kShiftedExp = 0x7C00u << 13;
+	constexpr std::uint32_t kMagic = 113u << 23;
+
+	std::uint32_t bits = (inBits & 0x7FFFu) << 13;
+	const std::uint32_t exp = bits & kShiftedExp;
+	bits += (127u - 15u) << 23; // Rebias the exponent
+	if (exp == kShiftedExp)
+	{
+		bits += (128u - 16u) << 23; // Infinity or NaN
+	}
+	else if (exp == 0)
+	{
+		bits += 1u << 23; // Zero or subnormal: renormalize
+		bits = FloatBits(BitsFloat(bits) - BitsFloat(kMagic));
+	}
+	bits |= static_cast<std::uint32_t>(inBits & 0x8000u) << 16;
+	return BitsFloat(bits);
+}
+
+#pragma endregion
+
+// ------------------------------------------------------------------
+#pragma region struct ElementTraits<T>
+
+/// @brief Describes how a geometry element type`<T>` computes.
+/// @tparam T Geometry element type
+template<typename T>
+struct ElementTraits
+{
+	/// @brief Arithmetic type used for conversions of `T` to other element types
+	using ComputeType = T;
+};
+
+template<>
+struct ElementTraits<Fixed16>
+{
+	using ComputeType = double; // Exact for every Q16.16 value
+};
+
+template<>
+struct ElementTraits<BFloat16>
+{
+	using ComputeType = float;
+};
+
+template<>
+struct ElementTraits<Half>
+{
+	using ComputeType = float;
+};
+
+#pragma endregion
+
+// ------------------------------------------------------------------
+#pragma region class Divisor<T>
+
+/// @brief A divisor prepared once, then applied to many values with `Divide()` (or the
+/// `DivBy()` geometry methods). Division by zero returns zero, like `Simd128<int>::Div()`.
+/// @tparam T Element type. Only `int` precomputes anything; other types divide directly.
+template<typename T>
+class Divisor
+{
+public:
+	/// @brief Prepare `inDivisor` for repeated use
+	/// @param inDivisor Value to divide by
+	constexpr explicit Divisor(T inDivisor);
+
+	/// @brief The value divided by
+	constexpr T Value() const;
+
+	/// @brief Divide `inValue` by this divisor
+	/// @param inValue Dividend
+	/// @return Quotient (truncated toward zero for integral types)
+	constexpr T Divide(T inValue) const;
+
+private:
+	T mDivisor{};
+}; // class Divisor<>
+
+template<typename T>
+inline constexpr Divisor<T>::Divisor(T inDivisor) :
+	mDivisor{inDivisor}
+{
+	// Do nothing
+}
+
+template<typename T>
+inline constexpr T Divisor<T>::Value() const
+{
+	return mDivisor;
+}
+
+template<typename T>
+inline constexpr T Divisor<T>::Divide(T inValue) const
+{
+	if constexpr (std::is_integral_v<T>)
+	{
+		return (mDivisor != T{0}) ? static_cast<T>(inValue / mDivisor) : T{0};
+	}
+	else
+	{
+		return inValue / mDivisor;
+	}
+}
+
+/// @brief `int` divisor as a "magic number" multiply, add, and shift (Hacker's Delight 10-1),
+/// so vectors of `int` can be divided without a (scalar) divide instruction per lane:
+/// @code
+/// const Divisor<int> kTile{ 48 };
+/// for (auto& point : points) { point.DivBy(kTile); } // No per point `idiv`
+/// @endcode
+template<>
+class Divisor<int>
+{
+public:
+	/// @brief Compute the magic number of `inDivisor`
+	/// @param inDivisor Value to divide by; any value, including zero and `INT_MIN`
+	constexpr explicit Divisor(int inDivisor);
+
+	/// @brief The value divided by
+	constexpr int Value() const;
+
+	/// @brief Divide `inValue` by this divisor, truncating toward zero
+	/// @param inValue Dividend
+	/// @return Quotient; `INT_MIN / -1` wraps to `INT_MIN`
+	constexpr int Divide(int inValue) const;
+
+	// Magic number terms, for SIMD implementations of `Divide()`:
+	// quotient = ((mulhi(Magic(), n) + Add() * n) >> Shift()), plus one if negative and RoundUp() is 1
+
+	/// @brief Signed multiplier; the high 32bits of the 64bit product are kept
+	constexpr int Magic() const;
+	/// @brief -1, 0 or 1 times the dividend added to the high product
+	constexpr int Add() const;
+	/// @brief Arithmetic right shift of the sum
+	constexpr int Shift() const;
+	/// @brief 1 when a negative result rounds up toward zero, otherwise 0
+	constexpr int RoundUp() const;
+
+private:
+	int mDivisor = 0;
+	int mMagic = 0;
+	int mAdd = 0;
+	int mShift = 0;
+	int mRoundUp = 0;
+}; // class Divisor<int>
+
+inline constexpr Divisor<int>::Divisor(int inDivisor) :
+	mDivisor{inDivisor}
+{
+	if (inDivisor == 0)
+	{
+		// Every term zero: every quotient is zero
+		return;
+	}
+
+	if (inDivisor == 1 || inDivisor == -1)
+	{
+		// No magic needed: quotient = +/-dividend, which is already exact
+		mAdd = inDivisor;
+		return;
+	}
+
+	constexpr std::uint32_t kTwo31 = 0x80000000u;
+	const std::uint32_t divisor = static_cast<std::uint32_t>(inDivisor);
+	const std::uint32_t absDivisor = (inDivisor < 0) ? (0u - divisor) : divisor;
+	const std::uint32_t t = kTwo31 + (divisor >> 31);
+	const std::uint32_t absNc = t - 1 - (t % absDivisor); // Absolute value of nc
+	int p = 31;
+	std::uint32_t q1 = kTwo31 / absNc;
+	std::uint32_t r1 = kTwo31 - (q1 * absNc);
+	std::uint32_t q2 = kTwo31 / absDivisor;
+	std::uint32_t r2 = kTwo31 - (q2 * absDivisor);
+	std::uint32_t delta = 0;
+	do
+	{
+		++p;
+		q1 *= 2;
+		r1 *= 2;
+		if (r1 >= absNc)
+		{
+			++q1;
+			r1 -= absNc;
+		}
+		q2 *= 2;
+		r2 *= 2;
+		if (r2 >= absDivisor)
+		{
+			++q2;
+			r2 -= absDivisor;
+		}
+		delta = absDivisor - r2;
+	} while (q1 < delta || (q1 == delta && r1 == 0));
+
+	const std::uint32_t magic = (inDivisor < 0) ? (0u - (q2 + 1)) : (q2 + 1);
+	mMagic = static_cast<int>(magic);
+	mShift = p - 32;
+	mRoundUp = 1;
+	if (inDivisor > 0 && mMagic < 0)
+	{
+		mAdd = 1;
+	}
+	else if (inDivisor < 0 && mMagic > 0)
+	{
+		mAdd = -1;
+	}
+}
+
+inline constexpr int Divisor<int>::Value() const
+{
+	return mDivisor;
+}
+
+inline constexpr int Divisor<int>::Divide(int inValue) const
+{
+	const auto high = static_cast<std::uint32_t>((std::int64_t{mMagic} * inValue) >> 32);
+	const auto add = static_cast<std::uint32_t>(mAdd) * static_cast<std::uint32_t>(inValue); // Wraps, never overflows
+	const auto sum = static_cast<std::int32_t>(high + add);
+	const auto quotient = static_cast<std::uint32_t>(sum >> mShift);
+	return static_cast<int>(quotient + ((quotient >> 31) & static_cast<std::uint32_t>(mRoundUp)));
+}
+
+inline constexpr int Divisor<int>::Magic() const
+{
+	return mMagic;
+}
+
+inline constexpr int Divisor<int>::Add() const
+{
+	return mAdd;
+}
+
+inline constexpr int Divisor<int>::Shift() const
+{
+	return mShift;
+}
+
+inline constexpr int Divisor<int>::RoundUp() const
+{
+	return mRoundUp;
+}
+
+#pragma endregion
+
+} // namespace saber::geometry
+
+#endif // SABER_GEOMETRY_NUMERIC_HPP
@@ -47,9 +47,18 @@ class Size;
 template<typename T, ImplKind Impl>
 class Rectangle;
 
+template<typename T, ImplKind Impl>
+class RectangleLTRB;
+
 template<typename T, ImplKind Impl>
 class Matrix;
 
+template<typename T, ImplKind Impl>
+class Matrix3;
+
+template<typename T, ImplKind Impl>
+class Matrix4;
+
 // Opt-in the geometry types for operator support by specializing `is_geometry_compatible` trait
 template<typename T>
 struct detail::is_geometry_compatible<Point<T, ImplKind::kScalar>> : std::true_type {};
@@ -66,11 +75,26 @@ struct detail::is_geometry_compatible<Rectangle<T, ImplKind::kScalar>> : std::tr
 template<typename T>
 struct detail::is_geometry_compatible<Rectangle<T, ImplKind::kSimd>> : std::true_type {};
 
+template<typename T>
+struct detail::is_geometry_compatible<RectangleLTRB<T, ImplKind::kScalar>> : std::true_type {};
+template<typename T>
+struct detail::is_geometry_compatible<RectangleLTRB<T, ImplKind::kSimd>> : std::true_type {};
+
 template<typename T>
 struct detail::is_geometry_compatible<Matrix<T, ImplKind::kScalar>> : std::true_type {};
 template<typename T>
 struct detail::is_geometry_compatible<Matrix<T, ImplKind::kSimd>> : std::true_type {};
 
+template<typename T>
+struct detail::is_geometry_compatible<Matrix3<T, ImplKind::kScalar>> : std::true_type {};
+template<typename T>
+struct detail::is_geometry_compatible<Matrix3<T, ImplKind::kSimd>> : std::true_type {};
+
+template<typename T>
+struct detail::is_geometry_compatible<Matrix4<T, ImplKind::kScalar>> : std::true_type {};
+template<typename T>
+struct detail::is_geometry_compatible<Matrix4<T, ImplKind::kSimd>> : std::true_type {};
+
 /// @brief Binary Operator that adds 2 input types returning a result of the same type
 /// Use it like this:
 /// ```
@@ -0,0 +1,183 @@
+#ifndef SABER_GEOMETRY_PARALLEL_HPP
+#define SABER_GEOMETRY_PARALLEL_HPP
+
+// saber
+#include "saber/exception.hpp"
+#include "saber/thread_pool.hpp"
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/point.hpp"
+#include "saber/geometry/rectangle.hpp"
+
+// std
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace saber::geometry {
+
+// ------------------------------------------------------------------
+#pragma region Parallel batch operations
+
+/// @brief Bytes of input each parallel batch operation processes per chunk: small enough for
+/// a chunk's input and output to stay in a core's L1/L2 cache, large enough to amortize the
+/// cost of claiming it. Chunk boundaries depend only on this and the element size, never on
+/// the number of threads, so every parallel batch operation is deterministic.
+inline constexpr std::size_t kParallelChunkBytes = 32 * 1024;
+
+namespace detail {
+
+/// @brief Gets the number of elements of type`<T>` per parallel chunk
+template<typename T>
+constexpr std::size_t ParallelChunk()
+{
+	return std::max<std::size_t>(kParallelChunkBytes / sizeof(T), 1);
+}
+
+} // namespace detail
+
+/// @brief Project a batch of points through a matrix (with perspective divide), in parallel.
+/// @tparam MatrixT `Matrix3<>` or `Matrix4<>`
+/// @param ioPool Thread pool to run on
+/// @param inMatrix Matrix to project through
+/// @param inPoints Points to project
+/// @param outPoints Projected points; may be the same array as `inPoints`
+/// @param inCount Number of points
+template<typename MatrixT, typename T, ImplKind Impl>
+inline void ParallelTransform(ThreadPool& ioPool, const MatrixT& inMatrix, const Point<T, Impl>* inPoints, Point<T, Impl>* outPoints, std::size_t inCount)
+{
+	ioPool.ParallelFor(inCount, detail::ParallelChunk<Point<T, Impl>>(), [&](std::size_t inBegin, std::size_t inEnd)
+	{
+		inMatrix.ProjectPoints(inPoints + inBegin, outPoints + inBegin, inEnd - inBegin);
+	});
+}
+
+/// @brief Compute the union of a batch of rectangles, in parallel. Each chunk is reduced
+/// on its own (see `UnionAll()`), then the chunk results are combined in order on the calling
+/// thread; so the result (including floating point rounding) is the same whatever the thread count.
+/// @param ioPool Thread pool to run on
+/// @param inRectangles Rectangles to unite
+/// @param inCount Number of rectangles
+/// @return The minimal bounding rectangle of all rectangles; empty when `inCount` is 0
+template<typename T, ImplKind Impl>
+inline Rectangle<T, Impl> ParallelUnion(ThreadPool& ioPool, const Rectangle<T, Impl>* inRectangles, std::size_t inCount)
+{
+	constexpr std::size_t kChunk = detail::ParallelChunk<Rectangle<T, Impl>>();
+	std::vector<Rectangle<T, Impl>> unions((inCount + kChunk - 1) / kChunk);
+	ioPool.ParallelFor(inCount, kChunk, [&](std::size_t inBegin, std::size_t inEnd)
+	{
+		unions[inBegin / kChunk] = UnionAll(inRectangles + inBegin, inEnd - inBegin);
+	});
+	return UnionAll(unions.data(), unions.size());
+}
+
+/// @brief Compute the bounding box of a batch of points, in parallel. Each chunk is reduced
+/// on its own (see `BoundingBox()`), then the chunk results are combined in order on the
+/// calling thread.
+/// @param ioPool Thread pool to run on
+/// @param inPoints Points to bound
+/// @param inCount Number of points
+/// @return Rectangle from the minimum to the maximum x and y; empty when `inCount` is 0
+template<typename T, ImplKind Impl>
+inline Rectangle<T, Impl> ParallelBoundingBox(ThreadPool& ioPool, const Point<T, Impl>* inPoints, std::size_t inCount)
+{
+	constexpr std::size_t kChunk = detail::ParallelChunk<Point<T, Impl>>();
+	std::vector<Rectangle<T, Impl>> boxes((inCount + kChunk - 1) / kChunk);
+	ioPool.ParallelFor(inCount, kChunk, [&](std::size_t inBegin, std::size_t inEnd)
+	{
+		boxes[inBegin / kChunk] = BoundingBox(inPoints + inBegin, inEnd - inBegin);
+	});
+	return UnionAll(boxes.data(), boxes.size());
+}
+
+/// @brief Intersect each of a batch of rectangles with a clip rectangle, in parallel.
+/// @param ioPool Thread pool to run on
+/// @param inRectangles Rectangles to intersect
+/// @param inClip Rectangle to intersect each of `inRectangles` with
+/// @param outRectangles Intersections; may be empty; may be the same array as `inRectangles`
+/// @param inCount Number of rectangles
+template<typename T, ImplKind Impl>
+inline void ParallelIntersect(ThreadPool& ioPool, const Rectangle<T, Impl>* inRectangles, const Rectangle<T, Impl>& inClip, Rectangle<T, Impl>* outRectangles, std::size_t inCount)
+{
+	ioPool.ParallelFor(inCount, detail::ParallelChunk<Rectangle<T, Impl>>(), [&](std::size_t inBegin, std::size_t inEnd)
+	{
+		for (std::size_t i = inBegin; i < inEnd; ++i)
+		{
+			outRectangles[i] = Intersect(inRectangles[i], inClip);
+		}
+	});
+}
+
+/// @brief Convert a batch of points to another coordinate type, rounding as `Round`, in parallel.
+/// See `Point<>::ConvertFrom()`.
+/// @param ioPool Thread pool to run on
+/// @param inPoints Points to convert
+/// @param outPoints Converted points
+/// @param inCount Number of points
+template<RoundKind Round, OverflowKind Overflow = OverflowKind::kUnchecked, typename T, typename FromT, ImplKind Impl>
+inline void ParallelRound(ThreadPool& ioPool, const Point<FromT, Impl>* inPoints, Point<T, Impl>* outPoints, std::size_t inCount)
+{
+	ioPool.ParallelFor(inCount, detail::ParallelChunk<Point<FromT, Impl>>(), [&](std::size_t inBegin, std::size_t inEnd)
+	{
+		Point<T, Impl>::template ConvertFrom<Round, Overflow>(inPoints + inBegin, outPoints + inBegin, inEnd - inBegin);
+	});
+}
+
+/// @brief Convert a batch of rectangles to another coordinate type, rounding as `Round`, in parallel.
+/// See `Rectangle<>::ConvertFrom()`.
+/// @param ioPool Thread pool to run on
+/// @param inRectangles Rectangles to convert
+/// @param outRectangles Converted rectangles
+/// @param inCount Number of rectangles
+template<RoundKind Round, OverflowKind Overflow = OverflowKind::kUnchecked, typename T, typename FromT, ImplKind Impl>
+inline void ParallelRound(ThreadPool& ioPool, const Rectangle<FromT, Impl>* inRectangles, Rectangle<T, Impl>* outRectangles, std::size_t inCount)
+{
+	ioPool.ParallelFor(inCount, detail::ParallelChunk<Rectangle<FromT, Impl>>(), [&](std::size_t inBegin, std::size_t inEnd)
+	{
+		Rectangle<T, Impl>::template ConvertFrom<Round, Overflow>(inRectangles + inBegin, outRectangles + inBegin, inEnd - inBegin);
+	});
+}
+
+/// @brief Find the rectangles of a batch that overlap a query rectangle, in parallel.
+/// @param ioPool Thread pool to run on
+/// @param inRectangles Rectangles to query
+/// @param inCount Number of rectangles
+/// @param inQuery Rectangle to test each of `inRectangles` against; see `IsOverlapping()`
+/// @return Indices of the overlapping rectangles, in increasing order
+template<typename T, ImplKind Impl>
+inline std::vector<std::size_t> ParallelQueryOverlapping(ThreadPool& ioPool, const Rectangle<T, Impl>* inRectangles, std::size_t inCount, const Rectangle<T, Impl>& inQuery)
+{
+	// Each chunk collects its own hits; concatenating them in chunk order keeps indices sorted
+	constexpr std::size_t kChunk = detail::ParallelChunk<Rectangle<T, Impl>>();
+	std::vector<std::vector<std::size_t>> hits((inCount + kChunk - 1) / kChunk);
+	ioPool.ParallelFor(inCount, kChunk, [&](std::size_t inBegin, std::size_t inEnd)
+	{
+		auto& chunkHits = hits[inBegin / kChunk];
+		for (std::size_t i = inBegin; i < inEnd; ++i)
+		{
+			if (IsOverlapping(inRectangles[i], inQuery))
+			{
+				chunkHits.push_back(i);
+			}
+		}
+	});
+
+	std::size_t hitCount = 0;
+	for (const auto& chunkHits : hits)
+	{
+		hitCount += chunkHits.size();
+	}
+
+	std::vector<std::size_t> result;
+	result.reserve(hitCount);
+	for (const auto& chunkHits : hits)
+	{
+		result.insert(result.end(), chunkHits.begin(), chunkHits.end());
+	}
+	return result;
+}
+
+#pragma endregion
+
+} // namespace saber::geometry
+
+#endif // SABER_GEOMETRY_PARALLEL_HPP
@@ -0,0 +1,226 @@
+#ifndef SABER_GEOMETRY_PIXELS_HPP
+#define SABER_GEOMETRY_PIXELS_HPP
+
+// saber
+#include "saber/exception.hpp"
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/point.hpp"
+#include "saber/geometry/rectangle.hpp"
+#include "saber/geometry/detail/pixel_helper.hpp"
+
+// std
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace saber::geometry {
+
+// ------------------------------------------------------------------
+#pragma region class PixelBuffer<>
+
+/// @brief Non-owning view of a 2D image: `Height()` rows of `Width()` pixels, each pixel
+/// `NChannels` consecutive elements of type`<T>` (e.g. `PixelBuffer<std::uint8_t, 4>` for RGBA8).
+/// Rows start `Stride()` elements apart, so a `PixelBuffer` may view a sub-image of a larger one.
+/// @tparam T Type of pixel channel elements; `const T` for a read only view
+/// @tparam NChannels Number of elements per pixel
+template<typename T, std::size_t NChannels = 1>
+class PixelBuffer
+{
+public:
+	using ValueType = T;
+	static constexpr std::size_t kChannels = NChannels;
+
+	static_assert(NChannels > 0, "PixelBuffer requires at least one channel per pixel");
+	static_assert(std::is_trivially_copyable_v<T>, "PixelBuffer requires trivially copyable pixel channels");
+
+public:
+	/// @brief Default constructor. Views an empty (0 x 0) image.
+	constexpr PixelBuffer() = default;
+
+	/// @brief Views an image whose rows are tightly packed (`Stride() == inWidth * NChannels`).
+	/// @param inPixels Address of the first channel of the top left pixel
+	/// @param inWidth Number of pixels per row
+	/// @param inHeight Number of rows
+	constexpr PixelBuffer(T* inPixels, int inWidth, int inHeight);
+
+	/// @brief Views an image whose rows start `inStride` elements apart.
+	/// @param inPixels Address of the first channel of the top left pixel
+	/// @param inWidth Number of pixels per row
+	/// @param inHeight Number of rows
+	/// @param inStride Distance between rows, in elements of type`<T>`; at least `inWidth * NChannels`
+	constexpr PixelBuffer(T* inPixels, int inWidth, int inHeight, std::ptrdiff_t inStride);
+
+	/// @brief Converting constructor: a read only view of a writable `PixelBuffer`.
+	template<typename U, typename = std::enable_if_t<std::is_same_v<const U, T> && !std::is_same_v<U, T>>>
+	constexpr PixelBuffer(const PixelBuffer<U, NChannels>& inBuffer);
+
+	// Getters
+
+	/// @brief Gets the address of the first channel of the leftmost pixel of row `inY`.
+	/// @param inY Row index, in [0, Height())
+	constexpr T* Row(int inY) const;
+
+	/// @brief Gets the number of pixels per row.
+	constexpr int Width() const;
+
+	/// @brief Gets the number of rows.
+	constexpr int Height() const;
+
+	/// @brief Gets the distance between rows, in elements of type`<T>`.
+	constexpr std::ptrdiff_t Stride() const;
+
+	/// @brief Gets the rectangle of all pixels: {0, 0, Width(), Height()}.
+	template<ImplKind Impl = ImplKind::kDefault>
+	constexpr Rectangle<int, Impl> Bounds() const;
+
+private:
+	T* mPixels = nullptr;
+	int mWidth = 0;
+	int mHeight = 0;
+	std::ptrdiff_t mStride = 0;
+}; // class PixelBuffer<>
+
+template<typename T, std::size_t NChannels>
+inline constexpr PixelBuffer<T, NChannels>::PixelBuffer(T* inPixels, int inWidth, int inHeight) :
+	PixelBuffer{inPixels, inWidth, inHeight, static_cast<std::ptrdiff_t>(inWidth) * static_cast<std::ptrdiff_t>(NChannels)}
+{
+	// Do nothing
+}
+
+template<typename T, std::size_t NChannels>
+inline constexpr PixelBuffer<T, NChannels>::PixelBuffer(T* inPixels, int inWidth, int inHeight, std::ptrdiff_t inStride) :
+	mPixels{inPixels},
+	mWidth{inWidth},
+	mHeight{inHeight},
+	mStride{inStride}
+{
+	SABER_REQUIRE(inWidth >= 0 && inHeight >= 0);
+	SABER_REQUIRE(inStride >= static_cast<std::ptrdiff_t>(inWidth) * static_cast<std::ptrdiff_t>(NChannels));
+	SABER_REQUIRE(inPixels != nullptr || inWidth == 0 || inHeight == 0);
+}
+
+template<typename T, std::size_t NChannels>
+template<typename U, typename>
+inline constexpr PixelBuffer<T, NChannels>::PixelBuffer(const PixelBuffer<U, NChannels>& inBuffer) :
+	mPixels{inBuffer.Row(0)},
+	mWidth{inBuffer.Width()},
+	mHeight{inBuffer.Height()},
+	mStride{inBuffer.Stride()}
+{
+	// Do nothing
+}
+
+template<typename T, std::size_t NChannels>
+inline constexpr T* PixelBuffer<T, NChannels>::Row(int inY) const
+{
+	return mPixels + static_cast<std::ptrdiff_t>(inY) * mStride;
+}
+
+template<typename T, std::size_t NChannels>
+inline constexpr int PixelBuffer<T, NChannels>::Width() const
+{
+	return mWidth;
+}
+
+template<typename T, std::size_t NChannels>
+inline constexpr int PixelBuffer<T, NChannels>::Height() const
+{
+	return mHeight;
+}
+
+template<typename T, std::size_t NChannels>
+inline constexpr std::ptrdiff_t PixelBuffer<T, NChannels>::Stride() const
+{
+	return mStride;
+}
+
+template<typename T, std::size_t NChannels>
+template<ImplKind Impl>
+inline constexpr Rectangle<int, Impl> PixelBuffer<T, NChannels>::Bounds() const
+{
+	return Rectangle<int, Impl>{0, 0, mWidth, mHeight};
+}
+
+#pragma endregion
+
+// ------------------------------------------------------------------
+#pragma region Fill()/Blit()
+
+/// @brief Set every pixel of `outBuffer` inside `inRectangle` to `inPixel`.
+/// `inRectangle` is first clipped to `outBuffer.Bounds()`, so no pixel outside
+/// of either is touched. With `ImplKind::kSimd`, each row is filled with whole
+/// (unaligned) 128bit vector stores of the repeated pixel.
+/// @tparam T Type of pixel channel elements
+/// @tparam NChannels Number of elements per pixel
+/// @tparam Impl Implementation kind (scalar or simd), from `inRectangle`
+/// @param outBuffer Image to fill
+/// @param inRectangle Pixels to fill; may extend outside of `outBuffer`
+/// @param inPixel Channel values of the fill pixel
+/// @return The clipped rectangle of pixels actually filled; may be empty
+template<typename T, std::size_t NChannels, ImplKind Impl>
+inline Rectangle<int, Impl> Fill(const PixelBuffer<T, NChannels>& outBuffer, const Rectangle<int, Impl>& inRectangle, const std::array<T, NChannels>& inPixel)
+{
+	const auto clip = Intersect(inRectangle, outBuffer.template Bounds<Impl>());
+	if (IsEmpty(clip))
+	{
+		return Rectangle<int, Impl>{};
+	}
+
+	const auto left = static_cast<std::ptrdiff_t>(clip.X()) * static_cast<std::ptrdiff_t>(NChannels);
+	const auto width = static_cast<std::size_t>(clip.Width());
+	for (int y = clip.Y(); y < clip.Y() + clip.Height(); ++y)
+	{
+		detail::PixelHelper<T, NChannels, Impl>::FillRow(outBuffer.Row(y) + left, width, inPixel);
+	}
+	return clip;
+}
+
+/// @brief Copy the pixels of `inSource` inside `inSourceRect` to `outBuffer`, placing
+/// the top left pixel of `inSourceRect` at `inOrigin`. The copy is clipped to both
+/// `inSource.Bounds()` and `outBuffer.Bounds()`, so no pixel outside of either is touched.
+/// `inSource` and `outBuffer` must not overlap.
+/// @tparam T Type of pixel channel elements
+/// @tparam U Type of source pixel channel elements: `T` or `const T`
+/// @tparam NChannels Number of elements per pixel
+/// @tparam Impl Implementation kind (scalar or simd), from `inOrigin` and `inSourceRect`
+/// @param outBuffer Destination image
+/// @param inOrigin Destination of the top left pixel of `inSourceRect`; may be outside of `outBuffer`
+/// @param inSource Source image
+/// @param inSourceRect Source pixels to copy; may extend outside of `inSource`
+/// @return The clipped rectangle of destination pixels actually written; may be empty
+template<typename T, typename U, std::size_t NChannels, ImplKind Impl>
+inline Rectangle<int, Impl> Blit(const PixelBuffer<T, NChannels>& outBuffer, const Point<int, Impl>& inOrigin,
+	const PixelBuffer<U, NChannels>& inSource, const Rectangle<int, Impl>& inSourceRect)
+{
+	static_assert(std::is_same_v<std::remove_const_t<U>, T>, "Blit() requires source and destination of the same pixel type");
+
+	// Clip to the source, then translate to the destination and clip to it too
+	const auto source = Intersect(inSourceRect, inSource.template Bounds<Impl>());
+	auto clip = source;
+	clip.Translate(Point<int, Impl>{inOrigin.X() - inSourceRect.X(), inOrigin.Y() - inSourceRect.Y()});
+	clip.Intersect(outBuffer.template Bounds<Impl>());
+	if (IsEmpty(source) || IsEmpty(clip))
+	{
+		return Rectangle<int, Impl>{};
+	}
+
+	// Source pixel of the (clipped) destination's top left pixel
+	const int sourceX = clip.X() - inOrigin.X() + inSourceRect.X();
+	const int sourceY = clip.Y() - inOrigin.Y() + inSourceRect.Y();
+
+	const auto channels = static_cast<std::ptrdiff_t>(NChannels);
+	const auto width = static_cast<std::size_t>(clip.Width());
+	for (int y = 0; y < clip.Height(); ++y)
+	{
+		T* dst = outBuffer.Row(clip.Y() + y) + clip.X() * channels;
+		const T* src = inSource.Row(sourceY + y) + sourceX * channels;
+		detail::PixelHelper<T, NChannels, Impl>::CopyRow(dst, src, width);
+	}
+	return clip;
+}
+
+#pragma endregion
+
+} // namespace saber::geometry
+
+#endif // SABER_GEOMETRY_PIXELS_HPP
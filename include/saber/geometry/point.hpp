@@ -7,6 +7,7 @@
 #include "saber/geometry/detail/impl2.hpp"
 
 // std
+#include <cstddef>
 #include <utility>
 
 namespace saber::geometry {
@@ -15,9 +16,18 @@ namespace saber::geometry {
 template<typename T, ImplKind Impl>
 class Matrix;
 
+template<typename T, ImplKind Impl>
+class Matrix3;
+
+template<typename T, ImplKind Impl>
+class Matrix4;
+
 template<typename T, ImplKind Impl>
 class Rectangle;
 
+template<typename T, ImplKind Impl>
+class RectangleLTRB;
+
 /// @brief 
 /// @tparam T 
 /// @tparam ImplType 
@@ -112,6 +122,19 @@ public:
 	template<typename U=T, typename SFINAE = std::enable_if_t<std::is_floating_point_v<U>>>
 	constexpr Point& RoundTrunc();
 
+	// --- Conversion ---
+
+	/// @brief Convert an array of `Point<FromT>` to this `Point<T>` type; such as float layout coordinates to integer pixel coordinates.
+	/// Floating point to integer conversions fuse rounding (and optional saturation) into the conversion itself.
+	/// @tparam Round Rounding applied to floating point to integer conversions
+	/// @tparam Overflow Out of range handling of floating point to integer conversions
+	/// @tparam FromT Underlying type of the source `Point<>`
+	/// @param inPoints Pointer to `inCount` points to convert
+	/// @param outPoints Pointer to `inCount` points receiving the converted result
+	/// @param inCount Number of points
+	template<RoundKind Round = RoundKind::kNearest, OverflowKind Overflow = OverflowKind::kUnchecked, typename FromT>
+	static void ConvertFrom(const Point<FromT, Impl>* inPoints, Point* outPoints, std::size_t inCount);
+
     /// @brief Translate this point by another point (component-wise)
     /// @param inTranslate Point to translate by
     /// @return Reference to this point
@@ -140,6 +163,11 @@ public:
 	/// @return Reference to this point
 	constexpr Point& Scale(T inXY);
 
+	/// @brief Divide both coordinates by the same prepared divisor
+	/// @param inDivisor Divisor prepared once, for many points (integer division without `idiv`)
+	/// @return Reference to this point
+	constexpr Point& DivBy(const Divisor<T>& inDivisor);
+
 private:
 	// Private APIs
 	constexpr bool IsEqual(const Point& inPoint) const;
@@ -149,7 +177,13 @@ private:
     friend constexpr bool operator==<>(const Point& inLHS, const Point& inRHS);
     friend constexpr bool operator!=<>(const Point& inLHS, const Point& inRHS);
 	friend class Matrix<T, Impl>;
+	friend class Matrix3<T, Impl>;
+	friend class Matrix4<T, Impl>;
     friend class Rectangle<T, Impl>;
+    friend class RectangleLTRB<T, Impl>;
+
+	template<typename U, ImplKind I>
+	friend class Point; // Permit ConvertFrom() access to other `Point<U>` types
 
 private:
     using ImplType = typename detail::Impl2Traits<T, Impl>::ImplType; // VOODOO: Nested template type requires `typename` prefix
@@ -264,6 +298,22 @@ inline constexpr Point<T, Impl>& Point<T, Impl>::RoundTrunc()
 	return *this;
 }
 
+template<typename T, ImplKind Impl>
+template<RoundKind Round, OverflowKind Overflow, typename FromT>
+inline void Point<T, Impl>::ConvertFrom(const Point<FromT, Impl>* inPoints, Point* outPoints, std::size_t inCount)
+{
+	// Two at a time (e.g., 2x 2 floats fill one 128bit conversion); then the odd one out, if any
+	std::size_t i = 0;
+	for (; i + 2 <= inCount; i += 2)
+	{
+		ImplType::template ConvertFrom2<Round, Overflow, FromT>(inPoints[i].mImpl, inPoints[i + 1].mImpl, outPoints[i].mImpl, outPoints[i + 1].mImpl);
+	}
+	if (i < inCount)
+	{
+		outPoints[i].mImpl.template ConvertFrom<Round, Overflow, FromT>(inPoints[i].mImpl);
+	}
+}
+
 // Mutators
 template<typename T, ImplKind Impl>
 inline constexpr Point<T, Impl>& Point<T, Impl>::Translate(const Point<T, Impl>& inTranslate)
@@ -305,6 +355,13 @@ inline constexpr Point<T, Impl>& Point<T, Impl>::Scale(T inXY)
 	return Scale(inXY, inXY);
 }
 
+template<typename T, ImplKind Impl>
+inline constexpr Point<T, Impl>& Point<T, Impl>::DivBy(const Divisor<T>& inDivisor)
+{
+	mImpl.DivBy(inDivisor);
+	return *this;
+}
+
 #pragma endregion
 
 // ------------------------------------------------------------------
@@ -352,6 +409,14 @@ inline constexpr Point<T, Impl> Scale(const Point<T, Impl>& inPoint, T inXY)
     return Scale(inPoint, inXY, inXY);
 }
 
+template<typename T, ImplKind Impl>
+inline constexpr Point<T, Impl> DivBy(const Point<T, Impl>& inPoint, const Divisor<T>& inDivisor)
+{
+    Point<T, Impl> result{inPoint};
+	result.DivBy(inDivisor);
+	return result;
+}
+
 /// @brief Round to nearest even integer value. Halfway cases round away from zero.
 /// @tparam T: Underlying `Point<>` type
 /// @tparam ImplType: Optional underlying implementation type
@@ -10,6 +10,8 @@
 #include "saber/geometry/utility.hpp"
 
 // std
+#include <array>
+#include <cstddef>
 #include <utility>
 
 namespace saber::geometry {
@@ -169,6 +171,11 @@ public:
 	/// @return Reference to this rectangle.
 	constexpr Rectangle& Scale(T inXY);
 
+	/// @brief Divides the rectangle's origin and size by the same prepared divisor.
+	/// @param inDivisor Divisor prepared once, for many rectangles (integer division without `idiv`).
+	/// @return Reference to this rectangle.
+	constexpr Rectangle& DivBy(const Divisor<T>& inDivisor);
+
 	/// @brief Unions this rectangle with another.
 	/// @param inRectangle The rectangle to union with.
 	/// @return Reference to this rectangle.
@@ -189,6 +196,35 @@ public:
 	/// @return True if this rectangle overlaps the other, false otherwise.
 	constexpr bool IsOverlapping(const Rectangle& inRectangle) const;
 
+	/// @brief Checks if given rectangle lies entirely within this rectangle; edges may touch.
+	/// @param inRectangle The rectangle to check.
+	/// @return True if this rectangle contains the other, false otherwise.
+	constexpr bool Contains(const Rectangle& inRectangle) const;
+
+	/// @brief Hit test one point against an array of rectangles at once, without branching on each rectangle.
+	/// With `ImplKind::kSimd`, a whole vector of rectangles (4x 32bit or 2x 64bit lanes) is tested per step.
+	/// @tparam N Number of rectangles (e.g. 4 or 8); at most 31
+	/// @param inRectangles The rectangles to test against.
+	/// @param inPoint The point to check.
+	/// @return Bitmask of hits: bit i set if `inRectangles[i].IsOverlapping(inPoint)`
+	template<std::size_t N>
+	static int HitMask(const std::array<Rectangle, N>& inRectangles, const Point<T, Impl>& inPoint);
+
+	/// @brief Union of an array of rectangles: same as `Union()`ing them one by one, but converts
+	/// between origin+size and edges once rather than twice per rectangle. With `ImplKind::kSimd`,
+	/// the running edges stay in vector registers.
+	/// @param inRectangles Pointer to `inCount` rectangles
+	/// @param inCount Number of rectangles
+	/// @return The minimal rectangle containing every rectangle; empty when `inCount` is 0
+	static Rectangle UnionAll(const Rectangle* inRectangles, std::size_t inCount);
+
+	/// @brief Bounding box of an array of points: from the minimum to the maximum x and y.
+	/// With `ImplKind::kSimd`, the running minimums and maximums stay in vector registers.
+	/// @param inPoints Pointer to `inCount` points
+	/// @param inCount Number of points
+	/// @return The bounding box; empty when `inCount` is 0
+	static Rectangle BoundingBox(const Point<T, Impl>* inPoints, std::size_t inCount);
+
 	// --- Rounding ---
 
 	/// @brief Round this rectangle to nearest integer value; both origin and scale. Halfway cases round away from zero. Compatible with std::round().
@@ -219,6 +255,19 @@ public:
 	template<typename U = T, typename SFINAE = std::enable_if_t<std::is_floating_point_v<U>>>
 	constexpr Rectangle& RoundTrunc();
 
+	// --- Conversion ---
+
+	/// @brief Convert an array of `Rectangle<FromT>` to this `Rectangle<T>` type; such as float layout rectangles to integer pixel rectangles.
+	/// Floating point to integer conversions fuse rounding (and optional saturation) into the conversion itself.
+	/// @tparam Round Rounding applied to floating point to integer conversions
+	/// @tparam Overflow Out of range handling of floating point to integer conversions
+	/// @tparam FromT Underlying type of the source `Rectangle<>`
+	/// @param inRectangles Pointer to `inCount` rectangles to convert
+	/// @param outRectangles Pointer to `inCount` rectangles receiving the converted result
+	/// @param inCount Number of rectangles
+	template<RoundKind Round = RoundKind::kNearest, OverflowKind Overflow = OverflowKind::kUnchecked, typename FromT>
+	static void ConvertFrom(const Rectangle<FromT, Impl>* inRectangles, Rectangle* outRectangles, std::size_t inCount);
+
 private:
 	// Private APIs
 
@@ -235,6 +284,9 @@ private:
 	template<typename T, ImplKind Impl>
 	friend constexpr bool IsEmpty(const Rectangle<T, Impl>& inRectangle);
 
+	template<typename U, ImplKind I>
+	friend class Rectangle; // Permit ConvertFrom() access to other `Rectangle<U>` types
+
 private:
 	using ImplType = typename detail::Impl4Traits<T, Impl>::ImplType; // VOODOO: Nested template type requires `typename` prefix
 	ImplType mImpl{};
@@ -413,6 +465,13 @@ inline constexpr Rectangle<T, Impl>& Rectangle<T, Impl>::Scale(T inXY)
 	return *this;
 }
 
+template<typename T, ImplKind Impl>
+inline constexpr Rectangle<T, Impl>& Rectangle<T, Impl>::DivBy(const Divisor<T>& inDivisor)
+{
+	mImpl.DivBy(inDivisor);
+	return *this;
+}
+
 template<typename T, ImplKind Impl>
 inline constexpr Rectangle<T, Impl>& Rectangle<T, Impl>::Union(const Rectangle& inRectangle)
 {
@@ -441,6 +500,48 @@ inline constexpr bool Rectangle<T, Impl>::IsOverlapping(const Rectangle& inRecta
 	return isOverlapping;
 }
 
+template<typename T, ImplKind Impl>
+inline constexpr bool Rectangle<T, Impl>::Contains(const Rectangle& inRectangle) const
+{
+	const bool isContained = mImpl.Contains(inRectangle.mImpl);
+	return isContained;
+}
+
+template<typename T, ImplKind Impl>
+template<std::size_t N>
+inline int Rectangle<T, Impl>::HitMask(const std::array<Rectangle, N>& inRectangles, const Point<T, Impl>& inPoint)
+{
+	std::array<const ImplType*, N> impls{};
+	for (std::size_t i = 0; i < N; ++i)
+	{
+		impls[i] = &inRectangles[i].mImpl;
+	}
+	const int hitMask = ImplType::template HitMask<N>(impls, inPoint.mImpl);
+	return hitMask;
+}
+
+template<typename T, ImplKind Impl>
+inline Rectangle<T, Impl> Rectangle<T, Impl>::UnionAll(const Rectangle* inRectangles, std::size_t inCount)
+{
+	Rectangle result{};
+	result.mImpl = ImplType::UnionAll(inCount, [inRectangles](std::size_t i) -> const ImplType&
+	{
+		return inRectangles[i].mImpl;
+	});
+	return result;
+}
+
+template<typename T, ImplKind Impl>
+inline Rectangle<T, Impl> Rectangle<T, Impl>::BoundingBox(const Point<T, Impl>* inPoints, std::size_t inCount)
+{
+	Rectangle result{};
+	result.mImpl = ImplType::BoundingBox(inCount, [inPoints](std::size_t i) -> const auto&
+	{
+		return inPoints[i].mImpl;
+	});
+	return result;
+}
+
 #pragma endregion
 
 template<typename T, ImplKind Impl>
@@ -485,6 +586,16 @@ inline constexpr Rectangle<T, Impl>& Rectangle<T, Impl>::RoundTrunc()
 	return *this;
 }
 
+template<typename T, ImplKind Impl>
+template<RoundKind Round, OverflowKind Overflow, typename FromT>
+inline void Rectangle<T, Impl>::ConvertFrom(const Rectangle<FromT, Impl>* inRectangles, Rectangle* outRectangles, std::size_t inCount)
+{
+	for (std::size_t i = 0; i < inCount; ++i)
+	{
+		outRectangles[i].mImpl.template ConvertFrom<Round, Overflow, FromT>(inRectangles[i].mImpl);
+	}
+}
+
 #pragma endregion
 
 #pragma region Free Functions
@@ -653,6 +764,16 @@ inline constexpr Rectangle<T, Impl> Scale(const Rectangle<T, Impl>& inRectangle,
 	return result.Scale(inXY);
 }
 
+/// @brief Divides the rectangle's origin and size by the same prepared divisor.
+/// @param inDivisor Divisor prepared once, for many rectangles.
+/// @return Divided rectangle.
+template<typename T, ImplKind Impl>
+inline constexpr Rectangle<T, Impl> DivBy(const Rectangle<T, Impl>& inRectangle, const Divisor<T>& inDivisor)
+{
+	auto result{inRectangle};
+	return result.DivBy(inDivisor);
+}
+
 /// @brief Compute the union of two rectangles and return the resulting rectangle.
 /// @tparam T Underlying coordinate type
 /// @tparam Impl Optional implementation kind (scalar or simd)
@@ -718,6 +839,59 @@ inline constexpr bool IsOverlapping(const Rectangle<T, Impl>& inLHS, const Recta
 	return isOverlapping;
 }
 
+/// @brief Test whether a rectangle lies entirely within another; edges may touch.
+/// @tparam T Underlying coordinate type
+/// @tparam Impl Optional implementation kind (scalar or simd)
+/// @param inOuter Containing rectangle
+/// @param inInner Contained rectangle
+/// @return true when `inInner` lies within `inOuter`, false otherwise
+template<typename T, ImplKind Impl>
+inline constexpr bool Contains(const Rectangle<T, Impl>& inOuter, const Rectangle<T, Impl>& inInner)
+{
+	const auto isContained = inOuter.Contains(inInner);
+	return isContained;
+}
+
+/// @brief Hit test one point against an array of rectangles at once (e.g. 4 or 8 widget bounds).
+/// @tparam T Underlying coordinate type
+/// @tparam Impl Optional implementation kind (scalar or simd)
+/// @tparam N Number of rectangles; at most 31
+/// @param inRectangles Rectangles to test against
+/// @param inPoint Point to check
+/// @return Bitmask of hits: bit i set when the point is inside `inRectangles[i]`
+template<typename T, ImplKind Impl, std::size_t N>
+inline int HitMask(const std::array<Rectangle<T, Impl>, N>& inRectangles, const Point<T, Impl>& inPoint)
+{
+	const auto hitMask = Rectangle<T, Impl>::HitMask(inRectangles, inPoint);
+	return hitMask;
+}
+
+/// @brief Compute the union of an array of rectangles, converting between origin+size and edges only once.
+/// @tparam T Underlying coordinate type
+/// @tparam Impl Optional implementation kind (scalar or simd)
+/// @param inRectangles Pointer to `inCount` rectangles
+/// @param inCount Number of rectangles
+/// @return Rectangle containing every rectangle; empty when `inCount` is 0
+template<typename T, ImplKind Impl>
+inline Rectangle<T, Impl> UnionAll(const Rectangle<T, Impl>* inRectangles, std::size_t inCount)
+{
+	const auto result = Rectangle<T, Impl>::UnionAll(inRectangles, inCount);
+	return result;
+}
+
+/// @brief Compute the bounding box of an array of points.
+/// @tparam T Underlying coordinate type
+/// @tparam Impl Optional implementation kind (scalar or simd)
+/// @param inPoints Pointer to `inCount` points
+/// @param inCount Number of points
+/// @return Rectangle from the minimum to the maximum x and y; empty when `inCount` is 0
+template<typename T, ImplKind Impl>
+inline Rectangle<T, Impl> BoundingBox(const Point<T, Impl>* inPoints, std::size_t inCount)
+{
+	const auto result = Rectangle<T, Impl>::BoundingBox(inPoints, inCount);
+	return result;
+}
+
 #pragma endregion
 #pragma endregion
 
@@ -0,0 +1,429 @@
+#ifndef SABER_GEOMETRY_RECTANGLE_LTRB_HPP
+#define SABER_GEOMETRY_RECTANGLE_LTRB_HPP
+
+// saber
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/operators.hpp"
+#include "saber/geometry/point.hpp"
+#include "saber/geometry/rectangle.hpp"
+#include "saber/geometry/detail/impl4_ltrb.hpp"
+
+// std
+#include <cstddef>
+
+namespace saber::geometry {
+
+/// @brief Represents a rectangle in 2D space by its edges: left, top, right and bottom.
+/// Same rectangle as `Rectangle<>` (which stores origin and size), but stored the way union,
+/// intersection and overlap tests use it; so chains of these (e.g. clip rectangle stacks) need
+/// no conversion per operation. Convert to and from `Rectangle<>` at the ends of such chains.
+/// @tparam T The type of the rectangle's coordinates (e.g., int, float).
+/// @tparam Impl The implementation kind (e.g., scalar or SIMD).
+template<typename T, ImplKind Impl = ImplKind::kDefault>
+class RectangleLTRB
+{
+public:
+	using ValueType = T;
+
+public:
+	/// @brief Default constructor. Initializes an empty rectangle at the origin.
+	constexpr RectangleLTRB() = default;
+
+	/// @brief Constructs a rectangle from its edges.
+	/// @param inLeft The x-coordinate of the left edge.
+	/// @param inTop The y-coordinate of the top edge.
+	/// @param inRight The x-coordinate of the right edge.
+	/// @param inBottom The y-coordinate of the bottom edge.
+	constexpr RectangleLTRB(T inLeft, T inTop, T inRight, T inBottom);
+
+	/// @brief Constructs a rectangle from its left/top and right/bottom corners.
+	/// @param inLeftTop The left/top corner.
+	/// @param inRightBottom The right/bottom corner.
+	constexpr RectangleLTRB(const Point<T, Impl>& inLeftTop, const Point<T, Impl>& inRightBottom);
+
+	/// @brief Constructs a rectangle from an origin+size rectangle.
+	/// @param inRectangle The rectangle to convert.
+	constexpr explicit RectangleLTRB(const Rectangle<T, Impl>& inRectangle);
+
+	/// @brief Destructor.
+	~RectangleLTRB() = default;
+
+	/// @brief Move constructor.
+	constexpr RectangleLTRB(RectangleLTRB&& ioMove) noexcept = default;
+
+	/// @brief Move assignment operator.
+	constexpr RectangleLTRB& operator=(RectangleLTRB&& ioMove) noexcept = default;
+
+	/// @brief Copy constructor.
+	constexpr RectangleLTRB(const RectangleLTRB& inCopy) = default;
+
+	/// @brief Copy assignment operator.
+	constexpr RectangleLTRB& operator=(const RectangleLTRB& inCopy) = default;
+
+	// Getters
+
+	/// @brief Gets the x-coordinate of the left edge.
+	constexpr T Left() const;
+
+	/// @brief Gets the y-coordinate of the top edge.
+	constexpr T Top() const;
+
+	/// @brief Gets the x-coordinate of the right edge.
+	constexpr T Right() const;
+
+	/// @brief Gets the y-coordinate of the bottom edge.
+	constexpr T Bottom() const;
+
+	/// @brief Gets the width of the rectangle: right - left.
+	constexpr T Width() const;
+
+	/// @brief Gets the height of the rectangle: bottom - top.
+	constexpr T Height() const;
+
+	/// @brief Gets the left/top corner of the rectangle.
+	constexpr Point<T, Impl> LeftTop() const;
+
+	/// @brief Gets the right/bottom corner of the rectangle.
+	constexpr Point<T, Impl> RightBottom() const;
+
+	// Setters
+
+	/// @brief Sets the x-coordinate of the left edge; the right edge does not move.
+	constexpr void Left(T inLeft);
+
+	/// @brief Sets the y-coordinate of the top edge; the bottom edge does not move.
+	constexpr void Top(T inTop);
+
+	/// @brief Sets the x-coordinate of the right edge.
+	constexpr void Right(T inRight);
+
+	/// @brief Sets the y-coordinate of the bottom edge.
+	constexpr void Bottom(T inBottom);
+
+	// Conversion
+
+	/// @brief Converts this rectangle to an origin+size rectangle.
+	/// @return The equivalent `Rectangle<>`.
+	constexpr Rectangle<T, Impl> ToRectangle() const;
+
+	// Mutators
+
+	/// @brief Translates the rectangle by a point offset.
+	/// @param inPoint The point by which to translate.
+	/// @return Reference to this rectangle.
+	constexpr RectangleLTRB& Translate(const Point<T, Impl>& inPoint);
+
+	/// @brief Translates the rectangle by x and y offsets.
+	/// @param inX The x offset.
+	/// @param inY The y offset.
+	/// @return Reference to this rectangle.
+	constexpr RectangleLTRB& Translate(T inX, T inY);
+
+	/// @brief Unions this rectangle with another.
+	/// @param inRectangle The rectangle to union with.
+	/// @return Reference to this rectangle.
+	constexpr RectangleLTRB& Union(const RectangleLTRB& inRectangle);
+
+	/// @brief Intersects this rectangle with another. An empty intersection keeps
+	/// zero (never negative) width and height, as `Rectangle<>::Intersect()`.
+	/// @param inRectangle The rectangle to intersect with.
+	/// @return Reference to this rectangle.
+	constexpr RectangleLTRB& Intersect(const RectangleLTRB& inRectangle);
+
+	/// @brief Checks if given point overlaps this rectangle.
+	/// @param inPoint The point to check.
+	/// @return True if the rectangle overlaps the point, false otherwise.
+	constexpr bool IsOverlapping(const Point<T, Impl>& inPoint) const;
+
+	/// @brief Checks if given rectangle overlaps this rectangle.
+	/// @param inRectangle The rectangle to check.
+	/// @return True if this rectangle overlaps the other, false otherwise.
+	constexpr bool IsOverlapping(const RectangleLTRB& inRectangle) const;
+
+	/// @brief Checks if given rectangle lies entirely within this rectangle; edges may touch.
+	/// @param inRectangle The rectangle to check.
+	/// @return True if this rectangle contains the other, false otherwise.
+	constexpr bool Contains(const RectangleLTRB& inRectangle) const;
+
+private:
+	// Private APIs
+
+	/// @brief Checks if this rectangle is equal to another.
+	/// @param inRectangle The rectangle to compare with.
+	/// @return True if equal, false otherwise.
+	constexpr bool IsEqual(const RectangleLTRB& inRectangle) const;
+
+	// Friend functions
+private:
+	friend constexpr bool operator==<>(const RectangleLTRB& inLHS, const RectangleLTRB& inRHS);
+	friend constexpr bool operator!=<>(const RectangleLTRB& inLHS, const RectangleLTRB& inRHS);
+
+	template<typename U, ImplKind I>
+	friend constexpr bool IsEmpty(const RectangleLTRB<U, I>& inRectangle);
+
+private:
+	using ImplType = typename detail::Impl4LTRBTraits<T, Impl>::ImplType; // VOODOO: Nested template type requires `typename` prefix
+	ImplType mImpl{};
+}; // class RectangleLTRB<>
+
+// ------------------------------------------------------------------
+#pragma region Inline Class Functions
+
+// Ctors
+template<typename T, ImplKind Impl>
+inline constexpr RectangleLTRB<T, Impl>::RectangleLTRB(T inLeft, T inTop, T inRight, T inBottom) : mImpl{inLeft, inTop, inRight, inBottom}
+{
+	// Do nothing
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr RectangleLTRB<T, Impl>::RectangleLTRB(const Point<T, Impl>& inLeftTop, const Point<T, Impl>& inRightBottom) :
+	mImpl{inLeftTop.X(), inLeftTop.Y(), inRightBottom.X(), inRightBottom.Y()}
+{
+	// Do nothing
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr RectangleLTRB<T, Impl>::RectangleLTRB(const Rectangle<T, Impl>& inRectangle) :
+	mImpl{ImplType::FromXYWH(typename detail::Impl4Traits<T, Impl>::ImplType{inRectangle.X(), inRectangle.Y(), inRectangle.Width(), inRectangle.Height()})}
+{
+	// Do nothing
+}
+
+// Getters
+template<typename T, ImplKind Impl>
+inline constexpr T RectangleLTRB<T, Impl>::Left() const
+{
+	return mImpl.template Get<0>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T RectangleLTRB<T, Impl>::Top() const
+{
+	return mImpl.template Get<1>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T RectangleLTRB<T, Impl>::Right() const
+{
+	return mImpl.template Get<2>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T RectangleLTRB<T, Impl>::Bottom() const
+{
+	return mImpl.template Get<3>();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T RectangleLTRB<T, Impl>::Width() const
+{
+	return Right() - Left();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr T RectangleLTRB<T, Impl>::Height() const
+{
+	return Bottom() - Top();
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Point<T, Impl> RectangleLTRB<T, Impl>::LeftTop() const
+{
+	return Point<T, Impl>{Left(), Top()};
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr Point<T, Impl> RectangleLTRB<T, Impl>::RightBottom() const
+{
+	return Point<T, Impl>{Right(), Bottom()};
+}
+
+// Setters
+template<typename T, ImplKind Impl>
+inline constexpr void RectangleLTRB<T, Impl>::Left(T inLeft)
+{
+	mImpl.template Get<0>() = inLeft;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void RectangleLTRB<T, Impl>::Top(T inTop)
+{
+	mImpl.template Get<1>() = inTop;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void RectangleLTRB<T, Impl>::Right(T inRight)
+{
+	mImpl.template Get<2>() = inRight;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr void RectangleLTRB<T, Impl>::Bottom(T inBottom)
+{
+	mImpl.template Get<3>() = inBottom;
+}
+
+// Conversion
+template<typename T, ImplKind Impl>
+inline constexpr Rectangle<T, Impl> RectangleLTRB<T, Impl>::ToRectangle() const
+{
+	const auto xywh = mImpl.ToXYWH();
+	return Rectangle<T, Impl>{xywh.template Get<0>(), xywh.template Get<1>(), xywh.template Get<2>(), xywh.template Get<3>()};
+}
+
+// Mutators
+template<typename T, ImplKind Impl>
+inline constexpr RectangleLTRB<T, Impl>& RectangleLTRB<T, Impl>::Translate(const Point<T, Impl>& inPoint)
+{
+	mImpl.Translate(inPoint.mImpl);
+	return *this;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr RectangleLTRB<T, Impl>& RectangleLTRB<T, Impl>::Translate(T inX, T inY)
+{
+	mImpl.Translate(Point<T, Impl>{inX, inY}.mImpl);
+	return *this;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr RectangleLTRB<T, Impl>& RectangleLTRB<T, Impl>::Union(const RectangleLTRB& inRectangle)
+{
+	mImpl.Union(inRectangle.mImpl);
+	return *this;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr RectangleLTRB<T, Impl>& RectangleLTRB<T, Impl>::Intersect(const RectangleLTRB& inRectangle)
+{
+	mImpl.Intersect(inRectangle.mImpl);
+	return *this;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr bool RectangleLTRB<T, Impl>::IsOverlapping(const Point<T, Impl>& inPoint) const
+{
+	const bool isOverlapping = mImpl.IsOverlapping(inPoint.mImpl);
+	return isOverlapping;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr bool RectangleLTRB<T, Impl>::IsOverlapping(const RectangleLTRB& inRectangle) const
+{
+	const bool isOverlapping = mImpl.IsOverlapping(inRectangle.mImpl);
+	return isOverlapping;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr bool RectangleLTRB<T, Impl>::Contains(const RectangleLTRB& inRectangle) const
+{
+	const bool isContained = mImpl.Contains(inRectangle.mImpl);
+	return isContained;
+}
+
+template<typename T, ImplKind Impl>
+inline constexpr bool RectangleLTRB<T, Impl>::IsEqual(const RectangleLTRB& inRectangle) const
+{
+	auto result = mImpl.IsEqual(inRectangle.mImpl);
+	return result;
+}
+
+#pragma endregion
+
+// ------------------------------------------------------------------
+#pragma region Free Functions
+
+/// @brief Translates the rectangle by a point offset.
+/// @param inRectangle The rectangle to translate.
+/// @param inPoint The point by which to translate.
+/// @return Translated rectangle.
+template<typename T, ImplKind Impl>
+inline constexpr RectangleLTRB<T, Impl> Translate(const RectangleLTRB<T, Impl>& inRectangle, const Point<T, Impl>& inPoint)
+{
+	auto result{inRectangle};
+	return result.Translate(inPoint);
+}
+
+/// @brief Compute the union of two rectangles and return the resulting rectangle.
+/// @tparam T Underlying coordinate type
+/// @tparam Impl Optional implementation kind (scalar or simd)
+/// @param inLHS Left-hand rectangle
+/// @param inRHS Right-hand rectangle
+/// @return Rectangle representing the minimal bounding rectangle that contains both inputs
+template<typename T, ImplKind Impl>
+inline constexpr RectangleLTRB<T, Impl> Union(const RectangleLTRB<T, Impl>& inLHS, const RectangleLTRB<T, Impl>& inRHS)
+{
+	auto result{inLHS};
+	return result.Union(inRHS);
+}
+
+/// @brief Compute the intersection of two rectangles and return the overlapping rectangle.
+/// @tparam T Underlying coordinate type
+/// @tparam Impl Optional implementation kind (scalar or simd)
+/// @param inLHS Left-hand rectangle
+/// @param inRHS Right-hand rectangle
+/// @return Rectangle representing the overlapping area; may be empty
+template<typename T, ImplKind Impl>
+inline constexpr RectangleLTRB<T, Impl> Intersect(const RectangleLTRB<T, Impl>& inLHS, const RectangleLTRB<T, Impl>& inRHS)
+{
+	auto intersect{inLHS};
+	return intersect.Intersect(inRHS);
+}
+
+/// @brief Test whether a rectangle is empty (zero area), as `IsEmpty()` of the equivalent `Rectangle<>`.
+/// @tparam T Underlying coordinate type
+/// @tparam Impl Optional implementation kind (scalar or simd)
+/// @param inRectangle Rectangle to test
+/// @return true when the rectangle area is empty, false otherwise
+template<typename T, ImplKind Impl>
+inline constexpr bool IsEmpty(const RectangleLTRB<T, Impl>& inRectangle)
+{
+	const auto isEmpty = IsEmpty(inRectangle.mImpl);
+	return isEmpty;
+}
+
+/// @brief Test whether a point lies within a rectangle.
+/// @tparam T Underlying coordinate type
+/// @tparam Impl Optional implementation kind (scalar or simd)
+/// @param inRectangle Rectangle to test against
+/// @param inPoint Point to check
+/// @return true when the point is inside the rectangle, false otherwise
+template<typename T, ImplKind Impl>
+inline constexpr bool IsOverlapping(const RectangleLTRB<T, Impl>& inRectangle, const Point<T, Impl>& inPoint)
+{
+	const auto isOverlapping = inRectangle.IsOverlapping(inPoint);
+	return isOverlapping;
+}
+
+/// @brief Test whether two rectangles overlap (have a non-empty intersection).
+/// @tparam T Underlying coordinate type
+/// @tparam Impl Optional implementation kind (scalar or simd)
+/// @param inLHS First rectangle
+/// @param inRHS Second rectangle
+/// @return true when rectangles overlap, false otherwise
+template<typename T, ImplKind Impl>
+inline constexpr bool IsOverlapping(const RectangleLTRB<T, Impl>& inLHS, const RectangleLTRB<T, Impl>& inRHS)
+{
+	const auto isOverlapping = inLHS.IsOverlapping(inRHS);
+	return isOverlapping;
+}
+
+/// @brief Test whether a rectangle lies entirely within another; edges may touch.
+/// @tparam T Underlying coordinate type
+/// @tparam Impl Optional implementation kind (scalar or simd)
+/// @param inOuter Containing rectangle
+/// @param inInner Contained rectangle
+/// @return true when `inInner` lies within `inOuter`, false otherwise
+template<typename T, ImplKind Impl>
+inline constexpr bool Contains(const RectangleLTRB<T, Impl>& inOuter, const RectangleLTRB<T, Impl>& inInner)
+{
+	const auto isContained = inOuter.Contains(inInner);
+	return isContained;
+}
+
+#pragma endregion
+
+} // namespace saber::geometry
+
+#endif // SABER_GEOMETRY_RECTANGLE_LTRB_HPP
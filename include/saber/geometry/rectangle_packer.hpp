@@ -0,0 +1,477 @@
+#ifndef SABER_GEOMETRY_RECTANGLE_PACKER_HPP
+#define SABER_GEOMETRY_RECTANGLE_PACKER_HPP
+
+// saber
+#include "saber/exception.hpp"
+#include "saber/geometry/config.hpp"
+#include "saber/geometry/rectangle.hpp"
+#include "saber/geometry/size.hpp"
+#include "saber/geometry/detail/packer_helper.hpp"
+
+// std
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace saber::geometry {
+
+/// @brief Placement heuristic of a `RectanglePacker<>`
+enum class PackKind
+{
+	kSkyline,	// Bottom-left skyline: fastest; space skipped below the skyline or freed is reused through a free list
+	kMaxRects	// Maximal free rectangles, best short side fit: tightest packing
+};
+
+/// @brief Packs rectangles (e.g. glyphs, sprites) into a fixed size area (e.g. a texture atlas), without overlap.
+/// Rectangles may be inserted and freed in any order. With `ImplKind::kSimd` and `int` coordinates,
+/// candidate free rectangles are scored, and tested for overlap and containment, 4 at a time.
+/// @tparam T Integer coordinate type
+/// @tparam Impl Optional implementation kind (scalar or simd)
+template<typename T = int, ImplKind Impl = ImplKind::kDefault>
+class RectanglePacker
+{
+public:
+	using ValueType = T;
+
+public:
+	/// @brief Constructs an empty packer.
+	/// @param inWidth Width of the area to pack into.
+	/// @param inHeight Height of the area to pack into.
+	/// @param inKind Placement heuristic.
+	RectanglePacker(T inWidth, T inHeight, PackKind inKind = PackKind::kMaxRects);
+
+	/// @brief Constructs an empty packer.
+	/// @param inSize Size of the area to pack into.
+	/// @param inKind Placement heuristic.
+	explicit RectanglePacker(const geometry::Size<T, Impl>& inSize, PackKind inKind = PackKind::kMaxRects);
+
+	/// @brief Destructor.
+	~RectanglePacker() = default;
+
+	RectanglePacker(RectanglePacker&& ioMove) noexcept = default;
+	RectanglePacker& operator=(RectanglePacker&& ioMove) noexcept = default;
+	RectanglePacker(const RectanglePacker& inCopy) = default;
+	RectanglePacker& operator=(const RectanglePacker& inCopy) = default;
+
+	/// @brief Place a rectangle of the given size.
+	/// @param inWidth Width of the rectangle; must be positive.
+	/// @param inHeight Height of the rectangle; must be positive.
+	/// @return The placed rectangle, or `std::nullopt` when there is no room for it.
+	std::optional<Rectangle<T, Impl>> Insert(T inWidth, T inHeight);
+
+	/// @brief Place a rectangle of the given size.
+	/// @param inSize Size of the rectangle; must be positive.
+	/// @return The placed rectangle, or `std::nullopt` when there is no room for it.
+	std::optional<Rectangle<T, Impl>> Insert(const geometry::Size<T, Impl>& inSize);
+
+	/// @brief Return a rectangle previously placed by `Insert()` for reuse.
+	/// @param inRectangle The placed rectangle.
+	void Free(const Rectangle<T, Impl>& inRectangle);
+
+	/// @brief Free every rectangle.
+	void Reset();
+
+	/// @brief Gets the width of the area packed into.
+	T Width() const;
+
+	/// @brief Gets the height of the area packed into.
+	T Height() const;
+
+	/// @brief Gets the placement heuristic.
+	PackKind Kind() const;
+
+	/// @brief Gets the fraction of the area occupied by placed rectangles: 0.0 (empty) to 1.0 (full).
+	double Occupancy() const;
+
+	/// @brief Gets the number of free rectangles tracked; `Insert()` scans all of them when one of them may fit.
+	std::size_t FreeCount() const;
+
+private:
+	struct SkylineNode
+	{
+		T mX;
+		T mY;
+		T mWidth;
+	};
+
+	using Edges = std::array<T, 4>; // {left, top, right, bottom}
+	using Helper = detail::PackerHelper<T, Impl>;
+
+	/// @brief Replace each free rectangle overlapping `inPlaced` with its parts outside it
+	void SplitFree(const Edges& inPlaced);
+
+	/// @brief Add `mNew` to the free rectangles, dropping those contained in another new one
+	/// @param inIsPruningOld Also test against the existing free rectangles, both ways
+	void AddNewFree(bool inIsPruningOld);
+
+	/// @brief Find the bottom-left skyline position of a `inWidth` by `inHeight` rectangle
+	bool InsertSkyline(T inWidth, T inHeight, T& outX, T& outY);
+
+	/// @brief Gets the y at which a rectangle of `inWidth` rests on the skyline from node `inIndex`
+	bool FitSkyline(std::size_t inIndex, T inWidth, T inHeight, T& outY) const;
+
+	static bool Contains(const Edges& inOuter, const Edges& inInner);
+
+private:
+	T mWidth{};
+	T mHeight{};
+	PackKind mKind = PackKind::kMaxRects;
+	std::int64_t mUsedArea = 0;
+
+	detail::FreeRects<T> mFree;
+	std::vector<SkylineNode> mSkyline;
+
+	// Scratch space, kept to avoid allocating on each `Insert()`
+	std::vector<std::size_t> mIndices;
+	std::vector<std::size_t> mContained;
+	std::vector<Edges> mNew;
+}; // class RectanglePacker<>
+
+// ------------------------------------------------------------------
+#pragma region Inline Class Functions
+
+template<typename T, ImplKind Impl>
+inline RectanglePacker<T, Impl>::RectanglePacker(T inWidth, T inHeight, PackKind inKind) :
+	mWidth{inWidth},
+	mHeight{inHeight},
+	mKind{inKind}
+{
+	static_assert(std::is_integral_v<T>, "RectanglePacker<> requires integer coordinates");
+	SABER_REQUIRE(inWidth > 0 && inHeight > 0);
+	Reset();
+}
+
+template<typename T, ImplKind Impl>
+inline RectanglePacker<T, Impl>::RectanglePacker(const geometry::Size<T, Impl>& inSize, PackKind inKind) :
+	RectanglePacker{inSize.Width(), inSize.Height(), inKind}
+{
+	// Do nothing
+}
+
+template<typename T, ImplKind Impl>
+inline std::optional<Rectangle<T, Impl>> RectanglePacker<T, Impl>::Insert(T inWidth, T inHeight)
+{
+	SABER_REQUIRE(inWidth > 0 && inHeight > 0);
+
+	// Free rectangles first: all space with `kMaxRects`; freed or skipped space with `kSkyline`.
+	// NOTE: Most of the latter are slivers too small for anything: only scan them when one may fit
+	T x{};
+	T y{};
+	auto best = Helper::kNotFound;
+	if (mFree.MayFit(inWidth, inHeight))
+	{
+		best = Helper::FindBestFit(mFree, inWidth, inHeight);
+		if (best == Helper::kNotFound)
+		{
+			mFree.Refit(); // Only erased rectangles seemed to fit: don't scan for them again
+		}
+	}
+	if (best != Helper::kNotFound)
+	{
+		x = mFree.mLeft[best];
+		y = mFree.mTop[best];
+		SplitFree(Edges{x, y, static_cast<T>(x + inWidth), static_cast<T>(y + inHeight)});
+	}
+	else if (mKind != PackKind::kSkyline || !InsertSkyline(inWidth, inHeight, x, y))
+	{
+		return std::nullopt;
+	}
+
+	mUsedArea += static_cast<std::int64_t>(inWidth) * inHeight;
+	return Rectangle<T, Impl>{x, y, inWidth, inHeight};
+}
+
+template<typename T, ImplKind Impl>
+inline std::optional<Rectangle<T, Impl>> RectanglePacker<T, Impl>::Insert(const geometry::Size<T, Impl>& inSize)
+{
+	return Insert(inSize.Width(), inSize.Height());
+}
+
+template<typename T, ImplKind Impl>
+inline void RectanglePacker<T, Impl>::Free(const Rectangle<T, Impl>& inRectangle)
+{
+	Edges freed{inRectangle.X(), inRectangle.Y(), static_cast<T>(inRectangle.X() + inRectangle.Width()), static_cast<T>(inRectangle.Y() + inRectangle.Height())};
+	SABER_REQUIRE(freed[0] >= 0 && freed[1] >= 0 && freed[2] <= mWidth && freed[3] <= mHeight && !IsEmpty(inRectangle));
+
+	mUsedArea -= static_cast<std::int64_t>(inRectangle.Width()) * inRectangle.Height();
+	if (mUsedArea <= 0)
+	{
+		Reset();
+		return;
+	}
+
+	// Grow the freed rectangle over free neighbours sharing a whole edge with it
+	for (bool isMerged = true; isMerged;)
+	{
+		isMerged = false;
+		for (std::size_t i = 0; i < mFree.Size(); ++i)
+		{
+			const Edges free{mFree.mLeft[i], mFree.mTop[i], mFree.mRight[i], mFree.mBottom[i]};
+			const bool isSameColumn = (free[0] == freed[0]) && (free[2] == freed[2]) && ((free[3] == freed[1]) || (free[1] == freed[3]));
+			const bool isSameRow = (free[1] == freed[1]) && (free[3] == freed[3]) && ((free[2] == freed[0]) || (free[0] == freed[2]));
+			if (isSameColumn || isSameRow)
+			{
+				freed = Edges{std::min(free[0], freed[0]), std::min(free[1], freed[1]), std::max(free[2], freed[2]), std::max(free[3], freed[3])};
+				mFree.Erase(i);
+				isMerged = true;
+				break;
+			}
+		}
+	}
+
+	mNew.clear();
+	mNew.push_back(freed);
+	AddNewFree(true);
+}
+
+template<typename T, ImplKind Impl>
+inline void RectanglePacker<T, Impl>::Reset()
+{
+	mUsedArea = 0;
+	mFree.Clear();
+	mSkyline.clear();
+	if (mKind == PackKind::kSkyline)
+	{
+		mSkyline.push_back(SkylineNode{0, 0, mWidth});
+	}
+	else
+	{
+		mFree.Push(0, 0, mWidth, mHeight);
+	}
+}
+
+template<typename T, ImplKind Impl>
+inline T RectanglePacker<T, Impl>::Width() const
+{
+	return mWidth;
+}
+
+template<typename T, ImplKind Impl>
+inline T RectanglePacker<T, Impl>::Height() const
+{
+	return mHeight;
+}
+
+template<typename T, ImplKind Impl>
+inline PackKind RectanglePacker<T, Impl>::Kind() const
+{
+	return mKind;
+}
+
+template<typename T, ImplKind Impl>
+inline double RectanglePacker<T, Impl>::Occupancy() const
+{
+	const auto area = static_cast<double>(mWidth) * static_cast<double>(mHeight);
+	return static_cast<double>(mUsedArea) / area;
+}
+
+template<typename T, ImplKind Impl>
+inline std::size_t RectanglePacker<T, Impl>::FreeCount() const
+{
+	return mFree.Size();
+}
+
+template<typename T, ImplKind Impl>
+inline void RectanglePacker<T, Impl>::SplitFree(const Edges& inPlaced)
+{
+	const auto [left, top, right, bottom] = inPlaced;
+	Helper::FindOverlapping(mFree, left, top, right, bottom, mIndices);
+
+	mNew.clear();
+	for (const auto i : mIndices)
+	{
+		const Edges free{mFree.mLeft[i], mFree.mTop[i], mFree.mRight[i], mFree.mBottom[i]};
+
+		// Maximal parts of `free` left of, right of, above and below the placed rectangle (they overlap)
+		if (free[0] < left)
+		{
+			mNew.push_back(Edges{free[0], free[1], left, free[3]});
+		}
+		if (free[2] > right)
+		{
+			mNew.push_back(Edges{right, free[1], free[2], free[3]});
+		}
+		if (free[1] < top)
+		{
+			mNew.push_back(Edges{free[0], free[1], free[2], top});
+		}
+		if (free[3] > bottom)
+		{
+			mNew.push_back(Edges{free[0], bottom, free[2], free[3]});
+		}
+	}
+
+	// NOTE: Descending order, so `Erase()` only ever moves a rectangle that is kept
+	for (auto i = mIndices.rbegin(); i != mIndices.rend(); ++i)
+	{
+		mFree.Erase(*i);
+	}
+
+	// NOTE: A split part rarely lies within an existing free rectangle, and is still free space if it does
+	// (it is pruned when next split), so split parts are only tested against each other: scanning every free
+	// rectangle per part would dominate `Insert()`
+	AddNewFree(false);
+}
+
+template<typename T, ImplKind Impl>
+inline void RectanglePacker<T, Impl>::AddNewFree(bool inIsPruningOld)
+{
+	// New rectangles contained in an existing one, or in another new one, add no space
+	const std::size_t oldCount = mFree.Size();
+	std::size_t keptCount = 0;
+	for (std::size_t n = 0; n < mNew.size(); ++n)
+	{
+		const auto edges = mNew[n];
+		if (inIsPruningOld && Helper::IsContained(mFree, oldCount, edges[0], edges[1], edges[2], edges[3]))
+		{
+			continue;
+		}
+
+		const auto kept = mNew.begin() + keptCount;
+		if (std::any_of(mNew.begin(), kept, [&](const Edges& inKept) { return Contains(inKept, edges); }))
+		{
+			continue;
+		}
+		const auto end = std::remove_if(mNew.begin(), kept, [&](const Edges& inKept) { return Contains(edges, inKept); });
+		*end = edges;
+		keptCount = static_cast<std::size_t>(end - mNew.begin()) + 1;
+	}
+	mNew.resize(keptCount);
+
+	// Existing rectangles contained in a new one are now redundant
+	if (inIsPruningOld)
+	{
+		std::vector<std::size_t>& redundant = mIndices;
+		redundant.clear();
+		for (const auto& edges : mNew)
+		{
+			const std::size_t first = redundant.size();
+			Helper::FindContained(mFree, oldCount, edges[0], edges[1], edges[2], edges[3], mContained);
+			redundant.insert(redundant.end(), mContained.begin(), mContained.end());
+			std::inplace_merge(redundant.begin(), redundant.begin() + first, redundant.end());
+		}
+		redundant.erase(std::unique(redundant.begin(), redundant.end()), redundant.end());
+		for (auto i = redundant.rbegin(); i != redundant.rend(); ++i)
+		{
+			mFree.Erase(*i);
+		}
+	}
+
+	for (const auto& edges : mNew)
+	{
+		mFree.Push(edges[0], edges[1], edges[2], edges[3]);
+	}
+}
+
+template<typename T, ImplKind Impl>
+inline bool RectanglePacker<T, Impl>::InsertSkyline(T inWidth, T inHeight, T& outX, T& outY)
+{
+	// Bottom-left: lowest top edge, then narrowest skyline node
+	std::size_t best = mSkyline.size();
+	T bestTop{};
+	T bestWidth{};
+	for (std::size_t i = 0; i < mSkyline.size(); ++i)
+	{
+		T y{};
+		if (!FitSkyline(i, inWidth, inHeight, y))
+		{
+			continue;
+		}
+
+		const T top = y + inHeight;
+		if ((best == mSkyline.size()) || (top < bestTop) || ((top == bestTop) && (mSkyline[i].mWidth < bestWidth)))
+		{
+			best = i;
+			bestTop = top;
+			bestWidth = mSkyline[i].mWidth;
+			outY = y;
+		}
+	}
+	if (best == mSkyline.size())
+	{
+		return false;
+	}
+
+	const T x = mSkyline[best].mX;
+	const T right = x + inWidth;
+	outX = x;
+
+	// Space between the skyline and the placed rectangle is kept as free rectangles
+	for (std::size_t i = best; (i < mSkyline.size()) && (mSkyline[i].mX < right); ++i)
+	{
+		const auto& node = mSkyline[i];
+		if (node.mY < outY)
+		{
+			mFree.Push(node.mX, node.mY, std::min<T>(node.mX + node.mWidth, right), outY);
+		}
+	}
+
+	// Raise the skyline under the placed rectangle
+	mSkyline.insert(mSkyline.begin() + best, SkylineNode{x, static_cast<T>(outY + inHeight), inWidth});
+	for (std::size_t i = best + 1; (i < mSkyline.size()) && (mSkyline[i].mX < right);)
+	{
+		auto& node = mSkyline[i];
+		const T overlap = right - node.mX;
+		if (node.mWidth <= overlap)
+		{
+			mSkyline.erase(mSkyline.begin() + i);
+			continue;
+		}
+		node.mX += overlap;
+		node.mWidth -= overlap;
+		break;
+	}
+
+	// Merge neighbouring nodes of the same height
+	for (std::size_t i = 0; i + 1 < mSkyline.size();)
+	{
+		if (mSkyline[i].mY == mSkyline[i + 1].mY)
+		{
+			mSkyline[i].mWidth += mSkyline[i + 1].mWidth;
+			mSkyline.erase(mSkyline.begin() + i + 1);
+			continue;
+		}
+		++i;
+	}
+	return true;
+}
+
+template<typename T, ImplKind Impl>
+inline bool RectanglePacker<T, Impl>::FitSkyline(std::size_t inIndex, T inWidth, T inHeight, T& outY) const
+{
+	if (mSkyline[inIndex].mX + inWidth > mWidth)
+	{
+		return false;
+	}
+
+	// Rest on the highest node under the rectangle's width
+	T y = mSkyline[inIndex].mY;
+	T remaining = inWidth;
+	for (std::size_t i = inIndex; remaining > 0; ++i)
+	{
+		y = std::max(y, mSkyline[i].mY);
+		if (y + inHeight > mHeight)
+		{
+			return false;
+		}
+		remaining -= mSkyline[i].mWidth;
+	}
+	outY = y;
+	return true;
+}
+
+template<typename T, ImplKind Impl>
+inline bool RectanglePacker<T, Impl>::Contains(const Edges& inOuter, const Edges& inInner)
+{
+	return (inOuter[0] <= inInner[0]) && (inOuter[1] <= inInner[1]) && (inOuter[2] >= inInner[2]) && (inOuter[3] >= inInner[3]);
+}
+
+#pragma endregion
+
+} // namespace saber::geometry
+
+#endif // SABER_GEOMETRY_RECTANGLE_PACKER_HPP
@@ -7,6 +7,7 @@
 #include "saber/geometry/detail/impl2.hpp"
 
 //std
+#include <cstddef>
 #include <type_traits>
 
 namespace saber::geometry {
@@ -108,6 +109,19 @@ public:
 	template<typename U=T, typename SFINAE = std::enable_if_t<std::is_floating_point_v<U>>>
 	constexpr Size& RoundTrunc();
 
+	// --- Conversion ---
+
+	/// @brief Convert an array of `Size<FromT>` to this `Size<T>` type; such as float layout extents to integer pixel extents.
+	/// Floating point to integer conversions fuse rounding (and optional saturation) into the conversion itself.
+	/// @tparam Round Rounding applied to floating point to integer conversions
+	/// @tparam Overflow Out of range handling of floating point to integer conversions
+	/// @tparam FromT Underlying type of the source `Size<>`
+	/// @param inSizes Pointer to `inCount` sizes to convert
+	/// @param outSizes Pointer to `inCount` sizes receiving the converted result
+	/// @param inCount Number of sizes
+	template<RoundKind Round = RoundKind::kNearest, OverflowKind Overflow = OverflowKind::kUnchecked, typename FromT>
+	static void ConvertFrom(const Size<FromT, Impl>* inSizes, Size* outSizes, std::size_t inCount);
+
 	/// @brief Enlarge (add) the provided size to this size
 	/// @param inEnlarge Size to add
 	/// @return Reference to this size
@@ -136,6 +150,11 @@ public:
 	/// @return Reference to this size
 	constexpr Size& Scale(T inWH);
 
+	/// @brief Divide width and height by the same prepared divisor
+	/// @param inDivisor Divisor prepared once, for many sizes (integer division without `idiv`)
+	/// @return Reference to this size
+	constexpr Size& DivBy(const Divisor<T>& inDivisor);
+
 private:
 	// Private APIs
 	constexpr bool IsEqual(const Size& inSize) const;
@@ -147,6 +166,9 @@ private:
 	friend class Matrix<T, Impl>;
 	friend class Rectangle<T, Impl>;
 
+	template<typename U, ImplKind I>
+	friend class Size; // Permit ConvertFrom() access to other `Size<U>` types
+
 private:
 	using ImplType = typename detail::Impl2Traits<T, Impl>::ImplType; // VOODOO: Nested template type requires `typename` prefix
     ImplType mImpl{};
@@ -260,6 +282,22 @@ inline constexpr Size<T, Impl>& Size<T, Impl>::RoundTrunc()
 	return *this;
 }
 
+template<typename T, ImplKind Impl>
+template<RoundKind Round, OverflowKind Overflow, typename FromT>
+inline void Size<T, Impl>::ConvertFrom(const Size<FromT, Impl>* inSizes, Size* outSizes, std::size_t inCount)
+{
+	// Two at a time (e.g., 2x 2 floats fill one 128bit conversion); then the odd one out, if any
+	std::size_t i = 0;
+	for (; i + 2 <= inCount; i += 2)
+	{
+		ImplType::template ConvertFrom2<Round, Overflow, FromT>(inSizes[i].mImpl, inSizes[i + 1].mImpl, outSizes[i].mImpl, outSizes[i + 1].mImpl);
+	}
+	if (i < inCount)
+	{
+		outSizes[i].mImpl.template ConvertFrom<Round, Overflow, FromT>(inSizes[i].mImpl);
+	}
+}
+
 
 // Mutators
 template<typename T, ImplKind Impl>
@@ -302,6 +340,13 @@ inline constexpr Size<T, Impl>& Size<T, Impl>::Scale(T inWH)
 	return Scale(inWH, inWH);
 }
 
+template<typename T, ImplKind Impl>
+inline constexpr Size<T, Impl>& Size<T, Impl>::DivBy(const Divisor<T>& inDivisor)
+{
+	mImpl.DivBy(inDivisor);
+	return *this;
+}
+
 #pragma endregion
 
 // ------------------------------------------------------------------
@@ -387,6 +432,20 @@ inline constexpr Size<T, Impl> Scale(const Size<T, Impl>& inSize, T inWH)
 	return Scale(inSize, inWH, inWH);
 }
 
+/// @brief Divide a `Size<>` by a prepared divisor
+/// @tparam T: Underlying `Size<>` type
+/// @tparam ImplKind: Optional underlying implementation type
+/// @param inSize: `Size<>` object to be divided
+/// @param inDivisor: Divisor prepared once, for many sizes
+/// @return Divided `Size<>` result
+template<typename T, ImplKind Impl>
+inline constexpr Size<T, Impl> DivBy(const Size<T, Impl>& inSize, const Divisor<T>& inDivisor)
+{
+	Size<T, Impl> result{inSize};
+	result.DivBy(inDivisor);
+	return result;
+}
+
 /// @brief Round to nearest even integer value. Halfway cases round away from zero.
 /// @tparam T: Underlying `Size<>` type
 /// @tparam ImplKind: Optional underlying implementation type
@@ -0,0 +1,116 @@
+/////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2025 Matthew Fitzgerald
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+/////////////////////////////////////////////////////////////////////
+
+#ifndef SABER_MEMORY_HPP
+#define SABER_MEMORY_HPP
+
+// saber
+#include "saber/config.hpp"
+
+// std
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace saber {
+
+// ------------------------------------------------------------------
+#pragma region class AlignedAllocator<>
+
+/// @brief Standard library compatible allocator returning storage aligned to
+/// (at least) `N` bytes. Use it for containers whose elements are loaded with
+/// aligned SIMD instructions, so the fast aligned load/store paths are taken:
+/// @code
+/// #include "saber/memory.hpp"
+/// // Every float in `rads` starts on a 16 byte boundary when its index is a multiple of 4
+/// std::vector<float, saber::AlignedAllocator<float, 16>> rads(1024);
+/// @endcode
+/// @tparam T Type of allocated elements
+/// @tparam N Requested alignment in bytes; must be a power of two
+template<typename T, std::size_t N = alignof(std::max_align_t)>
+class AlignedAllocator
+{
+public:
+	using value_type = T;
+
+	/// @brief Effective alignment: never less than the natural alignment of `T`
+	static constexpr std::size_t kAlignment = (N > alignof(T)) ? N : alignof(T);
+	static_assert((N != 0) && ((N & (N - 1)) == 0), "AlignedAllocator alignment must be a power of two");
+
+	/// @brief Rebind this allocator to another element type with the same alignment
+	template<typename U>
+	struct rebind
+	{
+		using other = AlignedAllocator<U, N>;
+	};
+
+public:
+	constexpr AlignedAllocator() noexcept = default;
+	~AlignedAllocator() = default;
+
+	constexpr AlignedAllocator(const AlignedAllocator& inCopy) noexcept = default;
+	constexpr AlignedAllocator& operator=(const AlignedAllocator& inCopy) noexcept = default;
+
+	/// @brief Converting ctor (required by allocator aware containers)
+	template<typename U>
+	constexpr AlignedAllocator(const AlignedAllocator<U, N>& /*inCopy*/) noexcept
+	{
+		// Do nothing: stateless
+	}
+
+	/// @brief Allocate uninitialized, aligned storage for `inCount` elements
+	/// @param inCount Number of elements
+	/// @return Pointer to storage aligned to `kAlignment` bytes
+	/// @throws std::bad_array_new_length if `inCount` elements would overflow `std::size_t`
+	/// @throws std::bad_alloc if memory is exhausted
+	[[nodiscard]] T* allocate(std::size_t inCount)
+	{
+		if (inCount > (std::numeric_limits<std::size_t>::max() / sizeof(T)))
+		{
+			throw std::bad_array_new_length{};
+		}
+		void* storage = ::operator new(inCount * sizeof(T), std::align_val_t{kAlignment});
+		return static_cast<T*>(storage);
+	}
+
+	/// @brief Release storage previously returned by `allocate()`
+	/// @param ioStorage Pointer returned by `allocate()`
+	/// @param inCount Number of elements passed to `allocate()`
+	void deallocate(T* ioStorage, std::size_t inCount) noexcept
+	{
+		::operator delete(ioStorage, inCount * sizeof(T), std::align_val_t{kAlignment});
+	}
+}; // class AlignedAllocator<>
+
+/// @brief Stateless: any two allocators of the same alignment can free each other's storage
+template<typename T, typename U, std::size_t N>
+constexpr bool operator==(const AlignedAllocator<T, N>& /*inLHS*/, const AlignedAllocator<U, N>& /*inRHS*/) noexcept
+{
+	return true;
+}
+
+template<typename T, typename U, std::size_t N>
+constexpr bool operator!=(const AlignedAllocator<T, N>& inLHS, const AlignedAllocator<U, N>& inRHS) noexcept
+{
+	return !(inLHS == inRHS);
+}
+
+#pragma endregion
+
+} // namespace saber
+
+#endif // SABER_MEMORY_HPP
@@ -0,0 +1,419 @@
+/////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2025 Matthew Fitzgerald
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+/////////////////////////////////////////////////////////////////////
+
+#ifndef SABER_THREAD_POOL_HPP
+#define SABER_THREAD_POOL_HPP
+
+// saber
+#include "saber/config.hpp"
+#include "saber/exception.hpp"
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace saber {
+
+// ------------------------------------------------------------------
+#pragma region class ThreadPool
+
+/// @brief Lightweight work stealing thread pool.
+/// Each worker thread owns a task queue: it runs its own tasks newest first,
+/// and when its queue is empty, steals the oldest task of another worker.
+/// Threads waiting on the pool (`Wait()`, `ParallelFor()`) run queued tasks
+/// rather than block, so `ParallelFor()` may be nested inside pool tasks.
+class ThreadPool
+{
+public:
+	using Task = std::function<void()>;
+
+public:
+	/// @brief Start `inThreadCount` worker threads. With no worker threads,
+	/// every task runs on the thread calling `Wait()` or `ParallelFor()`.
+	/// @param inThreadCount Number of worker threads
+	explicit ThreadPool(std::size_t inThreadCount = DefaultThreadCount());
+
+	/// @brief Runs every task still queued, then joins all worker threads.
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+	ThreadPool(ThreadPool&&) = delete;
+	ThreadPool& operator=(ThreadPool&&) = delete;
+
+	/// @brief Gets the number of worker threads.
+	std::size_t ThreadCount() const;
+
+	/// @brief Queue a task to run on the pool. Called from a pool task, the
+	/// task is queued on the calling worker's own queue.
+	/// @param inTask Task to run; an exception it throws is rethrown by `Wait()`
+	template<typename FuncT>
+	void Submit(FuncT&& inTask);
+
+	/// @brief Run queued tasks until every submitted task has completed.
+	/// Must not be called from a pool task.
+	/// @throws The first exception thrown by a task since the previous `Wait()`
+	void Wait();
+
+	/// @brief Call `inFunc(begin, end)` for consecutive ranges of `inChunk` indices
+	/// covering [0, inCount), spreading the ranges over the calling thread and the
+	/// worker threads, and return once every range has completed. Range boundaries
+	/// depend only on `inCount` and `inChunk`, never on the number of threads.
+	/// @param inCount Number of indices
+	/// @param inChunk Number of indices per range; the last range may be shorter
+	/// @param inFunc Callable as `inFunc(std::size_t begin, std::size_t end)`
+	/// @throws The first exception thrown by `inFunc`; later ranges are skipped
+	template<typename FuncT>
+	void ParallelFor(std::size_t inCount, std::size_t inChunk, FuncT&& inFunc);
+
+	/// @brief Gets the default number of worker threads: one per hardware thread.
+	static std::size_t DefaultThreadCount();
+
+private:
+	struct TaskQueue
+	{
+		std::mutex mMutex;
+		std::deque<Task> mTasks;
+	};
+
+	void Push(Task&& inTask);
+	bool TryRunOne();
+	bool TryPop(Task& outTask);
+	void Run(Task& ioTask);
+	void WorkerMain(std::size_t inIndex);
+
+	/// @brief Gets the queue of the calling thread: its own queue when called from a worker
+	/// thread of this pool, otherwise the next queue round robin.
+	std::size_t QueueIndex();
+
+	/// @brief Gets the index of the calling worker thread's queue, or `kNotWorker`
+	/// when not called from a worker thread of this pool.
+	std::size_t WorkerIndex() const;
+
+	static constexpr std::size_t kNotWorker = ~std::size_t{0};
+
+	/// @brief The pool (if any) of which the calling thread is a worker
+	struct WorkerSlot
+	{
+		const ThreadPool* mPool = nullptr;
+		std::size_t mIndex = kNotWorker;
+	};
+	static WorkerSlot& CurrentWorker();
+
+private:
+	std::vector<std::unique_ptr<TaskQueue>> mQueues;
+	std::vector<std::thread> mThreads;
+
+	std::mutex mMutex;
+	std::condition_variable mSignal;
+	bool mIsStopping = false;
+	std::exception_ptr mError;
+
+	std::atomic<std::size_t> mQueued{0};	// Tasks in any queue
+	std::atomic<std::size_t> mPending{0};	// Tasks submitted, but not completed
+	std::atomic<std::size_t> mNextQueue{0};
+}; // class ThreadPool
+
+inline ThreadPool::ThreadPool(std::size_t inThreadCount)
+{
+	const std::size_t queueCount = std::max<std::size_t>(inThreadCount, 1);
+	mQueues.reserve(queueCount);
+	for (std::size_t i = 0; i < queueCount; ++i)
+	{
+		mQueues.emplace_back(std::make_unique<TaskQueue>());
+	}
+
+	mThreads.reserve(inThreadCount);
+	for (std::size_t i = 0; i < inThreadCount; ++i)
+	{
+		mThreads.emplace_back([this, i]() { WorkerMain(i); });
+	}
+}
+
+inline ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock{mMutex};
+		mIsStopping = true;
+	}
+	mSignal.notify_all();
+	for (auto& thread : mThreads)
+	{
+		thread.join();
+	}
+
+	// Without worker threads, nothing else would run the remaining tasks
+	while (TryRunOne())
+	{
+		// Do nothing
+	}
+}
+
+inline std::size_t ThreadPool::ThreadCount() const
+{
+	return mThreads.size();
+}
+
+template<typename FuncT>
+inline void ThreadPool::Submit(FuncT&& inTask)
+{
+	Push(Task{std::forward<FuncT>(inTask)});
+}
+
+inline void ThreadPool::Wait()
+{
+	SABER_REQUIRE(WorkerIndex() == kNotWorker);
+	while (mPending.load() > 0)
+	{
+		if (!TryRunOne())
+		{
+			std::unique_lock<std::mutex> lock{mMutex};
+			mSignal.wait(lock, [this]() { return mPending.load() == 0 || mQueued.load() > 0; });
+		}
+	}
+
+	std::exception_ptr error;
+	{
+		std::lock_guard<std::mutex> lock{mMutex};
+		std::swap(error, mError);
+	}
+	if (error != nullptr)
+	{
+		std::rethrow_exception(error);
+	}
+}
+
+template<typename FuncT>
+inline void ThreadPool::ParallelFor(std::size_t inCount, std::size_t inChunk, FuncT&& inFunc)
+{
+	SABER_REQUIRE(inChunk > 0);
+	if (inCount == 0)
+	{
+		return;
+	}
+
+	struct State
+	{
+		std::atomic<std::size_t> mNextChunk{0};
+		std::atomic<std::size_t> mDone{0};
+		std::atomic<bool> mIsFailed{false};
+		std::mutex mMutex;
+		std::exception_ptr mError;
+	};
+
+	State state{};
+	const std::size_t chunkCount = (inCount - 1) / inChunk + 1;
+	auto runChunks = [&state, &inFunc, inCount, inChunk, chunkCount]()
+	{
+		for (auto chunk = state.mNextChunk++; chunk < chunkCount; chunk = state.mNextChunk++)
+		{
+			if (state.mIsFailed.load())
+			{
+				continue;
+			}
+
+			const std::size_t begin = chunk * inChunk;
+			try
+			{
+				inFunc(begin, std::min(begin + inChunk, inCount));
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock{state.mMutex};
+				if (!state.mIsFailed.exchange(true))
+				{
+					state.mError = std::current_exception();
+				}
+			}
+		}
+	};
+
+	// TRICKY: Helper tasks claim chunks from a shared counter rather than owning fixed ranges,
+	// so a helper that only starts late (or never, because every worker is busy) costs nothing
+	const std::size_t helperCount = std::min(ThreadCount(), chunkCount - 1);
+	for (std::size_t i = 0; i < helperCount; ++i)
+	{
+		Push([&state, &runChunks]()
+		{
+			runChunks();
+			state.mDone++;
+		});
+	}
+	runChunks();
+
+	// Every chunk is claimed; run other tasks (perhaps our own helpers) until the helpers finish
+	while (state.mDone.load() < helperCount)
+	{
+		if (!TryRunOne())
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	if (state.mError != nullptr)
+	{
+		std::rethrow_exception(state.mError);
+	}
+}
+
+inline std::size_t ThreadPool::DefaultThreadCount()
+{
+	return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+inline void ThreadPool::Push(Task&& inTask)
+{
+	mPending++;
+	{
+		auto& queue = *mQueues[QueueIndex()];
+		std::lock_guard<std::mutex> lock{queue.mMutex};
+		queue.mTasks.emplace_back(std::move(inTask));
+	}
+	mQueued++;
+
+	// Lock before notifying, so a thread between testing mQueued and sleeping cannot miss it
+	{
+		std::lock_guard<std::mutex> lock{mMutex};
+	}
+	mSignal.notify_all();
+}
+
+inline bool ThreadPool::TryRunOne()
+{
+	Task task;
+	const bool isPopped = TryPop(task);
+	if (isPopped)
+	{
+		Run(task);
+	}
+	return isPopped;
+}
+
+inline bool ThreadPool::TryPop(Task& outTask)
+{
+	// Own queue newest first (still warm in cache), then steal the oldest task of the others
+	const std::size_t ownIndex = WorkerIndex();
+	const std::size_t queueCount = mQueues.size();
+	const std::size_t first = (ownIndex != kNotWorker) ? ownIndex : 0;
+	for (std::size_t i = 0; i < queueCount; ++i)
+	{
+		const std::size_t index = (first + i) % queueCount;
+		auto& queue = *mQueues[index];
+		std::lock_guard<std::mutex> lock{queue.mMutex};
+		if (queue.mTasks.empty())
+		{
+			continue;
+		}
+
+		if (index == ownIndex)
+		{
+			outTask = std::move(queue.mTasks.back());
+			queue.mTasks.pop_back();
+		}
+		else
+		{
+			outTask = std::move(queue.mTasks.front());
+			queue.mTasks.pop_front();
+		}
+		mQueued--;
+		return true;
+	}
+	return false;
+}
+
+inline void ThreadPool::Run(Task& ioTask)
+{
+	try
+	{
+		ioTask();
+	}
+	catch (...)
+	{
+		std::lock_guard<std::mutex> lock{mMutex};
+		if (mError == nullptr)
+		{
+			mError = std::current_exception();
+		}
+	}
+	ioTask = nullptr;
+
+	if (--mPending == 0)
+	{
+		{
+			std::lock_guard<std::mutex> lock{mMutex};
+		}
+		mSignal.notify_all();
+	}
+}
+
+inline void ThreadPool::WorkerMain(std::size_t inIndex)
+{
+	CurrentWorker() = WorkerSlot{this, inIndex};
+	for (;;)
+	{
+		if (TryRunOne())
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock{mMutex};
+		mSignal.wait(lock, [this]() { return mIsStopping || mQueued.load() > 0; });
+		if (mIsStopping && mQueued.load() == 0)
+		{
+			break;
+		}
+	}
+	CurrentWorker() = WorkerSlot{};
+}
+
+inline std::size_t ThreadPool::QueueIndex()
+{
+	const std::size_t ownIndex = WorkerIndex();
+	if (ownIndex != kNotWorker)
+	{
+		return ownIndex;
+	}
+	return mNextQueue++ % mQueues.size();
+}
+
+inline std::size_t ThreadPool::WorkerIndex() const
+{
+	const auto& worker = CurrentWorker();
+	return (worker.mPool == this) ? worker.mIndex : kNotWorker;
+}
+
+inline ThreadPool::WorkerSlot& ThreadPool::CurrentWorker()
+{
+	thread_local WorkerSlot tWorker{};
+	return tWorker;
+}
+
+#pragma endregion
+
+} // namespace saber
+
+#endif // SABER_THREAD_POOL_HPP
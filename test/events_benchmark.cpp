@@ -0,0 +1,408 @@
+/////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2025 Matthew Fitzgerald
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+/////////////////////////////////////////////////////////////////////
+
+
+// catch2
+#include "catch2/catch_test_macros.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+// saber
+#include "saber/events/event_manager.hpp"
+#include "saber/events/static_event_bus.hpp"
+
+// std
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct BenchSender
+{
+	int mId{};
+};
+
+struct TickEvent
+{
+	int mValue{};
+};
+
+struct OtherEvent
+{
+	int mValue{};
+};
+
+// Distinct event types, to populate a manager with many of them
+template<std::size_t kIndex>
+struct IndexedEvent
+{
+	int mValue{};
+};
+
+// Handlers accumulate into a global, so their work can't be optimized away
+int sTotal = 0;
+
+template<typename EventType>
+saber::events::EventCallback MakeAccumulator()
+{
+	return saber::events::EventCallback::Make<BenchSender, EventType>([](const BenchSender&, const EventType& inEvent)
+	{
+		sTotal += inEvent.mValue;
+		return 0;
+	});
+}
+
+// Register `inHandlerCount` handlers for each of the first `inTypeCount` IndexedEvent<> types
+template<std::size_t... kIndices>
+void RegisterIndexed(saber::events::EventManager& ioManager, std::vector<saber::events::EventManager::Token>& outTokens,
+	int inHandlerCount, std::size_t inTypeCount, std::index_sequence<kIndices...>)
+{
+	auto registerType = [&](auto inEvent)
+	{
+		using EventType = decltype(inEvent);
+		for (int i = 0; i < inHandlerCount; ++i)
+		{
+			outTokens.push_back(ioManager.Register(MakeAccumulator<EventType>()));
+		}
+	};
+	((kIndices < inTypeCount ? registerType(IndexedEvent<kIndices>{}) : void()), ...);
+}
+
+// As MakeAccumulator(), for handlers run concurrently: each thread accumulates into its own total
+template<typename EventType>
+saber::events::EventCallback MakeThreadAccumulator()
+{
+	return saber::events::EventCallback::Make<BenchSender, EventType>([](const BenchSender&, const EventType& inEvent)
+	{
+		thread_local int tTotal = 0;
+		tTotal += inEvent.mValue;
+		return tTotal;
+	});
+}
+
+// Call `inFunction(IndexedEvent<inIndex>{})`, for a runtime `inIndex`
+template<typename Function, std::size_t... kIndices>
+void ForIndexed(std::size_t inIndex, Function&& inFunction, std::index_sequence<kIndices...>)
+{
+	((kIndices == inIndex ? inFunction(IndexedEvent<kIndices>{}) : void()), ...);
+}
+
+// Threads started once, outside of any timed region: Run() releases them all into the same work,
+// and returns when every one of them has finished it. Their registrations (and shards) live on
+// between runs, so a benchmark times the events, not thread start up and shard set up
+class WorkerThreads
+{
+public:
+	explicit WorkerThreads(int inCount)
+	{
+		for (int t = 0; t < inCount; ++t)
+		{
+			mThreads.emplace_back([this, t] { Main(t); });
+		}
+	}
+
+	~WorkerThreads()
+	{
+		{
+			std::lock_guard<std::mutex> lock{mMutex};
+			mIsStopping = true;
+			++mGeneration;
+		}
+		mStart.notify_all();
+		for (auto& thread : mThreads)
+			thread.join();
+	}
+
+	WorkerThreads(const WorkerThreads&) = delete;
+	WorkerThreads& operator=(const WorkerThreads&) = delete;
+
+	// Call `inWork(index)` on every thread, and wait for all of them to return
+	void Run(std::function<void(int)> inWork)
+	{
+		std::unique_lock<std::mutex> lock{mMutex};
+		mWork = std::move(inWork);
+		mRunningCount = static_cast<int>(mThreads.size());
+		++mGeneration;
+		mStart.notify_all();
+		mDone.wait(lock, [this] { return mRunningCount == 0; });
+	}
+
+private:
+	void Main(int inIndex)
+	{
+		std::uint64_t generation = 0;
+		for (;;)
+		{
+			{
+				std::unique_lock<std::mutex> lock{mMutex};
+				mStart.wait(lock, [&] { return mGeneration != generation; });
+				generation = mGeneration;
+				if (mIsStopping)
+					return;
+			}
+
+			mWork(inIndex); // NOTE: Not replaced until every thread is done with it
+
+			std::lock_guard<std::mutex> lock{mMutex};
+			if (--mRunningCount == 0)
+				mDone.notify_one();
+		}
+	}
+
+	std::vector<std::thread> mThreads{};
+	std::mutex mMutex{}; // Guards the members below
+	std::condition_variable mStart{};
+	std::condition_variable mDone{};
+	std::function<void(int)> mWork{};
+	std::uint64_t mGeneration{0};
+	int mRunningCount{0};
+	bool mIsStopping{false};
+};
+
+} // namespace
+
+TEST_CASE("saber::events::StaticEventBus vs EventManager", "[saber][benchmark]")
+{
+	using StaticBus = saber::events::StaticEventBus<BenchSender, TickEvent, OtherEvent>;
+	using saber::events::EventCallback;
+	using saber::events::EventManager;
+
+	const BenchSender sender{};
+	for (const int handlerCount : {1, 16, 256})
+	{
+		// Same handlers in both: one for TickEvent per count, and as many for OtherEvent (not notified)
+		auto manager = EventManager::Make();
+		StaticBus bus;
+		std::vector<EventManager::Token> managerTokens;
+		std::vector<StaticBus::Token> busTokens;
+		for (int i = 0; i < handlerCount; ++i)
+		{
+			auto onTick = [](const BenchSender&, const TickEvent& inEvent) { sTotal += inEvent.mValue; return 0; };
+			auto onOther = [](const BenchSender&, const OtherEvent& inEvent) { sTotal -= inEvent.mValue; return 0; };
+			managerTokens.push_back(manager->Register(EventCallback::Make<BenchSender, TickEvent>(onTick)));
+			managerTokens.push_back(manager->Register(EventCallback::Make<BenchSender, OtherEvent>(onOther)));
+			busTokens.push_back(bus.Register<TickEvent>(onTick));
+			busTokens.push_back(bus.Register<OtherEvent>(onOther));
+		}
+
+		const std::string suffix = " Notify() x" + std::to_string(handlerCount) + " handlers";
+		BENCHMARK("EventManager" + suffix)
+		{
+			manager->Notify(sender, TickEvent{1});
+			return sTotal;
+		};
+		BENCHMARK("StaticEventBus" + suffix)
+		{
+			bus.Notify(sender, TickEvent{1});
+			return sTotal;
+		};
+
+		for (auto token : managerTokens)
+			manager->Unregister(token);
+		for (auto token : busTokens)
+			bus.Unregister(token);
+	}
+}
+
+TEST_CASE("saber::events::EventManager Notify() throughput", "[saber][benchmark]")
+{
+	using saber::events::EventManager;
+
+	const BenchSender sender{};
+	for (const std::size_t typeCount : {1, 16, 64})
+	{
+		for (const int handlerCount : {1, 16, 256})
+		{
+			// Every event type has `handlerCount` handlers; only IndexedEvent<0> is notified
+			auto manager = EventManager::Make();
+			std::vector<EventManager::Token> tokens;
+			RegisterIndexed(*manager, tokens, handlerCount, typeCount, std::make_index_sequence<64>{});
+
+			BENCHMARK("Notify() x" + std::to_string(handlerCount) + " handlers, " + std::to_string(typeCount) + " event types")
+			{
+				manager->Notify(sender, IndexedEvent<0>{1});
+				return sTotal;
+			};
+
+			for (auto token : tokens)
+				manager->Unregister(token);
+		}
+	}
+}
+
+TEST_CASE("saber::events::EventManager Register()/Unregister() churn during Notify()", "[saber][benchmark]")
+{
+	using saber::events::EventManager;
+
+	const BenchSender sender{};
+	for (const int handlerCount : {16, 256})
+	{
+		auto manager = EventManager::Make();
+		std::vector<EventManager::Token> tokens;
+		RegisterIndexed(*manager, tokens, handlerCount, 1, std::make_index_sequence<1>{});
+
+		const std::string suffix = " x" + std::to_string(handlerCount) + " handlers";
+		BENCHMARK("Register()/Unregister() outside Notify()" + suffix)
+		{
+			manager->Unregister(manager->Register(MakeAccumulator<IndexedEvent<0>>()));
+			return sTotal;
+		};
+
+		// One handler registers and unregisters a handler of the notified type: the pending-changes path
+		// (the new handler goes to `mAdded` and is marked dead; both applied after the outermost Notify())
+		auto churn = manager->Register(saber::events::EventCallback::Make<BenchSender, IndexedEvent<0>>(
+			[&manager](const BenchSender&, const IndexedEvent<0>&)
+			{
+				manager->Unregister(manager->Register(MakeAccumulator<IndexedEvent<0>>()));
+				return 0;
+			}));
+		BENCHMARK("Notify() with Register()/Unregister() in a handler" + suffix)
+		{
+			manager->Notify(sender, IndexedEvent<0>{1});
+			return sTotal;
+		};
+		manager->Unregister(churn);
+
+		for (auto token : tokens)
+			manager->Unregister(token);
+	}
+}
+
+TEST_CASE("saber::events::EventManager re-entrant Notify()", "[saber][benchmark]")
+{
+	using saber::events::EventManager;
+
+	const BenchSender sender{};
+	for (const int depth : {1, 8, 64})
+	{
+		// A TickEvent handler notifies the next TickEvent, `depth` levels deep; 16 handlers observe each level
+		auto manager = EventManager::Make();
+		std::vector<EventManager::Token> tokens;
+		for (int i = 0; i < 16; ++i)
+			tokens.push_back(manager->Register(MakeAccumulator<TickEvent>()));
+		tokens.push_back(manager->Register(saber::events::EventCallback::Make<BenchSender, TickEvent>(
+			[&manager, &sender](const BenchSender&, const TickEvent& inEvent)
+			{
+				if (inEvent.mValue > 1)
+				{
+					manager->Notify(sender, TickEvent{inEvent.mValue - 1});
+				}
+				return 0;
+			})));
+
+		BENCHMARK("Notify() re-entrant x" + std::to_string(depth) + " deep")
+		{
+			manager->Notify(sender, TickEvent{depth});
+			return sTotal;
+		};
+
+		for (auto token : tokens)
+			manager->Unregister(token);
+	}
+}
+
+TEST_CASE("saber::events::EventManager multi-threaded Notify()", "[saber][benchmark]")
+{
+	using saber::events::EventManager;
+
+	constexpr int kEventCount = 1000; // Per thread, per benchmark run
+	const BenchSender sender{};
+	for (const int threadCount : {1, 4, 8})
+	{
+		const std::string suffix = " x" + std::to_string(threadCount) + " threads, " + std::to_string(kEventCount) + " events each";
+
+		WorkerThreads workers{threadCount};
+
+		// Baseline: one manager shared by every thread, behind a lock
+		{
+			auto manager = EventManager::Make();
+			std::mutex mutex;
+			std::vector<EventManager::Token> tokens;
+			RegisterIndexed(*manager, tokens, 16, 1, std::make_index_sequence<1>{});
+			BENCHMARK("Make() behind a mutex" + suffix)
+			{
+				workers.Run([&](int)
+				{
+					for (int i = 0; i < kEventCount; ++i)
+					{
+						std::lock_guard<std::mutex> lock{mutex};
+						manager->Notify(sender, IndexedEvent<0>{1});
+					}
+				});
+				return sTotal;
+			};
+			for (auto token : tokens)
+				manager->Unregister(token);
+		}
+
+		// Sharded: each thread registers and notifies its own event type, so events are dispatched locally
+		{
+			auto manager = EventManager::MakeSharded();
+			std::vector<EventManager::Token> tokens(static_cast<std::size_t>(threadCount));
+			workers.Run([&](int inIndex)
+			{
+				ForIndexed(static_cast<std::size_t>(inIndex), [&](auto inEvent)
+				{
+					tokens[static_cast<std::size_t>(inIndex)] = manager->Register(MakeThreadAccumulator<decltype(inEvent)>());
+				}, std::make_index_sequence<8>{});
+			});
+			BENCHMARK("MakeSharded(), thread-local events" + suffix)
+			{
+				workers.Run([&](int inIndex)
+				{
+					for (int i = 0; i < kEventCount; ++i)
+					{
+						ForIndexed(static_cast<std::size_t>(inIndex), [&](auto inEvent)
+						{
+							manager->Notify(sender, decltype(inEvent){1});
+						}, std::make_index_sequence<8>{});
+					}
+				});
+				return sTotal;
+			};
+			workers.Run([&](int inIndex) { manager->Unregister(tokens[static_cast<std::size_t>(inIndex)]); });
+		}
+
+		// Sharded: every thread registers the same event type, so each event is also forwarded to every other thread
+		{
+			auto manager = EventManager::MakeSharded();
+			std::vector<EventManager::Token> tokens(static_cast<std::size_t>(threadCount));
+			workers.Run([&](int inIndex)
+			{
+				tokens[static_cast<std::size_t>(inIndex)] = manager->Register(MakeThreadAccumulator<IndexedEvent<0>>());
+			});
+			BENCHMARK("MakeSharded(), forwarded events" + suffix)
+			{
+				// Every thread notifies, then (once all have) dispatches what the others forwarded to it
+				workers.Run([&](int)
+				{
+					for (int i = 0; i < kEventCount; ++i)
+						manager->Notify(sender, IndexedEvent<0>{1});
+				});
+				workers.Run([&](int) { manager->DispatchForwarded(); });
+				return sTotal;
+			};
+			workers.Run([&](int inIndex) { manager->Unregister(tokens[static_cast<std::size_t>(inIndex)]); });
+		}
+	}
+}
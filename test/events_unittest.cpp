@@ -6,6 +6,11 @@
 //   - EventManager::Register<>() (consume + observe overloads)
 //   - EventManager::Unregister()
 //   - EventManager::Notify<>()
+//   - EventManager::Make(std::pmr::memory_resource*) (when <memory_resource> is available)
+//   - EventManager::MakeSharded()
+//   - EventManager::GetStats() (when instrumentation is enabled), LatencyHistogram
+//   - EventManager::Next<>() (co_await, when coroutines are enabled)
+//   - StaticEventBus<>
 //
 // Framework: Catch2 v3
 // Standard:  C++17
@@ -14,6 +19,13 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "saber/events/event_manager.hpp"
+#include "saber/events/event_stats.hpp"
+#include "saber/events/static_event_bus.hpp"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
 
 // ============================================================================
 // Test event types
@@ -38,6 +50,34 @@ struct TestSender
 
 static TestSender sender{};
 
+// Coalesced event types: last value wins, and merged (summed) deltas
+struct ResizeEvent
+{
+    int mAmount{};
+};
+
+struct ScrollEvent
+{
+    int mAmount{};
+};
+
+template<>
+struct saber::events::CoalesceTraits<ResizeEvent>
+{
+    static constexpr CoalesceKind kKind = CoalesceKind::kLastWins;
+};
+
+template<>
+struct saber::events::CoalesceTraits<ScrollEvent>
+{
+    static constexpr CoalesceKind kKind = CoalesceKind::kMerge;
+
+    static void Merge(ScrollEvent& ioPending, const ScrollEvent& inNext)
+    {
+        ioPending.mAmount += inNext.mAmount;
+    }
+};
+
 // Convenience alias
 using namespace saber::events;
 
@@ -589,3 +629,1143 @@ TEST_CASE("All callbacks unregistered in reverse order — no crashes or missed
     manager->Notify(sender, DamageEvent{99});
     REQUIRE(log.empty());
 }
+
+TEST_CASE("Stale token does not unregister the callback that reused its slot", "[Unregister]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> logA, logB;
+
+    auto tA = manager->Register(MakeLoggingCallback<DamageEvent>(logA));
+    manager->Unregister(tA);
+
+    // tB reuses tA's slot, with a newer generation
+    auto tB = manager->Register(MakeLoggingCallback<DamageEvent>(logB));
+    REQUIRE(tA != tB);
+
+    manager->Unregister(tA);
+    manager->Notify(sender, DamageEvent{4});
+
+    REQUIRE(logA.empty());
+    REQUIRE(logB == std::vector<int>{4});
+    manager->Unregister(tB);
+}
+
+TEST_CASE("Unregister ignores default-constructed and unknown tokens", "[Unregister]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+
+    auto token = manager->Register(MakeLoggingCallback<DamageEvent>(log));
+
+    REQUIRE_NOTHROW(manager->Unregister(EventManager::Token{}));
+    REQUIRE_NOTHROW(manager->Unregister(EventManager::Token{~std::uint64_t{0}}));
+    manager->Notify(sender, DamageEvent{6});
+
+    REQUIRE(log == std::vector<int>{6});
+    manager->Unregister(token);
+}
+
+TEST_CASE("Callback may unregister itself and others during Notify", "[Unregister][Notify]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    EventManager::Token self{};
+    EventManager::Token other{};
+
+    self = manager->Register(
+        EventCallback::Make<TestSender, DamageEvent>([&](const TestSender&, const DamageEvent& e) -> int
+        {
+            log.push_back(e.mAmount);
+            manager->Unregister(self);
+            manager->Unregister(other);
+            return 0;
+        }));
+    auto kept = manager->Register(MakeLoggingCallback<DamageEvent>(log));
+    other = manager->Register(MakeLoggingCallback<HealEvent>(log));
+
+    // Removals made by a callback take effect for the rest of the in-flight Notify, and all later ones
+    manager->Notify(sender, DamageEvent{1});
+    manager->Notify(sender, DamageEvent{2});
+    manager->Notify(sender, HealEvent{3});
+
+    REQUIRE(log == std::vector<int>{1, 1, 2});
+    manager->Unregister(kept);
+}
+
+TEST_CASE("Callback unregistered during Notify is skipped by that Notify", "[Unregister][Notify]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    std::vector<EventManager::Token> tokens(4);
+    for (int i = 0; i < 4; ++i)
+    {
+        tokens[i] = manager->Register(
+            EventCallback::Make<TestSender, DamageEvent>([&, i](const TestSender&, const DamageEvent&) -> int
+            {
+                log.push_back(i);
+                for (auto& token : tokens)
+                    if (token != tokens[i])
+                        manager->Unregister(token); // Everyone else
+                return 0;
+            }));
+    }
+
+    // Whichever callback runs first removes the others before they run
+    manager->Notify(sender, DamageEvent{});
+    REQUIRE(log.size() == 1);
+    manager->Notify(sender, DamageEvent{});
+    REQUIRE(log.size() == 2);
+    REQUIRE(log[0] == log[1]);
+    manager->Unregister(tokens[log[0]]);
+}
+
+TEST_CASE("Callback registered during Notify runs from the next Notify", "[Register][Notify]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    std::vector<EventManager::Token> added;
+    auto adder = manager->Register(
+        EventCallback::Make<TestSender, DamageEvent>([&](const TestSender&, const DamageEvent& e) -> int
+        {
+            added.push_back(manager->Register(MakeLoggingCallback<DamageEvent>(log)));
+            if (e.mAmount == 1)
+                manager->Notify(sender, DamageEvent{2}); // Nested: applied after the outermost Notify
+            return 0;
+        }));
+
+    manager->Notify(sender, DamageEvent{1});
+    REQUIRE(log.empty());
+    REQUIRE(added.size() == 2);
+
+    manager->Unregister(adder);
+    manager->Notify(sender, DamageEvent{3});
+    REQUIRE(log == std::vector<int>{3, 3});
+
+    for (auto token : added)
+        manager->Unregister(token);
+    manager->Notify(sender, DamageEvent{4});
+    REQUIRE(log == std::vector<int>{3, 3});
+}
+
+TEST_CASE("Callback registered and unregistered within one Notify never fires", "[Register][Unregister][Notify]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    auto token = manager->Register(
+        EventCallback::Make<TestSender, HealEvent>([&](const TestSender&, const HealEvent&) -> int
+        {
+            // A new (sender, type) bucket, emptied again before the Notify returns
+            manager->Unregister(manager->Register(MakeLoggingCallback<DamageEvent>(log), &sender));
+            return 0;
+        }));
+
+    manager->Notify(sender, HealEvent{});
+    manager->Notify(sender, DamageEvent{1});
+    REQUIRE(log.empty());
+    manager->Unregister(token);
+}
+
+TEST_CASE("Heavy register/unregister churn keeps the remaining callbacks intact", "[EdgeCase]")
+{
+    auto manager = EventManager::Make();
+    constexpr int kCount = 2000;
+    int totalFired = 0;
+
+    std::vector<EventManager::Token> tokens;
+    for (int i = 0; i < kCount; ++i)
+    {
+        tokens.push_back(manager->Register(
+            EventCallback::Make<TestSender, DamageEvent>([&totalFired](const TestSender&, const DamageEvent&) -> int
+            {
+                ++totalFired;
+                return 0;
+            })));
+    }
+
+    // Unregister every other token, then recycle their slots with new registrations
+    for (int i = 0; i < kCount; i += 2)
+        manager->Unregister(tokens[i]);
+    for (int i = 0; i < kCount; i += 2)
+    {
+        tokens[i] = manager->Register(
+            EventCallback::Make<TestSender, DamageEvent>([&totalFired](const TestSender&, const DamageEvent&) -> int
+            {
+                totalFired += 2;
+                return 0;
+            }));
+    }
+
+    manager->Notify(sender, DamageEvent{});
+    REQUIRE(totalFired == kCount / 2 + kCount);
+
+    for (auto& t : tokens)
+        manager->Unregister(t);
+    totalFired = 0;
+    manager->Notify(sender, DamageEvent{});
+    REQUIRE(totalFired == 0);
+}
+
+// ============================================================================
+// SECTION: Sender-scoped registration
+// ============================================================================
+
+TEST_CASE("Sender-scoped callback only fires for its sender", "[Register][Notify]")
+{
+    auto manager = EventManager::Make();
+    TestSender senderA{1};
+    TestSender senderB{2};
+    std::vector<int> logA, logAny;
+
+    auto tA = manager->Register(MakeLoggingCallback<DamageEvent>(logA), &senderA);
+    auto tAny = manager->Register(MakeLoggingCallback<DamageEvent>(logAny));
+
+    manager->Notify(senderA, DamageEvent{1});
+    manager->Notify(senderB, DamageEvent{2});
+
+    REQUIRE(logA == std::vector<int>{1});
+    REQUIRE(logAny == std::vector<int>{1, 2});
+
+    manager->Unregister(tA);
+    manager->Notify(senderA, DamageEvent{3});
+    REQUIRE(logA == std::vector<int>{1});
+    REQUIRE(logAny == std::vector<int>{1, 2, 3});
+
+    manager->Unregister(tAny);
+}
+
+TEST_CASE("Sender-scoped callbacks are isolated by event type", "[Register][Notify]")
+{
+    auto manager = EventManager::Make();
+    TestSender senderA{1};
+    std::vector<int> damageLog, healLog;
+
+    const auto cb = MakeLoggingCallback<HealEvent>(healLog);
+    auto tDmg = manager->Register(MakeLoggingCallback<DamageEvent>(damageLog), &senderA);
+    auto tHeal = manager->Register(cb, &senderA); // Observe
+
+    manager->Notify(senderA, HealEvent{5});
+
+    REQUIRE(damageLog.empty());
+    REQUIRE(healLog == std::vector<int>{5});
+
+    manager->Unregister(tDmg);
+    manager->Unregister(tHeal);
+}
+
+TEST_CASE("Sender-scoped registration rejects a null or mismatched sender", "[Register]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    const TestSender* noSender = nullptr;
+    int wrongSender = 0;
+
+    REQUIRE_THROWS_AS(manager->Register(MakeLoggingCallback<DamageEvent>(log), noSender), saber::Exception);
+    REQUIRE_THROWS_AS(manager->Register(MakeLoggingCallback<DamageEvent>(log), &wrongSender), saber::Exception);
+}
+
+TEST_CASE("Many senders: each Notify only reaches its own sender's callbacks", "[EdgeCase]")
+{
+    auto manager = EventManager::Make();
+    constexpr int kCount = 200;
+    std::vector<TestSender> senders(kCount);
+    std::vector<int> fired(kCount);
+
+    std::vector<EventManager::Token> tokens;
+    for (int i = 0; i < kCount; ++i)
+    {
+        tokens.push_back(manager->Register(
+            EventCallback::Make<TestSender, DamageEvent>([&fired, i](const TestSender&, const DamageEvent&) -> int
+            {
+                ++fired[i];
+                return 0;
+            }), &senders[i]));
+    }
+
+    manager->Notify(senders[7], DamageEvent{});
+    manager->Notify(senders[7], DamageEvent{});
+    manager->Notify(senders[42], DamageEvent{});
+
+    REQUIRE(fired[7] == 2);
+    REQUIRE(fired[42] == 1);
+    REQUIRE(std::count(fired.begin(), fired.end(), 0) == kCount - 2);
+
+    for (auto& t : tokens)
+        manager->Unregister(t);
+    manager->Notify(senders[7], DamageEvent{});
+    REQUIRE(fired[7] == 2);
+}
+
+// ============================================================================
+// SECTION: Coalescing window
+// ============================================================================
+
+TEST_CASE("Coalesced events are delivered immediately outside a window", "[Coalesce]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    auto token = manager->Register(MakeLoggingCallback<ResizeEvent>(log));
+
+    manager->Notify(sender, ResizeEvent{1});
+    manager->Notify(sender, ResizeEvent{2});
+
+    REQUIRE(log == std::vector<int>{1, 2});
+    manager->Unregister(token);
+}
+
+TEST_CASE("Last-wins events inside a window deliver only the last value", "[Coalesce]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    auto token = manager->Register(MakeLoggingCallback<ResizeEvent>(log));
+
+    manager->BeginWindow();
+    for (int i = 1; i <= 100; ++i)
+        manager->Notify(sender, ResizeEvent{i});
+    REQUIRE(log.empty());
+    manager->EndWindow();
+
+    REQUIRE(log == std::vector<int>{100});
+    manager->Unregister(token);
+}
+
+TEST_CASE("Merged events inside a window are folded by CoalesceTraits::Merge", "[Coalesce]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    auto token = manager->Register(MakeLoggingCallback<ScrollEvent>(log));
+
+    manager->BeginWindow();
+    manager->Notify(sender, ScrollEvent{3});
+    manager->Notify(sender, ScrollEvent{4});
+    manager->Notify(sender, ScrollEvent{-2});
+    manager->EndWindow();
+
+    REQUIRE(log == std::vector<int>{5});
+    manager->Unregister(token);
+}
+
+TEST_CASE("Coalescing is per (sender, event type); other events pass through", "[Coalesce]")
+{
+    auto manager = EventManager::Make();
+    TestSender senderA{1};
+    TestSender senderB{2};
+    std::vector<int> resizeLog, scrollLog, damageLog;
+
+    auto tResize = manager->Register(MakeLoggingCallback<ResizeEvent>(resizeLog));
+    auto tScroll = manager->Register(MakeLoggingCallback<ScrollEvent>(scrollLog));
+    auto tDamage = manager->Register(MakeLoggingCallback<DamageEvent>(damageLog));
+
+    manager->BeginWindow();
+    manager->Notify(senderA, ResizeEvent{1});
+    manager->Notify(senderB, ResizeEvent{2});
+    manager->Notify(senderA, ScrollEvent{10});
+    manager->Notify(senderA, ResizeEvent{3});
+    manager->Notify(senderA, DamageEvent{7});
+    manager->Notify(senderA, ScrollEvent{20});
+    REQUIRE(damageLog == std::vector<int>{7});
+    manager->EndWindow();
+
+    // First-notified order: (senderA, Resize), (senderB, Resize), (senderA, Scroll)
+    REQUIRE(resizeLog == std::vector<int>{3, 2});
+    REQUIRE(scrollLog == std::vector<int>{30});
+
+    manager->Unregister(tResize);
+    manager->Unregister(tScroll);
+    manager->Unregister(tDamage);
+}
+
+TEST_CASE("Nested windows deliver when the outermost window ends", "[Coalesce]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    auto token = manager->Register(MakeLoggingCallback<ResizeEvent>(log));
+
+    manager->BeginWindow();
+    manager->Notify(sender, ResizeEvent{1});
+    manager->BeginWindow();
+    manager->Notify(sender, ResizeEvent{2});
+    manager->EndWindow();
+    REQUIRE(log.empty());
+    manager->EndWindow();
+    REQUIRE(log == std::vector<int>{2});
+
+    // Unbalanced EndWindow() is ignored
+    REQUIRE_NOTHROW(manager->EndWindow());
+    manager->Notify(sender, ResizeEvent{3});
+    REQUIRE(log == std::vector<int>{2, 3});
+    manager->Unregister(token);
+}
+
+TEST_CASE("Callback notifying during window delivery is delivered immediately", "[Coalesce]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+
+    auto tScroll = manager->Register(
+        EventCallback::Make<TestSender, ScrollEvent>([&](const TestSender& inSender, const ScrollEvent& e) -> int
+        {
+            manager->Notify(inSender, ResizeEvent{e.mAmount * 10});
+            return 0;
+        }));
+    auto tResize = manager->Register(MakeLoggingCallback<ResizeEvent>(log));
+
+    manager->BeginWindow();
+    manager->Notify(sender, ScrollEvent{1});
+    manager->Notify(sender, ScrollEvent{2});
+    manager->EndWindow();
+
+    REQUIRE(log == std::vector<int>{30});
+    manager->Unregister(tScroll);
+    manager->Unregister(tResize);
+}
+
+// ============================================================================
+// SECTION: Sharded EventManager
+// ============================================================================
+
+TEST_CASE("Sharded manager dispatches on a single thread like Make()", "[Sharded]")
+{
+    auto manager = EventManager::MakeSharded();
+    std::vector<int> damageLog, healLog;
+    auto tDmg = manager->Register(MakeLoggingCallback<DamageEvent>(damageLog));
+    auto tHeal = manager->Register(MakeLoggingCallback<HealEvent>(healLog), &sender);
+
+    manager->Notify(sender, DamageEvent{1});
+    manager->Notify(sender, HealEvent{2});
+    REQUIRE(damageLog == std::vector<int>{1});
+    REQUIRE(healLog == std::vector<int>{2});
+    REQUIRE(manager->DispatchForwarded() == 0);
+
+    manager->Unregister(tDmg);
+    manager->Unregister(tHeal);
+    manager->Notify(sender, DamageEvent{3});
+    REQUIRE(damageLog == std::vector<int>{1});
+}
+
+TEST_CASE("Sharded manager forwards events to the registering thread", "[Sharded]")
+{
+    auto manager = EventManager::MakeSharded();
+    std::vector<int> mainLog;
+    auto token = manager->Register(MakeLoggingCallback<DamageEvent>(mainLog));
+
+    std::vector<int> workerLog;
+    std::thread worker{[&]
+    {
+        auto workerToken = manager->Register(MakeLoggingCallback<DamageEvent>(workerLog));
+        manager->Notify(sender, DamageEvent{1});
+        manager->Notify(sender, HealEvent{2}); // No callbacks for it: not forwarded
+        manager->Notify(sender, DamageEvent{3});
+        manager->Unregister(workerToken);
+    }};
+    worker.join();
+
+    // Dispatched on the worker immediately; held for this thread until it dispatches them
+    REQUIRE(workerLog == std::vector<int>{1, 3});
+    REQUIRE(mainLog.empty());
+    REQUIRE(manager->DispatchForwarded() == 2);
+    REQUIRE(mainLog == std::vector<int>{1, 3});
+    REQUIRE(manager->DispatchForwarded() == 0);
+
+    manager->Unregister(token);
+}
+
+TEST_CASE("Sharded manager requires Unregister on the registering thread", "[Sharded]")
+{
+    auto manager = EventManager::MakeSharded();
+    std::vector<int> log;
+    auto token = manager->Register(MakeLoggingCallback<DamageEvent>(log));
+
+    bool didThrow = false;
+    std::thread worker{[&]
+    {
+        try
+        {
+            manager->Unregister(token);
+        }
+        catch (const saber::Exception&)
+        {
+            didThrow = true;
+        }
+    }};
+    worker.join();
+    REQUIRE(didThrow);
+
+    manager->Unregister(token);
+    manager->Unregister(token); // Stale: ignored
+}
+
+TEST_CASE("Sharded manager detaches a thread's shard when the thread exits", "[Sharded][EdgeCase]")
+{
+    auto manager = EventManager::MakeSharded();
+    auto alive = std::make_shared<int>(0);
+    std::atomic<int> calls{0};
+    std::vector<EventManager::Token> tokens;
+
+    // Threads one after another: their ids are likely reused, but none inherits a previous shard
+    for (int i = 0; i < 8; ++i)
+    {
+        std::thread worker{[&]
+        {
+            tokens.push_back(manager->Register(EventCallback::Make<TestSender, DamageEvent>(
+                [&calls, alive](const TestSender&, const DamageEvent&) -> int
+                {
+                    ++calls;
+                    return 0;
+                })));
+            manager->Notify(sender, DamageEvent{1});
+        }};
+        worker.join(); // Exits without unregistering
+
+        manager->Notify(sender, DamageEvent{2}); // No thread left to forward it to
+    }
+    REQUIRE(calls == 8);
+    REQUIRE(alive.use_count() == 1); // Callbacks are destroyed with their shards
+
+    std::size_t delivered = 1;
+    std::thread later{[&]
+    {
+        delivered = manager->DispatchForwarded();
+        manager->Notify(sender, DamageEvent{3});
+    }};
+    later.join();
+    REQUIRE(delivered == 0);
+    REQUIRE(calls == 8);
+
+    // Tokens of exited threads are stale: ignored
+    for (auto token : tokens)
+    {
+        REQUIRE_NOTHROW(manager->Unregister(token));
+    }
+}
+
+TEST_CASE("Sharded manager delivers every thread's events to every thread", "[Sharded][EdgeCase]")
+{
+    auto manager = EventManager::MakeSharded();
+    constexpr int kThreadCount = 8;
+    constexpr int kEventCount = 100;
+    std::atomic<int> registered{0};
+    std::atomic<int> notified{0};
+    std::vector<int> totals(kThreadCount, 0);
+
+    auto run = [&](int inIndex)
+    {
+        int& total = totals[inIndex];
+        auto token = manager->Register(EventCallback::Make<TestSender, DamageEvent>(
+            [&total](const TestSender&, const DamageEvent& e) -> int
+            {
+                total += e.mAmount;
+                return 0;
+            }));
+        ++registered;
+        while (registered < kThreadCount)
+            std::this_thread::yield();
+
+        for (int i = 0; i < kEventCount; ++i)
+            manager->Notify(sender, DamageEvent{1});
+        ++notified;
+        while (notified < kThreadCount)
+            std::this_thread::yield();
+
+        manager->DispatchForwarded();
+        manager->Unregister(token);
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreadCount; ++i)
+        threads.emplace_back(run, i);
+    for (auto& thread : threads)
+        thread.join();
+
+    for (int total : totals)
+        REQUIRE(total == kThreadCount * kEventCount);
+}
+
+TEST_CASE("Sharded managers used alternately on one thread each keep their shard", "[Sharded][EdgeCase]")
+{
+    auto first = EventManager::MakeSharded();
+    auto second = EventManager::MakeSharded();
+    std::vector<int> firstLog, secondLog;
+    auto firstToken = first->Register(MakeLoggingCallback<DamageEvent>(firstLog));
+    auto secondToken = second->Register(MakeLoggingCallback<DamageEvent>(secondLog));
+
+    // Each manager finds this thread's shard, however the calls interleave: delivered locally, never forwarded
+    for (int i = 0; i < 4; ++i)
+    {
+        first->Notify(sender, DamageEvent{i});
+        second->Notify(sender, DamageEvent{10 + i});
+    }
+    REQUIRE(firstLog == std::vector<int>{0, 1, 2, 3});
+    REQUIRE(secondLog == std::vector<int>{10, 11, 12, 13});
+    REQUIRE(first->DispatchForwarded() == 0);
+    REQUIRE(second->DispatchForwarded() == 0);
+
+    // A manager made after another is destroyed (maybe at the same address) gets a shard of its own
+    first->Unregister(firstToken);
+    first.reset();
+    auto third = EventManager::MakeSharded();
+    std::vector<int> thirdLog;
+    auto thirdToken = third->Register(MakeLoggingCallback<DamageEvent>(thirdLog));
+    third->Notify(sender, DamageEvent{20});
+    second->Notify(sender, DamageEvent{14});
+    third->Notify(sender, DamageEvent{21});
+    REQUIRE(thirdLog == std::vector<int>{20, 21});
+    REQUIRE(secondLog == std::vector<int>{10, 11, 12, 13, 14});
+
+    third->Unregister(thirdToken);
+    second->Unregister(secondToken);
+}
+
+// ============================================================================
+// SECTION: Instrumentation
+// ============================================================================
+
+TEST_CASE("LatencyHistogram buckets stay within their sub-bucket precision", "[Stats]")
+{
+    using saber::events::LatencyHistogram;
+    for (std::uint64_t value : {0ull, 1ull, 7ull, 8ull, 15ull, 16ull, 17ull, 1000ull, 123456789ull, ~0ull})
+    {
+        const std::size_t index = LatencyHistogram::GetBucketIndex(value);
+        REQUIRE(index < LatencyHistogram::kBucketCount);
+        REQUIRE(LatencyHistogram::GetBucketLowerBound(index) <= value);
+        REQUIRE(value <= LatencyHistogram::GetBucketUpperBound(index));
+        REQUIRE(LatencyHistogram::GetBucketUpperBound(index) - LatencyHistogram::GetBucketLowerBound(index)
+                <= LatencyHistogram::GetBucketLowerBound(index) / LatencyHistogram::kSubBucketCount);
+    }
+    REQUIRE(LatencyHistogram::GetBucketIndex(~0ull) == LatencyHistogram::kBucketCount - 1);
+}
+
+TEST_CASE("LatencyHistogram reports count, mean, percentiles and max", "[Stats]")
+{
+    saber::events::LatencyHistogram histogram;
+    REQUIRE(histogram.GetPercentile(50.0) == 0);
+
+    for (std::uint64_t i = 1; i <= 100; ++i)
+        histogram.Record(i * 1000);
+
+    REQUIRE(histogram.GetCount() == 100);
+    REQUIRE(histogram.GetMean() == 50500);
+    REQUIRE(histogram.GetMax() == 100000);
+    const std::uint64_t p50 = histogram.GetPercentile(50.0);
+    REQUIRE(p50 >= 50000);
+    REQUIRE(p50 <= 50000 + 50000 / 8);
+    REQUIRE(histogram.GetPercentile(100.0) == 100000);
+
+    saber::events::LatencyHistogram other;
+    other.Record(1);
+    histogram.Merge(other);
+    REQUIRE(histogram.GetCount() == 101);
+    REQUIRE(histogram.GetPercentile(0.0) == 1);
+}
+
+TEST_CASE("EventStats dumps escaped JSON", "[Stats]")
+{
+    saber::events::EventStats stats;
+    stats.mEventTypes.push_back({"a\"b", 3, 6});
+    stats.mHandlers.push_back({7, "c\\d", {}});
+    stats.mHandlers.back().mLatency.Record(10);
+
+    REQUIRE(stats.ToJson() ==
+        "{\"eventTypes\":[{\"name\":\"a\\\"b\",\"notifyCount\":3,\"fanOut\":6}],"
+        "\"handlers\":[{\"token\":7,\"name\":\"c\\\\d\",\"count\":1,\"meanNs\":10,\"p50Ns\":10,\"p99Ns\":10,\"maxNs\":10}]}");
+}
+
+#if SABER_EVENTS_CONFIG_ISENABLED_STATS
+TEST_CASE("GetStats counts notifies, fan-out and callback latencies", "[Stats]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> logA, logB;
+    auto tA = manager->Register(MakeLoggingCallback<DamageEvent>(logA));
+    auto tB = manager->Register(MakeLoggingCallback<DamageEvent>(logB));
+
+    for (int i = 0; i < 10; ++i)
+        manager->Notify(sender, DamageEvent{i});
+    manager->Notify(sender, HealEvent{1});
+
+    const auto stats = manager->GetStats();
+    REQUIRE(stats.mEventTypes.size() == 2);
+    for (const auto& eventType : stats.mEventTypes)
+    {
+        const bool isDamage = (eventType.mName.find("DamageEvent") != std::string::npos);
+        REQUIRE(eventType.mNotifyCount == (isDamage ? 10 : 1));
+        REQUIRE(eventType.mFanOut == (isDamage ? 20 : 0));
+    }
+
+    REQUIRE(stats.mHandlers.size() == 2);
+    for (const auto& handler : stats.mHandlers)
+    {
+        REQUIRE((handler.mToken == tA.Value() || handler.mToken == tB.Value()));
+        REQUIRE(handler.mLatency.GetCount() == 10);
+    }
+    REQUIRE(stats.ToJson().find("\"handlers\":[{\"token\":") != std::string::npos);
+
+    // Unregistered callbacks are no longer reported
+    manager->Unregister(tA);
+    REQUIRE(manager->GetStats().mHandlers.size() == 1);
+    manager->Unregister(tB);
+}
+
+TEST_CASE("GetStats of a sharded manager sums its shards, reporting sharded tokens", "[Stats][Sharded]")
+{
+    auto manager = EventManager::MakeSharded();
+    std::vector<int> log;
+    auto token = manager->Register(MakeLoggingCallback<DamageEvent>(log));
+
+    std::thread worker{[&]
+    {
+        manager->Notify(sender, DamageEvent{1});
+        manager->Notify(sender, DamageEvent{2});
+    }};
+    worker.join();
+    manager->Notify(sender, DamageEvent{3});
+    manager->DispatchForwarded();
+
+    const auto stats = manager->GetStats();
+    REQUIRE(stats.mEventTypes.size() == 1);
+    // Counted per shard dispatch: 2 forwarded + 1 local on this thread (the exited worker's shard is gone)
+    REQUIRE(stats.mEventTypes[0].mNotifyCount == 3);
+    REQUIRE(stats.mEventTypes[0].mFanOut == 3);
+    REQUIRE(stats.mHandlers.size() == 1);
+    REQUIRE(stats.mHandlers[0].mToken == token.Value());
+    manager->Unregister(token);
+}
+#endif // SABER_EVENTS_CONFIG_ISENABLED_STATS
+
+#if SABER_EVENTS_CONFIG_ISENABLED_PMR
+// ============================================================================
+// SECTION: Memory resource
+// ============================================================================
+
+namespace {
+
+// Counts the (outstanding) allocations made through it
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    int mAllocations{0};
+    int mOutstanding{0};
+
+private:
+    void* do_allocate(std::size_t inBytes, std::size_t inAlignment) override
+    {
+        ++mAllocations;
+        ++mOutstanding;
+        return std::pmr::new_delete_resource()->allocate(inBytes, inAlignment);
+    }
+
+    void do_deallocate(void* ioStorage, std::size_t inBytes, std::size_t inAlignment) override
+    {
+        --mOutstanding;
+        std::pmr::new_delete_resource()->deallocate(ioStorage, inBytes, inAlignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& inOther) const noexcept override
+    {
+        return this == &inOther;
+    }
+};
+
+} // namespace
+
+TEST_CASE("Make(memory_resource) allocates the manager's storage from it", "[Make][Memory]")
+{
+    CountingResource resource;
+    {
+        auto manager = EventManager::Make(&resource);
+        std::vector<int> log;
+        std::vector<EventManager::Token> tokens;
+        for (int i = 0; i < 16; ++i)
+            tokens.push_back(manager->Register(MakeLoggingCallback<DamageEvent>(log), &sender));
+        auto churn = manager->Register(
+            EventCallback::Make<TestSender, DamageEvent>([&](const TestSender&, const DamageEvent&) -> int
+            {
+                manager->Unregister(manager->Register(MakeLoggingCallback<HealEvent>(log)));
+                return 0;
+            }));
+        REQUIRE(resource.mAllocations > 0);
+
+        manager->BeginWindow();
+        manager->Notify(sender, ResizeEvent{1});
+        manager->EndWindow();
+        manager->Notify(sender, DamageEvent{2});
+        REQUIRE(log.size() == 16);
+
+        for (auto token : tokens)
+            manager->Unregister(token);
+        manager->Unregister(churn);
+    }
+    REQUIRE(resource.mOutstanding == 0);
+}
+
+TEST_CASE("Make(memory_resource) works with a monotonic buffer", "[Make][Memory]")
+{
+    std::byte buffer[16 * 1024];
+    std::pmr::monotonic_buffer_resource arena{buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    auto manager = EventManager::Make(&arena);
+    std::vector<int> log;
+    auto token = manager->Register(MakeLoggingCallback<DamageEvent>(log));
+    manager->Notify(sender, DamageEvent{5});
+    REQUIRE(log == std::vector<int>{5});
+    manager->Unregister(token);
+}
+
+TEST_CASE("Make(memory_resource) rejects a null resource", "[Make][Memory]")
+{
+    REQUIRE_THROWS_AS(EventManager::Make(nullptr), saber::Exception);
+}
+#endif // SABER_EVENTS_CONFIG_ISENABLED_PMR
+
+// ============================================================================
+// SECTION: StaticEventBus
+// ============================================================================
+
+using TestBus = StaticEventBus<TestSender, DamageEvent, HealEvent>;
+
+template<typename EventType>
+auto MakeLoggingHandler(std::vector<int>& outLog)
+{
+    return [&outLog](const TestSender&, const EventType& inEvent) -> int
+    {
+        outLog.push_back(inEvent.mAmount);
+        return 0;
+    };
+}
+
+TEST_CASE("StaticEventBus dispatches by event type", "[StaticEventBus]")
+{
+    TestBus bus;
+    std::vector<int> damageLogA, damageLogB, healLog;
+
+    auto tA = bus.Register<DamageEvent>(MakeLoggingHandler<DamageEvent>(damageLogA));
+    auto tB = bus.Register<DamageEvent>(MakeLoggingHandler<DamageEvent>(damageLogB));
+    auto tHeal = bus.Register<HealEvent>(MakeLoggingHandler<HealEvent>(healLog));
+    REQUIRE(tA != tB);
+
+    bus.Notify(sender, DamageEvent{3});
+    bus.Notify(sender, HealEvent{4});
+
+    REQUIRE(damageLogA == std::vector<int>{3});
+    REQUIRE(damageLogB == std::vector<int>{3});
+    REQUIRE(healLog == std::vector<int>{4});
+
+    bus.Unregister(tA);
+    bus.Notify(sender, DamageEvent{5});
+    REQUIRE(damageLogA == std::vector<int>{3});
+    REQUIRE(damageLogB == std::vector<int>{3, 5});
+
+    // Stale and default tokens are ignored
+    REQUIRE_NOTHROW(bus.Unregister(tA));
+    REQUIRE_NOTHROW(bus.Unregister(TestBus::Token{}));
+    bus.Notify(sender, DamageEvent{6});
+    REQUIRE(damageLogB == std::vector<int>{3, 5, 6});
+
+    bus.Unregister(tB);
+    bus.Unregister(tHeal);
+    bus.Notify(sender, DamageEvent{7});
+    REQUIRE(damageLogB == std::vector<int>{3, 5, 6});
+}
+
+TEST_CASE("StaticEventBus stores small and large callables, and destroys them on Unregister", "[StaticEventBus]")
+{
+    TestBus bus;
+    std::vector<int> log;
+    auto alive = std::make_shared<int>(0);
+
+    // Fits in place, and is move-only
+    auto small = bus.Register<DamageEvent>([&log, owned = std::make_unique<int>(10)](const TestSender&, const DamageEvent& e) -> int
+    {
+        log.push_back(*owned + e.mAmount);
+        return 0;
+    });
+
+    // Too large to fit in place, so it is allocated
+    std::array<int, 16> offsets{};
+    offsets.back() = 20;
+    auto large = bus.Register<DamageEvent>([&log, offsets, alive](const TestSender&, const DamageEvent& e) mutable -> int
+    {
+        log.push_back(offsets.back() + e.mAmount);
+        offsets.back() += 100; // state persists across calls
+        return 0;
+    });
+    REQUIRE(alive.use_count() == 2);
+
+    // Register more handlers, so the handler list reallocates and moves both
+    std::vector<TestBus::Token> others;
+    for (int i = 0; i < 32; ++i)
+    {
+        others.push_back(bus.Register<HealEvent>(MakeLoggingHandler<HealEvent>(log)));
+        others.push_back(bus.Register<DamageEvent>([](const TestSender&, const DamageEvent&) { return 0; }));
+    }
+
+    bus.Notify(sender, DamageEvent{1});
+    bus.Notify(sender, DamageEvent{2});
+    REQUIRE(log == std::vector<int>{11, 21, 12, 122});
+
+    bus.Unregister(large);
+    REQUIRE(alive.use_count() == 1);
+    bus.Unregister(small);
+    for (auto token : others)
+    {
+        bus.Unregister(token);
+    }
+    log.clear();
+    bus.Notify(sender, DamageEvent{3});
+    REQUIRE(log.empty());
+}
+
+TEST_CASE("StaticEventBus handler may unregister itself and register others during Notify", "[StaticEventBus]")
+{
+    TestBus bus;
+    std::vector<int> log;
+    TestBus::Token self{};
+    TestBus::Token added{};
+
+    self = bus.Register<DamageEvent>([&](const TestSender&, const DamageEvent& e) -> int
+    {
+        bus.Unregister(self);
+        added = bus.Register<DamageEvent>(MakeLoggingHandler<DamageEvent>(log));
+        log.push_back(-e.mAmount); // captures still alive after unregistering itself
+        return 0;
+    });
+    auto kept = bus.Register<DamageEvent>(MakeLoggingHandler<DamageEvent>(log));
+
+    // The added handler only sees later notifications
+    bus.Notify(sender, DamageEvent{1});
+    REQUIRE(log == std::vector<int>{-1, 1});
+    bus.Notify(sender, DamageEvent{2});
+    REQUIRE(log == std::vector<int>{-1, 1, 2, 2});
+
+    bus.Unregister(added);
+    bus.Unregister(kept);
+    bus.Notify(sender, DamageEvent{3});
+    REQUIRE(log == std::vector<int>{-1, 1, 2, 2});
+}
+
+TEST_CASE("StaticEventBus handler registered and unregistered within one Notify never fires", "[StaticEventBus]")
+{
+    TestBus bus;
+    std::vector<int> log;
+
+    auto token = bus.Register<HealEvent>([&](const TestSender&, const HealEvent&) -> int
+    {
+        auto transient = bus.Register<DamageEvent>(MakeLoggingHandler<DamageEvent>(log));
+        bus.Notify(sender, DamageEvent{1}); // re-entrant: transient is not yet added
+        bus.Unregister(transient);
+        return 0;
+    });
+
+    bus.Notify(sender, HealEvent{});
+    bus.Notify(sender, DamageEvent{2});
+    REQUIRE(log.empty());
+    bus.Unregister(token);
+}
+
+TEST_CASE("StaticEventBus applies pending changes when a handler throws", "[StaticEventBus]")
+{
+    TestBus bus;
+    std::vector<int> log;
+    auto logging = bus.Register<DamageEvent>(MakeLoggingHandler<DamageEvent>(log));
+    TestBus::Token added{};
+    auto thrower = bus.Register<HealEvent>([&](const TestSender&, const HealEvent&) -> int
+    {
+        added = bus.Register<DamageEvent>(MakeLoggingHandler<DamageEvent>(log));
+        throw 42;
+    });
+
+    REQUIRE_THROWS(bus.Notify(sender, HealEvent{}));
+
+    // The handler registered during the failed Notify was applied: unregistering it leaves the others intact
+    bus.Notify(sender, DamageEvent{1});
+    REQUIRE(log == std::vector<int>{1, 1});
+    bus.Unregister(added);
+    bus.Notify(sender, DamageEvent{2});
+    REQUIRE(log == std::vector<int>{1, 1, 2});
+
+    bus.Unregister(thrower);
+    bus.Unregister(logging);
+    bus.Notify(sender, DamageEvent{3});
+    REQUIRE(log == std::vector<int>{1, 1, 2});
+}
+
+TEST_CASE("StaticEventBus heavy churn keeps tokens and handlers consistent", "[StaticEventBus]")
+{
+    TestBus bus;
+    constexpr int kCount = 1000;
+    int totalFired = 0;
+    auto handler = [&totalFired](const TestSender&, const DamageEvent& e) -> int
+    {
+        totalFired += e.mAmount;
+        return 0;
+    };
+
+    std::vector<TestBus::Token> tokens;
+    for (int i = 0; i < kCount; ++i)
+        tokens.push_back(bus.Register<DamageEvent>(handler));
+
+    // Unregister every third handler from within a Notify(), then the rest outside of one
+    auto unregister = bus.Register<HealEvent>([&](const TestSender&, const HealEvent&) -> int
+    {
+        for (int i = 0; i < kCount; i += 3)
+            bus.Unregister(tokens[i]);
+        return 0;
+    });
+    bus.Notify(sender, HealEvent{});
+    bus.Notify(sender, DamageEvent{1});
+    REQUIRE(totalFired == kCount - (kCount + 2) / 3);
+
+    for (int i = 0; i < kCount; ++i)
+        bus.Unregister(tokens[i]);
+    totalFired = 0;
+    bus.Notify(sender, DamageEvent{1});
+    REQUIRE(totalFired == 0);
+    bus.Unregister(unregister);
+}
+
+#if SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
+// ============================================================================
+// SECTION: co_await EventManager::Next()
+// ============================================================================
+
+namespace {
+
+// Minimal eager, fire-and-forget coroutine: runs until its first co_await, frame freed on completion
+struct FireAndForget
+{
+    struct promise_type
+    {
+        FireAndForget get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+FireAndForget AwaitDamage(EventManager& ioManager, std::vector<int>& ioLog, int inCount)
+{
+    for (int i = 0; i < inCount; ++i)
+    {
+        const DamageEvent event = co_await ioManager.Next<TestSender, DamageEvent>();
+        ioLog.push_back(event.mAmount);
+    }
+}
+
+} // namespace
+
+TEST_CASE("co_await Next resumes on the next event of its type", "[Await]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    AwaitDamage(*manager, log, 1);
+    REQUIRE(log.empty());
+
+    manager->Notify(sender, HealEvent{7});
+    REQUIRE(log.empty());
+
+    manager->Notify(sender, DamageEvent{3});
+    REQUIRE(log == std::vector<int>{3});
+
+    // Resumed once: later events are not delivered to it
+    manager->Notify(sender, DamageEvent{4});
+    REQUIRE(log == std::vector<int>{3});
+}
+
+TEST_CASE("co_await Next in a loop awaits again after each resume", "[Await]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    AwaitDamage(*manager, log, 3);
+
+    for (int i = 1; i <= 5; ++i)
+        manager->Notify(sender, DamageEvent{i});
+
+    REQUIRE(log == std::vector<int>{1, 2, 3});
+}
+
+TEST_CASE("co_await Next filter selects the sender and event", "[Await]")
+{
+    auto manager = EventManager::Make();
+    TestSender senderA{1};
+    TestSender senderB{2};
+    std::vector<int> log;
+
+    auto awaitBigHitOnB = [](EventManager& ioManager, const TestSender& inSender, std::vector<int>& ioLog) -> FireAndForget
+    {
+        const DamageEvent event = co_await ioManager.Next<TestSender, DamageEvent>(
+            [&inSender](const TestSender& s, const DamageEvent& e) { return &s == &inSender && e.mAmount >= 10; });
+        ioLog.push_back(event.mAmount);
+    };
+    awaitBigHitOnB(*manager, senderB, log);
+
+    manager->Notify(senderA, DamageEvent{50});
+    manager->Notify(senderB, DamageEvent{5});
+    REQUIRE(log.empty());
+    manager->Notify(senderB, DamageEvent{20});
+    REQUIRE(log == std::vector<int>{20});
+}
+
+TEST_CASE("co_await Next resumes after the event's callbacks, in suspension order", "[Await]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    auto token = manager->Register(EventCallback::Make<TestSender, DamageEvent>(
+        [&log](const TestSender&, const DamageEvent&) -> int
+        {
+            log.push_back(0);
+            return 0;
+        }));
+
+    AwaitDamage(*manager, log, 1);
+    AwaitDamage(*manager, log, 1);
+    manager->Notify(sender, DamageEvent{9});
+
+    REQUIRE(log == std::vector<int>{0, 9, 9});
+    manager->Unregister(token);
+}
+
+TEST_CASE("co_await Next on a coalesced event resumes when the window ends", "[Await][Coalesce]")
+{
+    auto manager = EventManager::Make();
+    std::vector<int> log;
+    auto awaitResize = [](EventManager& ioManager, std::vector<int>& ioLog) -> FireAndForget
+    {
+        const ResizeEvent event = co_await ioManager.Next<TestSender, ResizeEvent>();
+        ioLog.push_back(event.mAmount);
+    };
+    awaitResize(*manager, log);
+
+    manager->BeginWindow();
+    manager->Notify(sender, ResizeEvent{1});
+    manager->Notify(sender, ResizeEvent{2});
+    REQUIRE(log.empty());
+    manager->EndWindow();
+
+    REQUIRE(log == std::vector<int>{2});
+}
+
+TEST_CASE("Destroying the EventManager detaches suspended awaiters", "[Await]")
+{
+    std::vector<int> log;
+    std::coroutine_handle<> handle{};
+    {
+        auto manager = EventManager::Make();
+        struct Capture
+        {
+            std::coroutine_handle<>& mHandle;
+            bool await_ready() const noexcept { return false; }
+            bool await_suspend(std::coroutine_handle<> inHandle) { mHandle = inHandle; return false; }
+            void await_resume() const noexcept {}
+        };
+        auto awaitDamage = [](EventManager& ioManager, std::coroutine_handle<>& ioHandle, std::vector<int>& ioLog) -> FireAndForget
+        {
+            co_await Capture{ioHandle};
+            const DamageEvent event = co_await ioManager.Next<TestSender, DamageEvent>();
+            ioLog.push_back(event.mAmount);
+        };
+        awaitDamage(*manager, handle, log);
+    }
+
+    // The frame outlives the manager; destroying it afterwards must not touch the manager
+    REQUIRE(log.empty());
+    handle.destroy();
+}
+#endif // SABER_EVENTS_CONFIG_ISENABLED_COROUTINE
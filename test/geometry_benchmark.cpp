@@ -30,10 +30,16 @@
 #include "saber/geometry/point.hpp"
 #include "saber/geometry/size.hpp"
 #include "saber/geometry/rectangle.hpp"
+#include "saber/geometry/rectangle_ltrb.hpp"
+#include "saber/geometry/rectangle_packer.hpp"
+#include "saber/geometry/clip.hpp"
 #include "saber/geometry/matrix.hpp"
+#include "saber/geometry/matrix3.hpp"
+#include "saber/geometry/matrix4.hpp"
 
 // std
 #include <array>
+#include <cstdint>
 #include <ctime>
 #include <iostream>
 #include <string>
@@ -170,6 +176,24 @@ void PointScaleWork()
 	sPoint<T, Impl>.Scale(point);
 }
 
+template<typename T, saber::geometry::ImplKind Impl>
+void PointDivByWork()
+{
+	// One divisor applied to a batch of points: prepared once, outside the loop
+	const saber::geometry::Divisor<T> divisor{ static_cast<T>(7) };
+	auto point = sPoint<T, Impl>;
+
+	point.DivBy(divisor);
+	point.DivBy(divisor);
+	point.DivBy(divisor);
+	point.DivBy(divisor);
+	point.DivBy(divisor);
+	point.DivBy(divisor);
+	point.DivBy(divisor);
+	point.DivBy(divisor);
+	sPoint<T, Impl> += point;
+}
+
 template<typename T, saber::geometry::ImplKind Impl>
 void PointTranslateWork()
 {
@@ -280,6 +304,9 @@ TEMPLATE_TEST_CASE("saber::geometry::Point", "[saber][benchmark][template]", int
 	BENCHMARK(pointScalarName + "Scale()") { PointScaleWork<TestType, ImplKind::kScalar>(); };
 	BENCHMARK(pointSimdName + "Scale()") { PointScaleWork<TestType, ImplKind::kSimd>(); };
 
+	BENCHMARK(pointScalarName + "DivBy()") { PointDivByWork<TestType, ImplKind::kScalar>(); };
+	BENCHMARK(pointSimdName + "DivBy()") { PointDivByWork<TestType, ImplKind::kSimd>(); };
+
 	BENCHMARK(pointScalarName + "Translate()") { PointTranslateWork<TestType, ImplKind::kScalar>(); };
 	BENCHMARK(pointSimdName + "Translate()") { PointTranslateWork<TestType, ImplKind::kSimd>(); };
 
@@ -738,6 +765,134 @@ void RectangleTruncWork()
 	sRectangle<T, Impl> = RoundTrunc(rect);
 }
 
+template<typename T, saber::geometry::ImplKind Impl>
+alignas(16) std::array<saber::geometry::Rectangle<T, Impl>, 256> sLayoutRects{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+alignas(16) std::array<saber::geometry::Rectangle<int, Impl>, 256> sPixelRects{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+void RectangleRoundThenConvertWork()
+{
+	// Per-rectangle baseline: round, then convert each element
+	for (std::size_t i = 0; i < sLayoutRects<T, Impl>.size(); ++i)
+	{
+		const auto rect = RoundFloor(sLayoutRects<T, Impl>[i]);
+		sPixelRects<T, Impl>[i] = saber::geometry::Rectangle<int, Impl>{
+			static_cast<int>(rect.X()), static_cast<int>(rect.Y()),
+			static_cast<int>(rect.Width()), static_cast<int>(rect.Height())};
+	}
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+void RectangleConvertFromWork()
+{
+	using saber::geometry::RoundKind;
+	saber::geometry::Rectangle<int, Impl>::template ConvertFrom<RoundKind::kFloor>(
+		sLayoutRects<T, Impl>.data(), sPixelRects<T, Impl>.data(), sLayoutRects<T, Impl>.size());
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+void RectangleConvertFromSaturateWork()
+{
+	using saber::geometry::OverflowKind;
+	using saber::geometry::RoundKind;
+	saber::geometry::Rectangle<int, Impl>::template ConvertFrom<RoundKind::kFloor, OverflowKind::kSaturate>(
+		sLayoutRects<T, Impl>.data(), sPixelRects<T, Impl>.data(), sLayoutRects<T, Impl>.size());
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+alignas(16) std::array<saber::geometry::Rectangle<T, Impl>, 256> sUnionRects{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+alignas(16) std::array<saber::geometry::Point<T, Impl>, 256> sBoundsPoints{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+void RectangleUnionLoopWork()
+{
+	// Per-rectangle baseline: each Union() converts to edges and back
+	auto rect = sUnionRects<T, Impl>[0];
+	for (std::size_t i = 1; i < sUnionRects<T, Impl>.size(); ++i)
+	{
+		rect.Union(sUnionRects<T, Impl>[i]);
+	}
+	sRectangle<T, Impl> = rect;
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+void RectangleUnionAllWork()
+{
+	sRectangle<T, Impl> = UnionAll(sUnionRects<T, Impl>.data(), sUnionRects<T, Impl>.size());
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+void RectangleBoundingBoxWork()
+{
+	sRectangle<T, Impl> = BoundingBox(sBoundsPoints<T, Impl>.data(), sBoundsPoints<T, Impl>.size());
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+alignas(16) std::array<saber::geometry::RectangleLTRB<T, Impl>, 256> sUnionRectsLTRB{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+void RectangleClipChainWork()
+{
+	// Damage rectangle: union of every rectangle clipped to the (shrinking) clip rectangle
+	auto clip = sRectangle<T, Impl>;
+	saber::geometry::Rectangle<T, Impl> damage{};
+	for (const auto& rect : sUnionRects<T, Impl>)
+	{
+		damage.Union(Intersect(rect, clip));
+		clip.Union(rect).Intersect(sUnionRects<T, Impl>[0]);
+	}
+	sRectangle<T, Impl> = damage;
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+void RectangleLTRBClipChainWork()
+{
+	// Same chain as RectangleClipChainWork(), converting between origin+size and edges only at the ends
+	saber::geometry::RectangleLTRB<T, Impl> clip{sRectangle<T, Impl>};
+	saber::geometry::RectangleLTRB<T, Impl> damage{};
+	for (const auto& rect : sUnionRectsLTRB<T, Impl>)
+	{
+		damage.Union(Intersect(rect, clip));
+		clip.Union(rect).Intersect(sUnionRectsLTRB<T, Impl>[0]);
+	}
+	sRectangle<T, Impl> = damage.ToRectangle();
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+alignas(16) std::array<saber::geometry::Point<T, Impl>, 512> sClipSegments{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+alignas(16) std::array<saber::geometry::Point<T, Impl>, 512> sClippedSegments{};
+
+std::array<std::uint32_t, 8> sClipAcceptMask{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+void ClipSegmentsWork()
+{
+	const saber::geometry::Rectangle<T, Impl> clip{T{0}, T{0}, T{100}, T{100}};
+	ClipSegments(clip, sClipSegments<T, Impl>.data(), sClippedSegments<T, Impl>.data(), sClipSegments<T, Impl>.size() / 2, sClipAcceptMask.data());
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+void RectanglePackerWork(saber::geometry::PackKind inKind)
+{
+	// Glyph atlas: 10k small rectangles of assorted sizes
+	saber::geometry::RectanglePacker<T, Impl> packer{T{2048}, T{2048}, inKind};
+	for (int i = 0; i < 10000; ++i)
+	{
+		const auto width = static_cast<T>(GauranteedNotConstexpr() + 4 + (i * 7) % 16);
+		const auto height = static_cast<T>(GauranteedNotConstexpr() + 4 + (i * 11) % 16);
+		if (const auto placed = packer.Insert(width, height))
+		{
+			sRectangle<T, Impl> = *placed;
+		}
+	}
+}
+
 TEMPLATE_TEST_CASE("saber::geometry::Rectangle", "[saber][benchmark][template]", int, float, double)
 {
 	using namespace saber::geometry;
@@ -779,6 +934,45 @@ TEMPLATE_TEST_CASE("saber::geometry::Rectangle", "[saber][benchmark][template]",
 	BENCHMARK(rectScalarName + "IsEmpty()") { RectangleIsEmptyWork<TestType, ImplKind::kScalar>(); };
 	BENCHMARK(rectSimdName + "IsEmpty()") { RectangleIsEmptyWork<TestType, ImplKind::kSimd>(); };
 
+	for (std::size_t i = 0; i < sUnionRects<TestType, ImplKind::kScalar>.size(); ++i)
+	{
+		const auto value = static_cast<TestType>(GauranteedNotConstexpr() + static_cast<int>(i % 37));
+		sUnionRects<TestType, ImplKind::kScalar>[i] = Rectangle<TestType, ImplKind::kScalar>{value, -value, value, value};
+		sUnionRects<TestType, ImplKind::kSimd>[i] = Rectangle<TestType, ImplKind::kSimd>{value, -value, value, value};
+		sBoundsPoints<TestType, ImplKind::kScalar>[i] = Point<TestType, ImplKind::kScalar>{value, -value};
+		sBoundsPoints<TestType, ImplKind::kSimd>[i] = Point<TestType, ImplKind::kSimd>{value, -value};
+	}
+	BENCHMARK(rectScalarName + "Union() loop x256") { RectangleUnionLoopWork<TestType, ImplKind::kScalar>(); };
+	BENCHMARK(rectSimdName + "Union() loop x256") { RectangleUnionLoopWork<TestType, ImplKind::kSimd>(); };
+	BENCHMARK(rectScalarName + "UnionAll() x256") { RectangleUnionAllWork<TestType, ImplKind::kScalar>(); };
+	BENCHMARK(rectSimdName + "UnionAll() x256") { RectangleUnionAllWork<TestType, ImplKind::kSimd>(); };
+	BENCHMARK(rectScalarName + "BoundingBox() x256") { RectangleBoundingBoxWork<TestType, ImplKind::kScalar>(); };
+	BENCHMARK(rectSimdName + "BoundingBox() x256") { RectangleBoundingBoxWork<TestType, ImplKind::kSimd>(); };
+
+	for (std::size_t i = 0; i < sUnionRects<TestType, ImplKind::kScalar>.size(); ++i)
+	{
+		sUnionRectsLTRB<TestType, ImplKind::kScalar>[i] = RectangleLTRB<TestType, ImplKind::kScalar>{sUnionRects<TestType, ImplKind::kScalar>[i]};
+		sUnionRectsLTRB<TestType, ImplKind::kSimd>[i] = RectangleLTRB<TestType, ImplKind::kSimd>{sUnionRects<TestType, ImplKind::kSimd>[i]};
+	}
+	BENCHMARK(rectScalarName + "clip chain x256") { RectangleClipChainWork<TestType, ImplKind::kScalar>(); };
+	BENCHMARK(rectSimdName + "clip chain x256") { RectangleClipChainWork<TestType, ImplKind::kSimd>(); };
+
+	const auto ltrbScalarName = WorkloadName<TestType, ImplKind::kScalar>("RectangleLTRB");
+	const auto ltrbSimdName = WorkloadName<TestType, ImplKind::kSimd>("RectangleLTRB");
+	BENCHMARK(ltrbScalarName + "clip chain x256") { RectangleLTRBClipChainWork<TestType, ImplKind::kScalar>(); };
+	BENCHMARK(ltrbSimdName + "clip chain x256") { RectangleLTRBClipChainWork<TestType, ImplKind::kSimd>(); };
+
+	if constexpr (std::is_integral_v<TestType>)
+	{
+		// RectanglePacker is only available for integer types
+		const auto packerScalarName = WorkloadName<TestType, ImplKind::kScalar>("RectanglePacker");
+		const auto packerSimdName = WorkloadName<TestType, ImplKind::kSimd>("RectanglePacker");
+		BENCHMARK(packerScalarName + "kMaxRects Insert() x10k") { RectanglePackerWork<TestType, ImplKind::kScalar>(PackKind::kMaxRects); };
+		BENCHMARK(packerSimdName + "kMaxRects Insert() x10k") { RectanglePackerWork<TestType, ImplKind::kSimd>(PackKind::kMaxRects); };
+		BENCHMARK(packerScalarName + "kSkyline Insert() x10k") { RectanglePackerWork<TestType, ImplKind::kScalar>(PackKind::kSkyline); };
+		BENCHMARK(packerSimdName + "kSkyline Insert() x10k") { RectanglePackerWork<TestType, ImplKind::kSimd>(PackKind::kSkyline); };
+	}
+
 	if constexpr (std::is_floating_point_v<TestType>)
 	{
 		// Rounding APIs are only available for floating point types
@@ -793,6 +987,30 @@ TEMPLATE_TEST_CASE("saber::geometry::Rectangle", "[saber][benchmark][template]",
 
 		BENCHMARK(rectScalarName + "RoundTrunc()") { RectangleTruncWork<TestType, ImplKind::kScalar>(); };
 		BENCHMARK(rectSimdName + "RoundTrunc()") { RectangleTruncWork<TestType, ImplKind::kSimd>(); };
+
+		for (std::size_t i = 0; i < sLayoutRects<TestType, ImplKind::kScalar>.size(); ++i)
+		{
+			const auto value = static_cast<TestType>(GauranteedNotConstexpr() + i) * TestType{1.25};
+			sLayoutRects<TestType, ImplKind::kScalar>[i] = Rectangle<TestType, ImplKind::kScalar>{value, -value, value, value};
+			sLayoutRects<TestType, ImplKind::kSimd>[i] = Rectangle<TestType, ImplKind::kSimd>{value, -value, value, value};
+		}
+		BENCHMARK(rectScalarName + "RoundFloor() then convert x256") { RectangleRoundThenConvertWork<TestType, ImplKind::kScalar>(); };
+		BENCHMARK(rectSimdName + "RoundFloor() then convert x256") { RectangleRoundThenConvertWork<TestType, ImplKind::kSimd>(); };
+		BENCHMARK(rectScalarName + "ConvertFrom<kFloor>() x256") { RectangleConvertFromWork<TestType, ImplKind::kScalar>(); };
+		BENCHMARK(rectSimdName + "ConvertFrom<kFloor>() x256") { RectangleConvertFromWork<TestType, ImplKind::kSimd>(); };
+		BENCHMARK(rectScalarName + "ConvertFrom<kFloor, kSaturate>() x256") { RectangleConvertFromSaturateWork<TestType, ImplKind::kScalar>(); };
+		BENCHMARK(rectSimdName + "ConvertFrom<kFloor, kSaturate>() x256") { RectangleConvertFromSaturateWork<TestType, ImplKind::kSimd>(); };
+
+		// Segments inside, crossing and outside the clip rectangle, some axis parallel
+		for (std::size_t i = 0; i < sClipSegments<TestType, ImplKind::kScalar>.size(); ++i)
+		{
+			const auto x = static_cast<TestType>(GauranteedNotConstexpr() + static_cast<int>((i * 37) % 211) - 50);
+			const auto y = static_cast<TestType>(GauranteedNotConstexpr() + static_cast<int>((i * 53) % 199) - 50);
+			sClipSegments<TestType, ImplKind::kScalar>[i] = Point<TestType, ImplKind::kScalar>{x, (i % 16 == 1) ? sClipSegments<TestType, ImplKind::kScalar>[i - 1].Y() : y};
+			sClipSegments<TestType, ImplKind::kSimd>[i] = Point<TestType, ImplKind::kSimd>{x, sClipSegments<TestType, ImplKind::kScalar>[i].Y()};
+		}
+		BENCHMARK(rectScalarName + "ClipSegments() x256") { ClipSegmentsWork<TestType, ImplKind::kScalar>(); };
+		BENCHMARK(rectSimdName + "ClipSegments() x256") { ClipSegmentsWork<TestType, ImplKind::kSimd>(); };
 	}
 };
 
@@ -964,6 +1182,28 @@ void MatrixMakeRotationWork()
 	sMatrix<T, Impl> = mat;
 }
 
+template<typename T>
+std::array<T, 256> sRotationRads{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+std::array<saber::geometry::Matrix<T, Impl>, 256> sRotations{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+void MatrixMakeRotationLoopWork()
+{
+	// One MakeRotation() per angle: the per-matrix baseline for MakeRotations()
+	for (std::size_t i = 0; i < sRotationRads<T>.size(); ++i)
+	{
+		sRotations<T, Impl>[i] = saber::geometry::Matrix<T, Impl>::MakeRotation(sRotationRads<T>[i]);
+	}
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+void MatrixMakeRotationsWork()
+{
+	saber::geometry::Matrix<T, Impl>::MakeRotations(sRotationRads<T>.data(), sRotations<T, Impl>.data(), sRotationRads<T>.size());
+}
+
 TEMPLATE_TEST_CASE("saber::geometry::Matrix", "[saber][benchmark][template]", int, float, double)
 {
 	using namespace saber::geometry;
@@ -1014,5 +1254,158 @@ TEMPLATE_TEST_CASE("saber::geometry::Matrix", "[saber][benchmark][template]", in
 		// MakeRotation() calls std::sin/cos and is only meaningful for floating point types
 		BENCHMARK(matrixNameScalar + "MakeRotation()") { MatrixMakeRotationWork<TestType, ImplKind::kScalar>(); };
 		BENCHMARK(matrixNameSimd + "MakeRotation()") { MatrixMakeRotationWork<TestType, ImplKind::kSimd>(); };
+
+		for (std::size_t i = 0; i < sRotationRads<TestType>.size(); ++i)
+		{
+			sRotationRads<TestType>[i] = static_cast<TestType>(GauranteedNotConstexpr() + i) * TestType{0.1};
+		}
+		BENCHMARK(matrixNameScalar + "MakeRotation() x256") { MatrixMakeRotationLoopWork<TestType, ImplKind::kScalar>(); };
+		BENCHMARK(matrixNameSimd + "MakeRotation() x256") { MatrixMakeRotationLoopWork<TestType, ImplKind::kSimd>(); };
+		BENCHMARK(matrixNameScalar + "MakeRotations() x256") { MatrixMakeRotationsWork<TestType, ImplKind::kScalar>(); };
+		BENCHMARK(matrixNameSimd + "MakeRotations() x256") { MatrixMakeRotationsWork<TestType, ImplKind::kSimd>(); };
+	}
+};
+
+template<typename T, saber::geometry::ImplKind Impl>
+saber::geometry::Matrix3<T, Impl> sMatrix3{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+saber::geometry::Matrix4<T, Impl> sMatrix4{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+std::array<saber::geometry::Point<T, Impl>, 64> sProjectPoints{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+std::array<saber::geometry::Point<T, Impl>, 64> sProjectedPoints{};
+
+template<typename T, saber::geometry::ImplKind Impl>
+void Matrix3MulWork()
+{
+	const auto mat1 = sMatrix3<T, Impl>;
+	const auto mat2 = saber::geometry::Matrix3<T, Impl>{ 2, -3, 1, 0, 2, -1, 1, 0, 1 };
+	auto mat = mat1;
+
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	sMatrix3<T, Impl> *= mat;
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+void Matrix3InvertWork()
+{
+	// TRICKY: Invert() is only numerically valid on non-singular matrices.
+	// Start from identity so every Invert() call acts on a well-conditioned matrix.
+	auto mat = saber::geometry::Matrix3<T, Impl>::MakeIdentity();
+
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	sMatrix3<T, Impl> = mat;
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+void Matrix3ProjectPointsWork()
+{
+	const auto& points = sProjectPoints<T, Impl>;
+	const auto mat = saber::geometry::Matrix3<T, Impl>{ 2, 0, 1, 0, 2, 1, 0, 0, 2 };
+	mat.ProjectPoints(points.data(), sProjectedPoints<T, Impl>.data(), points.size());
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+void Matrix4MulWork()
+{
+	const auto mat1 = sMatrix4<T, Impl>;
+	const auto mat2 = saber::geometry::Matrix4<T, Impl>{ 2, -3, 1, 0, 0, 2, -1, 1, 1, 0, 1, 0, 0, 1, 0, 1 };
+	auto mat = mat1;
+
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	mat *= mat2;
+	sMatrix4<T, Impl> *= mat;
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+void Matrix4InvertWork()
+{
+	// TRICKY: Invert() is only numerically valid on non-singular matrices.
+	// Start from identity so every Invert() call acts on a well-conditioned matrix.
+	auto mat = saber::geometry::Matrix4<T, Impl>::MakeIdentity();
+
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	mat.Invert();
+	sMatrix4<T, Impl> = mat;
+}
+
+template<typename T, saber::geometry::ImplKind Impl>
+void Matrix4ProjectPointsWork()
+{
+	const auto& points = sProjectPoints<T, Impl>;
+	const auto mat = saber::geometry::Matrix4<T, Impl>{ 2, 0, 0, 1, 0, 2, 0, 1, 0, 0, 1, 0, 0, 0, 0, 2 };
+	mat.ProjectPoints(points.data(), sProjectedPoints<T, Impl>.data(), points.size());
+}
+
+TEMPLATE_TEST_CASE("saber::geometry::Matrix3 and Matrix4", "[saber][benchmark][template]", int, float, double)
+{
+	using namespace saber::geometry;
+
+	sMatrix3<TestType, ImplKind::kScalar> = Matrix3<TestType, ImplKind::kScalar>::MakeTranslation(static_cast<TestType>(GauranteedNotConstexpr()), 1);
+	sMatrix3<TestType, ImplKind::kSimd> = Matrix3<TestType, ImplKind::kSimd>::MakeTranslation(static_cast<TestType>(GauranteedNotConstexpr()), 1);
+	sMatrix4<TestType, ImplKind::kScalar> = Matrix4<TestType, ImplKind::kScalar>::MakeTranslation(static_cast<TestType>(GauranteedNotConstexpr()), 1, 2);
+	sMatrix4<TestType, ImplKind::kSimd> = Matrix4<TestType, ImplKind::kSimd>::MakeTranslation(static_cast<TestType>(GauranteedNotConstexpr()), 1, 2);
+
+	for (std::size_t i = 0; i < sProjectPoints<TestType, ImplKind::kScalar>.size(); ++i)
+	{
+		const auto x = static_cast<TestType>(GauranteedNotConstexpr() + static_cast<int>(i));
+		sProjectPoints<TestType, ImplKind::kScalar>[i] = Point<TestType, ImplKind::kScalar>{x, x};
+		sProjectPoints<TestType, ImplKind::kSimd>[i] = Point<TestType, ImplKind::kSimd>{x, x};
 	}
-};
\ No newline at end of file
+
+	const auto matrix3NameScalar = WorkloadName<TestType, ImplKind::kScalar>("Matrix3");
+	const auto matrix3NameSimd = WorkloadName<TestType, ImplKind::kSimd>("Matrix3");
+	const auto matrix4NameScalar = WorkloadName<TestType, ImplKind::kScalar>("Matrix4");
+	const auto matrix4NameSimd = WorkloadName<TestType, ImplKind::kSimd>("Matrix4");
+
+	BENCHMARK(matrix3NameScalar + "operator*=") { Matrix3MulWork<TestType, ImplKind::kScalar>(); };
+	BENCHMARK(matrix3NameSimd + "operator*=") { Matrix3MulWork<TestType, ImplKind::kSimd>(); };
+
+	BENCHMARK(matrix3NameScalar + "Invert()") { Matrix3InvertWork<TestType, ImplKind::kScalar>(); };
+	BENCHMARK(matrix3NameSimd + "Invert()") { Matrix3InvertWork<TestType, ImplKind::kSimd>(); };
+
+	BENCHMARK(matrix3NameScalar + "ProjectPoints()") { Matrix3ProjectPointsWork<TestType, ImplKind::kScalar>(); };
+	BENCHMARK(matrix3NameSimd + "ProjectPoints()") { Matrix3ProjectPointsWork<TestType, ImplKind::kSimd>(); };
+
+	BENCHMARK(matrix4NameScalar + "operator*=") { Matrix4MulWork<TestType, ImplKind::kScalar>(); };
+	BENCHMARK(matrix4NameSimd + "operator*=") { Matrix4MulWork<TestType, ImplKind::kSimd>(); };
+
+	BENCHMARK(matrix4NameScalar + "Invert()") { Matrix4InvertWork<TestType, ImplKind::kScalar>(); };
+	BENCHMARK(matrix4NameSimd + "Invert()") { Matrix4InvertWork<TestType, ImplKind::kSimd>(); };
+
+	BENCHMARK(matrix4NameScalar + "ProjectPoints()") { Matrix4ProjectPointsWork<TestType, ImplKind::kScalar>(); };
+	BENCHMARK(matrix4NameSimd + "ProjectPoints()") { Matrix4ProjectPointsWork<TestType, ImplKind::kSimd>(); };
+}
@@ -18,18 +18,32 @@
 
 // saber
 #include "saber/inexact.hpp"
+#include "saber/geometry/clip.hpp"
 #include "saber/geometry/matrix.hpp"
+#include "saber/geometry/matrix3.hpp"
+#include "saber/geometry/matrix4.hpp"
+#include "saber/geometry/numeric.hpp"
+#include "saber/geometry/parallel.hpp"
+#include "saber/geometry/pixels.hpp"
 #include "saber/geometry/point.hpp"
 #include "saber/geometry/size.hpp"
 #include "saber/geometry/rectangle.hpp"
+#include "saber/geometry/rectangle_ltrb.hpp"
+#include "saber/geometry/rectangle_packer.hpp"
 #include "saber/geometry/utility.hpp"
 
 #define _USE_MATH_DEFINES 1
 
 // std
 #include <math.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <type_traits>
+#include <vector>
 
 using namespace saber;
 using saber::ConvertTo;
@@ -38,6 +52,8 @@ using saber::geometry::Point;
 using saber::geometry::Size;
 using saber::geometry::Rectangle;
 using saber::geometry::Matrix;
+using saber::geometry::Matrix3;
+using saber::geometry::Matrix4;
 using saber::geometry::Union;
 using saber::geometry::Intersect;
 using saber::geometry::IsEmpty;
@@ -2002,4 +2018,1953 @@ TEMPLATE_TEST_CASE( "saber::geometry::detail::MatrixInv() works correctly - impl
 	}
 }
 
+TEMPLATE_TEST_CASE( "saber::geometry::Matrix::MakeRotations() works correctly - impl variants",
+                    "[saber][matrix]",
+                    float, double)
+{
+	using namespace saber::geometry;
+
+	// Polynomial sin/cos: float <= 1e-7, double <= 1 ulp of 1 (see detail::SinCosTraits<>); the double
+	// tolerance allows for 1 more ulp of rounding in `std::sin`/`std::cos` themselves
+	const TestType kTolerance = std::is_same_v<TestType, float> ? TestType{1e-7} : TestType{4.5e-16};
+
+	// 67 angles: more than one internal block, and not a multiple of the SIMD width
+	std::array<TestType, 67> rads{};
+	for (std::size_t i = 0; i < rads.size(); ++i)
+	{
+		// Sweep all four quadrants, both positive and negative
+		rads[i] = (static_cast<TestType>(i) * TestType{0.37}) - TestType{12};
+	}
+
+	SECTION("ImplKind::kScalar")
+	{
+		std::array<Matrix<TestType, ImplKind::kScalar>, 67> rotations{};
+		Matrix<TestType, ImplKind::kScalar>::MakeRotations(rads.data(), rotations.data(), rads.size());
+		for (std::size_t i = 0; i < rads.size(); ++i)
+		{
+			const TestType sin = std::sin(rads[i]);
+			const TestType cos = std::cos(rads[i]);
+			REQUIRE(std::abs(rotations[i].M11() - cos) <= kTolerance);
+			REQUIRE(std::abs(rotations[i].M12() + sin) <= kTolerance);
+			REQUIRE(rotations[i].M13() == TestType{0});
+			REQUIRE(std::abs(rotations[i].M21() - sin) <= kTolerance);
+			REQUIRE(std::abs(rotations[i].M22() - cos) <= kTolerance);
+			REQUIRE(rotations[i].M23() == TestType{0});
+		}
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		std::array<Matrix<TestType, ImplKind::kSimd>, 67> rotations{};
+		Matrix<TestType, ImplKind::kSimd>::MakeRotations(rads.data(), rotations.data(), rads.size());
+		for (std::size_t i = 0; i < rads.size(); ++i)
+		{
+			const TestType sin = std::sin(rads[i]);
+			const TestType cos = std::cos(rads[i]);
+			REQUIRE(std::abs(rotations[i].M11() - cos) <= kTolerance);
+			REQUIRE(std::abs(rotations[i].M12() + sin) <= kTolerance);
+			REQUIRE(rotations[i].M13() == TestType{0});
+			REQUIRE(std::abs(rotations[i].M21() - sin) <= kTolerance);
+			REQUIRE(std::abs(rotations[i].M22() - cos) <= kTolerance);
+			REQUIRE(rotations[i].M23() == TestType{0});
+		}
+	}
+
+	SECTION("Exact quadrant angles")
+	{
+		const TestType kPi = static_cast<TestType>(3.14159265358979323846);
+		const std::array<TestType, 4> quadrants{TestType{0}, kPi/2, kPi, -kPi/2};
+		std::array<Matrix<TestType, ImplKind::kSimd>, 4> rotations{};
+		Matrix<TestType, ImplKind::kSimd>::MakeRotations(quadrants.data(), rotations.data(), quadrants.size());
+
+		REQUIRE(std::abs(rotations[0].M11() - TestType{1}) <= kTolerance);
+		REQUIRE(std::abs(rotations[0].M21()) <= kTolerance);
+		REQUIRE(std::abs(rotations[1].M11()) <= kTolerance);
+		REQUIRE(std::abs(rotations[1].M21() - TestType{1}) <= kTolerance);
+		REQUIRE(std::abs(rotations[2].M11() + TestType{1}) <= kTolerance);
+		REQUIRE(std::abs(rotations[2].M21()) <= kTolerance);
+		REQUIRE(std::abs(rotations[3].M11()) <= kTolerance);
+		REQUIRE(std::abs(rotations[3].M21() + TestType{1}) <= kTolerance);
+	}
+
+	SECTION("Zero count leaves output untouched")
+	{
+		std::array<Matrix<TestType, ImplKind::kSimd>, 1> rotations{Matrix<TestType, ImplKind::kSimd>::MakeIdentity()};
+		Matrix<TestType, ImplKind::kSimd>::MakeRotations(rads.data(), rotations.data(), 0);
+		REQUIRE(rotations[0] == Matrix<TestType, ImplKind::kSimd>::MakeIdentity());
+	}
+
+	SECTION("Aligned and unaligned angles give identical results")
+	{
+		// Same angles starting on, and one element past, a SIMD aligned boundary
+		alignas(16) std::array<TestType, 68> shifted{};
+		for (std::size_t i = 0; i < rads.size(); ++i)
+		{
+			shifted[i + 1] = rads[i];
+		}
+		alignas(16) std::array<TestType, 68> aligned{};
+		for (std::size_t i = 0; i < rads.size(); ++i)
+		{
+			aligned[i] = rads[i];
+		}
+
+		std::array<Matrix<TestType, ImplKind::kSimd>, 67> alignedRotations{};
+		std::array<Matrix<TestType, ImplKind::kSimd>, 67> unalignedRotations{};
+		Matrix<TestType, ImplKind::kSimd>::MakeRotations(aligned.data(), alignedRotations.data(), rads.size());
+		Matrix<TestType, ImplKind::kSimd>::MakeRotations(&shifted[1], unalignedRotations.data(), rads.size());
+		for (std::size_t i = 0; i < rads.size(); ++i)
+		{
+			REQUIRE(alignedRotations[i].M11() == unalignedRotations[i].M11());
+			REQUIRE(alignedRotations[i].M21() == unalignedRotations[i].M21());
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry::Matrix3 works correctly - impl variants",
+                    "[saber][matrix3]",
+                    int, float, double)
+{
+	SECTION("ImplKind::kScalar")
+	{
+		using M3 = Matrix3<TestType, ImplKind::kScalar>;
+		using P = Point<TestType, ImplKind::kScalar>;
+
+		SECTION("Alt ctor and equality")
+		{
+			M3 m1{TestType{1}, TestType{2}, TestType{3}, TestType{4}, TestType{5}, TestType{6}, TestType{7}, TestType{8}, TestType{9}};
+			M3 m2{TestType{1}, TestType{2}, TestType{3}, TestType{4}, TestType{5}, TestType{6}, TestType{7}, TestType{8}, TestType{9}};
+			REQUIRE(m1 == m2);
+			m2.M33(TestType{10});
+			REQUIRE(m1 != m2);
+			REQUIRE(m1.M31() == TestType{7});
+			REQUIRE(m1.M32() == TestType{8});
+		}
+
+		SECTION("Promote affine Matrix")
+		{
+			const M3 promoted{Matrix<TestType, ImplKind::kScalar>::MakeTranslation(TestType{3}, TestType{4})};
+			REQUIRE(promoted == M3::MakeTranslation(TestType{3}, TestType{4}));
+			REQUIRE(promoted.Project(P{TestType{1}, TestType{1}}) == P{TestType{4}, TestType{5}});
+		}
+
+		SECTION("Multiply")
+		{
+			const M3 m{TestType{2}, TestType{1}, TestType{3}, TestType{1}, TestType{3}, TestType{2}, TestType{1}, TestType{0}, TestType{4}};
+			REQUIRE(m * M3::MakeIdentity() == m);
+			REQUIRE(M3::MakeIdentity() * m == m);
+
+			// Scale applied after translation
+			const auto scaleTranslate = M3::MakeScale(TestType{2}, TestType{3}) * M3::MakeTranslation(TestType{1}, TestType{1});
+			REQUIRE(scaleTranslate.Project(P{TestType{0}, TestType{0}}) == P{TestType{2}, TestType{3}});
+		}
+
+		SECTION("Invert")
+		{
+			auto translation = M3::MakeTranslation(TestType{5}, TestType{7});
+			translation.Invert();
+			REQUIRE(translation == M3::MakeTranslation(TestType{-5}, TestType{-7}));
+
+			// Unimodular (det == 1), so the inverse is exact for integer and floating point types
+			const M3 unimodular{TestType{2}, TestType{3}, TestType{1}, TestType{1}, TestType{2}, TestType{1}, TestType{1}, TestType{1}, TestType{1}};
+			auto inverse = unimodular;
+			inverse.Invert();
+			REQUIRE(unimodular * inverse == M3::MakeIdentity());
+			REQUIRE(inverse * unimodular == M3::MakeIdentity());
+
+			M3 singular{TestType{1}, TestType{2}, TestType{3}, TestType{2}, TestType{4}, TestType{6}, TestType{1}, TestType{0}, TestType{1}};
+			REQUIRE_THROWS_AS(singular.Invert(), std::runtime_error);
+		}
+
+		SECTION("Project with perspective divide")
+		{
+			// w' = 2 for every point, so x' = (2x + 1)/2 and y' = (2y + 1)/2
+			const M3 m{TestType{2}, TestType{0}, TestType{1}, TestType{0}, TestType{2}, TestType{1}, TestType{0}, TestType{0}, TestType{2}};
+			const std::array<P, 5> points{{P{TestType{1}, TestType{2}}, P{TestType{3}, TestType{4}}, P{TestType{5}, TestType{6}}, P{TestType{-2}, TestType{7}}, P{TestType{0}, TestType{0}}}};
+			std::array<P, 5> projected{};
+			m.ProjectPoints(points.data(), projected.data(), points.size());
+			for (std::size_t i = 0; i < points.size(); ++i)
+			{
+				const P expected{(TestType{2} * points[i].X() + TestType{1}) / TestType{2}, (TestType{2} * points[i].Y() + TestType{1}) / TestType{2}};
+				REQUIRE(projected[i] == expected);
+				REQUIRE(m.Project(points[i]) == expected);
+			}
+		}
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		using M3 = Matrix3<TestType, ImplKind::kSimd>;
+		using P = Point<TestType, ImplKind::kSimd>;
+
+		SECTION("Alt ctor and equality")
+		{
+			M3 m1{TestType{1}, TestType{2}, TestType{3}, TestType{4}, TestType{5}, TestType{6}, TestType{7}, TestType{8}, TestType{9}};
+			M3 m2{TestType{1}, TestType{2}, TestType{3}, TestType{4}, TestType{5}, TestType{6}, TestType{7}, TestType{8}, TestType{9}};
+			REQUIRE(m1 == m2);
+			m2.M33(TestType{10});
+			REQUIRE(m1 != m2);
+			REQUIRE(m1.M31() == TestType{7});
+			REQUIRE(m1.M32() == TestType{8});
+		}
+
+		SECTION("Promote affine Matrix")
+		{
+			const M3 promoted{Matrix<TestType, ImplKind::kSimd>::MakeTranslation(TestType{3}, TestType{4})};
+			REQUIRE(promoted == M3::MakeTranslation(TestType{3}, TestType{4}));
+			REQUIRE(promoted.Project(P{TestType{1}, TestType{1}}) == P{TestType{4}, TestType{5}});
+		}
+
+		SECTION("Multiply")
+		{
+			const M3 m{TestType{2}, TestType{1}, TestType{3}, TestType{1}, TestType{3}, TestType{2}, TestType{1}, TestType{0}, TestType{4}};
+			REQUIRE(m * M3::MakeIdentity() == m);
+			REQUIRE(M3::MakeIdentity() * m == m);
+
+			// Scale applied after translation
+			const auto scaleTranslate = M3::MakeScale(TestType{2}, TestType{3}) * M3::MakeTranslation(TestType{1}, TestType{1});
+			REQUIRE(scaleTranslate.Project(P{TestType{0}, TestType{0}}) == P{TestType{2}, TestType{3}});
+		}
+
+		SECTION("Invert")
+		{
+			auto translation = M3::MakeTranslation(TestType{5}, TestType{7});
+			translation.Invert();
+			REQUIRE(translation == M3::MakeTranslation(TestType{-5}, TestType{-7}));
+
+			// Unimodular (det == 1), so the inverse is exact for integer and floating point types
+			const M3 unimodular{TestType{2}, TestType{3}, TestType{1}, TestType{1}, TestType{2}, TestType{1}, TestType{1}, TestType{1}, TestType{1}};
+			auto inverse = unimodular;
+			inverse.Invert();
+			REQUIRE(unimodular * inverse == M3::MakeIdentity());
+			REQUIRE(inverse * unimodular == M3::MakeIdentity());
+
+			M3 singular{TestType{1}, TestType{2}, TestType{3}, TestType{2}, TestType{4}, TestType{6}, TestType{1}, TestType{0}, TestType{1}};
+			REQUIRE_THROWS_AS(singular.Invert(), std::runtime_error);
+		}
+
+		SECTION("Project with perspective divide")
+		{
+			// w' = 2 for every point, so x' = (2x + 1)/2 and y' = (2y + 1)/2
+			const M3 m{TestType{2}, TestType{0}, TestType{1}, TestType{0}, TestType{2}, TestType{1}, TestType{0}, TestType{0}, TestType{2}};
+			const std::array<P, 5> points{{P{TestType{1}, TestType{2}}, P{TestType{3}, TestType{4}}, P{TestType{5}, TestType{6}}, P{TestType{-2}, TestType{7}}, P{TestType{0}, TestType{0}}}};
+			std::array<P, 5> projected{};
+			m.ProjectPoints(points.data(), projected.data(), points.size());
+			for (std::size_t i = 0; i < points.size(); ++i)
+			{
+				const P expected{(TestType{2} * points[i].X() + TestType{1}) / TestType{2}, (TestType{2} * points[i].Y() + TestType{1}) / TestType{2}};
+				REQUIRE(projected[i] == expected);
+				REQUIRE(m.Project(points[i]) == expected);
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry::Matrix4 works correctly - impl variants",
+                    "[saber][matrix4]",
+                    int, float, double)
+{
+	SECTION("ImplKind::kScalar")
+	{
+		using M4 = Matrix4<TestType, ImplKind::kScalar>;
+		using M3 = Matrix3<TestType, ImplKind::kScalar>;
+		using P = Point<TestType, ImplKind::kScalar>;
+
+		const M4 m{TestType{4}, TestType{7}, TestType{2}, TestType{3},
+				   TestType{0}, TestType{5}, TestType{0}, TestType{1},
+				   TestType{1}, TestType{2}, TestType{8}, TestType{0},
+				   TestType{3}, TestType{0}, TestType{1}, TestType{6}};
+
+		SECTION("Alt ctor and equality")
+		{
+			M4 copy = m;
+			REQUIRE(copy == m);
+			REQUIRE(copy.M14() == TestType{3});
+			REQUIRE(copy.M41() == TestType{3});
+			copy.M44(TestType{0});
+			REQUIRE(copy != m);
+		}
+
+		SECTION("Multiply")
+		{
+			REQUIRE(m * M4::MakeIdentity() == m);
+			REQUIRE(M4::MakeIdentity() * m == m);
+
+			const auto translate = M4::MakeTranslation(TestType{1}, TestType{2}, TestType{3}) * M4::MakeTranslation(TestType{4}, TestType{5}, TestType{6});
+			REQUIRE(translate == M4::MakeTranslation(TestType{5}, TestType{7}, TestType{9}));
+		}
+
+		SECTION("Invert")
+		{
+			auto translation = M4::MakeTranslation(TestType{5}, TestType{7}, TestType{9});
+			translation.Invert();
+			REQUIRE(translation == M4::MakeTranslation(TestType{-5}, TestType{-7}, TestType{-9}));
+
+			// Unimodular (det == -1), so the inverse is exact for integer and floating point types
+			const M4 unimodular{TestType{2}, TestType{3}, TestType{1}, TestType{0},
+								TestType{1}, TestType{2}, TestType{0}, TestType{1},
+								TestType{0}, TestType{1}, TestType{1}, TestType{-1},
+								TestType{1}, TestType{0}, TestType{-1}, TestType{1}};
+			auto inverse = unimodular;
+			inverse.Invert();
+			REQUIRE(unimodular * inverse == M4::MakeIdentity());
+			REQUIRE(inverse * unimodular == M4::MakeIdentity());
+
+			if constexpr (std::is_floating_point_v<TestType>)
+			{
+				auto general = m;
+				general.Invert();
+				REQUIRE(m * general == M4::MakeIdentity());
+			}
+
+			auto singular = M4::MakeZero();
+			REQUIRE_THROWS_AS(singular.Invert(), std::runtime_error);
+		}
+
+		SECTION("Project matches promoted Matrix3")
+		{
+			const M3 homography{TestType{2}, TestType{0}, TestType{1}, TestType{0}, TestType{2}, TestType{1}, TestType{0}, TestType{0}, TestType{2}};
+			const M4 promoted{homography};
+			const std::array<P, 3> points{{P{TestType{1}, TestType{2}}, P{TestType{3}, TestType{4}}, P{TestType{-5}, TestType{6}}}};
+			std::array<P, 3> projected3{};
+			std::array<P, 3> projected4{};
+			homography.ProjectPoints(points.data(), projected3.data(), points.size());
+			promoted.ProjectPoints(points.data(), projected4.data(), points.size());
+			for (std::size_t i = 0; i < points.size(); ++i)
+			{
+				REQUIRE(projected3[i] == projected4[i]);
+				REQUIRE(promoted.Project(points[i]) == projected4[i]);
+			}
+		}
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		using M4 = Matrix4<TestType, ImplKind::kSimd>;
+		using M3 = Matrix3<TestType, ImplKind::kSimd>;
+		using P = Point<TestType, ImplKind::kSimd>;
+
+		const M4 m{TestType{4}, TestType{7}, TestType{2}, TestType{3},
+				   TestType{0}, TestType{5}, TestType{0}, TestType{1},
+				   TestType{1}, TestType{2}, TestType{8}, TestType{0},
+				   TestType{3}, TestType{0}, TestType{1}, TestType{6}};
+
+		SECTION("Alt ctor and equality")
+		{
+			M4 copy = m;
+			REQUIRE(copy == m);
+			REQUIRE(copy.M14() == TestType{3});
+			REQUIRE(copy.M41() == TestType{3});
+			copy.M44(TestType{0});
+			REQUIRE(copy != m);
+		}
+
+		SECTION("Multiply")
+		{
+			REQUIRE(m * M4::MakeIdentity() == m);
+			REQUIRE(M4::MakeIdentity() * m == m);
+
+			const auto translate = M4::MakeTranslation(TestType{1}, TestType{2}, TestType{3}) * M4::MakeTranslation(TestType{4}, TestType{5}, TestType{6});
+			REQUIRE(translate == M4::MakeTranslation(TestType{5}, TestType{7}, TestType{9}));
+		}
+
+		SECTION("Invert")
+		{
+			auto translation = M4::MakeTranslation(TestType{5}, TestType{7}, TestType{9});
+			translation.Invert();
+			REQUIRE(translation == M4::MakeTranslation(TestType{-5}, TestType{-7}, TestType{-9}));
+
+			// Unimodular (det == -1), so the inverse is exact for integer and floating point types
+			const M4 unimodular{TestType{2}, TestType{3}, TestType{1}, TestType{0},
+								TestType{1}, TestType{2}, TestType{0}, TestType{1},
+								TestType{0}, TestType{1}, TestType{1}, TestType{-1},
+								TestType{1}, TestType{0}, TestType{-1}, TestType{1}};
+			auto inverse = unimodular;
+			inverse.Invert();
+			REQUIRE(unimodular * inverse == M4::MakeIdentity());
+			REQUIRE(inverse * unimodular == M4::MakeIdentity());
+
+			if constexpr (std::is_floating_point_v<TestType>)
+			{
+				auto general = m;
+				general.Invert();
+				REQUIRE(m * general == M4::MakeIdentity());
+			}
+
+			auto singular = M4::MakeZero();
+			REQUIRE_THROWS_AS(singular.Invert(), std::runtime_error);
+		}
+
+		SECTION("Project matches promoted Matrix3")
+		{
+			const M3 homography{TestType{2}, TestType{0}, TestType{1}, TestType{0}, TestType{2}, TestType{1}, TestType{0}, TestType{0}, TestType{2}};
+			const M4 promoted{homography};
+			const std::array<P, 3> points{{P{TestType{1}, TestType{2}}, P{TestType{3}, TestType{4}}, P{TestType{-5}, TestType{6}}}};
+			std::array<P, 3> projected3{};
+			std::array<P, 3> projected4{};
+			homography.ProjectPoints(points.data(), projected3.data(), points.size());
+			promoted.ProjectPoints(points.data(), projected4.data(), points.size());
+			for (std::size_t i = 0; i < points.size(); ++i)
+			{
+				REQUIRE(projected3[i] == projected4[i]);
+				REQUIRE(promoted.Project(points[i]) == projected4[i]);
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry ConvertFrom() works correctly - impl variants",
+                    "[saber][geometry][convert]",
+                    float, double)
+{
+	using saber::geometry::OverflowKind;
+	using saber::geometry::RoundKind;
+
+	SECTION("ImplKind::kScalar")
+	{
+		using Rect = saber::geometry::Rectangle<TestType, ImplKind::kScalar>;
+		using RectInt = saber::geometry::Rectangle<int, ImplKind::kScalar>;
+		using PointT = saber::geometry::Point<TestType, ImplKind::kScalar>;
+		using PointInt = saber::geometry::Point<int, ImplKind::kScalar>;
+		using SizeT = saber::geometry::Size<TestType, ImplKind::kScalar>;
+		using SizeInt = saber::geometry::Size<int, ImplKind::kScalar>;
+
+		alignas(16) const std::array<Rect, 2> rects{{
+			Rect{TestType{1.5}, TestType{-1.5}, TestType{2.25}, TestType{-2.75}},
+			Rect{TestType{3.7}, TestType{-3.7}, TestType{0}, TestType{-0.2}}}};
+		alignas(16) std::array<RectInt, 2> rectInts{};
+
+		RectInt::ConvertFrom(rects.data(), rectInts.data(), rects.size());
+		REQUIRE(rectInts[0] == RectInt{2, -2, 2, -3});
+		REQUIRE(rectInts[1] == RectInt{4, -4, 0, 0});
+
+		RectInt::template ConvertFrom<RoundKind::kFloor>(rects.data(), rectInts.data(), rects.size());
+		REQUIRE(rectInts[0] == RectInt{1, -2, 2, -3});
+		REQUIRE(rectInts[1] == RectInt{3, -4, 0, -1});
+
+		RectInt::template ConvertFrom<RoundKind::kCeil>(rects.data(), rectInts.data(), rects.size());
+		REQUIRE(rectInts[0] == RectInt{2, -1, 3, -2});
+		REQUIRE(rectInts[1] == RectInt{4, -3, 0, 0});
+
+		RectInt::template ConvertFrom<RoundKind::kTrunc>(rects.data(), rectInts.data(), rects.size());
+		REQUIRE(rectInts[0] == RectInt{1, -1, 2, -2});
+		REQUIRE(rectInts[1] == RectInt{3, -3, 0, 0});
+
+		// Out of range values clamp to int limits, and NaN converts to 0
+		constexpr auto kMax = std::numeric_limits<int>::max();
+		constexpr auto kMin = std::numeric_limits<int>::lowest();
+		const TestType nan = std::numeric_limits<TestType>::quiet_NaN();
+		alignas(16) const std::array<Rect, 1> hugeRects{{Rect{TestType{1e10}, TestType{-1e10}, nan, TestType{-0.5}}}};
+		RectInt::template ConvertFrom<RoundKind::kNearest, OverflowKind::kSaturate>(hugeRects.data(), rectInts.data(), hugeRects.size());
+		REQUIRE(rectInts[0] == RectInt{kMax, kMin, 0, -1});
+
+		const std::array<PointT, 2> points{{PointT{TestType{1.5}, TestType{-2.5}}, PointT{TestType{3e9}, TestType{-0.4}}}};
+		std::array<PointInt, 2> pointInts{};
+		PointInt::template ConvertFrom<RoundKind::kNearest, OverflowKind::kSaturate>(points.data(), pointInts.data(), points.size());
+		REQUIRE(pointInts[0] == PointInt{2, -3});
+		REQUIRE(pointInts[1] == PointInt{kMax, 0});
+
+		const std::array<SizeT, 1> sizes{{SizeT{TestType{1.2}, TestType{2.8}}}};
+		std::array<SizeInt, 1> sizeInts{};
+		SizeInt::template ConvertFrom<RoundKind::kCeil>(sizes.data(), sizeInts.data(), sizes.size());
+		REQUIRE(sizeInts[0] == SizeInt{2, 3});
+
+		// Integer to floating point, and between floating point types, are plain conversions
+		alignas(16) std::array<Rect, 2> rectsBack{};
+		Rect::ConvertFrom(rectInts.data(), rectsBack.data(), 1);
+		REQUIRE(rectsBack[0] == Rect{static_cast<TestType>(kMax), static_cast<TestType>(kMin), TestType{0}, TestType{-1}});
+
+		using PointOther = saber::geometry::Point<std::conditional_t<std::is_same_v<TestType, float>, double, float>, ImplKind::kScalar>;
+		std::array<PointOther, 2> pointOthers{};
+		PointOther::ConvertFrom(points.data(), pointOthers.data(), points.size());
+		REQUIRE(pointOthers[0] == PointOther{1.5, -2.5});
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		using Rect = saber::geometry::Rectangle<TestType, ImplKind::kSimd>;
+		using RectInt = saber::geometry::Rectangle<int, ImplKind::kSimd>;
+		using PointT = saber::geometry::Point<TestType, ImplKind::kSimd>;
+		using PointInt = saber::geometry::Point<int, ImplKind::kSimd>;
+		using SizeT = saber::geometry::Size<TestType, ImplKind::kSimd>;
+		using SizeInt = saber::geometry::Size<int, ImplKind::kSimd>;
+
+		alignas(16) const std::array<Rect, 2> rects{{
+			Rect{TestType{1.5}, TestType{-1.5}, TestType{2.25}, TestType{-2.75}},
+			Rect{TestType{3.7}, TestType{-3.7}, TestType{0}, TestType{-0.2}}}};
+		alignas(16) std::array<RectInt, 2> rectInts{};
+
+		RectInt::ConvertFrom(rects.data(), rectInts.data(), rects.size());
+		REQUIRE(rectInts[0] == RectInt{2, -2, 2, -3});
+		REQUIRE(rectInts[1] == RectInt{4, -4, 0, 0});
+
+		RectInt::template ConvertFrom<RoundKind::kFloor>(rects.data(), rectInts.data(), rects.size());
+		REQUIRE(rectInts[0] == RectInt{1, -2, 2, -3});
+		REQUIRE(rectInts[1] == RectInt{3, -4, 0, -1});
+
+		RectInt::template ConvertFrom<RoundKind::kCeil>(rects.data(), rectInts.data(), rects.size());
+		REQUIRE(rectInts[0] == RectInt{2, -1, 3, -2});
+		REQUIRE(rectInts[1] == RectInt{4, -3, 0, 0});
+
+		RectInt::template ConvertFrom<RoundKind::kTrunc>(rects.data(), rectInts.data(), rects.size());
+		REQUIRE(rectInts[0] == RectInt{1, -1, 2, -2});
+		REQUIRE(rectInts[1] == RectInt{3, -3, 0, 0});
+
+		// Out of range values clamp to int limits, and NaN converts to 0
+		constexpr auto kMax = std::numeric_limits<int>::max();
+		constexpr auto kMin = std::numeric_limits<int>::lowest();
+		const TestType nan = std::numeric_limits<TestType>::quiet_NaN();
+		alignas(16) const std::array<Rect, 1> hugeRects{{Rect{TestType{1e10}, TestType{-1e10}, nan, TestType{-0.5}}}};
+		RectInt::template ConvertFrom<RoundKind::kNearest, OverflowKind::kSaturate>(hugeRects.data(), rectInts.data(), hugeRects.size());
+		REQUIRE(rectInts[0] == RectInt{kMax, kMin, 0, -1});
+
+		// 3 points and sizes: converted two at a time, then the odd one out
+		const std::array<PointT, 3> points{{PointT{TestType{1.5}, TestType{-2.5}}, PointT{TestType{3e9}, TestType{-0.4}}, PointT{TestType{-3e9}, nan}}};
+		std::array<PointInt, 3> pointInts{};
+		PointInt::template ConvertFrom<RoundKind::kNearest, OverflowKind::kSaturate>(points.data(), pointInts.data(), points.size());
+		REQUIRE(pointInts[0] == PointInt{2, -3});
+		REQUIRE(pointInts[1] == PointInt{kMax, 0});
+		REQUIRE(pointInts[2] == PointInt{kMin, 0});
+
+		const std::array<SizeT, 3> sizes{{SizeT{TestType{1.2}, TestType{2.8}}, SizeT{TestType{-1.2}, TestType{0}}, SizeT{TestType{7}, TestType{7.01}}}};
+		std::array<SizeInt, 3> sizeInts{};
+		SizeInt::template ConvertFrom<RoundKind::kCeil>(sizes.data(), sizeInts.data(), sizes.size());
+		REQUIRE(sizeInts[0] == SizeInt{2, 3});
+		REQUIRE(sizeInts[1] == SizeInt{-1, 0});
+		REQUIRE(sizeInts[2] == SizeInt{7, 8});
+
+		// Integer to floating point, and between floating point types, are plain conversions
+		alignas(16) std::array<Rect, 2> rectsBack{};
+		Rect::ConvertFrom(rectInts.data(), rectsBack.data(), 1);
+		REQUIRE(rectsBack[0] == Rect{static_cast<TestType>(kMax), static_cast<TestType>(kMin), TestType{0}, TestType{-1}});
+
+		using PointOther = saber::geometry::Point<std::conditional_t<std::is_same_v<TestType, float>, double, float>, ImplKind::kSimd>;
+		std::array<PointOther, 2> pointOthers{};
+		PointOther::ConvertFrom(points.data(), pointOthers.data(), points.size());
+		REQUIRE(pointOthers[0] == PointOther{1.5, -2.5});
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry SIMD storage is aligned - impl variants",
+                    "[saber][geometry][align]",
+                    int, float, double)
+{
+	using namespace saber::geometry;
+
+	SECTION("ImplKind::kSimd")
+	{
+		// Types loaded with full 128bit vectors require 16 byte aligned storage
+		REQUIRE(alignof(Rectangle<TestType, ImplKind::kSimd>) >= 16);
+		REQUIRE(alignof(Matrix<TestType, ImplKind::kSimd>) >= 16);
+		REQUIRE(alignof(Matrix4<TestType, ImplKind::kSimd>) >= 16);
+		// 2 element types are aligned to their own size: no padding for 32bit types
+		REQUIRE(alignof(Point<TestType, ImplKind::kSimd>) == 2 * sizeof(TestType));
+		REQUIRE(sizeof(Point<TestType, ImplKind::kSimd>) == 2 * sizeof(TestType));
+
+		// Every element of a container remains aligned
+		std::array<Rectangle<TestType, ImplKind::kSimd>, 3> rects{};
+		for (const auto& rect : rects)
+		{
+			REQUIRE((reinterpret_cast<std::uintptr_t>(&rect) % 16) == 0);
+		}
+	}
+
+	SECTION("ImplKind::kScalar")
+	{
+		// Scalar storage keeps its natural alignment
+		REQUIRE(alignof(Rectangle<TestType, ImplKind::kScalar>) == alignof(TestType));
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry compact element types work correctly - impl variants",
+                    "[saber][geometry][numeric]",
+                    std::int16_t, saber::geometry::Fixed16, saber::geometry::BFloat16, saber::geometry::Half)
+{
+	using saber::geometry::RoundKind;
+
+	SECTION("ImplKind::kScalar")
+	{
+		using PointT = saber::geometry::Point<TestType, ImplKind::kScalar>;
+		using SizeT = saber::geometry::Size<TestType, ImplKind::kScalar>;
+		using Rect = saber::geometry::Rectangle<TestType, ImplKind::kScalar>;
+		using RectFloat = saber::geometry::Rectangle<float, ImplKind::kScalar>;
+		using RectInt = saber::geometry::Rectangle<int, ImplKind::kScalar>;
+
+		PointT point{TestType(1), TestType(2)};
+		point += PointT{TestType(3), TestType(-4)};
+		REQUIRE(point == PointT{TestType(4), TestType(-2)});
+
+		SizeT size{TestType(3), TestType(5)};
+		size *= SizeT{TestType(2), TestType(-1)};
+		REQUIRE(size == SizeT{TestType(6), TestType(-5)});
+
+		Rect rect{TestType(0), TestType(0), TestType(8), TestType(6)};
+		const Rect other{TestType(4), TestType(2), TestType(8), TestType(8)};
+		const Rect unionRect = saber::geometry::Union(rect, other);
+		REQUIRE(unionRect == Rect{TestType(0), TestType(0), TestType(12), TestType(10)});
+		rect.Intersect(other);
+		REQUIRE(rect == Rect{TestType(4), TestType(2), TestType(4), TestType(4)});
+
+		// Round trip through wider types is exact for small integral values
+		const std::array<RectFloat, 2> rectFloats{{RectFloat{1.0f, -2.0f, 30.0f, 40.0f}, RectFloat{-5.0f, 6.0f, 7.0f, 8.0f}}};
+		std::array<Rect, 2> rects{};
+		Rect::ConvertFrom(rectFloats.data(), rects.data(), rects.size());
+		std::array<RectFloat, 2> rectFloatsBack{};
+		RectFloat::ConvertFrom(rects.data(), rectFloatsBack.data(), rects.size());
+		REQUIRE(rectFloatsBack == rectFloats);
+
+		std::array<RectInt, 2> rectInts{};
+		RectInt::template ConvertFrom<RoundKind::kNearest>(rects.data(), rectInts.data(), rects.size());
+		REQUIRE(rectInts[0] == RectInt{1, -2, 30, 40});
+		REQUIRE(rectInts[1] == RectInt{-5, 6, 7, 8});
+
+		using MatrixT = saber::geometry::Matrix<TestType, ImplKind::kScalar>;
+		const MatrixT matrix{TestType(2), TestType(0), TestType(0), TestType(3), TestType(1), TestType(-1)};
+		const MatrixT product = MatrixT::MakeIdentity() * matrix;
+		REQUIRE(product == matrix);
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		using PointT = saber::geometry::Point<TestType, ImplKind::kSimd>;
+		using SizeT = saber::geometry::Size<TestType, ImplKind::kSimd>;
+		using Rect = saber::geometry::Rectangle<TestType, ImplKind::kSimd>;
+		using RectFloat = saber::geometry::Rectangle<float, ImplKind::kSimd>;
+		using RectInt = saber::geometry::Rectangle<int, ImplKind::kSimd>;
+
+		// Compact types are never padded: a 16bit Rectangle is a single 64bit load
+		REQUIRE(sizeof(Rect) == 4 * sizeof(TestType));
+		REQUIRE(sizeof(PointT) == 2 * sizeof(TestType));
+
+		PointT point{TestType(1), TestType(2)};
+		point += PointT{TestType(3), TestType(-4)};
+		REQUIRE(point == PointT{TestType(4), TestType(-2)});
+
+		SizeT size{TestType(3), TestType(5)};
+		size *= SizeT{TestType(2), TestType(-1)};
+		REQUIRE(size == SizeT{TestType(6), TestType(-5)});
+
+		Rect rect{TestType(0), TestType(0), TestType(8), TestType(6)};
+		const Rect other{TestType(4), TestType(2), TestType(8), TestType(8)};
+		const Rect unionRect = saber::geometry::Union(rect, other);
+		REQUIRE(unionRect == Rect{TestType(0), TestType(0), TestType(12), TestType(10)});
+		rect.Intersect(other);
+		REQUIRE(rect == Rect{TestType(4), TestType(2), TestType(4), TestType(4)});
+
+		// Round trip through wider types is exact for small integral values
+		const std::array<RectFloat, 2> rectFloats{{RectFloat{1.0f, -2.0f, 30.0f, 40.0f}, RectFloat{-5.0f, 6.0f, 7.0f, 8.0f}}};
+		std::array<Rect, 2> rects{};
+		Rect::ConvertFrom(rectFloats.data(), rects.data(), rects.size());
+		std::array<RectFloat, 2> rectFloatsBack{};
+		RectFloat::ConvertFrom(rects.data(), rectFloatsBack.data(), rects.size());
+		REQUIRE(rectFloatsBack == rectFloats);
+
+		std::array<RectInt, 2> rectInts{};
+		RectInt::template ConvertFrom<RoundKind::kNearest>(rects.data(), rectInts.data(), rects.size());
+		REQUIRE(rectInts[0] == RectInt{1, -2, 30, 40});
+		REQUIRE(rectInts[1] == RectInt{-5, 6, 7, 8});
+
+		using MatrixT = saber::geometry::Matrix<TestType, ImplKind::kSimd>;
+		const MatrixT matrix{TestType(2), TestType(0), TestType(0), TestType(3), TestType(1), TestType(-1)};
+		const MatrixT product = MatrixT::MakeIdentity() * matrix;
+		REQUIRE(product == matrix);
+	}
+}
+
+TEST_CASE( "saber::geometry compact element values round correctly", "[saber][geometry][numeric]")
+{
+	using saber::geometry::BFloat16;
+	using saber::geometry::Fixed16;
+	using saber::geometry::Half;
+
+	SECTION("Fixed16")
+	{
+		REQUIRE(Fixed16(1.5).Raw() == 0x18000);
+		REQUIRE(static_cast<double>(Fixed16(1.5) * Fixed16(-2.25)) == -3.375);
+		REQUIRE(static_cast<double>(Fixed16(1) / Fixed16(4)) == 0.25);
+		REQUIRE(static_cast<int>(Fixed16(-2.75)) == -2);
+	}
+
+	SECTION("Half")
+	{
+		REQUIRE(Half(1.0f).Bits() == 0x3C00);
+		REQUIRE(Half(65504.0f).Bits() == 0x7BFF);
+		REQUIRE(Half(1e6f).Bits() == 0x7C00); // Overflow rounds to infinity
+		REQUIRE(static_cast<float>(Half::FromBits(0x0001)) == std::ldexp(1.0f, -24)); // Smallest subnormal
+		REQUIRE(Half(1.0f + std::ldexp(1.0f, -11)).Bits() == 0x3C00); // Tie rounds to even
+	}
+
+	SECTION("BFloat16")
+	{
+		REQUIRE(BFloat16(1.0f).Bits() == 0x3F80);
+		REQUIRE(static_cast<float>(BFloat16(3.0e38f)) == std::ldexp(226.0f, 120)); // Same range as float
+		REQUIRE(BFloat16(1.0f + std::ldexp(1.0f, -8)).Bits() == 0x3F80); // Tie rounds to even
+		const float nan = std::numeric_limits<float>::quiet_NaN();
+		REQUIRE(std::isnan(static_cast<float>(BFloat16(nan))));
+	}
+
+	SECTION("SIMD widen/narrow matches scalar")
+	{
+		using RectFloat = saber::geometry::Rectangle<float, ImplKind::kSimd>;
+		using RectHalf = saber::geometry::Rectangle<Half, ImplKind::kSimd>;
+		using RectBFloat = saber::geometry::Rectangle<BFloat16, ImplKind::kSimd>;
+
+		const std::array<float, 4> floats{{0.1f, -60000.0f, 3.0e-8f, 1.0f + std::ldexp(1.0f, -11)}};
+		const std::array<RectFloat, 1> rectFloats{{RectFloat{floats[0], floats[1], floats[2], floats[3]}}};
+		std::array<RectHalf, 1> rectHalfs{};
+		std::array<RectBFloat, 1> rectBFloats{};
+		RectHalf::ConvertFrom(rectFloats.data(), rectHalfs.data(), 1);
+		RectBFloat::ConvertFrom(rectFloats.data(), rectBFloats.data(), 1);
+		REQUIRE(rectHalfs[0].X().Bits() == Half(floats[0]).Bits());
+		REQUIRE(rectHalfs[0].Y().Bits() == Half(floats[1]).Bits());
+		REQUIRE(rectHalfs[0].Width().Bits() == Half(floats[2]).Bits());
+		REQUIRE(rectHalfs[0].Height().Bits() == Half(floats[3]).Bits());
+		REQUIRE(rectBFloats[0].X().Bits() == BFloat16(floats[0]).Bits());
+		REQUIRE(rectBFloats[0].Y().Bits() == BFloat16(floats[1]).Bits());
+		REQUIRE(rectBFloats[0].Width().Bits() == BFloat16(floats[2]).Bits());
+		REQUIRE(rectBFloats[0].Height().Bits() == BFloat16(floats[3]).Bits());
+
+		std::array<RectFloat, 1> widen{};
+		RectFloat::ConvertFrom(rectHalfs.data(), widen.data(), 1);
+		REQUIRE(widen[0] == RectFloat{static_cast<float>(rectHalfs[0].X()), static_cast<float>(rectHalfs[0].Y()),
+									  static_cast<float>(rectHalfs[0].Width()), static_cast<float>(rectHalfs[0].Height())});
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry DivBy() works correctly - impl variants",
+                    "[saber][geometry][divisor]",
+                    int, float, double)
+{
+	using saber::geometry::Divisor;
+
+	SECTION("ImplKind::kScalar")
+	{
+		using PointT = saber::geometry::Point<TestType, ImplKind::kScalar>;
+		using SizeT = saber::geometry::Size<TestType, ImplKind::kScalar>;
+		using Rect = saber::geometry::Rectangle<TestType, ImplKind::kScalar>;
+
+		const Divisor<TestType> divisor{TestType(4)};
+		REQUIRE(divisor.Value() == TestType(4));
+
+		const PointT point = saber::geometry::DivBy(PointT{TestType(-10), TestType(12)}, divisor);
+		REQUIRE(point == PointT{TestType(-10) / TestType(4), TestType(3)});
+
+		SizeT size{TestType(8), TestType(-2)};
+		size.DivBy(divisor);
+		REQUIRE(size == SizeT{TestType(2), TestType(-2) / TestType(4)});
+
+		const Rect rect{TestType(100), TestType(-7), TestType(41), TestType(0)};
+		const Rect expected{TestType(25), TestType(-7) / TestType(4), TestType(41) / TestType(4), TestType(0)};
+		REQUIRE(saber::geometry::DivBy(rect, divisor) == expected);
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		using PointT = saber::geometry::Point<TestType, ImplKind::kSimd>;
+		using SizeT = saber::geometry::Size<TestType, ImplKind::kSimd>;
+		using Rect = saber::geometry::Rectangle<TestType, ImplKind::kSimd>;
+
+		const Divisor<TestType> divisor{TestType(4)};
+		REQUIRE(divisor.Value() == TestType(4));
+
+		const PointT point = saber::geometry::DivBy(PointT{TestType(-10), TestType(12)}, divisor);
+		REQUIRE(point == PointT{TestType(-10) / TestType(4), TestType(3)});
+
+		SizeT size{TestType(8), TestType(-2)};
+		size.DivBy(divisor);
+		REQUIRE(size == SizeT{TestType(2), TestType(-2) / TestType(4)});
+
+		const Rect rect{TestType(100), TestType(-7), TestType(41), TestType(0)};
+		const Rect expected{TestType(25), TestType(-7) / TestType(4), TestType(41) / TestType(4), TestType(0)};
+		REQUIRE(saber::geometry::DivBy(rect, divisor) == expected);
+	}
+}
+
+TEST_CASE( "saber::geometry integer division matches the builtin operator", "[saber][geometry][divisor]")
+{
+	using saber::geometry::Divisor;
+	using Rect = saber::geometry::Rectangle<int, ImplKind::kSimd>;
+
+	constexpr int kMin = std::numeric_limits<int>::lowest();
+	constexpr int kMax = std::numeric_limits<int>::max();
+	const std::array<int, 14> divisors{{1, -1, 2, -2, 3, 7, -7, 48, 641, 1 << 30, -(1 << 30), kMax, kMin + 1, kMin}};
+	const std::array<int, 12> dividends{{0, 1, -1, 5, -5, 47, -48, 123456789, kMax, kMax - 1, kMin + 1, kMin}};
+
+	SECTION("Divisor<int>::Divide() and Rectangle::DivBy()")
+	{
+		for (const int d : divisors)
+		{
+			const Divisor<int> divisor{d};
+			for (std::size_t i = 0; i < dividends.size(); i += 4)
+			{
+				Rect rect{dividends[i], dividends[i + 1], dividends[i + 2], dividends[i + 3]};
+				rect.DivBy(divisor);
+				std::array<int, 4> expected{};
+				for (std::size_t j = 0; j < expected.size(); ++j)
+				{
+					const int n = dividends[i + j];
+					// NOTE: kMin / -1 overflows; the divisor wraps, like the Simd128<int> lanes do
+					expected[j] = (n == kMin && d == -1) ? kMin : (n / d);
+					REQUIRE(divisor.Divide(n) == expected[j]);
+				}
+				REQUIRE(rect == Rect{expected[0], expected[1], expected[2], expected[3]});
+			}
+		}
+	}
+
+	SECTION("Division by zero returns zero")
+	{
+		const Divisor<int> zero{0};
+		REQUIRE(zero.Divide(42) == 0);
+
+		Point<int, ImplKind::kSimd> point{9, kMin};
+		point /= Point<int, ImplKind::kSimd>{0, 2};
+		REQUIRE(point == Point<int, ImplKind::kSimd>{0, kMin / 2});
+	}
+
+	SECTION("operator/= is exact for every int")
+	{
+		using SizeInt = saber::geometry::Size<int, ImplKind::kSimd>;
+		for (const int d : divisors)
+		{
+			if (d == -1)
+			{
+				continue; // kMin / -1 overflows (traps) without SIMD
+			}
+			const Divisor<int> divisor{d};
+			for (std::size_t i = 0; i < dividends.size(); i += 2)
+			{
+				SizeInt size{dividends[i], dividends[i + 1]};
+				size /= SizeInt{d, d};
+				REQUIRE(size == SizeInt{divisor.Divide(dividends[i]), divisor.Divide(dividends[i + 1])});
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry::detail::Simd128<> matches the scalar reference - backend equivalence",
+                    "[saber][geometry][simd]",
+                    int, float, double)
+{
+	// Runs against whichever Simd128<> backend this build selected (SSE, NEON, vector extensions,
+	// or the generic template), so every backend is held to the same scalar semantics
+	using Simd = saber::geometry::detail::Simd128<TestType>;
+	using SimdType = typename Simd::SimdType;
+	constexpr std::size_t kSize = Simd::kSize;
+	constexpr std::size_t kCount = 8;
+
+	const auto load = [](const TestType* inAddr) -> SimdType
+	{
+		if constexpr (kSize == 4)
+		{
+			return Simd::Load4(inAddr);
+		}
+		else
+		{
+			return Simd::Load2(inAddr);
+		}
+	};
+	const auto store = [](SimdType inSimd) -> std::array<TestType, kSize>
+	{
+		alignas(16) std::array<TestType, kSize> result{};
+		if constexpr (kSize == 4)
+		{
+			Simd::Store4(result.data(), inSimd);
+		}
+		else
+		{
+			Simd::Store2(result.data(), inSimd);
+		}
+		return result;
+	};
+	const auto requireSame = [](TestType inActual, TestType inExpected)
+	{
+		REQUIRE(inActual == inExpected);
+		if constexpr (std::is_floating_point_v<TestType>)
+		{
+			REQUIRE(std::signbit(inActual) == std::signbit(inExpected)); // e.g. round(-0.25) is -0
+		}
+	};
+
+	alignas(16) std::array<TestType, kCount> lhs{};
+	alignas(16) std::array<TestType, kCount> rhs{};
+	if constexpr (std::is_integral_v<TestType>)
+	{
+		constexpr int kMax = std::numeric_limits<int>::max();
+		lhs = {{7, -7, 0, kMax, -100, 65536, 12345, -1}};
+		rhs = {{2, 2, -3, 1, 7, 0, -12345, kMax}};
+	}
+	else
+	{
+		lhs = {{TestType(2.5), TestType(-2.5), TestType(-0.25), TestType(0.49999997f), TestType(1e10), TestType(-3), TestType(8388609), TestType(-0.0)}};
+		rhs = {{TestType(0.5), TestType(4), TestType(-8), TestType(3), TestType(-1e10), TestType(-3), TestType(0.1), TestType(1.5)}};
+	}
+
+	for (std::size_t i = 0; i < kCount; i += kSize)
+	{
+		const SimdType a = load(&lhs[i]);
+		const SimdType b = load(&rhs[i]);
+
+		SECTION("Arithmetic")
+		{
+			const auto add = store(Simd::Add(a, b));
+			const auto sub = store(Simd::Sub(a, b));
+			const auto mul = store(Simd::Mul(a, b));
+			const auto div = store(Simd::Div(a, b));
+			for (std::size_t j = 0; j < kSize; ++j)
+			{
+				const TestType l = lhs[i + j];
+				const TestType r = rhs[i + j];
+				if constexpr (std::is_integral_v<TestType>)
+				{
+					// Integer lanes wrap on overflow, and divide by zero to zero
+					using UInt = std::make_unsigned_t<TestType>;
+					REQUIRE(add[j] == static_cast<TestType>(static_cast<UInt>(l) + static_cast<UInt>(r)));
+					REQUIRE(sub[j] == static_cast<TestType>(static_cast<UInt>(l) - static_cast<UInt>(r)));
+					REQUIRE(mul[j] == static_cast<TestType>(static_cast<UInt>(l) * static_cast<UInt>(r)));
+					REQUIRE(div[j] == ((r != 0) ? (l / r) : 0));
+				}
+				else
+				{
+					requireSame(add[j], l + r);
+					requireSame(sub[j], l - r);
+					requireSame(mul[j], l * r);
+					requireSame(div[j], l / r);
+				}
+			}
+		}
+
+		SECTION("DivBy()")
+		{
+			for (const TestType d : {TestType(3), TestType(-7), TestType(1)})
+			{
+				const saber::geometry::Divisor<TestType> divisor{d};
+				const auto div = store(Simd::DivBy(a, divisor));
+				for (std::size_t j = 0; j < kSize; ++j)
+				{
+					requireSame(div[j], lhs[i + j] / d);
+				}
+			}
+		}
+
+		SECTION("DupLo(), DupHi()")
+		{
+			const auto lo = store(Simd::DupLo(a));
+			const auto hi = store(Simd::DupHi(a));
+			for (std::size_t j = 0; j < kSize; ++j)
+			{
+				requireSame(lo[j], lhs[i + (j % (kSize / 2))]);
+				requireSame(hi[j], lhs[i + (kSize / 2) + (j % (kSize / 2))]);
+			}
+		}
+
+		SECTION("Min(), Max(), MinMax(), MaxMin()")
+		{
+			const auto min = store(Simd::Min(a, b));
+			const auto max = store(Simd::Max(a, b));
+			const auto minMax = store(Simd::MinMax(a, b));
+			const auto maxMin = store(Simd::MaxMin(a, b));
+			constexpr std::size_t kPair = (kSize / 2 < 2) ? (kSize / 2) : 2;
+			for (std::size_t j = 0; j < kSize; ++j)
+			{
+				const TestType l = lhs[i + j];
+				const TestType r = rhs[i + j];
+				REQUIRE(min[j] == std::min(l, r));
+				REQUIRE(max[j] == std::max(l, r));
+				REQUIRE(minMax[j] == ((j < kPair) ? std::min(l, r) : std::max(l, r)));
+				REQUIRE(maxMin[j] == ((j < kPair) ? std::max(l, r) : std::min(l, r)));
+			}
+		}
+
+		SECTION("IsEq(), EqMask(), IsGe(), IsLe()")
+		{
+			int expectedEq = 0;
+			for (std::size_t j = 0; j < kSize; ++j)
+			{
+				expectedEq |= (lhs[i + j] == rhs[i + j]) ? (1 << j) : 0;
+			}
+			REQUIRE(Simd::EqMask(a, b) == expectedEq);
+			REQUIRE(Simd::IsEq(a, a));
+			REQUIRE(Simd::IsGe(a, a));
+			REQUIRE(Simd::IsLe(a, a));
+			REQUIRE(Simd::IsGe(Simd::Max(a, b), Simd::Min(a, b)));
+			REQUIRE(Simd::IsLe(Simd::Min(a, b), Simd::Max(a, b)));
+			if constexpr (std::is_floating_point_v<TestType>)
+			{
+				// Floating point elements are also "inexactly" equal, as `Inexact::IsEq()`
+				const SimdType nearA = Simd::Mul(a, Simd::Splat(TestType(1) + std::numeric_limits<TestType>::epsilon() / 2));
+				REQUIRE(Simd::IsEq(nearA, a));
+				REQUIRE(Simd::IsGe(a, nearA));
+				REQUIRE(Simd::IsLe(nearA, a));
+			}
+		}
+
+		if constexpr (std::is_floating_point_v<TestType>)
+		{
+			SECTION("Round*()")
+			{
+				const auto nearest = store(Simd::RoundNearest(a));
+				const auto ceil = store(Simd::RoundCeil(a));
+				const auto floor = store(Simd::RoundFloor(a));
+				const auto trunc = store(Simd::RoundTrunc(a));
+				for (std::size_t j = 0; j < kSize; ++j)
+				{
+					const TestType l = lhs[i + j];
+					requireSame(nearest[j], std::round(l));
+					requireSame(ceil[j], std::ceil(l));
+					requireSame(floor[j], std::floor(l));
+					requireSame(trunc[j], std::trunc(l));
+				}
+			}
+
+			SECTION("CompareEq(), Select()")
+			{
+				// Unlike `EqMask()`, `CompareEq()` is exact: "inexactly" equal elements are not selected
+				const SimdType nearA = Simd::Mul(a, Simd::Splat(TestType(1) + std::numeric_limits<TestType>::epsilon() * 2));
+				const auto eq = store(Simd::Select(Simd::CompareEq(a, b), a, Simd::Splat(TestType(7))));
+				const auto near = store(Simd::Select(Simd::CompareEq(nearA, a), b, a));
+				for (std::size_t j = 0; j < kSize; ++j)
+				{
+					const TestType l = lhs[i + j];
+					const TestType r = rhs[i + j];
+					requireSame(eq[j], (l == r) ? l : TestType(7));
+					requireSame(near[j], (l * (TestType(1) + std::numeric_limits<TestType>::epsilon() * 2) == l) ? r : l);
+				}
+			}
+
+			SECTION("ConvertStore2()")
+			{
+				using saber::geometry::OverflowKind;
+				using saber::geometry::RoundKind;
+				using saber::geometry::detail::ConvertValue;
+
+				alignas(16) std::array<int, 2> convert{};
+				Simd::template ConvertStore2<RoundKind::kNearest, OverflowKind::kSaturate>(convert.data(), a);
+				REQUIRE(convert[0] == ConvertValue<int, RoundKind::kNearest, OverflowKind::kSaturate>(lhs[i]));
+				REQUIRE(convert[1] == ConvertValue<int, RoundKind::kNearest, OverflowKind::kSaturate>(lhs[i + 1]));
+				Simd::template ConvertStore2<RoundKind::kFloor, OverflowKind::kSaturate>(convert.data(), b);
+				REQUIRE(convert[0] == ConvertValue<int, RoundKind::kFloor, OverflowKind::kSaturate>(rhs[i]));
+				REQUIRE(convert[1] == ConvertValue<int, RoundKind::kFloor, OverflowKind::kSaturate>(rhs[i + 1]));
+
+				const SimdType nan = Simd::Splat(std::numeric_limits<TestType>::quiet_NaN());
+				Simd::template ConvertStore2<RoundKind::kTrunc, OverflowKind::kSaturate>(convert.data(), nan);
+				REQUIRE(convert == std::array<int, 2>{{0, 0}});
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry::detail::Simd128<> packed lanes match the scalar reference - backend equivalence",
+                    "[saber][geometry][simd]",
+                    std::uint8_t, std::int16_t, std::uint16_t)
+{
+	using Simd = saber::geometry::detail::Simd128<TestType>;
+	using SimdType = typename Simd::SimdType;
+	using WideType = std::conditional_t<std::is_same_v<TestType, std::uint8_t>, std::uint16_t, int>;
+	using WideSimd = saber::geometry::detail::Simd128<WideType>;
+	constexpr std::size_t kSize = Simd::kSize;
+	constexpr auto kLowest = static_cast<long long>(std::numeric_limits<TestType>::lowest());
+	constexpr auto kMax = static_cast<long long>(std::numeric_limits<TestType>::max());
+	const auto clamp = [](long long inValue) -> TestType
+	{
+		return static_cast<TestType>(std::clamp(inValue, static_cast<long long>(std::numeric_limits<TestType>::lowest()),
+			static_cast<long long>(std::numeric_limits<TestType>::max())));
+	};
+
+	const auto load = [](const TestType* inAddr) -> SimdType
+	{
+		if constexpr (kSize == 16)
+		{
+			return Simd::LoadUnaligned16(inAddr);
+		}
+		else
+		{
+			return Simd::LoadUnaligned8(inAddr);
+		}
+	};
+	const auto store = [](SimdType inSimd) -> std::array<TestType, kSize>
+	{
+		std::array<TestType, kSize> result{};
+		if constexpr (kSize == 16)
+		{
+			Simd::StoreUnaligned16(result.data(), inSimd);
+		}
+		else
+		{
+			Simd::StoreUnaligned8(result.data(), inSimd);
+		}
+		return result;
+	};
+
+	// Mix of limits, mid values and small values, in every lane
+	std::array<TestType, kSize> lhs{};
+	std::array<TestType, kSize> rhs{};
+	for (std::size_t i = 0; i < kSize; ++i)
+	{
+		const long long span = kMax - kLowest;
+		lhs[i] = static_cast<TestType>(kLowest + (span * static_cast<long long>(i)) / static_cast<long long>(kSize - 1));
+		rhs[i] = static_cast<TestType>(kLowest + (span * static_cast<long long>((i * 5 + 3) % kSize)) / static_cast<long long>(kSize - 1));
+	}
+	rhs[1] = lhs[1]; // ensure some equal lanes
+	rhs[kSize - 2] = lhs[kSize - 2];
+	const SimdType a = load(lhs.data());
+	const SimdType b = load(rhs.data());
+
+	SECTION("AddSat(), SubSat()")
+	{
+		const auto add = store(Simd::AddSat(a, b));
+		const auto sub = store(Simd::SubSat(a, b));
+		for (std::size_t i = 0; i < kSize; ++i)
+		{
+			REQUIRE(add[i] == clamp(static_cast<long long>(lhs[i]) + rhs[i]));
+			REQUIRE(sub[i] == clamp(static_cast<long long>(lhs[i]) - rhs[i]));
+		}
+	}
+
+	SECTION("Min(), Max()")
+	{
+		const auto min = store(Simd::Min(a, b));
+		const auto max = store(Simd::Max(a, b));
+		for (std::size_t i = 0; i < kSize; ++i)
+		{
+			REQUIRE(min[i] == std::min(lhs[i], rhs[i]));
+			REQUIRE(max[i] == std::max(lhs[i], rhs[i]));
+		}
+	}
+
+	SECTION("WidenLo(), WidenHi(), Narrow()")
+	{
+		const auto lo = Simd::template WidenLo<WideType>(a);
+		const auto hi = Simd::template WidenHi<WideType>(a);
+		REQUIRE(store(Simd::template Narrow<WideType>(lo, hi)) == lhs);
+
+		// Widened lanes hold the exact values, so doubling them saturates when narrowed
+		std::array<WideType, kSize> wide{};
+		std::memcpy(&wide[0], &lo, sizeof(lo));
+		std::memcpy(&wide[kSize / 2], &hi, sizeof(hi));
+		for (std::size_t i = 0; i < kSize; ++i)
+		{
+			REQUIRE(wide[i] == static_cast<WideType>(lhs[i]));
+		}
+		const auto narrow = store(Simd::template Narrow<WideType>(WideSimd::Add(lo, lo), WideSimd::Add(hi, hi)));
+		for (std::size_t i = 0; i < kSize; ++i)
+		{
+			REQUIRE(narrow[i] == clamp(2 * static_cast<long long>(lhs[i])));
+		}
+	}
+
+	SECTION("CompareEq(), CompareGt(), Select()")
+	{
+		const auto eq = store(Simd::Select(Simd::CompareEq(a, b), a, Simd::Splat(TestType{0})));
+		const auto gt = store(Simd::Select(Simd::CompareGt(a, b), a, b));
+		for (std::size_t i = 0; i < kSize; ++i)
+		{
+			REQUIRE(eq[i] == ((lhs[i] == rhs[i]) ? lhs[i] : TestType{0}));
+			REQUIRE(gt[i] == std::max(lhs[i], rhs[i]));
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry Fill() and Blit() touch only pixels inside the rectangle - impl variants",
+                    "[saber][geometry][pixels]",
+                    std::uint8_t, std::uint16_t, float)
+{
+	constexpr std::size_t kChannels = 4; // e.g. RGBA
+	constexpr int kWidth = 23; // not a multiple of any vector size
+	constexpr int kHeight = 9;
+	constexpr int kBorder = 2; // sentinel pixels around (and between rows of) the buffer
+	constexpr std::ptrdiff_t kStride = (kWidth + 2 * kBorder) * static_cast<std::ptrdiff_t>(kChannels);
+	constexpr TestType kSentinel = TestType(7);
+	const std::array<TestType, kChannels> kPixel{{TestType(1), TestType(2), TestType(3), TestType(4)}};
+
+	std::vector<TestType> storage(static_cast<std::size_t>(kStride * (kHeight + 2 * kBorder)), kSentinel);
+	TestType* const origin = storage.data() + kBorder * kStride + kBorder * static_cast<std::ptrdiff_t>(kChannels);
+
+	// Pixel (x, y) of the whole storage, relative to the buffer's top left
+	const auto pixelAt = [&](int inX, int inY)
+	{
+		std::array<TestType, kChannels> pixel{};
+		const TestType* addr = origin + inY * kStride + inX * static_cast<std::ptrdiff_t>(kChannels);
+		std::copy(addr, addr + kChannels, pixel.begin());
+		return pixel;
+	};
+	const auto requireRegion = [&](int inLeft, int inTop, int inRight, int inBottom, auto inExpected)
+	{
+		for (int y = -kBorder; y < kHeight + kBorder; ++y)
+		{
+			for (int x = -kBorder; x < kWidth + kBorder; ++x)
+			{
+				const bool isInside = (x >= inLeft) && (x < inRight) && (y >= inTop) && (y < inBottom);
+				const auto pixel = pixelAt(x, y);
+				if (isInside)
+				{
+					REQUIRE(pixel == inExpected(x, y));
+				}
+				else
+				{
+					REQUIRE(pixel == std::array<TestType, kChannels>{{kSentinel, kSentinel, kSentinel, kSentinel}});
+				}
+			}
+		}
+	};
+
+	const auto testFill = [&](auto inImplTag)
+	{
+		constexpr auto kImpl = decltype(inImplTag)::value;
+		using Rectangle = saber::geometry::Rectangle<int, kImpl>;
+		const saber::geometry::PixelBuffer<TestType, kChannels> buffer{origin, kWidth, kHeight, kStride};
+
+		// Partly outside of the buffer, on the left, top and bottom
+		const auto filled = saber::geometry::Fill(buffer, Rectangle{-3, -1, 21, 20}, kPixel);
+		REQUIRE(filled == Rectangle{0, 0, 18, kHeight});
+		requireRegion(0, 0, 18, kHeight, [&](int, int) { return kPixel; });
+
+		// Narrower than a vector, and entirely outside
+		std::fill(storage.begin(), storage.end(), kSentinel);
+		REQUIRE(saber::geometry::Fill(buffer, Rectangle{kWidth - 1, 3, 5, 2}, kPixel) == Rectangle{kWidth - 1, 3, 1, 2});
+		requireRegion(kWidth - 1, 3, kWidth, 5, [&](int, int) { return kPixel; });
+		std::fill(storage.begin(), storage.end(), kSentinel);
+		REQUIRE(saber::geometry::IsEmpty(saber::geometry::Fill(buffer, Rectangle{kWidth, 0, 4, 4}, kPixel)));
+		requireRegion(0, 0, 0, 0, [&](int, int) { return kPixel; });
+	};
+
+	const auto testBlit = [&](auto inImplTag)
+	{
+		constexpr auto kImpl = decltype(inImplTag)::value;
+		using Rectangle = saber::geometry::Rectangle<int, kImpl>;
+		using Point = saber::geometry::Point<int, kImpl>;
+		const saber::geometry::PixelBuffer<TestType, kChannels> buffer{origin, kWidth, kHeight, kStride};
+
+		// Source pixels encode their own coordinates
+		constexpr int kSourceWidth = 20;
+		constexpr int kSourceHeight = 6;
+		std::vector<TestType> sourcePixels(kSourceWidth * kSourceHeight * kChannels);
+		for (int y = 0; y < kSourceHeight; ++y)
+		{
+			for (int x = 0; x < kSourceWidth; ++x)
+			{
+				for (std::size_t c = 0; c < kChannels; ++c)
+				{
+					sourcePixels[(y * kSourceWidth + x) * kChannels + c] = static_cast<TestType>(10 * x + y + c);
+				}
+			}
+		}
+		const saber::geometry::PixelBuffer<const TestType, kChannels> source{sourcePixels.data(), kSourceWidth, kSourceHeight};
+
+		// Source rect partly outside the source (left), destination partly outside the buffer (right)
+		const auto written = saber::geometry::Blit(buffer, Point{10, 2}, source, Rectangle{-2, 1, 19, 4});
+		REQUIRE(written == Rectangle{12, 2, kWidth - 12, 4});
+		requireRegion(12, 2, kWidth, 6, [&](int x, int y)
+		{
+			const int sourceX = x - 10 - 2;
+			const int sourceY = y - 2 + 1;
+			std::array<TestType, kChannels> pixel{};
+			for (std::size_t c = 0; c < kChannels; ++c)
+			{
+				pixel[c] = static_cast<TestType>(10 * sourceX + sourceY + c);
+			}
+			return pixel;
+		});
+	};
+
+	SECTION("ImplKind::kScalar")
+	{
+		testFill(std::integral_constant<saber::geometry::ImplKind, saber::geometry::ImplKind::kScalar>{});
+		std::fill(storage.begin(), storage.end(), kSentinel);
+		testBlit(std::integral_constant<saber::geometry::ImplKind, saber::geometry::ImplKind::kScalar>{});
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		testFill(std::integral_constant<saber::geometry::ImplKind, saber::geometry::ImplKind::kSimd>{});
+		std::fill(storage.begin(), storage.end(), kSentinel);
+		testBlit(std::integral_constant<saber::geometry::ImplKind, saber::geometry::ImplKind::kSimd>{});
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry HitMask() and Contains() work correctly - impl variants",
+                    "[saber][geometry][rectangle]",
+                    int, float, double, std::int16_t)
+{
+	using saber::geometry::ImplKind;
+
+	const auto test = [](auto inImplTag)
+	{
+		constexpr auto kImpl = decltype(inImplTag)::value;
+		using Rectangle = saber::geometry::Rectangle<TestType, kImpl>;
+		using Point = saber::geometry::Point<TestType, kImpl>;
+		const auto make = [](int inX, int inY, int inWidth, int inHeight)
+		{
+			return Rectangle{static_cast<TestType>(inX), static_cast<TestType>(inY), static_cast<TestType>(inWidth), static_cast<TestType>(inHeight)};
+		};
+
+		// Overlapping, nested, touching, empty and negative origin rectangles
+		const std::array<Rectangle, 8> rects{{
+			make(0, 0, 10, 10), make(2, 2, 3, 3), make(5, 0, 5, 5), make(-4, -4, 4, 4),
+			make(3, 3, 0, 5), make(8, 1, 1, 9), make(-1, 6, 12, 2), make(4, 4, 1, 1)}};
+		const std::array<Rectangle, 4> firstRects{{rects[0], rects[1], rects[2], rects[3]}};
+
+		for (int y = -5; y <= 11; ++y)
+		{
+			for (int x = -5; x <= 11; ++x)
+			{
+				const Point point{static_cast<TestType>(x), static_cast<TestType>(y)};
+				int expected = 0;
+				for (std::size_t i = 0; i < rects.size(); ++i)
+				{
+					// Reference: left/top edges are inside, right/bottom edges are outside
+					const auto& r = rects[i];
+					const bool isInside = (x >= r.X()) && (x < r.X() + r.Width()) && (y >= r.Y()) && (y < r.Y() + r.Height());
+					REQUIRE(r.IsOverlapping(point) == isInside);
+					expected |= isInside ? (1 << i) : 0;
+				}
+				REQUIRE(saber::geometry::HitMask(rects, point) == expected);
+				REQUIRE(Rectangle::HitMask(firstRects, point) == (expected & 0xF));
+			}
+		}
+
+		SECTION("Contains()")
+		{
+			const auto outer = make(0, 0, 10, 10);
+			REQUIRE(outer.Contains(outer));
+			REQUIRE(outer.Contains(make(2, 2, 3, 3)));
+			REQUIRE(saber::geometry::Contains(outer, make(0, 5, 10, 5))); // touching edges
+			REQUIRE_FALSE(outer.Contains(make(-1, 2, 3, 3)));
+			REQUIRE_FALSE(outer.Contains(make(2, -1, 3, 3)));
+			REQUIRE_FALSE(outer.Contains(make(8, 2, 3, 3)));
+			REQUIRE_FALSE(outer.Contains(make(2, 8, 3, 3)));
+			REQUIRE_FALSE(make(2, 2, 3, 3).Contains(outer));
+		}
+	};
+
+	SECTION("ImplKind::kScalar")
+	{
+		test(std::integral_constant<ImplKind, ImplKind::kScalar>{});
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		test(std::integral_constant<ImplKind, ImplKind::kSimd>{});
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry::detail LoadN(), StoreN() and ForEachSimd() handle any length - backend equivalence",
+                    "[saber][geometry][simd]",
+                    int, float, double)
+{
+	using Simd = saber::geometry::detail::Simd128<TestType>;
+	constexpr std::size_t kSize = Simd::kSize;
+	constexpr TestType kSentinel = TestType(-99);
+
+	SECTION("LoadN(), StoreN()")
+	{
+		for (std::size_t count = 0; count <= kSize + 1; ++count)
+		{
+			// Load from the very end of an array, so reading past `count` would be caught by sanitizers
+			std::vector<TestType> source(count);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				source[i] = static_cast<TestType>(i + 1);
+			}
+			const auto loadN = Simd::LoadN(source.data(), count);
+
+			std::array<TestType, kSize + 2> stored{};
+			stored.fill(kSentinel);
+			Simd::StoreN(stored.data(), loadN, kSize); // Whole vector: shows the zeroed lanes too
+			for (std::size_t i = 0; i < kSize; ++i)
+			{
+				REQUIRE(stored[i] == ((i < count) ? static_cast<TestType>(i + 1) : TestType(0)));
+			}
+
+			stored.fill(kSentinel);
+			Simd::StoreN(stored.data(), Simd::Splat(TestType(7)), count);
+			for (std::size_t i = 0; i < stored.size(); ++i)
+			{
+				REQUIRE(stored[i] == ((i < std::min(count, kSize)) ? TestType(7) : kSentinel));
+			}
+		}
+	}
+
+	SECTION("ForEachSimd()")
+	{
+		const auto kernel = [](auto inSimd)
+		{
+			return Simd::Add(Simd::Mul(inSimd, Simd::Splat(TestType(3))), Simd::Splat(TestType(1)));
+		};
+		for (std::size_t count = 0; count <= 3 * kSize + 1; ++count)
+		{
+			std::vector<TestType> values(count);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				values[i] = static_cast<TestType>(i) - TestType(5);
+			}
+
+			// Out-of-place, into an array with a trailing sentinel which must remain untouched
+			std::vector<TestType> results(count + 1, kSentinel);
+			saber::geometry::detail::ForEachSimd(values.data(), results.data(), count, kernel);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				REQUIRE(results[i] == values[i] * TestType(3) + TestType(1));
+			}
+			REQUIRE(results[count] == kSentinel);
+
+			// In-place
+			saber::geometry::detail::ForEachSimd(values.data(), count, kernel);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				REQUIRE(values[i] == results[i]);
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry Parallel batch operations match serial results for any thread count - impl variants",
+                    "[saber][geometry][parallel]",
+                    float, double)
+{
+	using saber::geometry::RoundKind;
+
+	auto test = [](auto inImplKind)
+	{
+		constexpr ImplKind kImpl = decltype(inImplKind)::value;
+		using Point = saber::geometry::Point<TestType, kImpl>;
+		using Rectangle = saber::geometry::Rectangle<TestType, kImpl>;
+
+		// Several chunks of each, with a partial last chunk
+		constexpr std::size_t kCount = 10001;
+		std::vector<Point> points(kCount);
+		std::vector<Rectangle> rectangles(kCount);
+		for (std::size_t i = 0; i < kCount; ++i)
+		{
+			const auto x = static_cast<TestType>((i * 37) % 1013) * TestType(0.37) - TestType(150);
+			const auto y = static_cast<TestType>((i * 91) % 997) * TestType(0.61) - TestType(300);
+			points[i] = Point{x, y};
+			rectangles[i] = Rectangle{x, y, static_cast<TestType>(i % 13) + TestType(0.25), static_cast<TestType>(i % 7) + TestType(0.5)};
+		}
+
+		// Serial references
+		const auto matrix = saber::geometry::Matrix3<TestType, kImpl>::MakeRotation(TestType(0.3));
+		std::vector<Point> projected(kCount);
+		matrix.ProjectPoints(points.data(), projected.data(), kCount);
+
+		auto united = rectangles.front();
+		for (const auto& rectangle : rectangles)
+		{
+			united.Union(rectangle);
+		}
+
+		const Rectangle clip{TestType(-20), TestType(-40), TestType(100), TestType(80)};
+		std::vector<std::size_t> overlapping;
+		for (std::size_t i = 0; i < kCount; ++i)
+		{
+			if (IsOverlapping(rectangles[i], clip))
+			{
+				overlapping.push_back(i);
+			}
+		}
+		REQUIRE_FALSE(overlapping.empty());
+
+		saber::ThreadPool serialPool{0};
+		const auto serialUnited = saber::geometry::ParallelUnion(serialPool, rectangles.data(), kCount);
+		REQUIRE(serialUnited.X() == united.X());
+		REQUIRE(serialUnited.Y() == united.Y());
+		REQUIRE(std::abs(serialUnited.Width() - united.Width()) < TestType(0.001));
+		REQUIRE(std::abs(serialUnited.Height() - united.Height()) < TestType(0.001));
+
+		const auto bounds = saber::geometry::BoundingBox(points.data(), kCount);
+
+		for (std::size_t threadCount : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::size_t{8}})
+		{
+			saber::ThreadPool pool{threadCount};
+
+			REQUIRE(saber::geometry::ParallelBoundingBox(pool, points.data(), kCount) == bounds);
+
+			std::vector<Point> parallelProjected(kCount);
+			saber::geometry::ParallelTransform(pool, matrix, points.data(), parallelProjected.data(), kCount);
+			std::size_t mismatches = 0;
+			for (std::size_t i = 0; i < kCount; ++i)
+			{
+				mismatches += (parallelProjected[i].X() != projected[i].X()) || (parallelProjected[i].Y() != projected[i].Y());
+			}
+			REQUIRE(mismatches == 0);
+
+			// Every thread count reduces the same chunks in the same order: identical, not just close
+			const auto parallelUnited = saber::geometry::ParallelUnion(pool, rectangles.data(), kCount);
+			REQUIRE(parallelUnited.X() == serialUnited.X());
+			REQUIRE(parallelUnited.Y() == serialUnited.Y());
+			REQUIRE(parallelUnited.Width() == serialUnited.Width());
+			REQUIRE(parallelUnited.Height() == serialUnited.Height());
+
+			std::vector<Rectangle> clipped(kCount);
+			saber::geometry::ParallelIntersect(pool, rectangles.data(), clip, clipped.data(), kCount);
+			for (std::size_t i = 0; i < kCount; ++i)
+			{
+				mismatches += !(clipped[i] == saber::geometry::Intersect(rectangles[i], clip));
+			}
+			REQUIRE(mismatches == 0);
+
+			std::vector<saber::geometry::Point<int, kImpl>> roundedPoints(kCount);
+			saber::geometry::ParallelRound<RoundKind::kFloor>(pool, points.data(), roundedPoints.data(), kCount);
+			std::vector<saber::geometry::Rectangle<int, kImpl>> roundedRectangles(kCount);
+			saber::geometry::ParallelRound<RoundKind::kNearest>(pool, rectangles.data(), roundedRectangles.data(), kCount);
+			for (std::size_t i = 0; i < kCount; ++i)
+			{
+				mismatches += (roundedPoints[i].X() != static_cast<int>(std::floor(points[i].X())))
+					|| (roundedPoints[i].Y() != static_cast<int>(std::floor(points[i].Y())))
+					|| (roundedRectangles[i].X() != static_cast<int>(std::round(rectangles[i].X())))
+					|| (roundedRectangles[i].Width() != static_cast<int>(std::round(rectangles[i].Width())));
+			}
+			REQUIRE(mismatches == 0);
+
+			REQUIRE(saber::geometry::ParallelQueryOverlapping(pool, rectangles.data(), kCount, clip) == overlapping);
+		}
+
+		saber::ThreadPool pool{2};
+		REQUIRE(IsEmpty(saber::geometry::ParallelUnion(pool, rectangles.data(), 0)));
+		REQUIRE(saber::geometry::ParallelQueryOverlapping(pool, rectangles.data(), 0, clip).empty());
+	};
+
+	SECTION("ImplKind::kScalar")
+	{
+		test(std::integral_constant<ImplKind, ImplKind::kScalar>{});
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		test(std::integral_constant<ImplKind, ImplKind::kSimd>{});
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry UnionAll() and BoundingBox() match one by one reduction - impl variants",
+                    "[saber][geometry][rectangle]",
+                    int, float, double, std::int16_t)
+{
+	auto test = [](auto inImplKind)
+	{
+		constexpr ImplKind kImpl = decltype(inImplKind)::value;
+		using Point = saber::geometry::Point<TestType, kImpl>;
+		using Rectangle = saber::geometry::Rectangle<TestType, kImpl>;
+		const auto value = [](int inValue) { return static_cast<TestType>(inValue); };
+
+		SECTION("Empty")
+		{
+			REQUIRE(IsEmpty(saber::geometry::UnionAll<TestType, kImpl>(nullptr, 0)));
+			REQUIRE(IsEmpty(saber::geometry::BoundingBox<TestType, kImpl>(nullptr, 0)));
+		}
+
+		SECTION("UnionAll()")
+		{
+			// Includes negative origins and a zero sized rectangle, for every count from 1 up
+			const std::vector<Rectangle> rectangles{
+				Rectangle{value(3), value(4), value(5), value(6)},
+				Rectangle{value(-7), value(2), value(1), value(1)},
+				Rectangle{value(0), value(-9), value(2), value(30)},
+				Rectangle{value(20), value(20), value(0), value(0)},
+				Rectangle{value(-1), value(-1), value(2), value(2)},
+				Rectangle{value(10), value(-3), value(15), value(4)}};
+			for (std::size_t count = 1; count <= rectangles.size(); ++count)
+			{
+				auto expected = rectangles.front();
+				for (std::size_t i = 1; i < count; ++i)
+				{
+					expected.Union(rectangles[i]);
+				}
+				const auto unionAll = saber::geometry::UnionAll(rectangles.data(), count);
+				REQUIRE(unionAll == expected);
+				REQUIRE(Rectangle::UnionAll(rectangles.data(), count) == expected);
+			}
+		}
+
+		SECTION("BoundingBox()")
+		{
+			const std::vector<Point> points{
+				Point{value(3), value(4)},
+				Point{value(-7), value(2)},
+				Point{value(0), value(-9)},
+				Point{value(20), value(21)},
+				Point{value(5), value(5)}};
+			REQUIRE(saber::geometry::BoundingBox(points.data(), 1) == Rectangle{value(3), value(4), value(0), value(0)});
+			REQUIRE(saber::geometry::BoundingBox(points.data(), 2) == Rectangle{value(-7), value(2), value(10), value(2)});
+			REQUIRE(saber::geometry::BoundingBox(points.data(), 3) == Rectangle{value(-7), value(-9), value(10), value(13)});
+			REQUIRE(Rectangle::BoundingBox(points.data(), points.size()) == Rectangle{value(-7), value(-9), value(27), value(30)});
+		}
+	};
+
+	SECTION("ImplKind::kScalar")
+	{
+		test(std::integral_constant<ImplKind, ImplKind::kScalar>{});
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		test(std::integral_constant<ImplKind, ImplKind::kSimd>{});
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry RectangleLTRB matches Rectangle operations - impl variants",
+                    "[saber][geometry][rectangle]",
+                    int, float, double, std::int16_t)
+{
+	auto test = [](auto inImplKind)
+	{
+		constexpr ImplKind kImpl = decltype(inImplKind)::value;
+		using Point = saber::geometry::Point<TestType, kImpl>;
+		using Rectangle = saber::geometry::Rectangle<TestType, kImpl>;
+		using RectangleLTRB = saber::geometry::RectangleLTRB<TestType, kImpl>;
+		const auto value = [](int inValue) { return static_cast<TestType>(inValue); };
+
+		// Includes negative origins, a zero sized, a nested and a disjoint rectangle
+		const std::vector<Rectangle> rectangles{
+			Rectangle{value(3), value(4), value(5), value(6)},
+			Rectangle{value(-7), value(2), value(12), value(1)},
+			Rectangle{value(0), value(-9), value(2), value(30)},
+			Rectangle{value(20), value(20), value(0), value(0)},
+			Rectangle{value(4), value(5), value(2), value(2)},
+			Rectangle{value(10), value(-3), value(15), value(4)}};
+
+		SECTION("Conversion")
+		{
+			const RectangleLTRB ltrb{value(-1), value(2), value(3), value(7)};
+			REQUIRE(ltrb.Left() == value(-1));
+			REQUIRE(ltrb.Top() == value(2));
+			REQUIRE(ltrb.Right() == value(3));
+			REQUIRE(ltrb.Bottom() == value(7));
+			REQUIRE(ltrb.Width() == value(4));
+			REQUIRE(ltrb.Height() == value(5));
+			REQUIRE(ltrb.LeftTop() == Point{value(-1), value(2)});
+			REQUIRE(ltrb.RightBottom() == Point{value(3), value(7)});
+			REQUIRE(ltrb == RectangleLTRB{Point{value(-1), value(2)}, Point{value(3), value(7)}});
+			REQUIRE(ltrb.ToRectangle() == Rectangle{value(-1), value(2), value(4), value(5)});
+
+			for (const auto& rectangle : rectangles)
+			{
+				REQUIRE(RectangleLTRB{rectangle}.ToRectangle() == rectangle);
+				REQUIRE(IsEmpty(RectangleLTRB{rectangle}) == IsEmpty(rectangle));
+			}
+		}
+
+		SECTION("Translate()")
+		{
+			const Point offset{value(-3), value(8)};
+			for (const auto& rectangle : rectangles)
+			{
+				const auto expected = saber::geometry::Translate(rectangle, offset);
+				REQUIRE(saber::geometry::Translate(RectangleLTRB{rectangle}, offset).ToRectangle() == expected);
+				REQUIRE(RectangleLTRB{rectangle}.Translate(value(-3), value(8)).ToRectangle() == expected);
+			}
+		}
+
+		SECTION("Union(), Intersect(), IsOverlapping() and Contains()")
+		{
+			for (const auto& lhs : rectangles)
+			{
+				for (const auto& rhs : rectangles)
+				{
+					const RectangleLTRB lhsLTRB{lhs};
+					const RectangleLTRB rhsLTRB{rhs};
+					REQUIRE(Union(lhsLTRB, rhsLTRB).ToRectangle() == Union(lhs, rhs));
+
+					// Empty intersections may differ in (non positive) size; both are empty
+					const auto intersection = Intersect(lhs, rhs);
+					const auto intersectionLTRB = Intersect(lhsLTRB, rhsLTRB);
+					REQUIRE(IsEmpty(intersectionLTRB) == IsEmpty(intersection));
+					if (!IsEmpty(intersection))
+					{
+						REQUIRE(intersectionLTRB.ToRectangle() == intersection);
+					}
+					REQUIRE(intersectionLTRB.Width() >= value(0));
+					REQUIRE(intersectionLTRB.Height() >= value(0));
+
+					REQUIRE(IsOverlapping(lhsLTRB, rhsLTRB) == IsOverlapping(lhs, rhs));
+					REQUIRE(Contains(lhsLTRB, rhsLTRB) == Contains(lhs, rhs));
+				}
+			}
+		}
+
+		SECTION("IsOverlapping() point")
+		{
+			const std::vector<Point> points{
+				Point{value(3), value(4)},
+				Point{value(8), value(10)},
+				Point{value(7), value(9)},
+				Point{value(-7), value(2)},
+				Point{value(1), value(20)},
+				Point{value(24), value(0)}};
+			for (const auto& rectangle : rectangles)
+			{
+				for (const auto& point : points)
+				{
+					REQUIRE(IsOverlapping(RectangleLTRB{rectangle}, point) == IsOverlapping(rectangle, point));
+				}
+			}
+		}
+
+		SECTION("Chained clip rectangles")
+		{
+			// Clip stack: each level intersects its parent; compare against the Rectangle chain
+			auto clip = Rectangle{value(-10), value(-10), value(40), value(40)};
+			RectangleLTRB clipLTRB{clip};
+			for (const auto& rectangle : rectangles)
+			{
+				clip.Intersect(saber::geometry::Translate(rectangle, value(1), value(1)).Union(rectangle));
+				clipLTRB.Intersect(RectangleLTRB{rectangle}.Translate(value(1), value(1)).Union(RectangleLTRB{rectangle}));
+				REQUIRE(IsEmpty(clipLTRB) == IsEmpty(clip));
+			}
+		}
+	};
+
+	SECTION("ImplKind::kScalar")
+	{
+		test(std::integral_constant<ImplKind, ImplKind::kScalar>{});
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		test(std::integral_constant<ImplKind, ImplKind::kSimd>{});
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry ClipSegments() clips line segments to a rectangle - impl variants",
+                    "[saber][geometry][rectangle]",
+                    float, double)
+{
+	auto test = [](auto inImplKind)
+	{
+		constexpr ImplKind kImpl = decltype(inImplKind)::value;
+		using Point = saber::geometry::Point<TestType, kImpl>;
+		using Rectangle = saber::geometry::Rectangle<TestType, kImpl>;
+		const auto value = [](double inValue) { return static_cast<TestType>(inValue); };
+		const Rectangle clip{value(0), value(0), value(10), value(10)};
+
+		SECTION("Accept, reject and clip")
+		{
+			// Segments (pairs of points); with parallel, point and on edge segments, 9 segments: not a multiple of 4
+			std::vector<Point> points{
+				Point{value(1), value(1)}, Point{value(9), value(8)},		// 0: inside
+				Point{value(-5), value(5)}, Point{value(15), value(5)},		// 1: horizontal, crosses both sides
+				Point{value(-5), value(-5)}, Point{value(15), value(15)},	// 2: diagonal, crosses both corners
+				Point{value(20), value(1)}, Point{value(30), value(9)},		// 3: right of the rectangle
+				Point{value(5), value(20)}, Point{value(5), value(12)},		// 4: vertical, below the rectangle
+				Point{value(5), value(5)}, Point{value(5), value(5)},		// 5: point inside
+				Point{value(0), value(-3)}, Point{value(0), value(4)},		// 6: vertical, on the left edge
+				Point{value(5), value(-5)}, Point{value(5), value(5)},		// 7: vertical, enters the top edge
+				Point{value(-4), value(8)}, Point{value(8), value(-4)}};	// 8: diagonal, cuts the top left corner
+			const std::vector<Point> expected{
+				Point{value(1), value(1)}, Point{value(9), value(8)},
+				Point{value(0), value(5)}, Point{value(10), value(5)},
+				Point{value(0), value(0)}, Point{value(10), value(10)},
+				Point{}, Point{},
+				Point{}, Point{},
+				Point{value(5), value(5)}, Point{value(5), value(5)},
+				Point{value(0), value(0)}, Point{value(0), value(4)},
+				Point{value(5), value(0)}, Point{value(5), value(5)},
+				Point{value(0), value(4)}, Point{value(4), value(0)}};
+			constexpr std::uint32_t kExpectedMask = 0b111100111;
+
+			std::vector<Point> clipped(points.size());
+			std::uint32_t acceptMask = ~std::uint32_t{0};
+			const auto acceptCount = saber::geometry::ClipSegments(clip, points.data(), clipped.data(), points.size() / 2, &acceptMask);
+			REQUIRE(acceptMask == kExpectedMask);
+			REQUIRE(acceptCount == 7);
+			for (std::size_t i = 0; i < points.size(); ++i)
+			{
+				if ((kExpectedMask >> (i / 2)) & 1)
+				{
+					REQUIRE(clipped[i] == expected[i]);
+				}
+			}
+
+			// In place
+			REQUIRE(saber::geometry::ClipSegments(clip, points.data(), points.data(), points.size() / 2, &acceptMask) == 7);
+			REQUIRE(points[2] == expected[2]);
+			REQUIRE(points[17] == expected[17]);
+		}
+
+		SECTION("Matches scalar for every batch size")
+		{
+			// 70 segments: more than two mask words, and a partial group of 4
+			std::vector<Point> points;
+			for (int i = 0; i < 140; ++i)
+			{
+				points.emplace_back(value(((i * 7) % 31) - 10), value(((i * 13) % 29) - 9));
+			}
+
+			// Segments grazing the corner {10, 0}: their tEnter and tExit are only "inexactly" equal
+			points[2] = Point{value(25.6650734), value(18.2913189)};
+			points[3] = Point{value(7.02363634), value(-3.47535062)};
+			for (int i = 1; i < 12; ++i)
+			{
+				const TestType x = value(0.37 * i + 0.1);
+				const TestType y = value(0.53 * i + 0.3);
+				points[4 * i + 2] = Point{value(10) + x, y};
+				points[4 * i + 3] = Point{value(10) - value(1.3) * x, value(-1.3) * y};
+			}
+
+			using ScalarPoint = saber::geometry::Point<TestType, ImplKind::kScalar>;
+			std::vector<ScalarPoint> scalarPoints;
+			for (const auto& point : points)
+			{
+				scalarPoints.emplace_back(point.X(), point.Y());
+			}
+			const saber::geometry::Rectangle<TestType, ImplKind::kScalar> scalarClip{clip.X(), clip.Y(), clip.Width(), clip.Height()};
+
+			for (std::size_t count : {std::size_t{0}, std::size_t{1}, std::size_t{4}, std::size_t{5}, std::size_t{33}, std::size_t{70}})
+			{
+				std::vector<Point> clipped(2 * count);
+				std::vector<ScalarPoint> expected(2 * count);
+				std::vector<std::uint32_t> acceptMask((count + 31) / 32);
+				std::vector<std::uint32_t> expectedMask((count + 31) / 32);
+				const auto acceptCount = saber::geometry::ClipSegments(clip, points.data(), clipped.data(), count, acceptMask.data());
+				const auto expectedCount = saber::geometry::ClipSegments(scalarClip, scalarPoints.data(), expected.data(), count, expectedMask.data());
+				REQUIRE(acceptCount == expectedCount);
+				REQUIRE(acceptMask == expectedMask);
+
+				int mismatchCount = 0;
+				for (std::size_t i = 0; i < 2 * count; ++i)
+				{
+					const bool isAccepted = (expectedMask[i / 64] >> ((i / 2) % 32)) & 1;
+					const bool isEqual = Inexact::IsEq(clipped[i].X(), expected[i].X()) && Inexact::IsEq(clipped[i].Y(), expected[i].Y());
+					mismatchCount += static_cast<int>(isAccepted && !isEqual);
+				}
+				REQUIRE(mismatchCount == 0);
+			}
+		}
+	};
+
+	SECTION("ImplKind::kScalar")
+	{
+		test(std::integral_constant<ImplKind, ImplKind::kScalar>{});
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		test(std::integral_constant<ImplKind, ImplKind::kSimd>{});
+	}
+}
+
+TEMPLATE_TEST_CASE( "saber::geometry RectanglePacker packs rectangles without overlap - impl variants",
+                    "[saber][geometry][rectangle]",
+                    int, std::int16_t)
+{
+	auto test = [](auto inImplKind)
+	{
+		constexpr ImplKind kImpl = decltype(inImplKind)::value;
+		using Rectangle = saber::geometry::Rectangle<TestType, kImpl>;
+		using RectanglePacker = saber::geometry::RectanglePacker<TestType, kImpl>;
+		using saber::geometry::PackKind;
+		const auto value = [](int inValue) { return static_cast<TestType>(inValue); };
+
+		const auto isPackedWithoutOverlap = [](const RectanglePacker& inPacker, const std::vector<Rectangle>& inPlaced)
+		{
+			const Rectangle bounds{0, 0, inPacker.Width(), inPacker.Height()};
+			for (std::size_t i = 0; i < inPlaced.size(); ++i)
+			{
+				if (saber::geometry::Union(bounds, inPlaced[i]) != bounds)
+				{
+					return false;
+				}
+				for (std::size_t j = i + 1; j < inPlaced.size(); ++j)
+				{
+					if (!IsEmpty(saber::geometry::Intersect(inPlaced[i], inPlaced[j])))
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		};
+
+		for (const auto kind : {PackKind::kMaxRects, PackKind::kSkyline})
+		{
+			SECTION(kind == PackKind::kMaxRects ? "kMaxRects" : "kSkyline")
+			{
+				RectanglePacker packer{value(128), value(128), kind};
+				REQUIRE(packer.Kind() == kind);
+
+				// Mixed sizes until full
+				std::vector<Rectangle> placed;
+				for (int i = 0; i < 400; ++i)
+				{
+					const auto rectangle = packer.Insert(value(3 + (i * 7) % 13), value(2 + (i * 5) % 11));
+					if (rectangle.has_value())
+					{
+						REQUIRE(rectangle->Width() == value(3 + (i * 7) % 13));
+						REQUIRE(rectangle->Height() == value(2 + (i * 5) % 11));
+						placed.push_back(*rectangle);
+					}
+				}
+				REQUIRE(placed.size() > 150);
+				REQUIRE(isPackedWithoutOverlap(packer, placed));
+				REQUIRE(packer.Occupancy() > 0.75);
+				REQUIRE_FALSE(packer.Insert(value(129), value(1)).has_value());
+
+				// Freed space is reused
+				const auto occupancy = packer.Occupancy();
+				for (std::size_t i = 0; i < placed.size(); i += 2)
+				{
+					packer.Free(placed[i]);
+				}
+				REQUIRE(packer.Occupancy() < occupancy);
+				std::vector<Rectangle> kept;
+				for (std::size_t i = 1; i < placed.size(); i += 2)
+				{
+					kept.push_back(placed[i]);
+				}
+				const auto reused = packer.Insert(placed[0].Width(), placed[0].Height());
+				REQUIRE(reused.has_value());
+				kept.push_back(*reused);
+				REQUIRE(isPackedWithoutOverlap(packer, kept));
+
+				// Freeing everything empties the packer
+				for (const auto& rectangle : kept)
+				{
+					packer.Free(rectangle);
+				}
+				REQUIRE(packer.Occupancy() == 0.0);
+				const auto whole = packer.Insert(value(128), value(128));
+				REQUIRE(whole.has_value());
+				REQUIRE(*whole == Rectangle{0, 0, value(128), value(128)});
+				REQUIRE_FALSE(packer.Insert(value(1), value(1)).has_value());
+			}
+		}
+
+		SECTION("Matches scalar placements")
+		{
+			for (const auto kind : {PackKind::kMaxRects, PackKind::kSkyline})
+			{
+				RectanglePacker packer{value(256), value(256), kind};
+				saber::geometry::RectanglePacker<TestType, ImplKind::kScalar> scalarPacker{value(256), value(256), kind};
+				int mismatchCount = 0;
+				for (int i = 0; i < 300; ++i)
+				{
+					const auto rectangle = packer.Insert(value(1 + (i * 11) % 17), value(1 + (i * 3) % 19));
+					const auto expected = scalarPacker.Insert(value(1 + (i * 11) % 17), value(1 + (i * 3) % 19));
+					const bool isEqual = (rectangle.has_value() == expected.has_value())
+						&& (!rectangle.has_value() || ((rectangle->X() == expected->X()) && (rectangle->Y() == expected->Y())));
+					mismatchCount += static_cast<int>(!isEqual);
+				}
+				REQUIRE(mismatchCount == 0);
+				REQUIRE(packer.FreeCount() == scalarPacker.FreeCount());
+			}
+		}
+
+		SECTION("Invalid arguments")
+		{
+			RectanglePacker packer{saber::geometry::Size<TestType, kImpl>{value(16), value(16)}};
+			REQUIRE(packer.Kind() == PackKind::kMaxRects);
+			REQUIRE_THROWS_AS(packer.Insert(value(0), value(4)), saber::Exception);
+			REQUIRE_THROWS_AS(packer.Free(Rectangle{value(8), value(8), value(16), value(16)}), saber::Exception);
+		}
+	};
+
+	SECTION("ImplKind::kScalar")
+	{
+		test(std::integral_constant<ImplKind, ImplKind::kScalar>{});
+	}
+
+	SECTION("ImplKind::kSimd")
+	{
+		test(std::integral_constant<ImplKind, ImplKind::kSimd>{});
+	}
+}
+
 // End of geometry_unittest2.cpp
\ No newline at end of file
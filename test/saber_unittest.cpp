@@ -25,13 +25,21 @@
 #include "saber/exception.hpp"
 #include "saber/hash.hpp"
 #include "saber/inexact.hpp"
-#include "saber/event/event_manager.hpp"
+#include "saber/memory.hpp"
+#include "saber/thread_pool.hpp"
+#include "saber/events/event_manager.hpp"
 
 // std
+#include <atomic>
+#include <cstdint>
 #include <cstdio>
+#include <limits>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 using namespace saber;
 TEST_CASE(	"saber::Exception and macros (REQUIRE, ENSURE, ASSERT)",
@@ -240,3 +248,158 @@ TEMPLATE_TEST_CASE(	"saber::Inexact floating point comparisons",
 	}
 }
 
+TEST_CASE(	"saber::AlignedAllocator<> storage alignment",
+			"[saber][memory]")
+{
+	auto isAligned = [](const void* inAddr, std::size_t inAlignment)
+	{
+		return (reinterpret_cast<std::uintptr_t>(inAddr) % inAlignment) == 0;
+	};
+
+	SECTION("std::vector storage is aligned")
+	{
+		for (std::size_t size = 1; size < 32; ++size)
+		{
+			std::vector<float, saber::AlignedAllocator<float, 16>> vec16(size);
+			std::vector<double, saber::AlignedAllocator<double, 64>> vec64(size);
+			REQUIRE(isAligned(vec16.data(), 16));
+			REQUIRE(isAligned(vec64.data(), 64));
+		}
+	}
+
+	SECTION("Alignment is never less than alignof(T)")
+	{
+		REQUIRE(saber::AlignedAllocator<char, 16>::kAlignment == 16);
+		REQUIRE(saber::AlignedAllocator<double, 1>::kAlignment == alignof(double));
+	}
+
+	SECTION("Rebind preserves alignment")
+	{
+		using Rebind = std::allocator_traits<saber::AlignedAllocator<float, 32>>::rebind_alloc<int>;
+		REQUIRE(std::is_same_v<Rebind, saber::AlignedAllocator<int, 32>>);
+
+		saber::AlignedAllocator<float, 32> floatAlloc{};
+		Rebind intAlloc{floatAlloc};
+		REQUIRE(intAlloc == floatAlloc);
+
+		int* storage = intAlloc.allocate(7);
+		REQUIRE(isAligned(storage, 32));
+		intAlloc.deallocate(storage, 7);
+	}
+
+	SECTION("Oversized allocation throws")
+	{
+		saber::AlignedAllocator<double, 16> alloc{};
+		REQUIRE_THROWS_AS(alloc.allocate(std::numeric_limits<std::size_t>::max()), std::bad_array_new_length);
+	}
+}
+
+TEST_CASE(	"saber::ThreadPool runs every task exactly once",
+			"[saber][thread_pool]")
+{
+	// With no worker threads, the waiting thread runs every task itself
+	const std::vector<std::size_t> threadCounts{0, 1, 4};
+
+	SECTION("Submit() and Wait()")
+	{
+		for (auto threadCount : threadCounts)
+		{
+			saber::ThreadPool pool{threadCount};
+			REQUIRE(pool.ThreadCount() == threadCount);
+
+			std::atomic<int> sum{0};
+			for (int i = 1; i <= 100; ++i)
+			{
+				pool.Submit([&sum, i]() { sum += i; });
+			}
+			pool.Wait();
+			REQUIRE(sum.load() == 5050);
+
+			// Tasks submitting tasks
+			for (int i = 0; i < 10; ++i)
+			{
+				pool.Submit([&pool, &sum]()
+				{
+					pool.Submit([&sum]() { sum -= 1; });
+				});
+			}
+			pool.Wait();
+			REQUIRE(sum.load() == 5040);
+		}
+	}
+
+	SECTION("ParallelFor() covers every index in fixed ranges")
+	{
+		for (auto threadCount : threadCounts)
+		{
+			saber::ThreadPool pool{threadCount};
+
+			constexpr std::size_t kCount = 1001;
+			std::vector<int> visits(kCount, 0);
+			std::vector<std::size_t> begins(kCount, kCount);
+			std::vector<std::size_t> ends(kCount, 0);
+			pool.ParallelFor(kCount, 64, [&](std::size_t inBegin, std::size_t inEnd)
+			{
+				for (std::size_t i = inBegin; i < inEnd; ++i)
+				{
+					visits[i]++;
+					begins[i] = inBegin;
+					ends[i] = inEnd;
+				}
+			});
+			for (std::size_t i = 0; i < kCount; ++i)
+			{
+				REQUIRE(visits[i] == 1);
+				REQUIRE(begins[i] == i - (i % 64));
+				REQUIRE(ends[i] == std::min<std::size_t>(begins[i] + 64, kCount));
+			}
+
+			bool isCalled = false;
+			pool.ParallelFor(0, 64, [&isCalled](std::size_t, std::size_t) { isCalled = true; });
+			REQUIRE_FALSE(isCalled);
+		}
+	}
+
+	SECTION("ParallelFor() nested inside pool tasks")
+	{
+		for (auto threadCount : threadCounts)
+		{
+			saber::ThreadPool pool{threadCount};
+
+			std::atomic<std::size_t> sum{0};
+			for (int i = 0; i < 8; ++i)
+			{
+				pool.Submit([&pool, &sum]()
+				{
+					pool.ParallelFor(100, 7, [&sum](std::size_t inBegin, std::size_t inEnd)
+					{
+						sum += inEnd - inBegin;
+					});
+				});
+			}
+			pool.Wait();
+			REQUIRE(sum.load() == 800);
+		}
+	}
+
+	SECTION("Exceptions propagate to the waiting thread")
+	{
+		for (auto threadCount : threadCounts)
+		{
+			saber::ThreadPool pool{threadCount};
+
+			pool.Submit([]() { throw std::runtime_error{"Submit"}; });
+			REQUIRE_THROWS_AS(pool.Wait(), std::runtime_error);
+			REQUIRE_NOTHROW(pool.Wait());
+
+			auto throwing = [](std::size_t inBegin, std::size_t)
+			{
+				if (inBegin == 50)
+				{
+					throw std::runtime_error{"ParallelFor"};
+				}
+			};
+			REQUIRE_THROWS_AS(pool.ParallelFor(100, 10, throwing), std::runtime_error);
+		}
+	}
+}